@@ -20,13 +20,16 @@ public:
 
 	/**
 		\brief Loads an asset (geometries, materials textures) from a file
+		\param lodCount The maximum number of the simplified levels of detail of every geometry,
+		generated at the loading
 		\return The scene node representing the asset if it was loaded successfully,
 		nullptr otherwise
 	*/
 	virtual SceneNode* loadAsset(
 		const char* filePath,
 		const AssetMaterialFactory* materialCreator,
-		bool loadTextures) noexcept = 0;
+		bool loadTextures,
+		u32 lodCount = 0) noexcept = 0;
 };
 
 // Global functions
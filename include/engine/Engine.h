@@ -13,6 +13,33 @@
 
 namespace gltut
 {
+// Global types
+/// The graphics backend of the engine
+enum class EngineBackend
+{
+	/// OpenGL rendering to a native window, currently only for Windows OS
+	OPENGL,
+	/**
+		\brief Offscreen OpenGL 3.3 rendering without a native window, via EGL.
+		The window framebuffer is replaced by an offscreen framebuffer
+		of the window size.
+	*/
+	OPENGL_HEADLESS,
+	/**
+		\brief Device without rendering and a native window,
+		which only counts the calls made to it.
+		Used for CPU-side benchmarking and testing of the renderer.
+		\see GraphicsDevice::getCallCounters
+	*/
+	NULL_DEVICE,
+	/**
+		\brief Multithreaded tile-based software rasterizer without a native window.
+		Supports the shaders created by the engine factories only.
+		\see Framebuffer::readColor
+	*/
+	SOFTWARE
+};
+
 // Global classes
 /**
 	\brief The main engine interface.
@@ -55,10 +82,16 @@ public:
 // Global functions
 /**
 	\brief Creates the engine instance
+	\param windowWidth The window width, or the offscreen framebuffer width
+	\param windowHeight The window height, or the offscreen framebuffer height
+	\param backend The graphics backend
 	\return The engine if it was created successfully, nullptr otherwise
 	\note The caller is responsible for deleting the instance
 */
-Engine* createEngine(u32 windowWidth, u32 windowHeight) noexcept;
+Engine* createEngine(
+	u32 windowWidth,
+	u32 windowHeight,
+	EngineBackend backend = EngineBackend::OPENGL) noexcept;
 
 /// \todo Add deleteEngine function
 
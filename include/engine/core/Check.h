@@ -6,6 +6,7 @@
 
 // Includes
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <stdexcept>
 
@@ -0,0 +1,136 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/core/Types.h"
+
+// Macros
+/// Define GLTUT_PROFILING as 0 to compile out the CPU profiling zones
+#ifndef GLTUT_PROFILING
+#define GLTUT_PROFILING 1
+#endif
+
+/// Concatenates two tokens after their expansion
+#define GLTUT_PROFILE_CONCAT_IMPL(a, b) a##b
+#define GLTUT_PROFILE_CONCAT(a, b) GLTUT_PROFILE_CONCAT_IMPL(a, b)
+
+#if GLTUT_PROFILING
+/// Measures the CPU time until the end of the scope, the name must be a string literal
+#define GLTUT_PROFILE_ZONE(name)\
+const gltut::CpuProfileScope GLTUT_PROFILE_CONCAT(gltutProfileZone, __LINE__)(name, false)
+
+/// Measures the CPU time until the end of the scope, the name is copied
+#define GLTUT_PROFILE_ZONE_DYNAMIC(name)\
+const gltut::CpuProfileScope GLTUT_PROFILE_CONCAT(gltutProfileZone, __LINE__)(name, true)
+
+/// Names the calling thread in the trace
+#define GLTUT_PROFILE_THREAD(name) gltut::getCpuProfiler()->setThreadName(name)
+#else
+#define GLTUT_PROFILE_ZONE(name) ((void)0)
+#define GLTUT_PROFILE_ZONE_DYNAMIC(name) ((void)0)
+#define GLTUT_PROFILE_THREAD(name) ((void)0)
+#endif
+
+namespace gltut
+{
+// Global classes
+/// The summary of the executions of a zone in a frame
+struct CpuProfileZone
+{
+	/// The zone name
+	const char* name = nullptr;
+
+	/// The number of the executions
+	u32 count = 0;
+
+	/// The total time of the executions, in milliseconds
+	float time = 0.0f;
+
+	/// The maximum time of an execution, in milliseconds
+	float maxTime = 0.0f;
+};
+
+/**
+	\brief The CPU profiler.
+	The zones are recorded by the threads into their own lock-free ring buffers
+	and collected at the end of every frame, the zones of a full buffer are dropped.
+	The profiling is disabled by default, a disabled zone costs an atomic load
+*/
+class CpuProfiler
+{
+public:
+	/// Virtual destructor
+	virtual ~CpuProfiler() noexcept = default;
+
+	/// Enables or disables the profiling, the recorded zones are cleared on enabling
+	virtual void setEnabled(bool enabled) noexcept = 0;
+
+	/// Returns if the profiling is enabled
+	virtual bool isEnabled() const noexcept = 0;
+
+	/// Names the calling thread in the trace
+	virtual void setThreadName(const char* name) noexcept = 0;
+
+	/**
+		\brief Ends a frame: collects the zones recorded by the threads
+		and updates the frame summary. Called by the engine update
+	*/
+	virtual void endFrame() noexcept = 0;
+
+	/// Returns the time of the last frame, in milliseconds
+	virtual float getFrameTime() const noexcept = 0;
+
+	/// Returns the number of the zones executed in the last frame
+	virtual u32 getZoneCount() const noexcept = 0;
+
+	/**
+		\brief Returns the summary of the i-th zone of the last frame, the zones are sorted by the time.
+		\return The zone or nullptr if the index is out of range
+	*/
+	virtual const CpuProfileZone* getZone(u32 index) const noexcept = 0;
+
+	/// Returns the number of the zones dropped since the profiling is enabled
+	virtual u64 getDroppedZoneCount() const noexcept = 0;
+
+	/**
+		\brief Saves the zones of the recent frames to a Chrome trace event JSON file,
+		viewable in chrome://tracing or Perfetto
+		\return true if the file is saved
+	*/
+	virtual bool saveChromeTrace(const char* path) const noexcept = 0;
+};
+
+/// Measures the CPU time of a scope, used by the profiling zone macros
+class CpuProfileScope
+{
+public:
+	/**
+		\brief Constructor
+		\param name The zone name
+		\param copyName If the name is copied, otherwise it must be a string literal
+	*/
+	CpuProfileScope(const char* name, bool copyName) noexcept;
+
+	/// Destructor, records the zone
+	~CpuProfileScope() noexcept;
+
+	CpuProfileScope(const CpuProfileScope&) = delete;
+	CpuProfileScope& operator=(const CpuProfileScope&) = delete;
+
+private:
+	/// The zone name, nullptr if the profiling is disabled
+	const char* mName;
+
+	/// The start time in nanoseconds
+	u64 mStart = 0;
+};
+
+// Global functions
+/// Returns the CPU profiler shared by all the threads
+CpuProfiler* getCpuProfiler() noexcept;
+
+// End of the namespace gltut
+}
@@ -24,11 +24,29 @@ public:
 	virtual FlatColorMaterialModel* createFlatColorMaterial(
 		bool castShadows = true) noexcept = 0;
 
-	/// Creates a Phong shader
+	/**
+		\brief Creates a Phong shader
+		\param textureAccess The requested access of the material textures,
+		falls back to a supported one
+	*/
 	virtual PhongShaderModel* createPhongShader(
 		u32 maxDirectionalLights,
 		u32 maxPointLights,
-		u32 maxSpotLights) noexcept = 0;
+		u32 maxSpotLights,
+		PhongShaderModel::TextureAccess textureAccess = PhongShaderModel::TextureAccess::SLOTS) noexcept = 0;
+
+	/**
+		\brief Creates a Phong shader shading the point and spot lights through the light clusters
+		of the active camera, the clusters are shared by the clustered Phong shaders.
+		The spot lights cast no shadows. The lights should be attenuated:
+		the influence of a light without attenuation is limited to the far plane distance of the camera,
+		so it takes a place in most clusters
+		\param textureAccess The requested access of the material textures,
+		falls back to a supported one
+	*/
+	virtual PhongShaderModel* createClusteredPhongShader(
+		u32 maxDirectionalLights,
+		PhongShaderModel::TextureAccess textureAccess = PhongShaderModel::TextureAccess::SLOTS) noexcept = 0;
 
 	/// Creates a Phong material model
 	virtual PhongMaterialModel* createPhongMaterial(
@@ -0,0 +1,87 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/graphics/shader/ShaderUniformBuffer.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief The point and spot lights of the scene binned into the clusters of the active camera.
+	The view frustum of the camera is divided into the clusters: the screen tiles
+	by the exponential slices of the view depth. Every frame the lights are packed
+	into the lights uniform buffer and binned by their spheres of influence
+	into the light lists of the clusters, so a fragment shades only the lights of its cluster.
+	The influence radius of a light is the distance where its attenuated diffuse and specular colors
+	fall below INTENSITY_CUTOFF. The ambient colors are not attenuated, so they are summed for all the lights
+*/
+class LightClusters
+{
+public:
+	/// The number of the clusters along the screen width
+	static constexpr u32 CLUSTER_COUNT_X = 16;
+
+	/// The number of the clusters along the screen height
+	static constexpr u32 CLUSTER_COUNT_Y = 9;
+
+	/// The upper limit of the number of the clusters along the view depth, lowered by the device uniform block size
+	static constexpr u32 CLUSTER_COUNT_Z = 24;
+
+	/// The upper limit of the total number of the clusters
+	static constexpr u32 CLUSTER_COUNT = CLUSTER_COUNT_X * CLUSTER_COUNT_Y * CLUSTER_COUNT_Z;
+
+	/// The upper limit of the number of the clustered lights, lowered by the device uniform block size
+	static constexpr u32 MAX_LIGHTS = 1024;
+
+	/// The upper limit of the total number of the lights in the cluster lists, lowered by the device uniform block size
+	static constexpr u32 MAX_LIGHT_INDICES = 24576;
+
+	/// The attenuated light intensity below which a light is not shaded
+	static constexpr float INTENSITY_CUTOFF = 1.0f / 256.0f;
+
+	/// The uniform buffer binding point of the lights buffer
+	static constexpr u32 LIGHTS_BUFFER_BINDING_POINT = 3;
+
+	/// The uniform buffer binding point of the clusters buffer
+	static constexpr u32 CLUSTERS_BUFFER_BINDING_POINT = 4;
+
+	/// Virtual destructor
+	virtual ~LightClusters() noexcept = default;
+
+	/// Returns the uniform buffer of the packed lights, the std140 block ClusteredLights
+	virtual const ShaderUniformBuffer* getLightsBuffer() const noexcept = 0;
+
+	/// Returns the uniform buffer of the cluster light lists, the std140 block LightClusters
+	virtual const ShaderUniformBuffer* getClustersBuffer() const noexcept = 0;
+
+	/// Returns the number of the lights packed by the last update
+	virtual u32 getLightCount() const noexcept = 0;
+
+	/// Returns the number of the lights dropped by the last update
+	virtual u32 getDroppedLightCount() const noexcept = 0;
+
+	/// Returns the total number of the lights in the cluster lists of the last update
+	virtual u32 getLightIndexCount() const noexcept = 0;
+
+	/// Returns the number of the lights dropped from the cluster lists by the last update
+	virtual u32 getDroppedLightIndexCount() const noexcept = 0;
+
+	/// Returns the maximum number of the lights in a cluster of the last update
+	virtual u32 getMaxClusterLightCount() const noexcept = 0;
+
+	/// Returns the number of the clusters along the view depth, at most CLUSTER_COUNT_Z
+	virtual u32 getClusterCountZ() const noexcept = 0;
+
+	/// Returns the capacity of the lights buffer, the lights above are dropped
+	virtual u32 getLightCapacity() const noexcept = 0;
+
+	/// Returns the capacity of the cluster lists, the lights above are dropped
+	virtual u32 getLightIndexCapacity() const noexcept = 0;
+};
+
+// End of the namespace gltut
+}
@@ -5,6 +5,7 @@
 #pragma once
 
 // Includes
+#include "engine/factory/shader/LightClusters.h"
 #include "engine/renderer/shader/ShaderRendererBinding.h"
 
 namespace gltut
@@ -17,6 +18,25 @@ namespace gltut
 class PhongShaderModel
 {
 public:
+	/**
+		\brief The access of the material textures by the shader.
+		An unsupported access falls back to the arrays and then to the slots
+	*/
+	enum class TextureAccess
+	{
+		/// A texture slot per material texture
+		SLOTS,
+
+		/**
+			\brief The textures of the same size, format and sampling are layers of the shared arrays,
+			the layer indices are in the material parameter block
+		*/
+		ARRAYS,
+
+		/// The resident bindless texture handles are in the material parameter block
+		BINDLESS
+	};
+
 	// The number of texture slots used by the Phong shader
 	static constexpr u32 TEXTURE_SLOTS_COUNT = 4;
 
@@ -38,13 +58,22 @@ public:
 	/// Returns the shader renderer binding for the Phong shader
 	virtual ShaderRendererBinding* getShader() const noexcept = 0;
 
+	/// Returns the access of the material textures
+	virtual TextureAccess getTextureAccess() const noexcept = 0;
+
+	/**
+		\brief Returns the light clusters shaded by the shader
+		\return The clusters or nullptr if the shader loops over the point and spot lights
+	*/
+	virtual const LightClusters* getLightClusters() const noexcept = 0;
+
 	/// Returns the maximum number of directional lights
 	virtual u32 getMaxDirectionalLights() const noexcept = 0;
 
-	/// Returns the maximum number of point lights
+	/// Returns the maximum number of point lights, 0 for the clustered lights
 	virtual u32 getMaxPointLights() const noexcept = 0;
 
-	/// Returns the maximum number of spot lights
+	/// Returns the maximum number of spot lights, 0 for the clustered lights
 	virtual u32 getMaxSpotLights() const noexcept = 0;
 
 	/// Returns the minimum bias for the shadow map
@@ -11,9 +11,13 @@
 #include "engine/math/Color.h"
 #include "engine/math/Rectangle.h"
 
+#include "engine/graphics/GraphicsDeviceCallCounters.h"
+#include "engine/graphics/PipelineState.h"
 #include "engine/graphics/RenderModes.h"
 #include "engine/graphics/framebuffer/FramebufferManager.h"
 #include "engine/graphics/geometry/GeometryManager.h"
+#include "engine/graphics/query/OcclusionQueryPool.h"
+#include "engine/graphics/query/ProfilerQueryPool.h"
 #include "engine/graphics/shader/ShaderManager.h"
 #include "engine/graphics/shader/ShaderUniformBufferManager.h"
 #include "engine/graphics/texture/TextureManager.h"
@@ -54,11 +58,34 @@ public:
 	/// Binds a texture to a slot
 	virtual void bindTexture(const Texture* texture, u32 slot) noexcept = 0;
 
+	/// Returns if the device supports the 2D texture arrays, see TextureManager::createArray
+	virtual bool isTextureArraySupported() const noexcept = 0;
+
+	/// Returns if the device supports the bindless textures, see Texture::getBindlessHandle
+	virtual bool isBindlessTextureSupported() const noexcept = 0;
+
 	/// Binds a shader uniform buffer to a binding point
 	virtual void bindShaderUniformBuffer(
 		const ShaderUniformBuffer* buffer,
 		u32 bindingPoint) noexcept = 0;
 
+	/**
+		\brief Binds a range of a shader uniform buffer to a binding point
+		\param offset The range offset in bytes, a multiple of getShaderUniformBufferAlignment()
+		\param size The range size in bytes
+	*/
+	virtual void bindShaderUniformBufferRange(
+		const ShaderUniformBuffer* buffer,
+		u32 bindingPoint,
+		u32 offset,
+		u32 size) noexcept = 0;
+
+	/// Returns the alignment of the shader uniform buffer range offsets
+	virtual u32 getShaderUniformBufferAlignment() const noexcept = 0;
+
+	/// Returns the maximum size of a shader uniform block in bytes
+	virtual u32 getMaxShaderUniformBlockSize() const noexcept = 0;
+
 	/// Binds a framebuffer
 	virtual void bindFramebuffer(
 		Framebuffer* frameBuffer,
@@ -76,6 +103,12 @@ public:
 	/// Sets the depth function
 	virtual void setDepthTest(DepthTestMode mode) noexcept = 0;
 
+	/// Enables or disables the depth writes, the depth clearing is not affected
+	virtual void setDepthWrite(bool enabled) noexcept = 0;
+
+	/// Enables or disables the color writes, the color clearing is not affected
+	virtual void setColorWrite(bool enabled) noexcept = 0;
+
 	/**
 		\brief Sets the polygon fill mode
 
@@ -91,6 +124,38 @@ public:
 		PolygonFillMode mode,
 		float size = 1.0f,
 		bool enableSizeInShader = false) noexcept = 0;
+
+	/**
+		\brief Returns the immutable pipeline state equal to a state.
+		The equal states share one object, which lives as long as the device
+		\return The pipeline state or nullptr if it cannot be created
+	*/
+	virtual const PipelineState* getPipelineState(const PipelineState& state) noexcept = 0;
+
+	/// Returns the number of the pipeline states created by the device
+	virtual u32 getPipelineStateCount() const noexcept = 0;
+
+	/**
+		\brief Binds a pipeline state
+		\param state The state to bind
+		\param previous The bound state, only the differing parts are set.
+		nullptr if the bound state is unknown, then the whole state is set
+	*/
+	virtual void bindPipelineState(
+		const PipelineState& state,
+		const PipelineState* previous) noexcept = 0;
+
+	/// Returns the occlusion query pool, nullptr if the device does not support the occlusion queries
+	virtual OcclusionQueryPool* getOcclusionQueries() noexcept = 0;
+
+	/// Returns the profiler query pool, nullptr if the device does not support the timer queries
+	virtual ProfilerQueryPool* getProfilerQueries() noexcept = 0;
+
+	/**
+		\brief Returns the call counters of the device
+		\return The counters or nullptr if the device does not count the calls
+	*/
+	virtual GraphicsDeviceCallCounters* getCallCounters() noexcept = 0;
 };
 
 // End of the namespace gltut
@@ -0,0 +1,73 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/core/Types.h"
+
+namespace gltut
+{
+// Global classes
+/// Numbers of the calls made to a graphics device and its objects
+struct GraphicsDeviceCallCounters
+{
+	/// Framebuffer binds
+	u64 framebufferBinds = 0;
+
+	/// Render target clears
+	u64 clears = 0;
+
+	/// Shader binds
+	u64 shaderBinds = 0;
+
+	/// Shader parameter (uniform) sets, including uniform block binding points
+	u64 uniformSets = 0;
+
+	/// Shader uniform buffer binds
+	u64 uniformBufferBinds = 0;
+
+	/// Shader uniform buffer data updates
+	u64 uniformBufferUpdates = 0;
+
+	/// Bytes written to the shader uniform buffers, also counted by uploadedBytes
+	u64 uniformBufferBytes = 0;
+
+	/// Texture binds, including unbinds of texture slots
+	u64 textureBinds = 0;
+
+	/// Face culling, blending, depth test and polygon fill mode changes
+	u64 stateChanges = 0;
+
+	/// Draw calls
+	u64 drawCalls = 0;
+
+	/// Indices submitted with the draw calls
+	u64 drawnIndices = 0;
+
+	/// Occlusion queries issued
+	u64 occlusionQueries = 0;
+
+	/// Conditional renders started
+	u64 conditionalRenders = 0;
+
+	/// Bytes uploaded to geometries, textures and uniform buffers
+	u64 uploadedBytes = 0;
+
+	/**
+		\brief Calls dropped because they did not change the device state.
+		Counted by the devices with a state cache; the other counters
+		of such devices include only the calls passed to the graphics API
+	*/
+	u64 filteredCalls = 0;
+
+	/// Resets all the counters to 0
+	void reset() noexcept
+	{
+		*this = GraphicsDeviceCallCounters();
+	}
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,54 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/graphics/RenderModes.h"
+#include "engine/graphics/shader/Shader.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief The state of the graphics pipeline of a draw.
+	The equal states are deduplicated by the device into immutable pipeline state objects,
+	so the bound states are compared by pointers.
+	The vertex format is not a part of the state, it is bound with the geometries
+*/
+struct PipelineState
+{
+	/// The shader
+	const Shader* shader = nullptr;
+
+	/// If the blending is enabled
+	bool blending = false;
+
+	/// The face culling mode
+	FaceCullingMode faceCulling = FaceCullingMode::BACK;
+
+	/// The depth test
+	DepthTestMode depthTest = DepthTestMode::LESS;
+
+	/// If the depth writes are enabled
+	bool depthWrite = true;
+
+	/// If the color writes are enabled
+	bool colorWrite = true;
+
+	/// The polygon fill mode
+	PolygonFillMode polygonFill = PolygonFillMode::SOLID;
+
+	/// The size of the polygon outline, used by the LINE and the POINT fill modes
+	float polygonFillSize = 1.0f;
+
+	/// If the polygon fill size is passed to the shader, used by the POINT fill mode
+	bool polygonFillSizeInShader = false;
+
+	/// Checks if the states are equal
+	bool operator==(const PipelineState&) const noexcept = default;
+};
+
+// End of the namespace gltut
+}
@@ -23,6 +23,14 @@ public:
 
 	/// Binds the framebuffer as the current rendering target
 	virtual void bind() const noexcept = 0;
+
+	/**
+		\brief Reads the color content of the framebuffer
+		\param data The output buffer of 4 * width * height bytes.
+		The pixels are RGBA, 8 bits per channel, the rows go from the bottom to the top.
+		\return false if the framebuffer has no color or does not support reading
+	*/
+	virtual bool readColor(u8* data) const noexcept = 0;
 };
 
 // End of the namespace gltut
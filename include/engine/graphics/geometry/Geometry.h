@@ -6,19 +6,74 @@
 
 // Includes
 #include "engine/graphics/geometry/VertexFormat.h"
+#include "engine/math/Box3.h"
 
 namespace gltut
 {
+// Global classes
+/**
+	\brief Per-instance data of the instanced rendering.
+	Passed to the vertex shaders as the attributes
+	at Geometry::INSTANCE_TRANSFORM_LOCATION (mat4)
+	and Geometry::INSTANCE_NORMAL_MATRIX_LOCATION (mat3)
+*/
+struct GeometryInstance
+{
+	/// The model matrix
+	Matrix4 transform;
+
+	/// The normal matrix
+	Matrix3 normalMatrix;
+};
+
+static_assert(
+	sizeof(GeometryInstance) == 25 * sizeof(float),
+	"The geometry instance must be tightly packed");
 
 /// The class represents a geometry to render
 class Geometry
 {
 public:
+	/**
+		\brief The first attribute location of the instance model matrix, 4 locations.
+		The instanced geometries must have less vertex components than this value
+	*/
+	static constexpr u32 INSTANCE_TRANSFORM_LOCATION = 9;
+
+	/// The first attribute location of the instance normal matrix, 3 locations
+	static constexpr u32 INSTANCE_NORMAL_MATRIX_LOCATION = INSTANCE_TRANSFORM_LOCATION + 4;
+
 	/// Virtual destructor
 	virtual ~Geometry() noexcept = default;
 
 	/// Renders the geometry
 	virtual void render() const noexcept = 0;
+
+	/**
+		\brief Renders instances of the geometry with a single draw call.
+		The bound shader must read the instance attributes
+	*/
+	virtual void renderInstanced(
+		const GeometryInstance* instances,
+		u32 instanceCount) const noexcept = 0;
+
+	/// Returns the bounding box of the vertex positions in the local frame
+	virtual const Box3& getBounds() const noexcept = 0;
+
+	/**
+		\brief Returns the number of the levels of detail.
+		The level 0 is the geometry itself, the next levels have less triangles
+	*/
+	virtual u32 getLodCount() const noexcept = 0;
+
+	/// Returns a level of detail, nullptr if there is no such level
+	virtual const Geometry* getLod(u32 level) const noexcept = 0;
+
+	/**
+		\brief Returns the estimated maximum distance of a level of detail to the geometry surface.
+		The distance is in the units of the vertex positions, 0 for the level 0
+	*/
+	virtual float getLodError(u32 level) const noexcept = 0;
 };
 
 // End of the namespace gltut
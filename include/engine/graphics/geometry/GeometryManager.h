@@ -22,6 +22,22 @@ public:
 		const float* vertices,
 		u32 indexCount,
 		const u32* indices) noexcept = 0;
+
+	/**
+		\brief Creates a geometry with the levels of detail simplified from its mesh.
+		Every level has about lodReduction of the triangles of the previous one,
+		the levels stop early if the mesh cannot be simplified further
+		\param lodCount The maximum number of the levels after the level 0
+		\param lodReduction The ratio of the triangles of a level to the previous one, in (0, 1)
+	*/
+	virtual Geometry* createWithLods(
+		VertexFormat vertexFormat,
+		u32 vertexCount,
+		const float* vertices,
+		u32 indexCount,
+		const u32* indices,
+		u32 lodCount,
+		float lodReduction = 0.5f) noexcept = 0;
 };
 
 // End of the namespace gltut
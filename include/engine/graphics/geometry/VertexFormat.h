@@ -71,6 +71,12 @@ public:
 		return getTotalSize() * sizeof(float);
 	}
 
+	/// Checks if the formats are equal
+	bool operator==(const VertexFormat& other) const noexcept
+	{
+		return mFormat == other.mFormat;
+	}
+
 private:
 	/// Vertex component mask
 	static constexpr u64 VERTEX_COMPONENT_MASK = (1 << COMPONENT_STRIDE) - 1;
@@ -0,0 +1,65 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <optional>
+
+#include "engine/core/Types.h"
+#include "engine/math/Matrix4.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Pool of the occlusion queries of a graphics device.
+	A query tells if any sample of a box passes the depth test of the bound framebuffer.
+	The results are read without waiting, so they are usually available a frame or two later
+*/
+class OcclusionQueryPool
+{
+public:
+	/// Virtual destructor
+	virtual ~OcclusionQueryPool() noexcept = default;
+
+	/**
+		\brief Acquires a query, reusing the released ones
+		\return The query or 0 if no query can be created
+	*/
+	virtual u32 acquire() noexcept = 0;
+
+	/// Returns a query to the pool
+	virtual void release(u32 query) noexcept = 0;
+
+	/**
+		\brief Starts rendering the query boxes.
+		The boxes do not write the color and the depth and are not culled
+	*/
+	virtual void beginBoxes() noexcept = 0;
+
+	/**
+		\brief Renders a box into a query, between beginBoxes() and endBoxes()
+		\param transform The transform of the unit cube [0, 1]^3 to the clip space
+	*/
+	virtual void queryBox(u32 query, const Matrix4& transform) noexcept = 0;
+
+	/// Restores the state changed by beginBoxes()
+	virtual void endBoxes() noexcept = 0;
+
+	/// Returns if any sample of the query passed, std::nullopt if the result is not available yet
+	virtual std::optional<bool> getResult(u32 query) noexcept = 0;
+
+	/**
+		\brief Renders the next draws only if any sample of the query passed.
+		The draws are rendered if the result is not available when they are executed
+	*/
+	virtual void beginConditionalRender(u32 query) noexcept = 0;
+
+	/// Ends the conditional rendering
+	virtual void endConditionalRender() noexcept = 0;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,67 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <optional>
+
+#include "engine/core/Types.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Pool of the profiler queries of a graphics device.
+	A query measures the GPU time of the commands between begin() and end()
+	and, if the device supports the pipeline statistics, counts the processed vertices, primitives and fragments.
+	The queries cannot nest. The results are read without waiting,
+	so they are usually available a frame or two later
+*/
+class ProfilerQueryPool
+{
+public:
+	/// The result of a query
+	struct Result
+	{
+		/// The GPU time in nanoseconds
+		u64 time = 0;
+
+		/// The number of the submitted vertices, 0 without the pipeline statistics
+		u64 vertices = 0;
+
+		/// The number of the submitted primitives, 0 without the pipeline statistics
+		u64 primitives = 0;
+
+		/// The number of the fragment shader invocations, 0 without the pipeline statistics
+		u64 fragments = 0;
+	};
+
+	/// Virtual destructor
+	virtual ~ProfilerQueryPool() noexcept = default;
+
+	/// Returns if the queries count the vertices, the primitives and the fragments
+	virtual bool hasPipelineStatistics() const noexcept = 0;
+
+	/**
+		\brief Acquires a query, reusing the released ones
+		\return The query or 0 if no query can be created
+	*/
+	virtual u32 acquire() noexcept = 0;
+
+	/// Returns a query to the pool
+	virtual void release(u32 query) noexcept = 0;
+
+	/// Starts measuring the commands into a query
+	virtual void begin(u32 query) noexcept = 0;
+
+	/// Ends measuring the commands into the query started by begin()
+	virtual void end(u32 query) noexcept = 0;
+
+	/// Returns the result of a query, std::nullopt if it is not available yet
+	virtual std::optional<Result> getResult(u32 query) noexcept = 0;
+};
+
+// End of the namespace gltut
+}
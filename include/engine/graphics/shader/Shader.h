@@ -19,6 +19,20 @@ public:
 
 	/// Binds the shader
 	virtual void bind() const noexcept = 0;
+
+	/**
+		\brief Returns the size of a uniform block in bytes
+		\return The size or 0 if the shader has no such block or its layout is unknown
+	*/
+	virtual u32 getUniformBlockSize(const char* blockName) const noexcept = 0;
+
+	/**
+		\brief Returns the offset of a member of a uniform block in bytes
+		\return The offset or -1 if the block has no such member
+	*/
+	virtual int32 getUniformBlockMemberOffset(
+		const char* blockName,
+		const char* memberName) const noexcept = 0;
 };
 
 // End of the namespace gltut
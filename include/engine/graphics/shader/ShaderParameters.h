@@ -33,6 +33,9 @@ public:
 	/// Sets a 2D vector to a shader parameter
 	virtual void setVec2(int32 location, float x, float y) noexcept = 0;
 
+	/// Sets a 2D unsigned integer vector to a shader parameter
+	virtual void setUvec2(int32 location, u32 x, u32 y) noexcept = 0;
+
 	/// Sets a 3D vector to a shader parameter
 	virtual void setVec3(int32 location, float x, float y, float z) noexcept = 0;
 
@@ -82,6 +85,12 @@ public:
 		setVec2(getParameterLocationChecked(name), x, y);
 	}
 
+	/// Sets a 2D unsigned integer vector to a shader parameter
+	void setUvec2(const char* name, u32 x, u32 y) noexcept
+	{
+		setUvec2(getParameterLocationChecked(name), x, y);
+	}
+
 	/// Sets a 3D vector to a shader parameter
 	void setVec3(const char* name, float x, float y, float z) noexcept
 	{
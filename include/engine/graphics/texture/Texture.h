@@ -61,6 +61,13 @@ public:
 
 	/// Binds the texture
 	virtual void bind(u32 slot) const noexcept = 0;
+
+	/**
+		\brief Returns the bindless handle of the texture, making the texture resident.
+		The parameters of the texture must not change after its handle is created
+		\return The handle or 0 if the device does not support the bindless textures
+	*/
+	virtual u64 getBindlessHandle() const noexcept = 0;
 };
 
 // End of the namespace gltut
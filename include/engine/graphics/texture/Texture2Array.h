@@ -0,0 +1,41 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/graphics/texture/Texture2.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Represents an array of 2D textures of the same size and format.
+	The shaders sample the array as sampler2DArray with the layer index
+	as the third texture coordinate
+*/
+class Texture2Array : public Texture
+{
+public:
+	/// Returns the format of the layers
+	virtual TextureFormat getFormat() const noexcept = 0;
+
+	/// Returns the size of the layers
+	virtual const Point2u& getSize() const noexcept = 0;
+
+	/// Returns the number of the layers
+	virtual u32 getLayerCount() const noexcept = 0;
+
+	/// Sets the number of the layers, keeping the contents of the remaining layers
+	virtual void setLayerCount(u32 count) noexcept = 0;
+
+	/**
+		\brief Copies a 2D texture to a layer and updates the mipmaps.
+		The texture must have the size and the format of the layers
+	*/
+	virtual void setLayer(u32 layer, const Texture2& texture) noexcept = 0;
+};
+
+// End of the namespace gltut
+}
@@ -7,6 +7,7 @@
 // Includes
 #include "engine/core/ItemManager.h"
 #include "engine/graphics/texture/Texture2.h"
+#include "engine/graphics/texture/Texture2Array.h"
 #include "engine/graphics/texture/TextureCubemap.h"
 #include "engine/math/Color.h"
 
@@ -14,15 +15,18 @@ namespace gltut
 {
 
 // Global classes
+/// Parameters for loading a texture from a file
+struct TextureLoadParameters
+{
+	bool invertChannel[4] = {false, false, false, false};
+};
+
 /// Interface for texture management
 class TextureManager : public ItemManager<Texture>
 {
 public:
 	/// Parameters for loading a texture from a file
-	struct LoadParameters
-	{
-		bool invertChannel[4] = {false, false, false, false};
-	};
+	using LoadParameters = TextureLoadParameters;
 
 	/// Creates a texture with the given parameters
 	virtual Texture2* create(
@@ -46,6 +50,16 @@ public:
 		const TextureParameters& textureParameters = {},
 		const LoadParameters& loadParameters = {}) noexcept = 0;
 
+	/**
+		\brief Creates an array of 2D textures with undefined contents
+		\return The texture array or nullptr if the device does not support the texture arrays
+	*/
+	virtual Texture2Array* createArray(
+		const Point2u& size,
+		TextureFormat format,
+		u32 layerCount,
+		const TextureParameters& parameters = {}) noexcept = 0;
+
 	/// Creates a solid color texture
 	virtual const Texture2* createSolidColor(const Color& color) noexcept = 0;
 };
@@ -5,7 +5,10 @@
 #pragma once
 
 // Includes
+#include <algorithm>
+
 #include "engine/core/Check.h"
+#include "engine/core/Types.h"
 
 namespace gltut
 {
@@ -84,6 +87,23 @@ public:
 		return mMax - mMin;
 	}
 
+	/// Extends the AABB to contain a point
+	void extend(const PointType& point) noexcept
+	{
+		for (u32 i = 0; i < D; ++i)
+		{
+			mMin[i] = std::min(mMin[i], point[i]);
+			mMax[i] = std::max(mMax[i], point[i]);
+		}
+	}
+
+	/// Extends the AABB to contain another AABB
+	void extend(const AABB& box) noexcept
+	{
+		extend(box.mMin);
+		extend(box.mMax);
+	}
+
 private:
 	/// Checks if 2 points are valid for an AABB
 	static bool isValid(const PointType& min, const PointType& max) noexcept
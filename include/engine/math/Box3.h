@@ -0,0 +1,40 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/math/Aabb.h"
+#include "engine/math/Matrix4.h"
+
+namespace gltut
+{
+// Global classes
+/// Represents a 3D axis-aligned box
+using Box3 = AABB<3, Vector3>;
+
+// Global functions
+/**
+	\brief Returns the axis-aligned box containing a transformed box.
+	The transform is assumed to be affine
+*/
+inline Box3 transformBox(const Box3& box, const Matrix4& transform) noexcept
+{
+	const Vector3 center = (box.getMin() + box.getMax()) * 0.5f;
+	const Vector3 extent = box.getSize() * 0.5f;
+
+	const Vector3 transformedCenter = transform * center;
+	Vector3 transformedExtent;
+	for (u32 row = 0; row < 3; ++row)
+	{
+		for (u32 col = 0; col < 3; ++col)
+		{
+			transformedExtent[row] += std::abs(transform(row, col)) * extent[col];
+		}
+	}
+	return {transformedCenter - transformedExtent, transformedCenter + transformedExtent};
+}
+
+// End of the namespace gltut
+}
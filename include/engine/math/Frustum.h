@@ -0,0 +1,96 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <array>
+
+#include "engine/math/Box3.h"
+
+namespace gltut
+{
+// Global classes
+/// Represents a view frustum as 6 planes with the normals pointing inside
+class Frustum
+{
+public:
+	/// The position of a box relative to the frustum
+	enum class Containment
+	{
+		/// The box is completely outside the frustum
+		OUTSIDE,
+		/// The box intersects the frustum boundary
+		INTERSECTING,
+		/// The box is completely inside the frustum
+		INSIDE
+	};
+
+	/**
+		\brief Extracts the frustum planes from a projection * view matrix.
+		Assumes the OpenGL clip space, i.e. -w <= x, y, z <= w
+	*/
+	explicit Frustum(const Matrix4& projectionView) noexcept
+	{
+		for (u32 axis = 0; axis < 3; ++axis)
+		{
+			for (u32 side = 0; side < 2; ++side)
+			{
+				const float sign = side == 0 ? 1.0f : -1.0f;
+				Plane& plane = mPlanes[axis * 2 + side];
+				for (u32 col = 0; col < 3; ++col)
+				{
+					plane.normal[col] =
+						projectionView(3, col) + sign * projectionView(axis, col);
+				}
+				plane.offset = projectionView(3, 3) + sign * projectionView(axis, 3);
+			}
+		}
+	}
+
+	/// Returns the position of a box relative to the frustum
+	Containment classify(const Box3& box) const noexcept
+	{
+		const Vector3 center = (box.getMin() + box.getMax()) * 0.5f;
+		const Vector3 extent = box.getSize() * 0.5f;
+
+		Containment result = Containment::INSIDE;
+		for (const Plane& plane : mPlanes)
+		{
+			const float distance = plane.normal.dot(center) + plane.offset;
+			const float radius =
+				std::abs(plane.normal.x) * extent.x +
+				std::abs(plane.normal.y) * extent.y +
+				std::abs(plane.normal.z) * extent.z;
+
+			if (distance + radius < 0.0f)
+			{
+				return Containment::OUTSIDE;
+			}
+
+			if (distance - radius < 0.0f)
+			{
+				result = Containment::INTERSECTING;
+			}
+		}
+		return result;
+	}
+
+private:
+	/// Plane of the points p, for which normal.dot(p) + offset = 0
+	struct Plane
+	{
+		/// The normal, not normalized
+		Vector3 normal;
+
+		/// The offset
+		float offset = 0.0f;
+	};
+
+	/// The left, right, bottom, top, near and far planes
+	std::array<Plane, 6> mPlanes;
+};
+
+// End of the namespace gltut
+}
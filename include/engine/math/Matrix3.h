@@ -5,9 +5,11 @@
 #pragma once
 
 // Includes
-#include "engine/Core/Types.h"
-#include "engine/Math/Functions.h"
-#include "engine/Math/Vector3.h"
+#include <cstring>
+
+#include "engine/core/Types.h"
+#include "engine/math/Functions.h"
+#include "engine/math/Vector3.h"
 
 namespace gltut
 {
@@ -274,9 +276,30 @@ inline Matrix3 Matrix3::identity() noexcept
 		0.f, 0.f, 1.f};
 }
 
-/// Returns the normal matrix for a rotation-scale matrix
+/**
+	\brief Returns the normal matrix for a rotation-scale matrix.
+	For a rotation with a uniform scale s the inverse transpose is the matrix divided by s^2,
+	so the general inverse is computed only for the non-uniform scale and the shear
+*/
 inline Matrix3 getNormalMatrix(const Matrix3& rotationScale) noexcept
 {
+	// The relative tolerance of the orthogonality and the scale uniformity
+	constexpr float UNIFORM_SCALE_TOLERANCE = 1.0e-5f;
+
+	const Vector3 x = rotationScale.getAxis(0);
+	const Vector3 y = rotationScale.getAxis(1);
+	const Vector3 z = rotationScale.getAxis(2);
+	const float scale2 = x.lengthSquared();
+	const float tolerance = UNIFORM_SCALE_TOLERANCE * scale2;
+	if (scale2 > FLOAT_EPSILON &&
+		std::abs(y.lengthSquared() - scale2) <= tolerance &&
+		std::abs(z.lengthSquared() - scale2) <= tolerance &&
+		std::abs(x.dot(y)) <= tolerance &&
+		std::abs(x.dot(z)) <= tolerance &&
+		std::abs(y.dot(z)) <= tolerance)
+	{
+		return rotationScale * (1.0f / scale2);
+	}
 	return rotationScale.getInverse().getTranspose();
 }
 
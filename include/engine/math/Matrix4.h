@@ -5,7 +5,7 @@
 #pragma once
 
 // Includes
-#include "engine/Math/Matrix3.h"
+#include "engine/math/Matrix3.h"
 
 namespace gltut
 {
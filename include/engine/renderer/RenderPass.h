@@ -7,9 +7,10 @@
 // Includes
 #include "engine/graphics/RenderModes.h"
 #include "engine/graphics/framebuffer/Framebuffer.h"
+#include "engine/graphics/texture/Texture.h"
 #include "engine/math/Color.h"
 #include "engine/math/Rectangle.h"
-#include "engine/renderer/objects/RenderObject.h"
+#include "engine/renderer/objects/RenderGeometry.h"
 #include "engine/renderer/viewpoint/Viewpoint.h"
 
 namespace gltut
@@ -22,6 +23,12 @@ public:
 	/// Virtual destructor
 	virtual ~RenderPass() noexcept = default;
 
+	/// Returns the name of the pass, used by the profiler
+	virtual const char* getName() const noexcept = 0;
+
+	/// Sets the name of the pass
+	virtual void setName(const char* name) noexcept = 0;
+
 	/// Returns the object to render
 	virtual const RenderObject* getObject() const noexcept = 0;
 
@@ -70,6 +77,113 @@ public:
 	/// Enables/disables the pass
 	virtual void setActive(bool active) noexcept = 0;
 
+	/**
+		\brief Declares a texture read by the pass.
+		The renderer executes the passes writing the texture before this pass
+	*/
+	virtual void addInput(const Texture* texture) noexcept = 0;
+
+	/// Removes a texture read by the pass
+	virtual void removeInput(const Texture* texture) noexcept = 0;
+
+	/// Returns the number of the textures read by the pass
+	virtual u32 getInputCount() const noexcept = 0;
+
+	/// Returns the i-th texture read by the pass
+	virtual const Texture* getInput(u32 index) const noexcept = 0;
+
+	/**
+		\brief Adds an occluder of the pass.
+		The passes with the occluders skip the geometries hidden by the local bounds of the occluders.
+		The occluder is not rendered by the pass unless it is a part of the rendered object,
+		so a simple geometry may stand for a complex one.
+		The local bounds of an occluder must be covered entirely by its surface, like the walls and the floors.
+		The depth-sorted passes do not use the occluders
+	*/
+	virtual void addOccluder(const RenderGeometry* occluder) noexcept = 0;
+
+	/// Removes an occluder of the pass
+	virtual void removeOccluder(const RenderGeometry* occluder) noexcept = 0;
+
+	/// Returns the number of the occluders of the pass
+	virtual u32 getOccluderCount() const noexcept = 0;
+
+	/// Returns the i-th occluder of the pass
+	virtual const RenderGeometry* getOccluder(u32 index) const noexcept = 0;
+
+	/// Returns the number of the geometries submitted to the culling in the last execution
+	virtual u32 getSubmittedCount() const noexcept = 0;
+
+	/// Returns the number of the geometries outside the view frustum in the last execution
+	virtual u32 getFrustumCulledCount() const noexcept = 0;
+
+	/**
+		\brief Enables or disables the GPU occlusion queries of the pass.
+		The bounding boxes of the geometries are tested against the depth of the rendered pass,
+		the results decide which geometries are drawn in the next frames.
+		The results are read without waiting, the geometries hidden in the latest result
+		whose new results are not available yet are drawn with the conditional rendering.
+		Does nothing if the device does not support the occlusion queries.
+		The depth-sorted passes do not use the occlusion queries
+	*/
+	virtual void enableOcclusionQueries(bool enabled) noexcept = 0;
+
+	/// Returns if the occlusion queries are enabled
+	virtual bool areOcclusionQueriesEnabled() const noexcept = 0;
+
+	/// Returns the number of the geometries hidden by the occluders or by the occlusion queries in the last execution
+	virtual u32 getOcclusionCulledCount() const noexcept = 0;
+
+	/// Returns the number of the occlusion queries issued in the last execution
+	virtual u32 getOcclusionQueryCount() const noexcept = 0;
+
+	/**
+		\brief Returns the number of the occlusion queries whose results were not available in the last execution.
+		The pass does not wait for such results, it uses the previous ones or the conditional rendering
+	*/
+	virtual u32 getOcclusionQueryPendingCount() const noexcept = 0;
+
+	/**
+		\brief Sets the maximum projected error of the levels of detail, in pixels.
+		The geometries are drawn with their coarsest levels whose errors projected to the viewport
+		do not exceed the threshold. The depth-sorted passes draw the levels 0
+	*/
+	virtual void setLodThreshold(float pixels) noexcept = 0;
+
+	/// Returns the maximum projected error of the levels of detail, in pixels
+	virtual float getLodThreshold() const noexcept = 0;
+
+	/**
+		\brief Sets the number of the coarser levels of detail added to the selected ones.
+		Lets the passes whose details are not seen directly, like the shadow passes, use cheaper geometries
+	*/
+	virtual void setLodBias(u32 levels) noexcept = 0;
+
+	/// Returns the number of the coarser levels of detail added to the selected ones
+	virtual u32 getLodBias() const noexcept = 0;
+
+	/**
+		\brief Enables the depth-only pre-pass of the opaque geometries with costly materials.
+		The geometries whose material passes cost at least the minimum cost are drawn by the depth material pass first,
+		then, after the other opaque geometries, by the material pass of the render pass
+		with the equal depth test and no depth writes, so only their visible fragments are shaded.
+		The depth material pass must compute the same positions as the material pass, like MaterialPassIndex::DEPTH.
+		The material passes which discard the fragments and the conditionally rendered geometries are not pre-passed.
+		The depth-sorted passes do not use the pre-pass
+		\param depthMaterialPass The index of the depth material pass
+		\param minCost The minimum cost of the pre-passed material passes, see MaterialPass::getCost()
+	*/
+	virtual void enableDepthPrePass(u32 depthMaterialPass, float minCost) noexcept = 0;
+
+	/// Disables the depth pre-pass
+	virtual void disableDepthPrePass() noexcept = 0;
+
+	/// Returns if the depth pre-pass is enabled
+	virtual bool isDepthPrePassEnabled() const noexcept = 0;
+
+	/// Returns the number of the geometries drawn by the depth pre-pass in the last execution
+	virtual u32 getDepthPrePassCount() const noexcept = 0;
+
 	/// Executes the render pass
 	virtual void execute() noexcept = 0;
 };
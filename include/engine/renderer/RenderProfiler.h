@@ -0,0 +1,87 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/renderer/RenderPass.h"
+
+namespace gltut
+{
+// Global classes
+/// The GPU profile of a render pass
+struct RenderPassProfile
+{
+	/// The pass
+	const RenderPass* pass = nullptr;
+
+	/// The GPU time of the latest measured execution, in milliseconds
+	float time = 0.0f;
+
+	/// The average GPU time of the recent measured executions, in milliseconds
+	float averageTime = 0.0f;
+
+	/// The maximum GPU time of the recent measured executions, in milliseconds
+	float maxTime = 0.0f;
+
+	/// The number of the vertices submitted by the latest measured execution
+	u64 vertices = 0;
+
+	/// The number of the primitives submitted by the latest measured execution
+	u64 primitives = 0;
+
+	/// The number of the fragment shader invocations of the latest measured execution
+	u64 fragments = 0;
+};
+
+/**
+	\brief The GPU profiler of the render passes.
+	Every executed pass is measured by the double-buffered profiler queries of the device,
+	the results are read without waiting, one or two frames later.
+	The vertices, the primitives and the fragments are counted only if the device supports the pipeline statistics
+*/
+class RenderProfiler
+{
+public:
+	/// Virtual destructor
+	virtual ~RenderProfiler() noexcept = default;
+
+	/// Returns if the device supports the profiling
+	virtual bool isSupported() const noexcept = 0;
+
+	/// Returns if the device counts the vertices, the primitives and the fragments
+	virtual bool hasPipelineStatistics() const noexcept = 0;
+
+	/// Enables or disables the profiling, the profiles are reset on enabling
+	virtual void setEnabled(bool enabled) noexcept = 0;
+
+	/// Returns if the profiling is enabled
+	virtual bool isEnabled() const noexcept = 0;
+
+	/// Returns the number of the profiled passes executed in the last frame
+	virtual u32 getPassCount() const noexcept = 0;
+
+	/// Returns the profile of the i-th pass executed in the last frame, nullptr if the index is out of range
+	virtual const RenderPassProfile* getPass(u32 index) const noexcept = 0;
+
+	/// Returns the sum of the latest GPU times of the passes executed in the last frame, in milliseconds
+	virtual float getFrameTime() const noexcept = 0;
+
+	/**
+		\brief Saves the profiles of the passes executed in the last frame to a CSV file,
+		one row per pass with the header row
+		\return true if the file is saved
+	*/
+	virtual bool saveCsv(const char* path) const noexcept = 0;
+
+	/**
+		\brief Saves the profiles of the passes executed in the last frame to a JSON file,
+		an object with the frame time and the array of the passes
+		\return true if the file is saved
+	*/
+	virtual bool saveJson(const char* path) const noexcept = 0;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,83 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/renderer/RenderPass.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief The counters of the execution of a render pass or of a frame.
+	The device counters are the calls passed to the graphics API,
+	they are 0 if the device does not count the calls
+	\see GraphicsDevice::getCallCounters
+*/
+struct RenderPassStatistics
+{
+	/// The pass, nullptr for the frame
+	const RenderPass* pass = nullptr;
+
+	/// The draw calls, including the occlusion queries
+	u64 drawCalls = 0;
+
+	/// The drawn triangles
+	u64 triangles = 0;
+
+	/// The geometries submitted to the culling
+	u64 submittedObjects = 0;
+
+	/// The geometries rejected by the frustum and the occlusion culling
+	u64 culledObjects = 0;
+
+	/// The shader binds
+	u64 shaderSwitches = 0;
+
+	/// The texture binds
+	u64 textureBinds = 0;
+
+	/// The shader parameter sets and the uniform buffer updates
+	u64 uniformUploads = 0;
+
+	/// The bytes written to the uniform buffers
+	u64 uniformBufferBytes = 0;
+
+	/// The framebuffer binds
+	u64 framebufferSwitches = 0;
+
+	/**
+		\brief The CPU time of the submission, in milliseconds.
+		The time of the frame includes the parallel build of the passes and excludes the work outside the passes
+	*/
+	float submissionTime = 0.0f;
+};
+
+/// The counters of the render passes executed in the last frame
+class RenderStatistics
+{
+public:
+	/// Virtual destructor
+	virtual ~RenderStatistics() noexcept = default;
+
+	/// Returns if the device counts the calls, otherwise only the objects and the times are counted
+	virtual bool hasDeviceCounters() const noexcept = 0;
+
+	/// Returns the number of the passes executed in the last frame
+	virtual u32 getPassCount() const noexcept = 0;
+
+	/// Returns the counters of the i-th pass executed in the last frame, nullptr if the index is out of range
+	virtual const RenderPassStatistics* getPass(u32 index) const noexcept = 0;
+
+	/**
+		\brief Returns the counters of the last frame.
+		The device counters include the calls outside the passes, e.g. the scene uniform uploads,
+		the objects are the sums of the passes
+	*/
+	virtual const RenderPassStatistics& getFrame() const noexcept = 0;
+};
+
+// End of the namespace gltut
+}
@@ -8,6 +8,8 @@
 #include "engine/graphics/GraphicsDevice.h"
 
 #include "engine/renderer/RenderPass.h"
+#include "engine/renderer/RenderProfiler.h"
+#include "engine/renderer/RenderStatistics.h"
 #include "engine/renderer/objects/RenderGeometry.h"
 #include "engine/renderer/objects/RenderGeometryGroup.h"
 #include "engine/renderer/shader/ShaderRendererBinding.h"
@@ -83,8 +85,38 @@ public:
 	/// Removes all render passes
 	virtual void removeAllPasses() noexcept = 0;
 
-	/// Sets the priority of the render pass
+	/**
+		\brief Sets the priority of the render pass.
+		The passes writing the textures read by a pass are executed before it regardless of the priorities,
+		the priorities order the remaining passes, e.g. the passes drawing to the same framebuffer
+	*/
 	virtual void setPassPriority(RenderPass* pass, int32 priority) noexcept = 0;
+
+	/**
+		\brief Creates a transient render target.
+		The renderer allocates the textures of the target only for the frames it is written and read,
+		the targets of the same size and formats with non-overlapping lifetimes share the textures.
+		The passes writing only transient targets are skipped if no executed pass reads their textures,
+		the readers must declare the textures with RenderPass::addInput().
+		The content of the target is not preserved between the frames.
+		\param size The size of the target, nullptr for the window size
+		\param colorFormat The format of the color texture, nullptr for no color texture
+		\param depth If the target has a depth texture
+		\return The target or nullptr if the target cannot be created
+	*/
+	virtual TextureFramebuffer* createTransientTarget(
+		const Point2u* size,
+		const TextureFormat* colorFormat,
+		bool depth) noexcept = 0;
+
+	/// Removes a transient render target
+	virtual void removeTransientTarget(TextureFramebuffer* target) noexcept = 0;
+
+	/// Returns the GPU profiler of the render passes
+	virtual RenderProfiler* getProfiler() noexcept = 0;
+
+	/// Returns the counters of the render passes executed in the last frame
+	virtual const RenderStatistics* getStatistics() const noexcept = 0;
 };
 
 // End of the namespace gltut
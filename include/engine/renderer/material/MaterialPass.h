@@ -50,6 +50,25 @@ public:
 	/// Sets the transparency flag
 	virtual void setTransparent(bool transparent) noexcept = 0;
 
+	/**
+		\brief Returns the estimated cost of shading a fragment, in texture samples.
+		The render passes with the depth pre-pass draw the depth of the costly opaque geometries first,
+		so their fragments are shaded only once
+	*/
+	virtual float getCost() const noexcept = 0;
+
+	/// Sets the estimated cost of shading a fragment, in texture samples
+	virtual void setCost(float cost) noexcept = 0;
+
+	/**
+		\brief Returns if the shader may discard the fragments.
+		Such passes are not drawn after a depth pre-pass, since the depth pass does not discard the same fragments
+	*/
+	virtual bool isDiscarding() const noexcept = 0;
+
+	/// Sets if the shader may discard the fragments
+	virtual void setDiscarding(bool discarding) noexcept = 0;
+
 	/**
 		\brief Sets the polygon fill mode
 
@@ -0,0 +1,32 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/math/Box3.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Represents a node of a bounding volume hierarchy.
+	The bounds of a volume contain the bounds of all the volumes
+	which have it as the parent, so the render passes can reject whole subtrees
+*/
+class BoundingVolume
+{
+public:
+	/// Virtual destructor
+	virtual ~BoundingVolume() noexcept = default;
+
+	/// Returns the bounds in the global frame, nullptr if the volume is empty
+	virtual const Box3* getGlobalBounds() const noexcept = 0;
+
+	/// Returns the enclosing volume, nullptr if there is none
+	virtual const BoundingVolume* getParentVolume() const noexcept = 0;
+};
+
+// End of the namespace gltut
+}
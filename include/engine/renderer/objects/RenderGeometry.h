@@ -8,13 +8,14 @@
 #include "engine/graphics/geometry/Geometry.h"
 #include "engine/math/Matrix4.h"
 #include "engine/renderer/material/Material.h"
+#include "engine/renderer/objects/BoundingVolume.h"
 #include "engine/renderer/objects/RenderObject.h"
 
 namespace gltut
 {
 // Global classes
 /// Represents a render pipeline for the scene
-class RenderGeometry : public RenderObject
+class RenderGeometry : public RenderObject, public BoundingVolume
 {
 public:
 	virtual const Geometry* getGeometry() const noexcept = 0;
@@ -28,6 +29,15 @@ public:
 	virtual const Matrix4& getTransform() const noexcept = 0;
 
 	virtual void setTransform(const Matrix4& transform) noexcept = 0;
+
+	/// Returns the normal matrix of the transform, updated by setTransform()
+	virtual const Matrix3& getNormalMatrix() const noexcept = 0;
+
+	/**
+		\brief Sets the enclosing volume, used to reject the geometry with its siblings.
+		The volume must contain the global bounds of the geometry
+	*/
+	virtual void setParentVolume(const BoundingVolume* volume) noexcept = 0;
 };
 
 // End of the namespace gltut
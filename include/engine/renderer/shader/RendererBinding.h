@@ -4,6 +4,9 @@
 
 #pragma once
 
+// Includes
+#include "engine/core/Types.h"
+
 namespace gltut
 {
 // Global classes
@@ -16,6 +19,36 @@ class Viewpoint;
 class RendererBinding
 {
 public:
+	/**
+		\brief The uniform buffer binding point of the object buffer.
+		The object buffer is the std140 block of the per-draw data:
+		mat4 model matrix, mat3 normal matrix
+	*/
+	static constexpr u32 OBJECT_BUFFER_BINDING_POINT = 1;
+
+	/**
+		\brief The uniform buffer binding point of the material parameter blocks.
+		The shader parameters of a material pass which are the members of the std140 block
+		named MATERIAL_BLOCK_NAME are uploaded to the range of the pass bound to this point
+	*/
+	static constexpr u32 MATERIAL_BUFFER_BINDING_POINT = 2;
+
+	/// The name of the uniform block of the material parameters
+	static constexpr const char* MATERIAL_BLOCK_NAME = "Material";
+
+	/// The source of the model and normal matrices of a draw
+	enum class MatrixSource
+	{
+		/// The model and normal matrix uniforms
+		UNIFORMS = 0,
+
+		/// The per-instance vertex attributes, see GeometryInstance
+		INSTANCE_ATTRIBUTES,
+
+		/// The object buffer range bound to OBJECT_BUFFER_BINDING_POINT
+		OBJECT_BUFFER
+	};
+
 	enum class Parameter
 	{
 		/// View matrix
@@ -33,6 +66,9 @@ public:
 		/// The normal matrix
 		GEOMETRY_NORMAL_MATRIX,
 
+		/// The int selecting the source of the model and normal matrices, see MatrixSource
+		GEOMETRY_MATRIX_SOURCE,
+
 		/// Total number of parameters
 		TOTAL_COUNT
 	};
@@ -28,6 +28,18 @@ public:
 	/// Returns the name of a shader parameter bound to a scene parameter
 	virtual const char* getBoundShaderParameter(
 		RendererBinding::Parameter parameter) const noexcept = 0;
+
+	/**
+		\brief Returns true if the shader can read the model and normal matrices
+		from all the matrix sources, see RendererBinding::MatrixSource
+	*/
+	virtual bool isMatrixSourceSupported() const noexcept = 0;
+
+	/**
+		\brief Sets the source of the model and normal matrices.
+		Updating the binding for a render geometry switches to the uniforms
+	*/
+	virtual void updateMatrixSource(RendererBinding::MatrixSource source) const noexcept = 0;
 };
 
 // Global functions
@@ -31,7 +31,7 @@ public:
 	/// Sets the number of binding points
 	virtual void setBindingPointsCount(u32 count) noexcept = 0;
 
-	/// Binds the uniform buffers
+	/// Binds the uniform buffers, the binding points without buffers keep their bound ones
 	virtual void bind() const noexcept = 0;
 };
 
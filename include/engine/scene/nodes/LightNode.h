@@ -124,6 +124,12 @@ public:
 		\param shadowMap The shadow map to set, nullptr to disable shadows
 	*/
 	virtual void setShadowMap(ShadowMap* shadowMap) noexcept = 0;
+
+	/**
+		\brief Returns the version of the light, changed on every change of its parameters,
+		its shadow map or its global transform. The versions are unique across the lights
+	*/
+	virtual u64 getVersion() const noexcept = 0;
 };
 
 // End of the namespace gltut
@@ -6,12 +6,13 @@
 
 // Includes
 #include "engine/math/Matrix4.h"
+#include "engine/renderer/objects/BoundingVolume.h"
 
 namespace gltut
 {
 // Global classes
 /// Contains the colors used for a light source
-class SceneNode
+class SceneNode : public BoundingVolume
 {
 public:
 	/// Virtual destructor
@@ -52,6 +53,13 @@ public:
 	/// Returns a child node by index
 	virtual SceneNode* getChild(u32 index) noexcept = 0;
 
+	/**
+		\brief Returns the global bounds of the node geometry and of all its descendants,
+		nullptr if there is no geometry.
+		Updated by Scene::update, i.e. once per frame
+	*/
+	const Box3* getGlobalBounds() const noexcept override = 0;
+
 private:
 	/// Friend implementation class
 	template <typename SceneNodeInterface>
@@ -62,6 +70,9 @@ private:
 
 	/// Sets the parent of this node
 	virtual void setParent(SceneNode* parent) noexcept = 0;
+
+	/// Updates the global bounds of this node and its descendants
+	virtual void updateGlobalBounds() noexcept = 0;
 };
 
 // End of the namespace gltut
@@ -35,6 +35,12 @@ public:
 
 	/// Updates the shadow map
 	virtual void update() noexcept = 0;
+
+	/**
+		\brief Returns the version of the shadow matrix, changed on its every change.
+		The versions are unique across the shadow maps
+	*/
+	virtual u64 getVersion() const noexcept = 0;
 };
 
 // End of the namespace gltut
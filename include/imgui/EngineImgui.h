@@ -24,6 +24,14 @@ public:
 
 	/// Renders the ImGui draw data
 	virtual void newFrame() noexcept = 0;
+
+	/**
+		Shows the window with the GPU profiles of the render passes
+		and the CPU profiling zones.
+		Must be called after newFrame()
+		\param open If not nullptr, the window shows a close button which resets the flag
+	*/
+	virtual void showRenderProfile(bool* open = nullptr) noexcept = 0;
 };
 
 // Global functions
@@ -5,6 +5,7 @@
 // Includes
 #include "AssetLoaderC.h"
 #include <filesystem>
+#include "engine/core/CpuProfiler.h"
 
 namespace gltut
 {
@@ -18,8 +19,10 @@ AssetLoaderC::AssetLoaderC(Engine& engine) noexcept :
 SceneNode* AssetLoaderC::loadAsset(
 	const char* filePath,
 	const AssetMaterialFactory* materialFactory,
-	bool loadTextures) noexcept
+	bool loadTextures,
+	u32 lodCount) noexcept
 {
+	GLTUT_PROFILE_ZONE("AssetLoaderC::loadAsset");
 	GLTUT_ASSERT(filePath != nullptr);
 	GLTUT_ASSERT(materialFactory != nullptr);
 
@@ -51,6 +54,7 @@ SceneNode* AssetLoaderC::loadAsset(
 		processMeshes(
 			*scene,
 			materials,
+			lodCount,
 			geometries,
 			geometryMaterials);
 
@@ -174,7 +178,7 @@ SceneNode* AssetLoaderC::createCompoundGeometryNode(
 	return result;
 }
 
-Geometry* AssetLoaderC::createGeometry(aiMesh* mesh)
+Geometry* AssetLoaderC::createGeometry(aiMesh* mesh, u32 lodCount)
 {
 	// data to fill
 	std::vector<float> vertices;
@@ -247,7 +251,19 @@ Geometry* AssetLoaderC::createGeometry(aiMesh* mesh)
 
 	PhongMaterialModel* material = nullptr;
 
-	return mEngine.getDevice()->getGeometries()->create(
+	GeometryManager* geometries = mEngine.getDevice()->getGeometries();
+	if (lodCount > 0)
+	{
+		return geometries->createWithLods(
+			vertexFormat,
+			static_cast<u32>(vertices.size() / vertexFormat.getTotalSize()),
+			vertices.data(),
+			static_cast<u32>(indices.size()),
+			indices.data(),
+			lodCount);
+	}
+
+	return geometries->create(
 		vertexFormat,
 		static_cast<u32>(vertices.size() / vertexFormat.getTotalSize()),
 		vertices.data(),
@@ -258,6 +274,7 @@ Geometry* AssetLoaderC::createGeometry(aiMesh* mesh)
 void AssetLoaderC::processMeshes(
 	const aiScene& scene,
 	const MaterialsType& materials,
+	u32 lodCount,
 	std::vector<Geometry*>& geometries,
 	MaterialsType& geometryMaterials)
 {
@@ -271,7 +288,7 @@ void AssetLoaderC::processMeshes(
 		for (u32 meshInd = 0; meshInd < scene.mNumMeshes; ++meshInd)
 		{
 			aiMesh* mesh = scene.mMeshes[meshInd];
-			Geometry* geometry = createGeometry(mesh);
+			Geometry* geometry = createGeometry(mesh, lodCount);
 			GLTUT_CHECK(geometry != nullptr, "Failed to create geometry");
 
 			geometries[meshInd] = geometry;
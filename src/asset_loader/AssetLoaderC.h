@@ -5,6 +5,8 @@
 #pragma once
 
 // Includes
+#include <vector>
+
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
@@ -29,7 +31,8 @@ public:
 	SceneNode* loadAsset(
 		const char* filePath,
 		const AssetMaterialFactory* materialCreator,
-		bool loadTextures) noexcept final;
+		bool loadTextures,
+		u32 lodCount) noexcept final;
 
 private:
 	/// Vector of materials
@@ -48,13 +51,14 @@ private:
 		const AssetMaterialFactory& materialCreator,
 		bool loadTextures);
 
-	/// Creates a geometry from an aiMesh
-	Geometry* createGeometry(aiMesh* mesh);
+	/// Creates a geometry from an aiMesh, with up to lodCount levels of detail
+	Geometry* createGeometry(aiMesh* mesh, u32 lodCount);
 
 	/// Processes meshes from a scene
 	void processMeshes(
 		const aiScene& scene,
 		const MaterialsType& materials,
+		u32 lodCount,
 		std::vector<Geometry*>& geometries,
 		MaterialsType& geometryMaterials);
 
@@ -8,22 +8,78 @@
 #include <iostream>
 #include <stdexcept>
 
+#include "engine/core/CpuProfiler.h"
 #include "factory/FactoryC.h"
+#include "graphics/backends/null/DeviceNull.h"
 #include "graphics/backends/opengl/DeviceOpenGL.h"
+#include "graphics/backends/software/DeviceSoftware.h"
 #include "scene/SceneC.h"
+#include "window/HeadlessWindowC.h"
 #include "window/WindowC.h"
 
 namespace gltut
 {
 // Global classes
-EngineC::EngineC(u32 windowWidth, u32 windowHeight)
+EngineC::EngineC(
+	u32 windowWidth,
+	u32 windowHeight,
+	EngineBackend backend)
 {
-	mWindow = std::make_unique<WindowC>(
-		windowWidth,
-		windowHeight);
-	GLTUT_CHECK(mWindow != nullptr, "Failed to create the window");
+	GLTUT_PROFILE_THREAD("Main");
+	std::unique_ptr<GraphicsDeviceBase> device;
+	switch (backend)
+	{
+	case EngineBackend::OPENGL:
+	{
+#ifdef _WIN32
+		mWindow = std::make_unique<WindowC>(
+			windowWidth,
+			windowHeight);
+		GLTUT_CHECK(mWindow != nullptr, "Failed to create the window");
+
+		device = std::make_unique<DeviceOpenGL>(
+			*mWindow,
+			createContextWGL(*mWindow));
+#else
+		GLTUT_CHECK(false, "Native windows are supported only on Windows");
+#endif
+	}
+	break;
+
+	case EngineBackend::OPENGL_HEADLESS:
+	{
+		mWindow = std::make_unique<HeadlessWindowC>(
+			windowWidth,
+			windowHeight);
+
+		device = std::make_unique<DeviceOpenGL>(
+			*mWindow,
+			createContextEGL(mWindow->getSize()));
+	}
+	break;
+
+	case EngineBackend::NULL_DEVICE:
+	{
+		mWindow = std::make_unique<HeadlessWindowC>(
+			windowWidth,
+			windowHeight);
 
-	auto device = std::make_unique<DeviceOpenGL>(*mWindow);
+		device = std::make_unique<DeviceNull>(*mWindow);
+	}
+	break;
+
+	case EngineBackend::SOFTWARE:
+	{
+		mWindow = std::make_unique<HeadlessWindowC>(
+			windowWidth,
+			windowHeight);
+
+		device = std::make_unique<DeviceSoftware>(*mWindow);
+	}
+	break;
+
+		GLTUT_UNEXPECTED_SWITCH_DEFAULT_CASE(backend)
+	}
 	GLTUT_CHECK(device != nullptr, "Failed to create the device");
 
 	mWindow->addEventHandler(this);
@@ -47,6 +103,7 @@ EngineC::EngineC(u32 windowWidth, u32 windowHeight)
 		true,
 		nullptr);
 	GLTUT_CHECK(mSceneRenderPass != nullptr, "Cannot create the scene render pass");
+	mSceneRenderPass->setName("Scene");
 
 	mDepthSortedSceneRenderPass = mRenderer->createDepthSortedPass(
 		mScene->getActiveCameraViewpoint(),
@@ -57,16 +114,25 @@ EngineC::EngineC(u32 windowWidth, u32 windowHeight)
 		false,
 		nullptr);
 	GLTUT_CHECK(mDepthSortedSceneRenderPass != nullptr, "Cannot create the depth-sorted scene render pass");
+	mDepthSortedSceneRenderPass->setName("Depth-sorted scene");
 
-	mFactory = std::make_unique<FactoryC>(*mRenderer, *mScene, *mWindow);
+	mFactory = std::make_unique<FactoryC>(*mRenderer, mRenderer->getTaskPool(), *mScene, *mWindow);
 }
 
 bool EngineC::update() noexcept
 {
-	mScene->update();
-	mFactory->update();
-	mRenderer->execute();
-	return mWindow->update();
+	bool result = false;
+	{
+		GLTUT_PROFILE_ZONE("EngineC::update");
+		mRenderer->beginFrame();
+		mScene->update();
+		mFactory->update();
+		mRenderer->execute();
+		result = mWindow->update();
+		mRenderer->endFrame();
+	}
+	getCpuProfiler()->endFrame();
+	return result;
 }
 
 bool EngineC::onEvent(const Event& event) noexcept
@@ -80,11 +146,14 @@ bool EngineC::onEvent(const Event& event) noexcept
 }
 
 // Global functions
-Engine* createEngine(u32 windowWidth, u32 windowHeight) noexcept
+Engine* createEngine(
+	u32 windowWidth,
+	u32 windowHeight,
+	EngineBackend backend) noexcept
 {
 	try
 	{
-		return new EngineC(windowWidth, windowHeight);
+		return new EngineC(windowWidth, windowHeight, backend);
 	}
 	catch (const std::exception& e)
 	{
@@ -14,7 +14,7 @@
 #include "./graphics/GraphicsDeviceBase.h"
 #include "./renderer/RendererC.h"
 #include "./scene/SceneC.h"
-#include "./window/WindowC.h"
+#include "./window/WindowBase.h"
 
 namespace gltut
 {
@@ -24,7 +24,10 @@ class EngineC final : public Engine, public EventHandler, public NonCopyable
 {
 public:
 	/// Constructor
-	EngineC(u32 windowWidth, u32 windowHeight);
+	EngineC(
+		u32 windowWidth,
+		u32 windowHeight,
+		EngineBackend backend);
 
 	/// Runs the engine
 	bool update() noexcept final;
@@ -76,7 +79,7 @@ public:
 
 private:
 	/// The window
-	std::unique_ptr<WindowC> mWindow;
+	std::unique_ptr<WindowBase> mWindow;
 
 	/// The device
 	std::unique_ptr<GraphicsDeviceBase> mDevice;
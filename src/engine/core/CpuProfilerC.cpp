@@ -0,0 +1,296 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "CpuProfilerC.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+
+#include "engine/core/Check.h"
+#include "File.h"
+#include "Json.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The nanoseconds in a millisecond
+constexpr float NANOSECONDS_PER_MILLISECOND = 1.0e6f;
+
+/// The nanoseconds in a microsecond, the time unit of the Chrome trace
+constexpr double NANOSECONDS_PER_MICROSECOND = 1.0e3;
+
+// Local variables
+/// The name of the calling thread set before its buffer is created
+thread_local std::string tThreadName;
+
+// Local functions
+/// Returns the profiler instance
+CpuProfilerC& getProfiler() noexcept
+{
+	static CpuProfilerC profiler;
+	return profiler;
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+thread_local CpuProfilerC::ThreadBuffer* CpuProfilerC::sThreadBuffer = nullptr;
+
+CpuProfilerC::CpuProfilerC() noexcept :
+	mOrigin(std::chrono::steady_clock::now())
+{
+}
+
+void CpuProfilerC::setEnabled(bool enabled) noexcept
+{
+	if (enabled == isEnabled())
+	{
+		return;
+	}
+
+	if (enabled)
+	{
+		// Discards the zones recorded before
+		GLTUT_CATCH_ALL_BEGIN
+		std::vector<TraceZone> zones;
+		collect(zones);
+		GLTUT_CATCH_ALL_END("Cannot clear the CPU profiler")
+		mFrames.clear();
+		mSummary.clear();
+		mFrameTime = 0.0f;
+		mFrameStart = getTime();
+		mDroppedZoneCount.store(0, std::memory_order_relaxed);
+	}
+	mEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+void CpuProfilerC::setThreadName(const char* name) noexcept
+{
+	GLTUT_CATCH_ALL_BEGIN
+	GLTUT_CHECK(name != nullptr, "The thread name is null");
+	tThreadName = name;
+	if (sThreadBuffer != nullptr)
+	{
+		std::lock_guard lock(mThreadsMutex);
+		sThreadBuffer->name = name;
+	}
+	GLTUT_CATCH_ALL_END("Cannot set the profiled thread name")
+}
+
+void CpuProfilerC::endFrame() noexcept
+{
+	if (!isEnabled())
+	{
+		return;
+	}
+
+	const u64 now = getTime();
+	GLTUT_CATCH_ALL_BEGIN
+	if (mFrames.size() == TRACE_FRAME_COUNT)
+	{
+		// Reuses the memory of the oldest frame
+		mFrames.push_back(std::move(mFrames.front()));
+		mFrames.pop_front();
+	}
+	else
+	{
+		mFrames.emplace_back();
+	}
+
+	Frame& frame = mFrames.back();
+	frame.start = mFrameStart;
+	frame.zones.clear();
+	collect(frame.zones);
+	updateSummary(frame.zones);
+	GLTUT_CATCH_ALL_END("Cannot collect the CPU profiling zones")
+
+	mFrameTime = static_cast<float>(now - mFrameStart) / NANOSECONDS_PER_MILLISECOND;
+	mFrameStart = now;
+}
+
+bool CpuProfilerC::saveChromeTrace(const char* path) const noexcept
+{
+	GLTUT_CATCH_ALL_BEGIN
+	GLTUT_CHECK(path != nullptr, "The path is null");
+	writeStringToFile(path, getChromeTrace());
+	return true;
+	GLTUT_CATCH_ALL_END("Cannot save the CPU profiling zones to a Chrome trace file")
+	return false;
+}
+
+const char* CpuProfilerC::copyName(const char* name) noexcept
+{
+	GLTUT_CATCH_ALL_BEGIN
+	std::lock_guard lock(mNamesMutex);
+	return mNames.emplace(name).first->c_str();
+	GLTUT_CATCH_ALL_END("Cannot copy the CPU profiling zone name")
+	return "Unknown";
+}
+
+void CpuProfilerC::record(const char* name, u64 start, u64 end) noexcept
+{
+	ThreadBuffer* buffer = getThreadBuffer();
+	if (buffer == nullptr)
+	{
+		return;
+	}
+
+	// Only the calling thread writes the head
+	const u32 head = buffer->head.load(std::memory_order_relaxed);
+	if (head - buffer->tail.load(std::memory_order_acquire) == THREAD_ZONE_COUNT)
+	{
+		mDroppedZoneCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	buffer->zones[head % THREAD_ZONE_COUNT] = {name, start, end};
+	buffer->head.store(head + 1, std::memory_order_release);
+}
+
+CpuProfilerC::ThreadBuffer* CpuProfilerC::getThreadBuffer() noexcept
+{
+	if (sThreadBuffer != nullptr)
+	{
+		return sThreadBuffer;
+	}
+
+	GLTUT_CATCH_ALL_BEGIN
+	auto buffer = std::make_unique<ThreadBuffer>();
+	std::lock_guard lock(mThreadsMutex);
+	buffer->name = tThreadName.empty() ?
+		"Thread " + std::to_string(mThreads.size()) :
+		tThreadName;
+	mThreads.push_back(std::move(buffer));
+	sThreadBuffer = mThreads.back().get();
+	GLTUT_CATCH_ALL_END("Cannot create the CPU profiling buffer of a thread")
+	return sThreadBuffer;
+}
+
+void CpuProfilerC::collect(std::vector<TraceZone>& zones)
+{
+	std::lock_guard lock(mThreadsMutex);
+	for (u32 thread = 0; thread < mThreads.size(); ++thread)
+	{
+		ThreadBuffer& buffer = *mThreads[thread];
+		const u32 tail = buffer.tail.load(std::memory_order_relaxed);
+		const u32 head = buffer.head.load(std::memory_order_acquire);
+		for (u32 i = tail; i != head; ++i)
+		{
+			zones.push_back({buffer.zones[i % THREAD_ZONE_COUNT], thread});
+		}
+		buffer.tail.store(head, std::memory_order_release);
+	}
+}
+
+void CpuProfilerC::updateSummary(const std::vector<TraceZone>& zones)
+{
+	mSummary.clear();
+	// The equal names of different string literals are merged
+	std::unordered_map<std::string_view, size_t> indices;
+	for (const TraceZone& zone : zones)
+	{
+		const auto found = indices.try_emplace(zone.zone.name, mSummary.size());
+		if (found.second)
+		{
+			mSummary.push_back({zone.zone.name});
+		}
+
+		CpuProfileZone& summary = mSummary[found.first->second];
+		const float time = static_cast<float>(zone.zone.end - zone.zone.start) / NANOSECONDS_PER_MILLISECOND;
+		++summary.count;
+		summary.time += time;
+		summary.maxTime = std::max(summary.maxTime, time);
+	}
+
+	std::sort(
+		mSummary.begin(),
+		mSummary.end(),
+		[](const CpuProfileZone& a, const CpuProfileZone& b)
+		{
+			return a.time > b.time;
+		});
+}
+
+std::string CpuProfilerC::getChromeTrace() const
+{
+	std::ostringstream stream;
+	stream << std::fixed << std::setprecision(3);
+	stream << "{\n\"displayTimeUnit\": \"ms\",\n\"traceEvents\": [";
+
+	bool first = true;
+	const auto beginEvent = [&stream, &first]()
+	{
+		stream << (first ? "\n" : ",\n");
+		first = false;
+	};
+
+	{
+		std::lock_guard lock(mThreadsMutex);
+		for (u32 thread = 0; thread < mThreads.size(); ++thread)
+		{
+			beginEvent();
+			stream << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << thread <<
+				", \"args\": {\"name\": ";
+			writeJsonString(stream, mThreads[thread]->name.c_str());
+			stream << "}}";
+		}
+	}
+
+	for (const Frame& frame : mFrames)
+	{
+		beginEvent();
+		stream << "{\"name\": \"Frame\", \"ph\": \"i\", \"s\": \"g\", \"pid\": 1, \"tid\": 0, \"ts\": " <<
+			static_cast<double>(frame.start) / NANOSECONDS_PER_MICROSECOND << '}';
+
+		for (const TraceZone& zone : frame.zones)
+		{
+			beginEvent();
+			stream << "{\"name\": ";
+			writeJsonString(stream, zone.zone.name);
+			stream << ", \"cat\": \"cpu\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << zone.thread <<
+				", \"ts\": " << static_cast<double>(zone.zone.start) / NANOSECONDS_PER_MICROSECOND <<
+				", \"dur\": " << static_cast<double>(zone.zone.end - zone.zone.start) / NANOSECONDS_PER_MICROSECOND <<
+				'}';
+		}
+	}
+	stream << "\n]\n}\n";
+	return stream.str();
+}
+
+CpuProfileScope::CpuProfileScope(const char* name, bool copyName) noexcept :
+	mName(nullptr)
+{
+	CpuProfilerC& profiler = getProfiler();
+	if (profiler.isEnabled())
+	{
+		mName = copyName ? profiler.copyName(name) : name;
+		mStart = profiler.getTime();
+	}
+}
+
+CpuProfileScope::~CpuProfileScope() noexcept
+{
+	if (mName != nullptr)
+	{
+		CpuProfilerC& profiler = getProfiler();
+		profiler.record(mName, mStart, profiler.getTime());
+	}
+}
+
+// Global functions
+CpuProfiler* getCpuProfiler() noexcept
+{
+	return &getProfiler();
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,195 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "engine/core/CpuProfiler.h"
+#include "engine/core/NonCopyable.h"
+
+namespace gltut
+{
+// Global classes
+/// The implementation of the CPU profiler
+class CpuProfilerC final : public CpuProfiler, public NonCopyable
+{
+public:
+	/// Constructor
+	CpuProfilerC() noexcept;
+
+	/// Enables or disables the profiling, the recorded zones are cleared on enabling
+	void setEnabled(bool enabled) noexcept final;
+
+	/// Returns if the profiling is enabled
+	bool isEnabled() const noexcept final
+	{
+		return mEnabled.load(std::memory_order_relaxed);
+	}
+
+	/// Names the calling thread in the trace
+	void setThreadName(const char* name) noexcept final;
+
+	/// Ends a frame
+	void endFrame() noexcept final;
+
+	/// Returns the time of the last frame, in milliseconds
+	float getFrameTime() const noexcept final
+	{
+		return mFrameTime;
+	}
+
+	/// Returns the number of the zones executed in the last frame
+	u32 getZoneCount() const noexcept final
+	{
+		return static_cast<u32>(mSummary.size());
+	}
+
+	/// Returns the summary of the i-th zone of the last frame
+	const CpuProfileZone* getZone(u32 index) const noexcept final
+	{
+		return index < mSummary.size() ? &mSummary[index] : nullptr;
+	}
+
+	/// Returns the number of the zones dropped since the profiling is enabled
+	u64 getDroppedZoneCount() const noexcept final
+	{
+		return mDroppedZoneCount.load(std::memory_order_relaxed);
+	}
+
+	/// Saves the zones of the recent frames to a Chrome trace event JSON file
+	bool saveChromeTrace(const char* path) const noexcept final;
+
+	/// Returns the time since the profiler creation, in nanoseconds
+	u64 getTime() const noexcept
+	{
+		return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - mOrigin).count());
+	}
+
+	/// Returns a copy of a name which lives as long as the profiler
+	const char* copyName(const char* name) noexcept;
+
+	/// Records a zone of the calling thread
+	void record(const char* name, u64 start, u64 end) noexcept;
+
+private:
+	/// The number of the zones in a thread buffer, a power of two
+	static constexpr u32 THREAD_ZONE_COUNT = 8192;
+
+	/// The number of the recent frames saved to the trace
+	static constexpr size_t TRACE_FRAME_COUNT = 300;
+
+	/// A recorded zone
+	struct Zone
+	{
+		/// The name
+		const char* name;
+
+		/// The start time in nanoseconds
+		u64 start;
+
+		/// The end time in nanoseconds
+		u64 end;
+	};
+
+	/**
+		\brief The ring buffer of the zones recorded by a thread.
+		The thread writes the zones, the frame end reads them
+	*/
+	struct ThreadBuffer
+	{
+		/// The zones
+		std::array<Zone, THREAD_ZONE_COUNT> zones;
+
+		/// The number of the written zones
+		std::atomic<u32> head = 0;
+
+		/// The number of the read zones
+		std::atomic<u32> tail = 0;
+
+		/// The thread name
+		std::string name;
+	};
+
+	/// A zone of the trace
+	struct TraceZone
+	{
+		/// The zone
+		Zone zone;
+
+		/// The index of the thread
+		u32 thread;
+	};
+
+	/// A frame of the trace
+	struct Frame
+	{
+		/// The start time in nanoseconds
+		u64 start;
+
+		/// The zones
+		std::vector<TraceZone> zones;
+	};
+
+	/// Returns the buffer of the calling thread, creates it on the first call
+	ThreadBuffer* getThreadBuffer() noexcept;
+
+	/// The buffer of the calling thread, nullptr until the thread records a zone
+	static thread_local ThreadBuffer* sThreadBuffer;
+
+	/// Reads the zones of the thread buffers
+	void collect(std::vector<TraceZone>& zones);
+
+	/// Updates the summary of the frame zones
+	void updateSummary(const std::vector<TraceZone>& zones);
+
+	/// Returns the trace of the recent frames
+	std::string getChromeTrace() const;
+
+	/// If the profiling is enabled
+	std::atomic<bool> mEnabled = false;
+
+	/// The time origin
+	const std::chrono::steady_clock::time_point mOrigin;
+
+	/// The mutex guarding the thread buffers list and the thread names
+	mutable std::mutex mThreadsMutex;
+
+	/// The thread buffers, indexed by the thread indices
+	std::vector<std::unique_ptr<ThreadBuffer>> mThreads;
+
+	/// The mutex guarding the copied names
+	std::mutex mNamesMutex;
+
+	/// The copied names
+	std::unordered_set<std::string> mNames;
+
+	/// The recent frames
+	std::deque<Frame> mFrames;
+
+	/// The summary of the zones of the last frame
+	std::vector<CpuProfileZone> mSummary;
+
+	/// The start of the current frame in nanoseconds
+	u64 mFrameStart = 0;
+
+	/// The time of the last frame, in milliseconds
+	float mFrameTime = 0.0f;
+
+	/// The number of the dropped zones
+	std::atomic<u64> mDroppedZoneCount = 0;
+};
+
+// End of the namespace gltut
+}
@@ -19,5 +19,13 @@ std::string readFileToString(const std::filesystem::path& path)
 		std::istreambuf_iterator<char>()};
 }
 
+void writeStringToFile(const std::filesystem::path& path, const std::string& contents)
+{
+	std::ofstream file;
+	file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+	file.open(path, std::ios::binary);
+	file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
 // End of the namespace gltut
 }
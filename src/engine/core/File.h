@@ -19,5 +19,13 @@ namespace gltut
 */
 std::string readFileToString(const std::filesystem::path& path);
 
+/**
+	\brief Writes a string to a file, replacing its contents
+	\param path The path to the file
+	\param contents The string to write
+	\throw std::ios_base::failure if the file could not be written
+*/
+void writeStringToFile(const std::filesystem::path& path, const std::string& contents);
+
 // End of the namespace gltut
 }
@@ -0,0 +1,217 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <algorithm>
+#include <cstring>
+
+#include "engine/core/Types.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GLTUT_FLOAT4_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace gltut
+{
+// Global functions
+#ifdef GLTUT_FLOAT4_SSE2
+/// 4 float lanes
+using Float4 = __m128;
+
+inline Float4 splat(float value) noexcept
+{
+	return _mm_set1_ps(value);
+}
+
+/// Returns (first, first + 1, first + 2, first + 3)
+inline Float4 sequence(float first) noexcept
+{
+	return _mm_add_ps(_mm_set1_ps(first), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f));
+}
+
+inline Float4 load(const float* data) noexcept
+{
+	return _mm_loadu_ps(data);
+}
+
+inline void store(float* data, Float4 value) noexcept
+{
+	_mm_storeu_ps(data, value);
+}
+
+inline Float4 add(Float4 first, Float4 second) noexcept
+{
+	return _mm_add_ps(first, second);
+}
+
+inline Float4 subtract(Float4 first, Float4 second) noexcept
+{
+	return _mm_sub_ps(first, second);
+}
+
+inline Float4 multiply(Float4 first, Float4 second) noexcept
+{
+	return _mm_mul_ps(first, second);
+}
+
+inline Float4 minimum(Float4 first, Float4 second) noexcept
+{
+	return _mm_min_ps(first, second);
+}
+
+inline Float4 maximum(Float4 first, Float4 second) noexcept
+{
+	return _mm_max_ps(first, second);
+}
+
+/// Returns the lanes of first where the bit of the lane mask is set and the lanes of second elsewhere
+inline Float4 select(u32 mask, Float4 first, Float4 second) noexcept
+{
+	const __m128i bits = _mm_setr_epi32(1, 2, 4, 8);
+	const __m128 lanes = _mm_castsi128_ps(
+		_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(static_cast<int>(mask)), bits), bits));
+	return _mm_or_ps(_mm_and_ps(lanes, first), _mm_andnot_ps(lanes, second));
+}
+
+// The comparisons return the lane masks, bit i for lane i
+inline u32 less(Float4 first, Float4 second) noexcept
+{
+	return static_cast<u32>(_mm_movemask_ps(_mm_cmplt_ps(first, second)));
+}
+
+inline u32 lessEqual(Float4 first, Float4 second) noexcept
+{
+	return static_cast<u32>(_mm_movemask_ps(_mm_cmple_ps(first, second)));
+}
+
+inline u32 equal(Float4 first, Float4 second) noexcept
+{
+	return static_cast<u32>(_mm_movemask_ps(_mm_cmpeq_ps(first, second)));
+}
+#else
+/// 4 float lanes
+struct Float4
+{
+	float lanes[4];
+};
+
+inline Float4 splat(float value) noexcept
+{
+	return {{value, value, value, value}};
+}
+
+/// Returns (first, first + 1, first + 2, first + 3)
+inline Float4 sequence(float first) noexcept
+{
+	return {{first, first + 1.0f, first + 2.0f, first + 3.0f}};
+}
+
+inline Float4 load(const float* data) noexcept
+{
+	return {{data[0], data[1], data[2], data[3]}};
+}
+
+inline void store(float* data, Float4 value) noexcept
+{
+	std::memcpy(data, value.lanes, sizeof(value.lanes));
+}
+
+inline Float4 add(Float4 first, Float4 second) noexcept
+{
+	Float4 result;
+	for (u32 i = 0; i < 4; ++i)
+	{
+		result.lanes[i] = first.lanes[i] + second.lanes[i];
+	}
+	return result;
+}
+
+inline Float4 subtract(Float4 first, Float4 second) noexcept
+{
+	Float4 result;
+	for (u32 i = 0; i < 4; ++i)
+	{
+		result.lanes[i] = first.lanes[i] - second.lanes[i];
+	}
+	return result;
+}
+
+inline Float4 multiply(Float4 first, Float4 second) noexcept
+{
+	Float4 result;
+	for (u32 i = 0; i < 4; ++i)
+	{
+		result.lanes[i] = first.lanes[i] * second.lanes[i];
+	}
+	return result;
+}
+
+inline Float4 minimum(Float4 first, Float4 second) noexcept
+{
+	Float4 result;
+	for (u32 i = 0; i < 4; ++i)
+	{
+		result.lanes[i] = std::min(first.lanes[i], second.lanes[i]);
+	}
+	return result;
+}
+
+inline Float4 maximum(Float4 first, Float4 second) noexcept
+{
+	Float4 result;
+	for (u32 i = 0; i < 4; ++i)
+	{
+		result.lanes[i] = std::max(first.lanes[i], second.lanes[i]);
+	}
+	return result;
+}
+
+/// Returns the lanes of first where the bit of the lane mask is set and the lanes of second elsewhere
+inline Float4 select(u32 mask, Float4 first, Float4 second) noexcept
+{
+	Float4 result;
+	for (u32 i = 0; i < 4; ++i)
+	{
+		result.lanes[i] = (mask & (1u << i)) != 0 ? first.lanes[i] : second.lanes[i];
+	}
+	return result;
+}
+
+// The comparisons return the lane masks, bit i for lane i
+inline u32 less(Float4 first, Float4 second) noexcept
+{
+	u32 result = 0;
+	for (u32 i = 0; i < 4; ++i)
+	{
+		result |= first.lanes[i] < second.lanes[i] ? (1u << i) : 0;
+	}
+	return result;
+}
+
+inline u32 lessEqual(Float4 first, Float4 second) noexcept
+{
+	u32 result = 0;
+	for (u32 i = 0; i < 4; ++i)
+	{
+		result |= first.lanes[i] <= second.lanes[i] ? (1u << i) : 0;
+	}
+	return result;
+}
+
+inline u32 equal(Float4 first, Float4 second) noexcept
+{
+	u32 result = 0;
+	for (u32 i = 0; i < 4; ++i)
+	{
+		result |= first.lanes[i] == second.lanes[i] ? (1u << i) : 0;
+	}
+	return result;
+}
+#endif
+
+// End of the namespace gltut
+}
@@ -6,6 +6,7 @@
 #include "engine/core/Check.h"
 #include "engine/core/NonCopyable.h"
 #include "engine/core/Types.h"
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -0,0 +1,37 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "Json.h"
+
+#include <cstdio>
+
+namespace gltut
+{
+// Global functions
+void writeJsonString(std::ostream& stream, const char* string)
+{
+	stream << '"';
+	for (const char* c = string; *c != '\0'; ++c)
+	{
+		if (*c == '"' || *c == '\\')
+		{
+			stream << '\\' << *c;
+		}
+		else if (static_cast<unsigned char>(*c) < 0x20)
+		{
+			char escaped[8];
+			std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(*c));
+			stream << escaped;
+		}
+		else
+		{
+			stream << *c;
+		}
+	}
+	stream << '"';
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,17 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <ostream>
+
+namespace gltut
+{
+// Global functions
+/// Writes a string as a quoted JSON string, escaping the quotes, the backslashes and the control characters
+void writeJsonString(std::ostream& stream, const char* string);
+
+// End of the namespace gltut
+}
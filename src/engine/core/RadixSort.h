@@ -0,0 +1,87 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "engine/core/Types.h"
+
+namespace gltut
+{
+// Global functions
+/**
+	\brief Stable LSD radix sort of items by 64-bit keys in ascending order.
+	The digits which are equal for all the items are skipped,
+	so the keys with few used bits are sorted in few passes.
+
+	\param items The items to sort
+	\param buffer The temporary buffer, reused between the calls to avoid allocations
+	\param getKey The function returning the u64 key of an item
+*/
+template <typename ItemType, typename GetKey>
+void radixSort(
+	std::vector<ItemType>& items,
+	std::vector<ItemType>& buffer,
+	GetKey getKey)
+{
+	constexpr u32 DIGIT_BITS = 8;
+	constexpr u32 DIGIT_VALUES = 1 << DIGIT_BITS;
+	constexpr u32 DIGITS = 64 / DIGIT_BITS;
+
+	const size_t count = items.size();
+	if (count < 2)
+	{
+		return;
+	}
+
+	// Histograms of all the digits in a single pass over the items
+	std::array<std::array<size_t, DIGIT_VALUES>, DIGITS> histograms{};
+	for (const ItemType& item : items)
+	{
+		const u64 key = getKey(item);
+		for (u32 digit = 0; digit < DIGITS; ++digit)
+		{
+			++histograms[digit][(key >> (digit * DIGIT_BITS)) & (DIGIT_VALUES - 1)];
+		}
+	}
+
+	buffer.resize(count);
+	std::vector<ItemType>* source = &items;
+	std::vector<ItemType>* target = &buffer;
+	for (u32 digit = 0; digit < DIGITS; ++digit)
+	{
+		std::array<size_t, DIGIT_VALUES>& histogram = histograms[digit];
+		const u32 shift = digit * DIGIT_BITS;
+		if (histogram[(getKey((*source)[0]) >> shift) & (DIGIT_VALUES - 1)] == count)
+		{
+			continue;
+		}
+
+		size_t offset = 0;
+		for (size_t& value : histogram)
+		{
+			const size_t valueCount = value;
+			value = offset;
+			offset += valueCount;
+		}
+
+		for (const ItemType& item : *source)
+		{
+			(*target)[histogram[(getKey(item) >> shift) & (DIGIT_VALUES - 1)]++] = item;
+		}
+		std::swap(source, target);
+	}
+
+	if (source != &items)
+	{
+		items.swap(buffer);
+	}
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,137 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <iterator>
+#include <map>
+#include <optional>
+
+#include "engine/core/Check.h"
+#include "engine/core/Types.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief First-fit free-list allocator of ranges [offset, offset + size) of a capacity.
+	The freed ranges are merged with the adjacent free ranges.
+	The allocator manages the offsets only, the storage is owned by the user.
+*/
+class RangeAllocator
+{
+public:
+	/// Constructor
+	explicit RangeAllocator(u32 capacity = 0) noexcept
+	{
+		reset(capacity, 0);
+	}
+
+	/// Returns the capacity
+	u32 getCapacity() const noexcept
+	{
+		return mCapacity;
+	}
+
+	/// Returns the total size of the free ranges
+	u32 getFreeSize() const noexcept
+	{
+		return mFreeSize;
+	}
+
+	/// Returns true if the free space is split into several ranges
+	bool isFragmented() const noexcept
+	{
+		return mFreeRanges.size() > 1;
+	}
+
+	/**
+		\brief Allocates a range
+		\return The range offset, or std::nullopt if there is no free range of the size
+	*/
+	std::optional<u32> allocate(u32 size) noexcept
+	{
+		if (size == 0)
+		{
+			return std::nullopt;
+		}
+
+		for (auto it = mFreeRanges.begin(); it != mFreeRanges.end(); ++it)
+		{
+			if (it->second >= size)
+			{
+				const u32 offset = it->first;
+				const u32 rest = it->second - size;
+				mFreeRanges.erase(it);
+				if (rest > 0)
+				{
+					mFreeRanges.emplace(offset + size, rest);
+				}
+				mFreeSize -= size;
+				return offset;
+			}
+		}
+		return std::nullopt;
+	}
+
+	/// Frees a range returned by allocate()
+	void free(u32 offset, u32 size) noexcept
+	{
+		if (size == 0 || !GLTUT_ASSERT(offset + size <= mCapacity))
+		{
+			return;
+		}
+		mFreeSize += size;
+
+		auto next = mFreeRanges.lower_bound(offset);
+		GLTUT_ASSERT(next == mFreeRanges.end() || next->first >= offset + size);
+		if (next != mFreeRanges.end() && next->first == offset + size)
+		{
+			size += next->second;
+			next = mFreeRanges.erase(next);
+		}
+
+		if (next != mFreeRanges.begin())
+		{
+			const auto previous = std::prev(next);
+			GLTUT_ASSERT(previous->first + previous->second <= offset);
+			if (previous->first + previous->second == offset)
+			{
+				previous->second += size;
+				return;
+			}
+		}
+		mFreeRanges.emplace(offset, size);
+	}
+
+	/**
+		\brief Resets the allocator to a capacity with the first usedSize elements allocated.
+		Used after the live ranges are compacted to the beginning of a storage
+	*/
+	void reset(u32 capacity, u32 usedSize) noexcept
+	{
+		GLTUT_ASSERT(usedSize <= capacity);
+		mCapacity = capacity;
+		mFreeSize = capacity - usedSize;
+		mFreeRanges.clear();
+		if (mFreeSize > 0)
+		{
+			mFreeRanges.emplace(usedSize, mFreeSize);
+		}
+	}
+
+private:
+	/// The capacity
+	u32 mCapacity = 0;
+
+	/// The total size of the free ranges
+	u32 mFreeSize = 0;
+
+	/// The free ranges, offset -> size
+	std::map<u32, u32> mFreeRanges;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,107 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "TaskPool.h"
+#include "engine/core/CpuProfiler.h"
+
+namespace gltut
+{
+// Global classes
+TaskPool::TaskPool(u32 threadCount)
+{
+	for (u32 i = 1; i < threadCount; ++i)
+	{
+		mWorkers.emplace_back(&TaskPool::work, this);
+	}
+}
+
+TaskPool::~TaskPool() noexcept
+{
+	{
+		std::lock_guard lock(mMutex);
+		mStop = true;
+	}
+	mJobStarted.notify_all();
+
+	for (auto& worker : mWorkers)
+	{
+		worker.join();
+	}
+}
+
+void TaskPool::run(u32 count, const std::function<void(u32)>& task) noexcept
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	if (mWorkers.empty() || count == 1)
+	{
+		for (u32 i = 0; i < count; ++i)
+		{
+			task(i);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard lock(mMutex);
+		mTask = &task;
+		mTaskCount = count;
+		mNextTask = 0;
+		mBusyWorkers = static_cast<u32>(mWorkers.size());
+		++mJob;
+	}
+	mJobStarted.notify_all();
+
+	execute();
+
+	std::unique_lock lock(mMutex);
+	mJobFinished.wait(lock, [this] { return mBusyWorkers == 0; });
+	mTask = nullptr;
+}
+
+void TaskPool::execute() noexcept
+{
+	for (u32 i = mNextTask.fetch_add(1); i < mTaskCount; i = mNextTask.fetch_add(1))
+	{
+		(*mTask)(i);
+	}
+}
+
+void TaskPool::work() noexcept
+{
+	GLTUT_PROFILE_THREAD("Task pool worker");
+	u64 lastJob = 0;
+	while (true)
+	{
+		{
+			std::unique_lock lock(mMutex);
+			mJobStarted.wait(lock, [this, lastJob] { return mStop || mJob != lastJob; });
+			if (mStop)
+			{
+				return;
+			}
+			lastJob = mJob;
+		}
+
+		execute();
+
+		bool finished = false;
+		{
+			std::lock_guard lock(mMutex);
+			finished = --mBusyWorkers == 0;
+		}
+
+		if (finished)
+		{
+			mJobFinished.notify_one();
+		}
+	}
+}
+
+// End of the namespace gltut
+}
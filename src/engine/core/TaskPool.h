@@ -0,0 +1,87 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/core/Types.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Pool of worker threads running indexed tasks.
+	The calling thread takes part in the execution,
+	so a pool without workers runs the tasks sequentially.
+*/
+class TaskPool : public NonCopyable
+{
+public:
+	/// Constructor. Starts (threadCount - 1) worker threads.
+	explicit TaskPool(u32 threadCount);
+
+	/// Destructor. Stops the worker threads.
+	~TaskPool() noexcept;
+
+	/// Returns the number of threads executing the tasks, including the calling one
+	u32 getThreadCount() const noexcept
+	{
+		return static_cast<u32>(mWorkers.size()) + 1;
+	}
+
+	/**
+		\brief Runs task(index) for every index in [0, count).
+		Returns when all the tasks are done.
+		The tasks must not throw exceptions.
+	*/
+	void run(u32 count, const std::function<void(u32)>& task) noexcept;
+
+private:
+	/// Runs the tasks of the current job until there are no tasks left
+	void execute() noexcept;
+
+	/// The worker thread function
+	void work() noexcept;
+
+	/// The worker threads
+	std::vector<std::thread> mWorkers;
+
+	/// The mutex guarding the job state
+	std::mutex mMutex;
+
+	/// Notifies the workers about a new job or the stop
+	std::condition_variable mJobStarted;
+
+	/// Notifies the calling thread about the job completion
+	std::condition_variable mJobFinished;
+
+	/// The task of the current job
+	const std::function<void(u32)>* mTask = nullptr;
+
+	/// The number of tasks in the current job
+	u32 mTaskCount = 0;
+
+	/// The index of the next task to run
+	std::atomic<u32> mNextTask = 0;
+
+	/// The number of workers busy with the current job
+	u32 mBusyWorkers = 0;
+
+	/// The job counter, used by the workers to detect new jobs
+	u64 mJob = 0;
+
+	/// The stop flag
+	bool mStop = false;
+};
+
+// End of the namespace gltut
+}
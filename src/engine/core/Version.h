@@ -0,0 +1,28 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <atomic>
+
+#include "engine/core/Types.h"
+
+namespace gltut
+{
+// Global functions
+/**
+	\brief Returns a new version, unique in the process.
+	The objects take the new versions on their changes, so an object created
+	at the address of a removed one does not repeat its version.
+	The version 0 is never returned
+*/
+inline u64 getNextVersion() noexcept
+{
+	static std::atomic<u64> version = 0;
+	return version.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+// End of the namespace gltut
+}
@@ -10,11 +10,12 @@ namespace gltut
 // Global classes
 FactoryC::FactoryC(
 	Renderer& renderer,
+	TaskPool& taskPool,
 	Scene& scene,
 	Window& window) noexcept :
 
 	mGeometry(*renderer.getDevice()),
-	mMaterial(renderer, scene),
+	mMaterial(renderer, taskPool, scene),
 	mRenderPass(renderer),
 	mTexture(*renderer.getDevice(), window),
 	mScene(renderer, mGeometry)
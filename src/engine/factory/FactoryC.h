@@ -5,6 +5,7 @@
 #pragma once
 
 // Includes
+#include "engine/core/CpuProfiler.h"
 #include "engine/core/NonCopyable.h"
 #include "engine/factory/Factory.h"
 
@@ -24,6 +25,7 @@ public:
 	// Constructor
 	FactoryC(
 		Renderer& renderer,
+		TaskPool& taskPool,
 		Scene& scene,
 		Window& window) noexcept;
 
@@ -60,6 +62,7 @@ public:
 	/// Updates the factory
 	void update() noexcept final
 	{
+		GLTUT_PROFILE_ZONE("FactoryC::update");
 		mMaterial.update();
 		mScene.update();
 	}
@@ -61,6 +61,7 @@ void FlatColorMaterialModelC::setTransparencyThreshold(float threshold) noexcept
 	if (thresholdInRange && pass != nullptr)
 	{
 		pass->getShader()->getTarget()->setFloat("transparencyThreshold", threshold);
+		pass->setDiscarding(threshold != 0.0f);
 	}
 }
 
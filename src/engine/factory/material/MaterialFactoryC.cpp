@@ -12,10 +12,13 @@ namespace gltut
 
 MaterialFactoryC::MaterialFactoryC(
 	Renderer& renderer,
+	TaskPool& taskPool,
 	Scene& scene) noexcept :
 
 	mRenderer(renderer),
-	mScene(scene)
+	mTaskPool(taskPool),
+	mScene(scene),
+	mTextureArrays(*renderer.getDevice())
 {
 }
 
@@ -65,7 +68,8 @@ FlatColorMaterialModel* MaterialFactoryC::createFlatColorMaterial(
 PhongShaderModel* MaterialFactoryC::createPhongShader(
 	u32 maxDirectionalLights,
 	u32 maxPointLights,
-	u32 maxSpotLights) noexcept
+	u32 maxSpotLights,
+	PhongShaderModel::TextureAccess textureAccess) noexcept
 {
 	PhongShaderModel* result = nullptr;
 	GLTUT_CATCH_ALL_BEGIN
@@ -75,11 +79,37 @@ PhongShaderModel* MaterialFactoryC::createPhongShader(
 		mScene,
 		maxDirectionalLights,
 		maxPointLights,
-		maxSpotLights);
+		maxSpotLights,
+		textureAccess,
+		nullptr);
 	GLTUT_CATCH_ALL_END("Cannot create a Phong shader")
 	return result;
 }
 
+PhongShaderModel* MaterialFactoryC::createClusteredPhongShader(
+	u32 maxDirectionalLights,
+	PhongShaderModel::TextureAccess textureAccess) noexcept
+{
+	PhongShaderModel* result = nullptr;
+	GLTUT_CATCH_ALL_BEGIN
+	createViewProjectionBuffer();
+	if (mLightClusters == nullptr)
+	{
+		mLightClusters = std::make_unique<LightClustersC>(*mRenderer.getDevice(), mTaskPool, mScene);
+	}
+
+	result = &mPhongShaders.emplace_back(
+		mRenderer,
+		mScene,
+		maxDirectionalLights,
+		0,
+		0,
+		textureAccess,
+		mLightClusters.get());
+	GLTUT_CATCH_ALL_END("Cannot create a clustered Phong shader")
+	return result;
+}
+
 PhongMaterialModel* MaterialFactoryC::createPhongMaterial(
 	const PhongShaderModel* phongShader,
 	bool castShadows) noexcept
@@ -101,7 +131,8 @@ PhongMaterialModel* MaterialFactoryC::createPhongMaterial(
 		mScene,
 		*phongShader,
 		castShadows ? mDepthShader : nullptr,
-		*mViewProjectionBuffer->getTarget());
+		*mViewProjectionBuffer->getTarget(),
+		mTextureArrays);
 	GLTUT_CATCH_ALL_END("Cannot create a Phong material model")
 	return result;
 }
@@ -157,6 +188,10 @@ void MaterialFactoryC::createDepthShader()
 
 void MaterialFactoryC::update() noexcept
 {
+	if (mLightClusters != nullptr)
+	{
+		mLightClusters->update();
+	}
 }
 
 // End of the namespace gltut
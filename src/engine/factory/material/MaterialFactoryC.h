@@ -10,8 +10,11 @@
 #include "engine/renderer/Renderer.h"
 #include <deque>
 #include <map>
+#include <memory>
 
+#include "../shader/LightClustersC.h"
 #include "../shader/PhongShaderModelC.h"
+#include "../texture/TextureArrayPoolC.h"
 #include "./FlatColorMaterialModelC.h"
 #include "./PhongMaterialModelC.h"
 
@@ -22,8 +25,9 @@ class MaterialFactoryC final : public MaterialFactory, public NonCopyable
 {
 public:
 	/// Constructor
-	explicit MaterialFactoryC(
+	MaterialFactoryC(
 		Renderer& renderer,
+		TaskPool& taskPool,
 		Scene& scene) noexcept;
 
 	/// Destructor
@@ -37,7 +41,13 @@ public:
 	PhongShaderModel* createPhongShader(
 		u32 maxDirectionalLights,
 		u32 maxPointLights,
-		u32 maxSpotLights) noexcept final;
+		u32 maxSpotLights,
+		PhongShaderModel::TextureAccess textureAccess = PhongShaderModel::TextureAccess::SLOTS) noexcept final;
+
+	/// Creates a Phong shader shading the clustered lights
+	PhongShaderModel* createClusteredPhongShader(
+		u32 maxDirectionalLights,
+		PhongShaderModel::TextureAccess textureAccess = PhongShaderModel::TextureAccess::SLOTS) noexcept final;
 
 	/// Creates a Phong material model
 	PhongMaterialModel* createPhongMaterial(
@@ -63,6 +73,9 @@ private:
 	/// The device
 	Renderer& mRenderer;
 
+	/// The worker threads of the renderer
+	TaskPool& mTaskPool;
+
 	/// The scene
 	Scene& mScene;
 
@@ -75,6 +88,12 @@ private:
 	/// Depth shader binding
 	ShaderRendererBinding* mDepthShader = nullptr;
 
+	/// The light clusters of the clustered Phong shaders, created with the first one
+	std::unique_ptr<LightClustersC> mLightClusters;
+
+	/// The texture arrays of the Phong materials, outlive the material models
+	TextureArrayPoolC mTextureArrays;
+
 	/// Flat color material models
 	std::deque<FlatColorMaterialModelC> mFlatColorModels;
 
@@ -4,35 +4,77 @@
 
 // Includes
 #include "PhongMaterialModelC.h"
+#include <string>
+
 #include "engine/factory/material/MaterialPassIndex.h"
 
 namespace gltut
 {
+
+namespace
+{
+// Local constants
+/// The shading cost of the diffuse and specular samples
+constexpr float SURFACE_COST = 2.0f;
+
+/// The shading cost of the normal map sample
+constexpr float NORMAL_MAP_COST = 1.0f;
+
+/// The shading cost of the parallax mapping, the shader samples the height 8 to 32 times
+constexpr float PARALLAX_COST = 20.0f;
+
+/// The shading cost of a shadow map, sampled by the 3x3 PCF
+constexpr float SHADOW_MAP_COST = 9.0f;
+
+/// The names of the material textures in the order of their slots
+const char* MATERIAL_TEXTURE_NAMES[PhongShaderModel::TEXTURE_SLOTS_COUNT] = {
+	"diffuse",
+	"specular",
+	"normal",
+	"depth"};
+
+// End of the anonymous namespace
+}
+
 // Global classes
 PhongMaterialModelC::PhongMaterialModelC(
 	Renderer& renderer,
 	Scene& scene,
 	const PhongShaderModel& phongShader,
 	ShaderRendererBinding* depthShader,
-	const ShaderUniformBuffer& viewProjectionBuffer) :
+	const ShaderUniformBuffer& viewProjectionBuffer,
+	TextureArrayPoolC& textureArrays) :
 
 	MaterialModelT<PhongMaterialModel>(renderer),
 	mScene(scene),
-	mPhongShader(phongShader)
+	mPhongShader(phongShader),
+	mTextureArrays(textureArrays)
 {
+	const LightClusters* lightClusters = phongShader.getLightClusters();
 	MaterialPass* lightingPass = getMaterial().createPass(
 		static_cast<u32>(MaterialPassIndex::LIGHTING),
 		phongShader.getShader(),
 		PhongShaderModel::TEXTURE_SLOTS_COUNT +
 			phongShader.getMaxDirectionalLights() +
 			phongShader.getMaxSpotLights(),
-		1); // No uniform buffers
+		lightClusters != nullptr ? LightClusters::CLUSTERS_BUFFER_BINDING_POINT + 1 : 1);
 
 	GLTUT_CHECK(lightingPass != nullptr, "Failed to create a material pass");
 	lightingPass->getShaderUniformBuffers()->set(
 		&viewProjectionBuffer,
 		PhongShaderModel::VIEW_PROJECTION_BUFFER_BINDING_POINT);
 
+	if (lightClusters != nullptr)
+	{
+		lightingPass->getShaderUniformBuffers()->set(
+			lightClusters->getLightsBuffer(),
+			LightClusters::LIGHTS_BUFFER_BINDING_POINT);
+
+		lightingPass->getShaderUniformBuffers()->set(
+			lightClusters->getClustersBuffer(),
+			LightClusters::CLUSTERS_BUFFER_BINDING_POINT);
+	}
+
 	if (depthShader != nullptr)
 	{
 		MaterialPass* depthPass = getMaterial().createPass(
@@ -55,39 +97,58 @@ PhongMaterialModelC::PhongMaterialModelC(
 	mTextureSetBinding = mScene.createTextureSetBinding(lightingPass->getTextures());
 	GLTUT_CHECK(mTextureSetBinding != nullptr, "Failed to create a texture set binding");
 
-	mTextureSetBinding->bind(
-		SceneTextureSetBinding::Parameter::DIRECTIONAL_LIGHT_SHADOW_MAP,
-		PhongShaderModel::TEXTURE_SLOTS_COUNT);
+	if (phongShader.getMaxDirectionalLights() > 0)
+	{
+		mTextureSetBinding->bind(
+			SceneTextureSetBinding::Parameter::DIRECTIONAL_LIGHT_SHADOW_MAP,
+			PhongShaderModel::TEXTURE_SLOTS_COUNT);
+	}
+
+	// The clustered spot lights have no shadow maps
+	if (phongShader.getMaxSpotLights() > 0)
+	{
+		mTextureSetBinding->bind(
+			SceneTextureSetBinding::Parameter::SPOT_LIGHT_SHADOW_MAP,
+			PhongShaderModel::TEXTURE_SLOTS_COUNT + phongShader.getMaxDirectionalLights());
+	}
 
-	mTextureSetBinding->bind(
-		SceneTextureSetBinding::Parameter::SPOT_LIGHT_SHADOW_MAP,
-		PhongShaderModel::TEXTURE_SLOTS_COUNT + phongShader.getMaxDirectionalLights());
+	setShininess(PhongShaderModel::DEFAULT_SHINESS);
+	updateCost();
 }
 
 PhongMaterialModelC::~PhongMaterialModelC() noexcept
 {
 	mScene.removeTextureSetBinding(mTextureSetBinding);
+	if (mPhongShader.getTextureAccess() == PhongShaderModel::TextureAccess::ARRAYS)
+	{
+		for (const Texture* texture : mTextures)
+		{
+			mTextureArrays.release(texture);
+		}
+	}
 }
 
 void PhongMaterialModelC::setDiffuse(const Texture* diffuse) noexcept
 {
-	getMaterial()[0]->getTextures()->setTexture(diffuse, 0);
+	setMaterialTexture(0, diffuse);
 }
 
 void PhongMaterialModelC::setSpecular(const Texture* specular) noexcept
 {
-	getMaterial()[0]->getTextures()->setTexture(specular, 1);
+	setMaterialTexture(1, specular);
 }
 
 void PhongMaterialModelC::setNormal(const Texture* normal) noexcept
 {
-	getMaterial()[0]->getTextures()->setTexture(normal, 2);
+	setMaterialTexture(2, normal);
 	getMaterial()[0]->getShaderArguments()->setInt("normalMap", normal != nullptr);
+	mNormalMap = normal != nullptr;
+	updateCost();
 }
 
 void PhongMaterialModelC::setDepth(const Texture* height) noexcept
 {
-	getMaterial()[0]->getTextures()->setTexture(height, 3);
+	setMaterialTexture(3, height);
 	if (height == nullptr)
 	{
 		setDepthScale(0.0f);
@@ -97,6 +158,8 @@ void PhongMaterialModelC::setDepth(const Texture* height) noexcept
 void PhongMaterialModelC::setDepthScale(float depthScale) noexcept
 {
 	getMaterial()[0]->getShaderArguments()->setFloat("depthScale", depthScale);
+	mDepthScale = depthScale;
+	updateCost();
 }
 
 void PhongMaterialModelC::setShininess(float shininess) noexcept
@@ -104,5 +167,64 @@ void PhongMaterialModelC::setShininess(float shininess) noexcept
 	getMaterial()[0]->getShaderArguments()->setFloat("shininess", shininess);
 }
 
+void PhongMaterialModelC::setMaterialTexture(u32 slot, const Texture* texture) noexcept
+{
+	MaterialPass* lightingPass = getMaterial()[0];
+	const std::string name = MATERIAL_TEXTURE_NAMES[slot];
+	switch (mPhongShader.getTextureAccess())
+	{
+	case PhongShaderModel::TextureAccess::SLOTS:
+		lightingPass->getTextures()->setTexture(texture, slot);
+		break;
+
+	case PhongShaderModel::TextureAccess::ARRAYS:
+	{
+		// Acquires before releasing, so a texture set again keeps its layer
+		const TextureArrayPoolC::Layer layer = mTextureArrays.acquire(texture);
+		mTextureArrays.release(mTextures[slot]);
+		lightingPass->getTextures()->setTexture(layer.array, slot);
+		lightingPass->getShaderArguments()->setFloat(
+			(name + "Layer").c_str(),
+			static_cast<float>(layer.index));
+		break;
+	}
+
+	case PhongShaderModel::TextureAccess::BINDLESS:
+	{
+		// The texture slot stays empty, the handle is in the material parameter block
+		const u64 handle = texture != nullptr ? texture->getBindlessHandle() : 0;
+		lightingPass->getShaderArguments()->setUvec2(
+			(name + "Texture").c_str(),
+			static_cast<u32>(handle),
+			static_cast<u32>(handle >> 32));
+		break;
+	}
+	}
+	mTextures[slot] = texture;
+}
+
+void PhongMaterialModelC::updateCost() noexcept
+{
+	MaterialPass* lightingPass = getMaterial()[0];
+	float cost = SURFACE_COST +
+		SHADOW_MAP_COST * static_cast<float>(
+			mPhongShader.getMaxDirectionalLights() + mPhongShader.getMaxSpotLights());
+
+	if (mNormalMap)
+	{
+		cost += NORMAL_MAP_COST;
+	}
+
+	// The parallax mapping discards the fragments whose shifted texture coordinates are out of the texture
+	const bool parallax = mDepthScale > 0.0f;
+	if (parallax)
+	{
+		cost += PARALLAX_COST;
+	}
+
+	lightingPass->setCost(cost);
+	lightingPass->setDiscarding(parallax);
+}
+
 // End of the namespace gltut
 }
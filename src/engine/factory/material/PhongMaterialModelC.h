@@ -5,7 +5,10 @@
 #pragma once
 
 // Includes
+#include <array>
+
 #include "./MaterialModelT.h"
+#include "../texture/TextureArrayPoolC.h"
 #include "engine/factory/material/PhongMaterialModel.h"
 #include "engine/scene/Scene.h"
 
@@ -22,7 +25,8 @@ public:
 		Scene& scene,
 		const PhongShaderModel& phongShader,
 		ShaderRendererBinding* depthShader,
-		const ShaderUniformBuffer& viewProjectionBuffer);
+		const ShaderUniformBuffer& viewProjectionBuffer,
+		TextureArrayPoolC& textureArrays);
 
 	/// Virtual destructor
 	~PhongMaterialModelC() noexcept final;
@@ -52,14 +56,32 @@ public:
 	void setShininess(float shininess) noexcept final;
 
 private:
+	/// Sets a material texture by the texture access of the Phong shader
+	void setMaterialTexture(u32 slot, const Texture* texture) noexcept;
+
+	/// Updates the estimated shading cost of the lighting pass
+	void updateCost() noexcept;
+
 	/// The scene
 	Scene& mScene;
 
 	/// The Phong shader model
 	const PhongShaderModel& mPhongShader;
 
+	/// The texture arrays
+	TextureArrayPoolC& mTextureArrays;
+
+	/// The material textures by their slots
+	std::array<const Texture*, PhongShaderModel::TEXTURE_SLOTS_COUNT> mTextures{};
+
 	/// The texture set binding
 	SceneTextureSetBinding* mTextureSetBinding = nullptr;
+
+	/// If the normal texture is set
+	bool mNormalMap = false;
+
+	/// The height scale
+	float mDepthScale = 0.0f;
 };
 
 // End of the namespace gltut
@@ -271,7 +271,7 @@ RenderPass* RenderPassFactoryC::createTexturesToWindowRenderPass(
 			quadRenderGeometry != nullptr,
 			"Failed to create render quadRenderGeometry for texture-to-window render pass");
 
-		return mRenderer.createPass(
+		RenderPass* result = mRenderer.createPass(
 			nullptr, // No viewpoint
 			quadRenderGeometry,
 			mRenderer.getDevice()->getFramebuffers()->getDefault(),
@@ -280,6 +280,18 @@ RenderPass* RenderPassFactoryC::createTexturesToWindowRenderPass(
 			true,	 // Depth clearing
 			viewport);
 
+		GLTUT_CHECK(
+			result != nullptr,
+			"Failed to create textures-to-window render pass");
+		result->setName("Textures to window");
+
+		// The passes writing the textures go first
+		for (u32 i = 0; i < texturesCount; ++i)
+		{
+			result->addInput(textures[i]);
+		}
+		return result;
+
 		/// \todo: add render pass without depth test
 	}
 	GLTUT_CATCH_ALL("Failed to create textures-to-window render pass");
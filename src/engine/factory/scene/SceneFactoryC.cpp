@@ -159,6 +159,7 @@ bool SceneFactoryC::createSkybox(
 		);
 
 		GLTUT_CHECK(skyboxPass != nullptr, "Failed to create skybox render pass");
+		skyboxPass->setName("Skybox");
 		// Set the depth function to less equal since the z-buffer is filled with 1.0 and
 		// we force the skybox depth to 1.0 in the vertex shader
 		skyboxPass->setDepthTest(DepthTestMode::LEQUAL);
@@ -4,6 +4,9 @@
 
 // Includes
 #include "ShadowMapC.h"
+
+#include <algorithm>
+
 #include "engine/factory/material/MaterialPassIndex.h"
 
 namespace gltut
@@ -109,7 +112,9 @@ ShadowMapC::ShadowMapC(
 		nullptr);
 
 	GLTUT_CHECK(mRenderPass != nullptr, "Failed to create shadow map render pass");
+	mRenderPass->setName("Shadow map");
 	mRenderer.setPassPriority(mRenderPass, SHADOW_PASS_PRIORITY);
+	mRenderPass->setLodBias(SHADOW_LOD_BIAS);
 	update();
 }
 
@@ -122,6 +127,7 @@ ShadowMapC::~ShadowMapC() noexcept
 
 void ShadowMapC::update() noexcept
 {
+	const Matrix4 shadowMatrix = getShadowMatrix();
 	const Vector3 position = mLight.getGlobalTransform().getTranslation();
 	const Vector3 target = position + mLight.getGlobalDirection();
 
@@ -143,6 +149,12 @@ void ShadowMapC::update() noexcept
 				mFrustumNear,
 				mFrustumFar));
 	}
+
+	const Matrix4 newShadowMatrix = getShadowMatrix();
+	if (!std::equal(shadowMatrix.data(), shadowMatrix.data() + 16, newShadowMatrix.data()))
+	{
+		mVersion = getNextVersion();
+	}
 }
 
 // End of the namespace gltut
@@ -10,6 +10,7 @@
 #include "engine/graphics/texture/Texture.h"
 #include "engine/scene/nodes/LightNode.h"
 
+#include "../../core/Version.h"
 #include "../../renderer/viewpoint/ViewpointC.h"
 
 namespace gltut
@@ -22,6 +23,9 @@ public:
 	/// The priority of the shadow pass in the render pipeline
 	static constexpr int32 SHADOW_PASS_PRIORITY = -1000;
 
+	/// The number of the coarser levels of detail of the shadow casters, the shadows hide their details
+	static constexpr u32 SHADOW_LOD_BIAS = 1;
+
 	/**
 		Directional light constructor
 		\throw std::runtime_error
@@ -91,6 +95,12 @@ public:
 		return mFrustumFar;
 	}
 
+	/// Returns the version of the shadow matrix
+	u64 getVersion() const noexcept final
+	{
+		return mVersion;
+	}
+
 private:
 	// Private constructor for directional and spot lights
 	ShadowMapC(
@@ -125,6 +135,9 @@ private:
 
 	/// The viewpoint for the shadow map
 	ViewpointC mViewpoint;
+
+	/// The version of the shadow matrix
+	u64 mVersion = getNextVersion();
 };
 
 // End of the namespace gltut
@@ -20,19 +20,37 @@ uniform mat4 model;
 uniform mat4 view;
 uniform mat4 projection;
 
+// Per-draw data of the object buffer
+layout (std140) uniform Object
+{
+	mat4 objectModel;
+	mat3 objectNormalMat;
+};
+
+// The source of the matrices: 0 - uniforms, 1 - instance attributes, 2 - object buffer
+uniform int matrixSource;
+
 // Inputs
 layout (location = 0) in vec3 inPos;
 layout (location = 1) in vec3 inNormal;
 layout (location = 2) in vec2 inTexCoord;
+layout (location = 9) in mat4 instanceModel;
+
+// The depth of the depth pre-pass must match the one of the lighting shaders exactly,
+// so the position is computed by the same expression as in the Phong shader
+invariant gl_Position;
 
 void main()
 {
-	gl_Position = projection * view * model * vec4(inPos, 1.0f);
+	mat4 modelMat = matrixSource == 1 ? instanceModel : (matrixSource == 2 ? objectModel : model);
+	vec4 modelPos = modelMat * vec4(inPos, 1.0f);
+	gl_Position = projection * view * modelPos;
 })";
 
 // Fragment shader source code for flat color shading
 const char* DEPTH_FRAGMENT_SHADER = R"(
 #version 330 core
+// Software rasterizer program: depth
 void main()
 {
 })";
@@ -43,10 +61,19 @@ void main()
 // Global functions
 ShaderRendererBinding* createDepthShader(Renderer& renderer) noexcept
 {
-	return createStandardShaderBinding(
+	ShaderRendererBinding* result = createStandardShaderBinding(
 		&renderer,
 		DEPTH_VERTEX_SHADER,
 		DEPTH_FRAGMENT_SHADER);
+
+	if (result != nullptr)
+	{
+		result->bind(RendererBinding::Parameter::GEOMETRY_MATRIX_SOURCE, "matrixSource");
+		result->getTarget()->setUniformBlockBindingPoint(
+			"Object",
+			RendererBinding::OBJECT_BUFFER_BINDING_POINT);
+	}
+	return result;
 }
 
 // End of the namespace gltut
@@ -23,23 +23,36 @@ layout (std140) uniform ViewProjection
 };
 uniform mat4 model;
 
+// Per-draw data of the object buffer
+layout (std140) uniform Object
+{
+	mat4 objectModel;
+	mat3 objectNormalMat;
+};
+
+// The source of the matrices: 0 - uniforms, 1 - instance attributes, 2 - object buffer
+uniform int matrixSource;
+
 // Inputs
 layout (location = 0) in vec3 inPos;
 layout (location = 1) in vec3 inNormal;
 layout (location = 2) in vec2 inTexCoord;
+layout (location = 9) in mat4 instanceModel;
 
 // Outputs
 out vec2 texCoord;
 
 void main()
 {
-	gl_Position = projection * view * model * vec4(inPos, 1.0f);
+	mat4 modelMat = matrixSource == 1 ? instanceModel : (matrixSource == 2 ? objectModel : model);
+	gl_Position = projection * view * modelMat * vec4(inPos, 1.0f);
 	texCoord = inTexCoord;
 })";
 
 // Fragment shader source code for flat color shading
 const char* FLAT_COLOR_FRAGMENT_SHADER = R"(
 #version 330 core
+// Software rasterizer program: flat_color
 
 // Uniforms
 uniform sampler2D colorSampler;
@@ -77,11 +90,15 @@ ShaderRendererBinding* createFlatColorShader(Renderer& renderer) noexcept
 		return result;
 	}
 
+	result->bind(RendererBinding::Parameter::GEOMETRY_MATRIX_SOURCE, "matrixSource");
 	result->getTarget()->setInt("colorSampler", 0);
 	result->getTarget()->setFloat("transparencyThreshold", 0.0f);
 	result->getTarget()->setUniformBlockBindingPoint(
 		"ViewProjection",
 		0); // Binding point 0 for view/projection matrix uniform buffer
+	result->getTarget()->setUniformBlockBindingPoint(
+		"Object",
+		RendererBinding::OBJECT_BUFFER_BINDING_POINT);
 	return result;
 }
 
@@ -0,0 +1,467 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "LightClustersC.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "engine/core/Check.h"
+#include "engine/core/CpuProfiler.h"
+#include "../../core/Float4.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The number of the lights tested at once
+constexpr u32 LANES = 4;
+
+/// The packed inner angle cosine of a point light, a spot light lit in all the directions
+constexpr float POINT_LIGHT_INNER_ANGLE_COS = -1.0f;
+
+/// The packed outer angle cosine of a point light
+constexpr float POINT_LIGHT_OUTER_ANGLE_COS = -2.0f;
+
+/// The light indices per cluster kept when the depth slices are lowered to the uniform block size
+constexpr u32 MIN_CLUSTER_LIGHT_INDICES = 4;
+
+// Local functions
+/// Returns the maximum color component
+float getMaxComponent(const Color& color) noexcept
+{
+	return std::max({color.r, color.g, color.b});
+}
+
+/**
+	\brief Returns the distance where the attenuated diffuse and specular colors of a light
+	fall below the intensity cutoff, infinity for a not attenuated light
+*/
+float getInfluenceRadius(const LightNode& light) noexcept
+{
+	// intensity / (1 + linear * radius + quadratic * radius^2) = cutoff
+	const float attenuation =
+		(getMaxComponent(light.getDiffuse()) + getMaxComponent(light.getSpecular())) /
+			LightClusters::INTENSITY_CUTOFF -
+		1.0f;
+
+	if (attenuation <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	const float linear = light.getLinearAttenuation();
+	const float quadratic = light.getQuadraticAttenuation();
+	if (quadratic > 0.0f)
+	{
+		return (std::sqrt(linear * linear + 4.0f * quadratic * attenuation) - linear) / (2.0f * quadratic);
+	}
+
+	if (linear > 0.0f)
+	{
+		return attenuation / linear;
+	}
+	return std::numeric_limits<float>::infinity();
+}
+
+/// Returns the point of a line at a view depth
+Vector3 getPointAtDepth(const Vector3& nearPoint, const Vector3& farPoint, float depth) noexcept
+{
+	const float length = farPoint.z - nearPoint.z;
+	const float t = length != 0.0f ? (-depth - nearPoint.z) / length : 0.0f;
+	return nearPoint + (farPoint - nearPoint) * t;
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+LightClustersC::LightClustersC(GraphicsDevice& device, TaskPool& taskPool, const Scene& scene) :
+	mDevice(device),
+	mScene(scene),
+	mTaskPool(taskPool),
+	mLights(MAX_LIGHTS * LIGHT_FLOATS),
+	mClusters(std::make_unique<ClustersBlock>()),
+	mMinX(CLUSTER_COUNT),
+	mMinY(CLUSTER_COUNT),
+	mMinZ(CLUSTER_COUNT),
+	mMaxX(CLUSTER_COUNT),
+	mMaxY(CLUSTER_COUNT),
+	mMaxZ(CLUSTER_COUNT)
+{
+	static_assert(offsetof(ClustersBlock, lists) == 112);
+	static_assert(SLICE_CLUSTER_COUNT % 4 == 0 && MAX_LIGHT_INDICES % 8 == 0);
+	static_assert(MAX_LIGHTS <= 0xFFFF && MAX_LIGHT_INDICES <= 0xFFFF);
+
+	// OpenGL 3.3 guarantees only 16 KiB, so the grid and the capacities are lowered to the device limit.
+	// A slice takes the lists of its clusters and a budget of the light indices
+	const u32 blockSize = mDevice.getMaxShaderUniformBlockSize();
+	const u32 listsOffset = static_cast<u32>(offsetof(ClustersBlock, lists));
+	constexpr u32 SLICE_SIZE = SLICE_CLUSTER_COUNT * (sizeof(u32) + MIN_CLUSTER_LIGHT_INDICES * sizeof(u16));
+	GLTUT_CHECK(
+		blockSize >= listsOffset + SLICE_SIZE,
+		"The uniform block size limit of the device (" + std::to_string(blockSize) +
+			" bytes) is too small for the light clusters, " +
+			std::to_string(listsOffset + SLICE_SIZE) + " bytes are required");
+
+	mClusterCountZ = std::min(CLUSTER_COUNT_Z, (blockSize - listsOffset) / SLICE_SIZE);
+	mClusterCount = SLICE_CLUSTER_COUNT * mClusterCountZ;
+	mLightCapacity = std::min(MAX_LIGHTS, blockSize / static_cast<u32>(LIGHT_FLOATS * sizeof(float)));
+
+	// The indices are uploaded as uvec4, 8 per element
+	const u32 indicesOffset = listsOffset + mClusterCount * static_cast<u32>(sizeof(u32));
+	mLightIndexCapacity = std::min(
+		MAX_LIGHT_INDICES,
+		(blockSize - indicesOffset) / static_cast<u32>(sizeof(u16)) / 8 * 8);
+
+	std::memset(mClusters.get(), 0, sizeof(ClustersBlock));
+	mCenterX.reserve(MAX_LIGHTS);
+	mCenterY.reserve(MAX_LIGHTS);
+	mCenterZ.reserve(MAX_LIGHTS);
+	mRadius.reserve(MAX_LIGHTS);
+
+	mLightsBuffer = mDevice.getShaderUniformBuffers()->create(mLightCapacity * LIGHT_FLOATS * sizeof(float));
+	GLTUT_CHECK(mLightsBuffer != nullptr, "Failed to create the clustered lights uniform buffer");
+
+	mClustersBuffer = mDevice.getShaderUniformBuffers()->create(indicesOffset + mLightIndexCapacity * sizeof(u16));
+	GLTUT_CHECK(mClustersBuffer != nullptr, "Failed to create the light clusters uniform buffer");
+}
+
+LightClustersC::~LightClustersC() noexcept
+{
+	mDevice.getShaderUniformBuffers()->remove(mLightsBuffer);
+	mDevice.getShaderUniformBuffers()->remove(mClustersBuffer);
+}
+
+void LightClustersC::update() noexcept
+{
+	GLTUT_PROFILE_ZONE("LightClustersC::update");
+	const Camera* camera = mScene.getActiveCamera();
+	const Matrix4 view = camera != nullptr ? camera->getView().getMatrix() : Matrix4::identity();
+	// The lights without attenuation do not reach beyond the far plane distance
+	packLights(
+		view,
+		camera != nullptr ?
+			camera->getProjection().getFarPlane() :
+			std::numeric_limits<float>::infinity());
+
+	if (camera != nullptr)
+	{
+		const CameraProjection& projection = camera->getProjection();
+		updateClusterBounds(projection.getMatrix(), projection.getNearPlane(), projection.getFarPlane());
+
+		const Matrix4 viewProjection = projection.getMatrix() * view;
+		std::memcpy(mClusters->viewProjection, viewProjection.data(), sizeof(mClusters->viewProjection));
+		// The view depth is the negated view space z
+		for (u32 i = 0; i < 4; ++i)
+		{
+			mClusters->viewDepth[i] = -view.data()[i * 4 + 2];
+		}
+
+		const float scale = static_cast<float>(mClusterCountZ) / std::log(mFarPlane / mNearPlane);
+		mClusters->depthSlicing[0] = scale;
+		mClusters->depthSlicing[1] = -std::log(mNearPlane) * scale;
+
+		mTaskPool.run(
+			mClusterCountZ,
+			[this](u32 slice)
+			{
+				binSlice(slice);
+			});
+		joinSlices();
+	}
+	else
+	{
+		// Without the camera only the ambient colors are shaded
+		std::memset(mClusters->viewProjection, 0, sizeof(mClusters->viewProjection));
+		std::memset(mClusters->lists, 0, mClusterCount * sizeof(u32));
+		mLightIndexCount = 0;
+		mDroppedLightIndexCount = 0;
+		mMaxClusterLightCount = 0;
+	}
+
+	if (mLightCount > 0)
+	{
+		mLightsBuffer->setData(mLights.data(), mLightCount * LIGHT_FLOATS * sizeof(float), 0);
+	}
+
+	// Uploads only the used light indices
+	const u32 listsSize = (mClusterCount + (mLightIndexCount + 1) / 2) * static_cast<u32>(sizeof(u32));
+	mClustersBuffer->setData(
+		mClusters.get(),
+		static_cast<u32>(offsetof(ClustersBlock, lists)) + listsSize,
+		0);
+}
+
+void LightClustersC::packLights(const Matrix4& view, float maxRadius) noexcept
+{
+	mCenterX.clear();
+	mCenterY.clear();
+	mCenterZ.clear();
+	mRadius.clear();
+	mLightCount = 0;
+	mDroppedLightCount = 0;
+
+	Vector3 ambient(0.0f, 0.0f, 0.0f);
+	for (u32 i = 0; i < mScene.getLightCount(); ++i)
+	{
+		const LightNode* light = mScene.getLight(i);
+		if (light == nullptr || light->getType() == LightNode::Type::DIRECTIONAL)
+		{
+			continue;
+		}
+
+		ambient += toVector3(light->getAmbient());
+		if (mLightCount == mLightCapacity)
+		{
+			++mDroppedLightCount;
+			continue;
+		}
+
+		const float radius = std::min(getInfluenceRadius(*light), maxRadius);
+		if (radius <= 0.0f)
+		{
+			continue;
+		}
+
+		// A point light is packed as a spot light lit in all the directions
+		const bool spot = light->getType() == LightNode::Type::SPOT;
+		const Vector3 position = light->getGlobalTransform().getTranslation();
+		const Vector3 direction = spot ? light->getGlobalDirection() : Vector3(0.0f, 0.0f, 0.0f);
+		const Vector3 diffuse = toVector3(light->getDiffuse());
+		const Vector3 specular = toVector3(light->getSpecular());
+
+		float* packed = mLights.data() + mLightCount * LIGHT_FLOATS;
+		packed[0] = position.x;
+		packed[1] = position.y;
+		packed[2] = position.z;
+		packed[3] = light->getQuadraticAttenuation();
+		packed[4] = direction.x;
+		packed[5] = direction.y;
+		packed[6] = direction.z;
+		packed[7] = spot ? std::cos(light->getInnerAngle()) : POINT_LIGHT_INNER_ANGLE_COS;
+		packed[8] = diffuse.x;
+		packed[9] = diffuse.y;
+		packed[10] = diffuse.z;
+		packed[11] = spot ? std::cos(light->getOuterAngle()) : POINT_LIGHT_OUTER_ANGLE_COS;
+		packed[12] = specular.x;
+		packed[13] = specular.y;
+		packed[14] = specular.z;
+		packed[15] = light->getLinearAttenuation();
+
+		const Vector3 center = view * position;
+		mCenterX.push_back(center.x);
+		mCenterY.push_back(center.y);
+		mCenterZ.push_back(center.z);
+		mRadius.push_back(radius);
+		++mLightCount;
+	}
+
+	mClusters->ambient[0] = ambient.x;
+	mClusters->ambient[1] = ambient.y;
+	mClusters->ambient[2] = ambient.z;
+	mClusters->ambient[3] = 0.0f;
+}
+
+void LightClustersC::updateClusterBounds(
+	const Matrix4& projection,
+	float nearPlane,
+	float farPlane) noexcept
+{
+	if (std::memcmp(projection.data(), mProjection.data(), sizeof(float) * 16) == 0 &&
+		nearPlane == mNearPlane &&
+		farPlane == mFarPlane)
+	{
+		return;
+	}
+
+	mProjection = projection;
+	mNearPlane = nearPlane;
+	mFarPlane = farPlane;
+	for (u32 slice = 0; slice <= mClusterCountZ; ++slice)
+	{
+		mSliceDepths[slice] = nearPlane * std::pow(
+			farPlane / nearPlane,
+			static_cast<float>(slice) / static_cast<float>(mClusterCountZ));
+	}
+
+	// The view space lines of the tile corners, from the near to the far plane
+	Matrix4 inverse;
+	GLTUT_CATCH_ALL_BEGIN
+	inverse = projection.getInverse();
+	GLTUT_CATCH_ALL_END("Cannot invert the projection matrix of the light clusters")
+
+	constexpr u32 CORNERS_X = CLUSTER_COUNT_X + 1;
+	constexpr u32 CORNERS_Y = CLUSTER_COUNT_Y + 1;
+	std::array<Vector3, CORNERS_X * CORNERS_Y> nearCorners;
+	std::array<Vector3, CORNERS_X * CORNERS_Y> farCorners;
+	for (u32 y = 0; y < CORNERS_Y; ++y)
+	{
+		for (u32 x = 0; x < CORNERS_X; ++x)
+		{
+			const float ndcX = -1.0f + 2.0f * static_cast<float>(x) / static_cast<float>(CLUSTER_COUNT_X);
+			const float ndcY = -1.0f + 2.0f * static_cast<float>(y) / static_cast<float>(CLUSTER_COUNT_Y);
+			nearCorners[x + y * CORNERS_X] = inverse * Vector3(ndcX, ndcY, -1.0f);
+			farCorners[x + y * CORNERS_X] = inverse * Vector3(ndcX, ndcY, 1.0f);
+		}
+	}
+
+	for (u32 slice = 0; slice < mClusterCountZ; ++slice)
+	{
+		for (u32 y = 0; y < CLUSTER_COUNT_Y; ++y)
+		{
+			for (u32 x = 0; x < CLUSTER_COUNT_X; ++x)
+			{
+				Vector3 min(
+					std::numeric_limits<float>::max(),
+					std::numeric_limits<float>::max(),
+					std::numeric_limits<float>::max());
+				Vector3 max = -min;
+				for (u32 corner = 0; corner < 8; ++corner)
+				{
+					const u32 index = (x + (corner & 1)) + (y + ((corner >> 1) & 1)) * CORNERS_X;
+					const Vector3 point = getPointAtDepth(
+						nearCorners[index],
+						farCorners[index],
+						mSliceDepths[slice + (corner >> 2)]);
+					min = Vector3(std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z));
+					max = Vector3(std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z));
+				}
+
+				const u32 cluster = x + CLUSTER_COUNT_X * (y + CLUSTER_COUNT_Y * slice);
+				mMinX[cluster] = min.x;
+				mMinY[cluster] = min.y;
+				mMinZ[cluster] = min.z;
+				mMaxX[cluster] = max.x;
+				mMaxY[cluster] = max.y;
+				mMaxZ[cluster] = max.z;
+			}
+		}
+	}
+}
+
+void LightClustersC::binSlice(u32 sliceIndex) noexcept
+{
+	Slice& slice = mSlices[sliceIndex];
+	slice.x.clear();
+	slice.y.clear();
+	slice.z.clear();
+	slice.radius2.clear();
+	slice.lights.clear();
+	slice.indices.clear();
+
+	GLTUT_CATCH_ALL_BEGIN
+	// The lights overlapping the slice depth range
+	const float sliceNear = mSliceDepths[sliceIndex];
+	const float sliceFar = mSliceDepths[sliceIndex + 1];
+	for (u32 light = 0; light < mLightCount; ++light)
+	{
+		const float depth = -mCenterZ[light];
+		const float radius = mRadius[light];
+		if (depth + radius >= sliceNear && depth - radius <= sliceFar)
+		{
+			slice.x.push_back(mCenterX[light]);
+			slice.y.push_back(mCenterY[light]);
+			slice.z.push_back(mCenterZ[light]);
+			slice.radius2.push_back(radius * radius);
+			slice.lights.push_back(static_cast<u16>(light));
+		}
+	}
+
+	const size_t lightCount = slice.lights.size();
+	const size_t paddedCount = (lightCount + LANES - 1) / LANES * LANES;
+	slice.x.resize(paddedCount, 0.0f);
+	slice.y.resize(paddedCount, 0.0f);
+	slice.z.resize(paddedCount, 0.0f);
+	slice.radius2.resize(paddedCount, -1.0f);
+
+	// The squared distance from a light center to the cluster bounds against the squared radius
+	const Float4 zero = splat(0.0f);
+	for (u32 tile = 0; tile < SLICE_CLUSTER_COUNT; ++tile)
+	{
+		const u32 cluster = tile + SLICE_CLUSTER_COUNT * sliceIndex;
+		const Float4 minX = splat(mMinX[cluster]);
+		const Float4 minY = splat(mMinY[cluster]);
+		const Float4 minZ = splat(mMinZ[cluster]);
+		const Float4 maxX = splat(mMaxX[cluster]);
+		const Float4 maxY = splat(mMaxY[cluster]);
+		const Float4 maxZ = splat(mMaxZ[cluster]);
+
+		const size_t begin = slice.indices.size();
+		for (size_t i = 0; i < paddedCount; i += LANES)
+		{
+			const Float4 x = load(slice.x.data() + i);
+			const Float4 y = load(slice.y.data() + i);
+			const Float4 z = load(slice.z.data() + i);
+			const Float4 dx = maximum(maximum(subtract(minX, x), subtract(x, maxX)), zero);
+			const Float4 dy = maximum(maximum(subtract(minY, y), subtract(y, maxY)), zero);
+			const Float4 dz = maximum(maximum(subtract(minZ, z), subtract(z, maxZ)), zero);
+			const Float4 distance2 = add(add(multiply(dx, dx), multiply(dy, dy)), multiply(dz, dz));
+
+			for (u32 mask = lessEqual(distance2, load(slice.radius2.data() + i)); mask != 0; mask &= mask - 1)
+			{
+				slice.indices.push_back(slice.lights[i + std::countr_zero(mask)]);
+			}
+		}
+		slice.counts[tile] = static_cast<u32>(slice.indices.size() - begin);
+	}
+	return;
+	GLTUT_CATCH_ALL_END("Cannot bin the lights into the clusters")
+
+	// The slice is left without lights
+	slice.indices.clear();
+	slice.counts.fill(0);
+}
+
+void LightClustersC::joinSlices() noexcept
+{
+	u32 total = 0;
+	for (u32 sliceIndex = 0; sliceIndex < mClusterCountZ; ++sliceIndex)
+	{
+		total += static_cast<u32>(mSlices[sliceIndex].indices.size());
+	}
+
+	// On the overflow every cluster keeps the same share of its lights,
+	// so the far slices do not lose all their lights to the near ones
+	const float share = total > mLightIndexCapacity ?
+		static_cast<float>(mLightIndexCapacity) / static_cast<float>(total) :
+		1.0f;
+
+	// The light indices follow the lists of the clusters
+	char* lightIndices = reinterpret_cast<char*>(mClusters->lists + mClusterCount);
+	u32 offset = 0;
+	mDroppedLightIndexCount = 0;
+	mMaxClusterLightCount = 0;
+	for (u32 sliceIndex = 0; sliceIndex < mClusterCountZ; ++sliceIndex)
+	{
+		const Slice& slice = mSlices[sliceIndex];
+		const u16* indices = slice.indices.data();
+		for (u32 tile = 0; tile < SLICE_CLUSTER_COUNT; ++tile)
+		{
+			const u32 count = slice.counts[tile];
+			const u32 kept = std::min(
+				static_cast<u32>(static_cast<float>(count) * share),
+				mLightIndexCapacity - offset);
+			std::memcpy(lightIndices + offset * sizeof(u16), indices, kept * sizeof(u16));
+			mClusters->lists[tile + SLICE_CLUSTER_COUNT * sliceIndex] = offset | (kept << 16);
+
+			indices += count;
+			offset += kept;
+			mDroppedLightIndexCount += count - kept;
+			mMaxClusterLightCount = std::max(mMaxClusterLightCount, count);
+		}
+	}
+	mLightIndexCount = offset;
+}
+
+// End of the namespace gltut
+}
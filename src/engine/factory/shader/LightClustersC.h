@@ -0,0 +1,245 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/factory/shader/LightClusters.h"
+#include "engine/graphics/GraphicsDevice.h"
+#include "engine/scene/Scene.h"
+
+#include "../../core/TaskPool.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Implementation of the LightClusters interface.
+	The slices of the clusters are binned on the worker threads,
+	a slice tests 4 lights against a cluster at once
+*/
+class LightClustersC final : public LightClusters, public NonCopyable
+{
+public:
+	/// Constructor, the slices are binned on the task pool
+	LightClustersC(GraphicsDevice& device, TaskPool& taskPool, const Scene& scene);
+
+	/// Destructor, removes the buffers
+	~LightClustersC() noexcept final;
+
+	/// Returns the uniform buffer of the packed lights
+	const ShaderUniformBuffer* getLightsBuffer() const noexcept final
+	{
+		return mLightsBuffer;
+	}
+
+	/// Returns the uniform buffer of the cluster light lists
+	const ShaderUniformBuffer* getClustersBuffer() const noexcept final
+	{
+		return mClustersBuffer;
+	}
+
+	/// Returns the number of the lights packed by the last update
+	u32 getLightCount() const noexcept final
+	{
+		return mLightCount;
+	}
+
+	/// Returns the number of the lights dropped by the last update
+	u32 getDroppedLightCount() const noexcept final
+	{
+		return mDroppedLightCount;
+	}
+
+	/// Returns the total number of the lights in the cluster lists of the last update
+	u32 getLightIndexCount() const noexcept final
+	{
+		return mLightIndexCount;
+	}
+
+	/// Returns the number of the lights dropped from the cluster lists by the last update
+	u32 getDroppedLightIndexCount() const noexcept final
+	{
+		return mDroppedLightIndexCount;
+	}
+
+	/// Returns the maximum number of the lights in a cluster of the last update
+	u32 getMaxClusterLightCount() const noexcept final
+	{
+		return mMaxClusterLightCount;
+	}
+
+	/// Returns the number of the clusters along the view depth
+	u32 getClusterCountZ() const noexcept final
+	{
+		return mClusterCountZ;
+	}
+
+	/// Returns the capacity of the lights buffer
+	u32 getLightCapacity() const noexcept final
+	{
+		return mLightCapacity;
+	}
+
+	/// Returns the capacity of the cluster lists
+	u32 getLightIndexCapacity() const noexcept final
+	{
+		return mLightIndexCapacity;
+	}
+
+	/// Packs the lights, bins them into the clusters of the active camera and uploads the buffers
+	void update() noexcept;
+
+private:
+	/// The number of the clusters in a depth slice
+	static constexpr u32 SLICE_CLUSTER_COUNT = CLUSTER_COUNT_X * CLUSTER_COUNT_Y;
+
+	/// The number of the floats of a packed light, 4 vec4
+	static constexpr u32 LIGHT_FLOATS = 16;
+
+	/// The std140 block LightClusters of the largest grid, the used part is uploaded
+	struct ClustersBlock
+	{
+		/// The view-projection matrix of the camera
+		float viewProjection[16];
+
+		/// The row of the view matrix which returns the view depth
+		float viewDepth[4];
+
+		/// The depth slicing: slice = log(depth) * x + y
+		float depthSlicing[4];
+
+		/// The sum of the ambient colors of the lights
+		float ambient[4];
+
+		/**
+			\brief The light lists of the clusters followed by the light indices of the lists, 2 per uint.
+			A list is the offset in the low 16 bits and the count in the high ones
+		*/
+		u32 lists[CLUSTER_COUNT + MAX_LIGHT_INDICES / 2];
+	};
+
+	/// The lights overlapping a depth slice and the light lists of its clusters
+	struct Slice
+	{
+		/// The view space centers of the lights, padded to a multiple of 4
+		std::vector<float> x;
+		std::vector<float> y;
+		std::vector<float> z;
+
+		/// The squared influence radii, -1 for the padding
+		std::vector<float> radius2;
+
+		/// The indices of the lights
+		std::vector<u16> lights;
+
+		/// The light lists of the clusters
+		std::vector<u16> indices;
+
+		/// The number of the lights of the clusters
+		std::array<u32, SLICE_CLUSTER_COUNT> counts;
+	};
+
+	/**
+		\brief Packs the point and spot lights, computes their view space spheres and sums their ambient colors
+		\param maxRadius The limit of the influence radii
+	*/
+	void packLights(const Matrix4& view, float maxRadius) noexcept;
+
+	/// Computes the view space bounds of the clusters
+	void updateClusterBounds(const Matrix4& projection, float nearPlane, float farPlane) noexcept;
+
+	/// Bins the lights into the clusters of a depth slice
+	void binSlice(u32 slice) noexcept;
+
+	/// Joins the light lists of the slices
+	void joinSlices() noexcept;
+
+	/// The device
+	GraphicsDevice& mDevice;
+
+	/// The scene
+	const Scene& mScene;
+
+	/// The buffer of the packed lights
+	ShaderUniformBuffer* mLightsBuffer = nullptr;
+
+	/// The buffer of the cluster light lists
+	ShaderUniformBuffer* mClustersBuffer = nullptr;
+
+	/// The worker threads binning the slices
+	TaskPool& mTaskPool;
+
+	/// The number of the clusters along the view depth fitting the uniform block size of the device
+	u32 mClusterCountZ = CLUSTER_COUNT_Z;
+
+	/// The total number of the clusters
+	u32 mClusterCount = CLUSTER_COUNT;
+
+	/// The number of the lights fitting the uniform block size of the device
+	u32 mLightCapacity = MAX_LIGHTS;
+
+	/// The number of the light indices fitting the uniform block size of the device
+	u32 mLightIndexCapacity = MAX_LIGHT_INDICES;
+
+	/// The packed lights
+	std::vector<float> mLights;
+
+	/// The block of the clusters
+	std::unique_ptr<ClustersBlock> mClusters;
+
+	/// The view space centers of the packed lights
+	std::vector<float> mCenterX;
+	std::vector<float> mCenterY;
+	std::vector<float> mCenterZ;
+
+	/// The influence radii of the packed lights
+	std::vector<float> mRadius;
+
+	/// The view space bounds of the clusters
+	std::vector<float> mMinX;
+	std::vector<float> mMinY;
+	std::vector<float> mMinZ;
+	std::vector<float> mMaxX;
+	std::vector<float> mMaxY;
+	std::vector<float> mMaxZ;
+
+	/// The view depths of the slice boundaries, the first mClusterCountZ + 1 are used
+	std::array<float, CLUSTER_COUNT_Z + 1> mSliceDepths{};
+
+	/// The projection matrix of the cluster bounds
+	Matrix4 mProjection;
+
+	/// The near plane of the cluster bounds
+	float mNearPlane = 0.0f;
+
+	/// The far plane of the cluster bounds
+	float mFarPlane = 0.0f;
+
+	/// The slices, the first mClusterCountZ are used
+	std::array<Slice, CLUSTER_COUNT_Z> mSlices;
+
+	/// The number of the packed lights
+	u32 mLightCount = 0;
+
+	/// The number of the dropped lights
+	u32 mDroppedLightCount = 0;
+
+	/// The total number of the lights in the cluster lists
+	u32 mLightIndexCount = 0;
+
+	/// The number of the lights dropped from the cluster lists
+	u32 mDroppedLightIndexCount = 0;
+
+	/// The maximum number of the lights in a cluster
+	u32 mMaxClusterLightCount = 0;
+};
+
+// End of the namespace gltut
+}
@@ -4,6 +4,7 @@
 
 // Includes
 #include "PhongShaderModelC.h"
+#include <cctype>
 #include <string>
 
 namespace gltut
@@ -77,12 +78,24 @@ uniform mat4 model;
 uniform vec3 viewPos;
 uniform mat3 normalMat;
 
+// Per-draw data of the object buffer
+layout (std140) uniform Object
+{
+	mat4 objectModel;
+	mat3 objectNormalMat;
+};
+
+// The source of the matrices: 0 - uniforms, 1 - instance attributes, 2 - object buffer
+uniform int matrixSource;
+
 // Inputs
 layout (location = 0) in vec3 inPos;
 layout (location = 1) in vec3 inNormal;
 layout (location = 2) in vec2 inTexCoord;
 layout (location = 3) in vec3 inTangent;
 layout (location = 4) in vec3 inBitangent;
+layout (location = 9) in mat4 instanceModel;
+layout (location = 13) in mat3 instanceNormalMat;
 
 // Outputs
 out vec3 pos;
@@ -100,14 +113,19 @@ out vec4 directionalShadowSpacePos[MAX_DIRECTIONAL_LIGHTS];
 out vec4 spotShadowSpacePos[MAX_SPOT_LIGHTS];
 #endif
 
+// The depth of the depth pre-pass must match exactly
+invariant gl_Position;
+
 void main()
 {
-	vec4 modelPos = model * vec4(inPos, 1.0f);
+	mat4 modelMat = matrixSource == 1 ? instanceModel : (matrixSource == 2 ? objectModel : model);
+	mat3 modelNormalMat = matrixSource == 1 ? instanceNormalMat : (matrixSource == 2 ? objectNormalMat : normalMat);
+	vec4 modelPos = modelMat * vec4(inPos, 1.0f);
 	gl_Position = projection * view * modelPos;
 	pos = vec3(modelPos);
-	normal = normalMat * inNormal;
+	normal = modelNormalMat * inNormal;
 	texCoord = inTexCoord;
-	TBN = mat3(normalMat * inTangent, normalMat * inBitangent, normal);
+	TBN = mat3(modelNormalMat * inTangent, modelNormalMat * inBitangent, normal);
 
 	mat3 invTBN = transpose(TBN);
 	vec3 localViewDir = viewPos - pos;
@@ -129,19 +147,11 @@ void main()
 #endif
 })";
 
-// Fragment shader source code for Phong shading
-const char* PHONG_FRAGMENT_SHADER = R"(
+// Fragment shader declarations for Phong shading
+const char* PHONG_FRAGMENT_SHADER_DECLARATIONS = R"(
+// Software rasterizer program: phong
 
 // Uniforms
-uniform sampler2D diffuseSampler;
-uniform sampler2D specularSampler;
-uniform sampler2D normalSampler;
-uniform bool normalMap;
-
-uniform sampler2D depthSampler;
-uniform float depthScale;
-
-uniform float shininess;
 uniform vec3 viewPos;
 uniform float minShadowMapBias;
 uniform float maxShadowMapBias;
@@ -168,7 +178,10 @@ uniform sampler2D shadowSamplers[MAX_DIRECTIONAL_LIGHTS + MAX_SPOT_LIGHTS];
 
 // Outputs
 out vec4 outColor;
+)";
 
+// Fragment shader functions and main for Phong shading
+const char* PHONG_FRAGMENT_SHADER = R"(
 float getShadowFactorOrthogonalProjection(
 	vec4 shadowSpacePos,
 	int shadowSamplerInd,
@@ -181,15 +194,15 @@ float getShadowFactorOrthogonalProjection(
 
 	float bias = mix(minShadowMapBias, maxShadowMapBias, 1.0 - abs(normalLightDot));
 	vec3 projCoords = shadowSpacePos.xyz * (0.5 / shadowSpacePos.w) + 0.5;
-	vec2 texelSize = 1.0 / textureSize(shadowSamplers[shadowSamplerInd], 0);
+	vec2 texelSize = 1.0 / getShadowMapSize(shadowSamplerInd);
 	float shadow = 0.0f;
 	for (int x = -1; x <= 1; ++x)
 	{
 		for (int y = -1; y <= 1; ++y)
 		{
-			float closestDepth = texture(
-				shadowSamplers[shadowSamplerInd],
-				projCoords.xy + vec2(x, y) * texelSize).r;
+			float closestDepth = getShadowMapDepth(
+				shadowSamplerInd,
+				projCoords.xy + vec2(x, y) * texelSize);
 			shadow += float(projCoords.z - bias < closestDepth);
 		}
 	}
@@ -217,15 +230,15 @@ float getShadowFactorPerspectiveProjection(
 	float bias = mix(minShadowMapBias, maxShadowMapBias, 1.0 - abs(normalLightDot));
 	vec3 projCoords = shadowSpacePos.xyz * (0.5 / shadowSpacePos.w) + 0.5;
 	projCoords.z = linearizeDepth(projCoords.z, zNear, zFar);
-	vec2 texelSize = 1.0 / textureSize(shadowSamplers[shadowSamplerInd], 0);
+	vec2 texelSize = 1.0 / getShadowMapSize(shadowSamplerInd);
 	float shadow = 0.0f;
 	for (int x = -1; x <= 1; ++x)
 	{
 		for (int y = -1; y <= 1; ++y)
 		{
-			float closestDepth = texture(
-				shadowSamplers[shadowSamplerInd],
-				projCoords.xy + vec2(x, y) * texelSize).r;
+			float closestDepth = getShadowMapDepth(
+				shadowSamplerInd,
+				projCoords.xy + vec2(x, y) * texelSize);
 
 			closestDepth = linearizeDepth(closestDepth, zNear, zFar);
 			shadow += float(projCoords.z - bias < closestDepth);
@@ -246,12 +259,12 @@ vec2 parallaxMapping(vec2 texCoords, vec3 viewDir)
 	vec2 deltaTexCoords = viewDir.xy * depthScale * depthStep / viewDir.z;
   
 	vec2 curTexCoords = texCoords;
-	float curDepthMapValue = texture(depthSampler, curTexCoords).r;
+	float curDepthMapValue = sampleDepth(curTexCoords).r;
 
 	while(curDepth < curDepthMapValue)
 	{
 		curTexCoords -= deltaTexCoords;
-		curDepthMapValue = texture(depthSampler, curTexCoords).r;
+		curDepthMapValue = sampleDepth(curTexCoords).r;
 		curDepth += depthStep;
 	}
 
@@ -260,7 +273,7 @@ vec2 parallaxMapping(vec2 texCoords, vec3 viewDir)
 
 	// get depth after and before collision for linear interpolation
 	float depthAfter  = curDepthMapValue - curDepth;
-	float depthBefore = texture(depthSampler, prevTexCoords).r - curDepth + depthStep;
+	float depthBefore = sampleDepth(prevTexCoords).r - curDepth + depthStep;
  
 	// interpolation of texture coordinates
 	return mix(prevTexCoords, curTexCoords, depthBefore / (depthBefore - depthAfter));
@@ -283,10 +296,10 @@ void main()
 	}
 
 	vec3 norm = normalMap ? 
-		normalize(TBN * (texture(normalSampler, tCoord).rgb * 2.0f - 1.0f)) :
+		normalize(TBN * (sampleNormal(tCoord).rgb * 2.0f - 1.0f)) :
 		normalize(normal);
 	vec3 viewDir = normalize(viewPos - pos);
-	vec3 geomDiffuse = texture(diffuseSampler, tCoord).rgb;
+	vec3 geomDiffuse = sampleDiffuse(tCoord).rgb;
 #endif
 
 #if MAX_DIRECTIONAL_LIGHTS > 0
@@ -304,7 +317,7 @@ void main()
 		vec3 reflectDir = reflect(-lightDir, norm);
 		float dot_specular = max(dot(viewDir, reflectDir), 0.0);
 		float spec = pow(dot_specular, shininess);
-		vec3 specular = spec * directionalLights[i].color.specular * texture(specularSampler, tCoord).rgb;
+		vec3 specular = spec * directionalLights[i].color.specular * sampleSpecular(tCoord).rgb;
 
 		float shadowBias = mix(minShadowMapBias, maxShadowMapBias, 1.0 - abs(normalLightDot));
 		result += (diffuse + specular) * 
@@ -327,7 +340,7 @@ void main()
 		// Specular
 		vec3 reflectDir = reflect(-lightDir, norm);
 		float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);
-		vec3 specular = spec * pointLights[i].color.specular * texture(specularSampler, tCoord).rgb;
+		vec3 specular = spec * pointLights[i].color.specular * sampleSpecular(tCoord).rgb;
 
 		// Attenuation
 		float attenuation = 1.0f / (
@@ -364,7 +377,7 @@ void main()
 			// Specular
 			vec3 reflectDir = reflect(-lightDir, norm);
 			float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);
-			vec3 specular = spec * spotLights[i].color.specular * texture(specularSampler, tCoord).rgb;
+			vec3 specular = spec * spotLights[i].color.specular * sampleSpecular(tCoord).rgb;
 
 			// Attenuation
 			float attenuation = 1.0f / (
@@ -383,9 +396,207 @@ void main()
 		}
 	}
 #endif
+
+#ifdef CLUSTERED_LIGHTS
+	result += getClusteredLighting(norm, viewDir, geomDiffuse, sampleSpecular(tCoord).rgb);
+#endif
 	outColor = vec4(result, 1.0f);
 })";
 
+/**
+	\brief Fragment shader function shading the lights of the cluster of a fragment.
+	A point light is packed as a spot light lit in all the directions
+*/
+const char* CLUSTERED_LIGHTING_FUNCTION = R"(
+vec3 getClusteredLighting(vec3 norm, vec3 viewDir, vec3 geomDiffuse, vec3 geomSpecular)
+{
+	vec3 result = clusteredAmbient.rgb * geomDiffuse;
+	vec4 clusterPos = clusterViewProjection * vec4(pos, 1.0f);
+	float depth = dot(clusterViewDepth, vec4(pos, 1.0f));
+	if (clusterPos.w <= 0.0f || depth <= 0.0f)
+	{
+		return result;
+	}
+
+	ivec2 tile = clamp(
+		ivec2(floor((clusterPos.xy / clusterPos.w * 0.5f + 0.5f) * vec2(CLUSTER_COUNT_X, CLUSTER_COUNT_Y))),
+		ivec2(0),
+		ivec2(CLUSTER_COUNT_X - 1, CLUSTER_COUNT_Y - 1));
+	int slice = clamp(
+		int(floor(log(depth) * clusterDepthSlicing.x + clusterDepthSlicing.y)),
+		0,
+		CLUSTER_COUNT_Z - 1);
+	int cluster = tile.x + CLUSTER_COUNT_X * (tile.y + CLUSTER_COUNT_Y * slice);
+
+	// The offset of the light list in the low 16 bits, the count in the high ones
+	uint range = clusterRanges[cluster / 4][cluster % 4];
+	uint end = (range & 0xFFFFu) + (range >> 16);
+	for (uint i = range & 0xFFFFu; i < end; ++i)
+	{
+		uint light = 4u * ((clusterLightIndices[i / 8u][(i / 2u) % 4u] >> (16u * (i % 2u))) & 0xFFFFu);
+		vec4 position = clusteredLights[light];
+		vec4 direction = clusteredLights[light + 1u];
+		vec4 diffuseColor = clusteredLights[light + 2u];
+		vec4 specularColor = clusteredLights[light + 3u];
+
+		vec3 lightDir = position.xyz - pos;
+		float distance = length(lightDir);
+		lightDir /= distance;
+
+		float theta = dot(-lightDir, direction.xyz);
+		if (theta > diffuseColor.w)
+		{
+			float intensity = clamp((theta - diffuseColor.w) / (direction.w - diffuseColor.w), 0.0, 1.0);
+			vec3 diffuse = max(0.0f, dot(norm, lightDir)) * diffuseColor.rgb * geomDiffuse;
+
+			vec3 reflectDir = reflect(-lightDir, norm);
+			float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);
+			vec3 specular = spec * specularColor.rgb * geomSpecular;
+
+			float attenuation = 1.0f / (1.0f + specularColor.w * distance + position.w * distance * distance);
+			result += intensity * attenuation * (diffuse + specular);
+		}
+	}
+	return result;
+}
+)";
+
+/// The names of the material textures in the order of their slots
+const char* MATERIAL_TEXTURE_NAMES[PhongShaderModel::TEXTURE_SLOTS_COUNT] = {
+	"diffuse",
+	"specular",
+	"normal",
+	"depth"};
+
+// Local functions
+/**
+	\brief Returns the texture access supported by a device.
+	The bindless textures fall back to the texture arrays, the texture arrays fall back to the slots
+*/
+PhongShaderModel::TextureAccess getSupportedTextureAccess(
+	const GraphicsDevice& device,
+	PhongShaderModel::TextureAccess access) noexcept
+{
+	if (access == PhongShaderModel::TextureAccess::BINDLESS &&
+		!device.isBindlessTextureSupported())
+	{
+		access = PhongShaderModel::TextureAccess::ARRAYS;
+	}
+
+	if (access == PhongShaderModel::TextureAccess::ARRAYS &&
+		!device.isTextureArraySupported())
+	{
+		access = PhongShaderModel::TextureAccess::SLOTS;
+	}
+	return access;
+}
+
+/**
+	\brief Returns the GLSL declarations of the material textures and parameters
+	and the functions sampling the textures, e.g. sampleDiffuse(vec2 coords).
+	The declarations are generated per access and not with #if,
+	because the uniform block layout is parsed without the preprocessor
+*/
+std::string getMaterialDeclarations(PhongShaderModel::TextureAccess access)
+{
+	std::string samplers;
+	std::string blockMembers;
+	std::string functions;
+	for (const char* name : MATERIAL_TEXTURE_NAMES)
+	{
+		std::string functionName = std::string("sample") + name;
+		functionName[6] = static_cast<char>(std::toupper(functionName[6]));
+		functions += "vec4 " + functionName + "(vec2 coords)\n{\n";
+
+		switch (access)
+		{
+		case PhongShaderModel::TextureAccess::SLOTS:
+			samplers += std::string("uniform sampler2D ") + name + "Sampler;\n";
+			functions += std::string("\treturn texture(") + name + "Sampler, coords);\n";
+			break;
+
+		case PhongShaderModel::TextureAccess::ARRAYS:
+			samplers += std::string("uniform sampler2DArray ") + name + "Sampler;\n";
+			blockMembers += std::string("\tfloat ") + name + "Layer;\n";
+			functions += std::string("\treturn texture(") + name + "Sampler, vec3(coords, " + name + "Layer));\n";
+			break;
+
+		case PhongShaderModel::TextureAccess::BINDLESS:
+			// A null handle samples as an empty slot
+			blockMembers += std::string("\tuvec2 ") + name + "Texture;\n";
+			functions += std::string("\treturn ") + name + "Texture == uvec2(0) ? vec4(0.0, 0.0, 0.0, 1.0) : " +
+				"texture(sampler2D(" + name + "Texture), coords);\n";
+			break;
+		}
+		functions += "}\n\n";
+	}
+
+	return
+		samplers +
+		"\n// The material parameters\n"
+		"layout (std140) uniform Material\n{\n"
+		"\tfloat shininess;\n"
+		"\tfloat depthScale;\n"
+		"\tbool normalMap;\n" +
+		blockMembers +
+		"};\n\n" +
+		functions;
+}
+
+/**
+	\brief Returns the GLSL declarations of the clustered light blocks of LightClustersC.
+	The array sizes are the capacities of the clusters as literals,
+	because the uniform block layout is parsed without the preprocessor.
+	A light is 4 vec4: the position and the quadratic attenuation,
+	the direction and the inner angle cosine, the diffuse color and the outer angle cosine,
+	the specular color and the linear attenuation
+*/
+std::string getClusteredLightDeclarations(const LightClusters& lightClusters)
+{
+	return
+		"\n#define CLUSTER_COUNT_X " + std::to_string(LightClusters::CLUSTER_COUNT_X) +
+		"\n#define CLUSTER_COUNT_Y " + std::to_string(LightClusters::CLUSTER_COUNT_Y) +
+		"\n#define CLUSTER_COUNT_Z " + std::to_string(lightClusters.getClusterCountZ()) +
+		"\n\n// The clustered point and spot lights\n"
+		"layout (std140) uniform ClusteredLights\n{\n"
+		"\tvec4 clusteredLights[" + std::to_string(lightClusters.getLightCapacity() * 4) + "];\n"
+		"};\n\n"
+		"// The light lists of the clusters of the camera\n"
+		"layout (std140) uniform LightClusters\n{\n"
+		"\tmat4 clusterViewProjection;\n"
+		"\tvec4 clusterViewDepth;\n"
+		"\tvec4 clusterDepthSlicing;\n"
+		"\tvec4 clusteredAmbient;\n"
+		"\tuvec4 clusterRanges[" + std::to_string(
+			LightClusters::CLUSTER_COUNT_X * LightClusters::CLUSTER_COUNT_Y * lightClusters.getClusterCountZ() / 4) + "];\n"
+		"\tuvec4 clusterLightIndices[" + std::to_string(lightClusters.getLightIndexCapacity() / 8) + "];\n"
+		"};\n" +
+		CLUSTERED_LIGHTING_FUNCTION;
+}
+
+/**
+	\brief Returns the GLSL functions which access the shadow samplers by index.
+	GLSL 1.30+ allows to index sampler arrays only with constant expressions,
+	so the dynamic index is dispatched to constant ones via switch.
+*/
+std::string getShadowSamplerFunctions(u32 shadowSamplersCount)
+{
+	std::string depthCases;
+	std::string sizeCases;
+	for (u32 i = 0; i < shadowSamplersCount; ++i)
+	{
+		const std::string index = std::to_string(i);
+		depthCases += "\tcase " + index + ": return texture(shadowSamplers[" + index + "], coords).r;\n";
+		sizeCases += "\tcase " + index + ": return vec2(textureSize(shadowSamplers[" + index + "], 0));\n";
+	}
+
+	return
+		"\nfloat getShadowMapDepth(int samplerInd, vec2 coords)\n{\n"
+		"\tswitch (samplerInd)\n\t{\n" + depthCases + "\t}\n\treturn 1.0;\n}\n"
+		"\nvec2 getShadowMapSize(int samplerInd)\n{\n"
+		"\tswitch (samplerInd)\n\t{\n" + sizeCases + "\t}\n\treturn vec2(1.0);\n}\n";
+}
+
 // End of anonymous namespace
 }
 
@@ -395,33 +606,51 @@ PhongShaderModelC::PhongShaderModelC(
 	Scene& scene,
 	u32 maxDirectionalLights,
 	u32 maxPointLights,
-	u32 maxSpotLights) :
+	u32 maxSpotLights,
+	TextureAccess textureAccess,
+	const LightClusters* lightClusters) :
 
 	mRenderer(renderer),
 	mScene(scene),
 	mMaxDirectionalLights(maxDirectionalLights),
 	mMaxPointLights(maxPointLights),
 	mMaxSpotLights(maxSpotLights),
+	mLightClusters(lightClusters),
 	mMinShadowMapBias(0),
 	mMaxShadowMapBias(0)
 {
 	GLTUT_CHECK(
-		mMaxDirectionalLights + mMaxDirectionalLights + mMaxSpotLights > 0,
+		mMaxDirectionalLights + mMaxDirectionalLights + mMaxSpotLights > 0 || mLightClusters != nullptr,
 		"At least one amount of lights must be greater than 0");
 
 	GraphicsDevice* device = renderer.getDevice();
 	GLTUT_CHECK(device, "Failed to get graphics device");
 
+	mTextureAccess = getSupportedTextureAccess(*device, textureAccess);
+
 	std::string shaderHeader = "#version 330 core\n";
+	if (mTextureAccess == TextureAccess::BINDLESS)
+	{
+		shaderHeader += "#extension GL_ARB_bindless_texture : require\n";
+	}
 	shaderHeader += "#define MAX_DIRECTIONAL_LIGHTS " + std::to_string(maxDirectionalLights) + "\n";
 	shaderHeader += "#define MAX_POINT_LIGHTS " + std::to_string(maxPointLights) + "\n";
 	shaderHeader += "#define MAX_SPOT_LIGHTS " + std::to_string(maxSpotLights) + "\n";
+	if (mLightClusters != nullptr)
+	{
+		shaderHeader += "#define CLUSTERED_LIGHTS 1\n";
+	}
 	shaderHeader += LIGHT_UNIFORMS;
 
 	mRendererShaderBinding = createStandardShaderBinding(
 		&mRenderer,
 		(shaderHeader + PHONG_VERTEX_SHADER).c_str(),
-		(shaderHeader + PHONG_FRAGMENT_SHADER).c_str(),
+		(shaderHeader +
+		 PHONG_FRAGMENT_SHADER_DECLARATIONS +
+		 getMaterialDeclarations(mTextureAccess) +
+		 (mLightClusters != nullptr ? getClusteredLightDeclarations(*mLightClusters) : std::string()) +
+		 getShadowSamplerFunctions(maxDirectionalLights + maxSpotLights) +
+		 PHONG_FRAGMENT_SHADER).c_str(),
 		"model",
 		nullptr,
 		nullptr, // No bindings for view and projection matrices - they are in the uniform buffer
@@ -430,14 +659,26 @@ PhongShaderModelC::PhongShaderModelC(
 	GLTUT_CHECK(mRendererShaderBinding != nullptr, "Failed to create Phong shader binding");
 	auto* shader = mRendererShaderBinding->getTarget();
 	shader->setUniformBlockBindingPoint("ViewProjection", VIEW_PROJECTION_BUFFER_BINDING_POINT);
+	shader->setUniformBlockBindingPoint("Object", RendererBinding::OBJECT_BUFFER_BINDING_POINT);
+	shader->setUniformBlockBindingPoint(
+		RendererBinding::MATERIAL_BLOCK_NAME,
+		RendererBinding::MATERIAL_BUFFER_BINDING_POINT);
+	if (mLightClusters != nullptr)
+	{
+		shader->setUniformBlockBindingPoint("ClusteredLights", LightClusters::LIGHTS_BUFFER_BINDING_POINT);
+		shader->setUniformBlockBindingPoint("LightClusters", LightClusters::CLUSTERS_BUFFER_BINDING_POINT);
+	}
 
 	mRendererShaderBinding->bind(RendererBinding::Parameter::VIEWPOINT_POSITION, "viewPos");
+	mRendererShaderBinding->bind(RendererBinding::Parameter::GEOMETRY_MATRIX_SOURCE, "matrixSource");
 
-	shader->setInt("diffuseSampler", 0);
-	shader->setInt("specularSampler", 1);
-	shader->setInt("normalSampler", 2);
-	shader->setInt("depthSampler", 3);
-	shader->setFloat("shininess", DEFAULT_SHINESS);
+	if (mTextureAccess != TextureAccess::BINDLESS)
+	{
+		for (u32 i = 0; i < PhongShaderModel::TEXTURE_SLOTS_COUNT; ++i)
+		{
+			shader->setInt((std::string(MATERIAL_TEXTURE_NAMES[i]) + "Sampler").c_str(), i);
+		}
+	}
 	for (u32 i = 0; i < maxDirectionalLights + maxSpotLights; ++i)
 	{
 		shader->setInt(
@@ -17,13 +17,18 @@ namespace gltut
 class PhongShaderModelC final : public PhongShaderModel, public NonCopyable
 {
 public:
-	/// Constructor
+	/**
+		\brief Constructor, the texture access falls back to one supported by the device
+		\param lightClusters The light clusters shaded instead of the point and spot lights, may be nullptr
+	*/
 	PhongShaderModelC(
 		Renderer& renderer,
 		Scene& scene,
 		u32 maxDirectionalLights,
 		u32 maxPointLights,
-		u32 maxSpotLights);
+		u32 maxSpotLights,
+		TextureAccess textureAccess,
+		const LightClusters* lightClusters);
 
 	/// Virtual destructor
 	~PhongShaderModelC() noexcept final;
@@ -34,6 +39,18 @@ public:
 		return mRendererShaderBinding;
 	}
 
+	/// Returns the access of the material textures
+	TextureAccess getTextureAccess() const noexcept final
+	{
+		return mTextureAccess;
+	}
+
+	/// Returns the light clusters shaded by the shader
+	const LightClusters* getLightClusters() const noexcept final
+	{
+		return mLightClusters;
+	}
+
 	/// Returns the maximum number of directional lights
 	u32 getMaxDirectionalLights() const noexcept final
 	{
@@ -75,6 +92,9 @@ public:
 	void setMaxShadowMapBias(float bias) noexcept final;
 
 private:
+	/// The access of the material textures
+	TextureAccess mTextureAccess = TextureAccess::SLOTS;
+
 	/// The maximum number of directional lights
 	u32 mMaxDirectionalLights;
 
@@ -84,6 +104,9 @@ private:
 	/// The maximum number of spot lights
 	u32 mMaxSpotLights;
 
+	/// The light clusters, nullptr if the point and spot lights are looped over
+	const LightClusters* mLightClusters = nullptr;
+
 	/// The minimum bias for the shadow map
 	float mMinShadowMapBias = DEFAULT_MIN_SHADOW_MAP_BIAS;
 
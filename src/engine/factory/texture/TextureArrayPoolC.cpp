@@ -0,0 +1,114 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "TextureArrayPoolC.h"
+
+namespace gltut
+{
+// Global classes
+TextureArrayPoolC::TextureArrayPoolC(GraphicsDevice& device) noexcept :
+	mDevice(device)
+{
+}
+
+TextureArrayPoolC::~TextureArrayPoolC() noexcept
+{
+	for (auto& [key, group] : mGroups)
+	{
+		if (group.array != nullptr)
+		{
+			mDevice.getTextures()->remove(group.array);
+		}
+	}
+}
+
+TextureArrayPoolC::Layer TextureArrayPoolC::acquire(const Texture* texture) noexcept
+{
+	if (texture == nullptr)
+	{
+		return {};
+	}
+
+	GLTUT_CATCH_ALL_BEGIN
+	if (const auto found = mEntries.find(texture); found != mEntries.end())
+	{
+		++found->second.references;
+		return {found->second.group->array, found->second.layer};
+	}
+
+	const auto* texture2 = dynamic_cast<const Texture2*>(texture);
+	if (texture2 == nullptr || texture2->getFormat() == TextureFormat::FLOAT)
+	{
+		return {};
+	}
+
+	const TextureParameters& parameters = texture2->getParameters();
+	const GroupKey key = {
+		texture2->getSize().x,
+		texture2->getSize().y,
+		texture2->getFormat(),
+		parameters.minFilter,
+		parameters.magFilter,
+		parameters.wrapMode};
+
+	Group& group = mGroups[key];
+	const u32 layer = allocateLayer(group, key, *texture2);
+	group.array->setLayer(layer, *texture2);
+	mEntries.emplace(texture, Entry{&group, layer, 1});
+	return {group.array, layer};
+	GLTUT_CATCH_ALL_END("Cannot copy a texture to a texture array")
+	return {};
+}
+
+void TextureArrayPoolC::release(const Texture* texture) noexcept
+{
+	const auto found = mEntries.find(texture);
+	if (found == mEntries.end())
+	{
+		return;
+	}
+
+	Entry& entry = found->second;
+	if (--entry.references > 0)
+	{
+		return;
+	}
+
+	GLTUT_CATCH_ALL_BEGIN
+	entry.group->freeLayers.push_back(entry.layer);
+	GLTUT_CATCH_ALL_END("Cannot release a texture array layer")
+	mEntries.erase(found);
+}
+
+u32 TextureArrayPoolC::allocateLayer(
+	Group& group,
+	const GroupKey& key,
+	const Texture2& texture)
+{
+	if (!group.freeLayers.empty())
+	{
+		const u32 layer = group.freeLayers.back();
+		group.freeLayers.pop_back();
+		return layer;
+	}
+
+	if (group.array == nullptr)
+	{
+		group.array = mDevice.getTextures()->createArray(
+			texture.getSize(),
+			key.format,
+			INITIAL_LAYER_COUNT,
+			texture.getParameters());
+		GLTUT_CHECK(group.array != nullptr, "Failed to create a texture array");
+	}
+	else if (group.layerCount == group.array->getLayerCount())
+	{
+		group.array->setLayerCount(group.layerCount * 2);
+	}
+	return group.layerCount++;
+}
+
+// End of the namespace gltut
+}
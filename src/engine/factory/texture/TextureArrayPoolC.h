@@ -0,0 +1,123 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDevice.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Groups the 2D textures of the same size, format and parameters into the layers of shared texture arrays.
+	A texture is copied to its layer when it is acquired the first time, the later changes of the texture are not copied.
+	An array grows by doubling its layer count, the array object stays the same,
+	so the texture sets referencing it remain valid
+*/
+class TextureArrayPoolC : public NonCopyable
+{
+public:
+	/// A layer of a texture array
+	struct Layer
+	{
+		/// The array, nullptr for an empty layer
+		Texture2Array* array = nullptr;
+
+		/// The layer index
+		u32 index = 0;
+	};
+
+	/// Constructor
+	explicit TextureArrayPoolC(GraphicsDevice& device) noexcept;
+
+	/// Destructor, removes the arrays
+	~TextureArrayPoolC() noexcept;
+
+	/**
+		\brief Returns the layer holding a copy of a texture, copying the texture on the first request.
+		Every call must be paired with release()
+		\return The layer or an empty layer if the texture is null,
+		is not a 2D color texture or cannot be copied
+	*/
+	Layer acquire(const Texture* texture) noexcept;
+
+	/// Releases a texture acquired by acquire(), its layer is reused when the texture is not used anymore
+	void release(const Texture* texture) noexcept;
+
+private:
+	/// The number of the layers of a new array
+	static constexpr u32 INITIAL_LAYER_COUNT = 4;
+
+	/// The key of the textures sharing an array
+	struct GroupKey
+	{
+		/// The width
+		u32 width;
+
+		/// The height
+		u32 height;
+
+		/// The format
+		TextureFormat format;
+
+		/// The minification filter
+		TextureFilterMode minFilter;
+
+		/// The magnification filter
+		TextureFilterMode magFilter;
+
+		/// The wrap mode
+		TextureWrapMode wrapMode;
+
+		/// Compares the keys
+		auto operator<=>(const GroupKey&) const noexcept = default;
+	};
+
+	/// The textures sharing an array
+	struct Group
+	{
+		/// The array
+		Texture2Array* array = nullptr;
+
+		/// The number of the used layers, the free ones excluded
+		u32 layerCount = 0;
+
+		/// The released layers
+		std::vector<u32> freeLayers;
+	};
+
+	/// A texture copied to a layer
+	struct Entry
+	{
+		/// The group
+		Group* group;
+
+		/// The layer index
+		u32 layer;
+
+		/// The number of the acquisitions
+		u32 references;
+	};
+
+	/// Allocates a layer of a group, growing its array
+	u32 allocateLayer(Group& group, const GroupKey& key, const Texture2& texture);
+
+	/// The graphics device
+	GraphicsDevice& mDevice;
+
+	/// The groups
+	std::map<GroupKey, Group> mGroups;
+
+	/// The acquired textures
+	std::unordered_map<const Texture*, Entry> mEntries;
+};
+
+// End of the namespace gltut
+}
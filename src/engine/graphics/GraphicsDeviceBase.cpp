@@ -11,6 +11,23 @@
 
 namespace gltut
 {
+
+namespace
+{
+// Local functions
+/// Removes all items from a manager
+template <typename ItemType>
+void removeAll(ItemManager<ItemType>& manager) noexcept
+{
+	while (manager.size() > 0)
+	{
+		manager.remove(manager.get(manager.size() - 1));
+	}
+}
+
+// End of the anonymous namespace
+}
+
 // Global classes
 GraphicsDeviceBase::GraphicsDeviceBase(Window& window) noexcept :
 	mWindow(window),
@@ -43,5 +60,67 @@ void GraphicsDeviceBase::bindFramebuffer(
 	}
 }
 
+void GraphicsDeviceBase::bindPipelineState(
+	const PipelineState& state,
+	const PipelineState* previous) noexcept
+{
+	if (&state == previous)
+	{
+		return;
+	}
+
+	if (state.shader != nullptr &&
+		(previous == nullptr || state.shader != previous->shader))
+	{
+		state.shader->bind();
+	}
+
+	if (previous == nullptr || state.blending != previous->blending)
+	{
+		setBlending(state.blending);
+	}
+
+	if (previous == nullptr || state.faceCulling != previous->faceCulling)
+	{
+		setFaceCulling(state.faceCulling);
+	}
+
+	if (previous == nullptr || state.depthTest != previous->depthTest)
+	{
+		setDepthTest(state.depthTest);
+	}
+
+	if (previous == nullptr || state.depthWrite != previous->depthWrite)
+	{
+		setDepthWrite(state.depthWrite);
+	}
+
+	if (previous == nullptr || state.colorWrite != previous->colorWrite)
+	{
+		setColorWrite(state.colorWrite);
+	}
+
+	if (previous == nullptr ||
+		state.polygonFill != previous->polygonFill ||
+		state.polygonFillSize != previous->polygonFillSize ||
+		state.polygonFillSizeInShader != previous->polygonFillSizeInShader)
+	{
+		setPolygonFill(
+			state.polygonFill,
+			state.polygonFillSize,
+			state.polygonFillSizeInShader);
+	}
+}
+
+void GraphicsDeviceBase::removeAllObjects() noexcept
+{
+	// Framebuffers go first because they reference textures
+	removeAll(mFramebuffers);
+	removeAll(mGeometries);
+	removeAll(mShaders);
+	removeAll(mShaderUniformBuffers);
+	removeAll(mTextures);
+}
+
 // End of the namespace gltut
 }
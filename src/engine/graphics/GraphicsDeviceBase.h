@@ -9,6 +9,7 @@
 #include "engine/graphics/GraphicsDevice.h"
 #include "engine/window/Window.h"
 
+#include "./PipelineStateCache.h"
 #include "./framebuffer/FramebufferManagerC.h"
 #include "./geometry/GeometryManagerC.h"
 #include "./shader/ShaderManagerC.h"
@@ -63,6 +64,23 @@ public:
 		Framebuffer* framebuffer,
 		Rectangle2u* viewport) noexcept final;
 
+	/// Returns the immutable pipeline state equal to a state
+	const PipelineState* getPipelineState(const PipelineState& state) noexcept final
+	{
+		return mPipelineStates.get(state);
+	}
+
+	/// Returns the number of the pipeline states created by the device
+	u32 getPipelineStateCount() const noexcept final
+	{
+		return mPipelineStates.size();
+	}
+
+	/// Binds a pipeline state, setting only the parts differing from the previous state
+	void bindPipelineState(
+		const PipelineState& state,
+		const PipelineState* previous) noexcept final;
+
 	/// Returns the window associated with this device
 	Window& getWindow() noexcept
 	{
@@ -91,6 +109,13 @@ public:
 		const TextureData& data,
 		const TextureParameters& parameters) = 0;
 
+	/// Creates a 2D texture array for a specific graphics backend
+	virtual std::unique_ptr<Texture2Array> createBackendTexture2Array(
+		const Point2u& size,
+		TextureFormat format,
+		u32 layerCount,
+		const TextureParameters& parameters) = 0;
+
 	/// Creates a texture cubemap for a specific graphics backend
 	virtual std::unique_ptr<TextureCubemap> createBackendTextureCubemap(
 		const TextureData& minusXData,
@@ -107,6 +132,13 @@ public:
 
 	virtual Framebuffer* getDefaultFramebuffer() const noexcept = 0;
 
+protected:
+	/**
+		\brief Removes all the device objects.
+		Backends call it in their destructors, while the objects can still be released.
+	*/
+	void removeAllObjects() noexcept;
+
 private:
 	// Sets the framebuffer for rendering
 	virtual void setFramebuffer(Framebuffer* frameBuffer) noexcept = 0;
@@ -131,6 +163,9 @@ private:
 
 	/// Textures
 	TextureManagerC mTextures;
+
+	/// Pipeline states
+	PipelineStateCache mPipelineStates;
 };
 
 // End of the namespace gltut
@@ -0,0 +1,59 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "PipelineStateCache.h"
+
+#include <functional>
+
+#include "engine/core/Check.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local functions
+/// Combines a hash with the hash of a value
+template <typename T>
+void combineHash(size_t& hash, const T& value) noexcept
+{
+	hash ^= std::hash<T>()(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+const PipelineState* PipelineStateCache::get(const PipelineState& state) noexcept
+{
+	GLTUT_CATCH_ALL_BEGIN
+	std::lock_guard lock(mMutex);
+	return &*mStates.insert(state).first;
+	GLTUT_CATCH_ALL_END("Cannot cache a pipeline state")
+	return nullptr;
+}
+
+u32 PipelineStateCache::size() const noexcept
+{
+	std::lock_guard lock(mMutex);
+	return static_cast<u32>(mStates.size());
+}
+
+size_t PipelineStateCache::Hash::operator()(const PipelineState& state) const noexcept
+{
+	size_t hash = std::hash<const Shader*>()(state.shader);
+	combineHash(hash, state.blending);
+	combineHash(hash, state.faceCulling);
+	combineHash(hash, state.depthTest);
+	combineHash(hash, state.depthWrite);
+	combineHash(hash, state.colorWrite);
+	combineHash(hash, state.polygonFill);
+	combineHash(hash, state.polygonFillSize);
+	combineHash(hash, state.polygonFillSizeInShader);
+	return hash;
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,51 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <mutex>
+#include <unordered_set>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/core/Types.h"
+#include "engine/graphics/PipelineState.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief The cache of the unique pipeline states of a device.
+	The states live as long as the cache, so their pointers identify them.
+	The states may be requested by several threads at once
+*/
+class PipelineStateCache : public NonCopyable
+{
+public:
+	/**
+		\brief Returns the cached state equal to a state, adds it on the first request
+		\return The cached state or nullptr if it cannot be added
+	*/
+	const PipelineState* get(const PipelineState& state) noexcept;
+
+	/// Returns the number of the cached states
+	u32 size() const noexcept;
+
+private:
+	/// The hash of the pipeline states
+	struct Hash
+	{
+		/// Returns the hash of a state
+		size_t operator()(const PipelineState& state) const noexcept;
+	};
+
+	/// The mutex guarding the states
+	mutable std::mutex mMutex;
+
+	/// The states, the set nodes keep their addresses
+	std::unordered_set<PipelineState, Hash> mStates;
+};
+
+// End of the namespace gltut
+}
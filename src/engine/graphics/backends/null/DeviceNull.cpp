@@ -0,0 +1,210 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "DeviceNull.h"
+
+#include "FramebufferNull.h"
+#include "GeometryNull.h"
+#include "ShaderNull.h"
+#include "ShaderUniformBufferNull.h"
+#include "TextureNull.h"
+
+namespace gltut
+{
+// Global classes
+DeviceNull::DeviceNull(Window& window) :
+
+	GraphicsDeviceBase(window),
+	mDefaultFramebuffer(std::make_unique<WindowFramebufferNull>(mCounters, window))
+{
+}
+
+DeviceNull::~DeviceNull() noexcept
+{
+	// The objects reference the counters, so they must go first
+	removeAllObjects();
+	mDefaultFramebuffer.reset();
+}
+
+void DeviceNull::clear(
+	const Color*,
+	bool) noexcept
+{
+	++mCounters.clears;
+}
+
+std::unique_ptr<Geometry> DeviceNull::createBackendGeometry(
+	VertexFormat vertexFormat,
+	u32 vertexCount,
+	const float* vertices,
+	u32 indexCount,
+	const u32* indices)
+{
+	return std::make_unique<GeometryNull>(
+		mCounters,
+		vertexFormat,
+		vertexCount,
+		vertices,
+		indexCount,
+		indices);
+}
+
+std::unique_ptr<Shader> DeviceNull::createBackendShader(
+	const char* vertexShader,
+	const char* fragmentShader)
+{
+	return std::make_unique<ShaderNull>(mCounters, vertexShader, fragmentShader);
+}
+
+std::unique_ptr<ShaderUniformBuffer> DeviceNull::createBackendShaderUniformBuffer(
+	u32 sizeInBytes)
+{
+	return std::make_unique<ShaderUniformBufferNull>(
+		mCounters,
+		getNextId(),
+		sizeInBytes);
+}
+
+std::unique_ptr<Texture2> DeviceNull::createBackendTexture2(
+	const TextureData& data,
+	const TextureParameters& parameters)
+{
+	return std::make_unique<Texture2Null>(
+		mCounters,
+		getNextId(),
+		data,
+		parameters);
+}
+
+std::unique_ptr<Texture2Array> DeviceNull::createBackendTexture2Array(
+	const Point2u& size,
+	TextureFormat format,
+	u32 layerCount,
+	const TextureParameters& parameters)
+{
+	return std::make_unique<Texture2ArrayNull>(
+		mCounters,
+		getNextId(),
+		size,
+		format,
+		layerCount,
+		parameters);
+}
+
+std::unique_ptr<TextureCubemap> DeviceNull::createBackendTextureCubemap(
+	const TextureData& minusXData,
+	const TextureData& plusXData,
+	const TextureData& minusYData,
+	const TextureData& plusYData,
+	const TextureData& minusZData,
+	const TextureData& plusZData,
+	const TextureParameters& parameters)
+{
+	return std::make_unique<TextureCubemapNull>(
+		mCounters,
+		getNextId(),
+		minusXData,
+		plusXData,
+		minusYData,
+		plusYData,
+		minusZData,
+		plusZData,
+		parameters);
+}
+
+std::unique_ptr<TextureFramebuffer> DeviceNull::createBackendTextureFramebuffer(
+	Texture2* color,
+	Texture2* depth)
+{
+	return std::make_unique<TextureFramebufferNull>(
+		mCounters,
+		color,
+		depth);
+}
+
+void DeviceNull::bindTexture(const Texture* texture, u32 slot) noexcept
+{
+	if (slot >= Texture::TEXTURE_SLOTS)
+	{
+		return;
+	}
+
+	if (texture == nullptr)
+	{
+		++mCounters.textureBinds;
+	}
+	else
+	{
+		texture->bind(slot);
+	}
+}
+
+void DeviceNull::bindShaderUniformBuffer(
+	const ShaderUniformBuffer*,
+	u32) noexcept
+{
+	++mCounters.uniformBufferBinds;
+}
+
+void DeviceNull::bindShaderUniformBufferRange(
+	const ShaderUniformBuffer*,
+	u32,
+	u32,
+	u32) noexcept
+{
+	++mCounters.uniformBufferBinds;
+}
+
+void DeviceNull::setFaceCulling(FaceCullingMode) noexcept
+{
+	++mCounters.stateChanges;
+}
+
+void DeviceNull::setBlending(bool) noexcept
+{
+	++mCounters.stateChanges;
+}
+
+void DeviceNull::setDepthTest(DepthTestMode) noexcept
+{
+	++mCounters.stateChanges;
+}
+
+void DeviceNull::setDepthWrite(bool) noexcept
+{
+	++mCounters.stateChanges;
+}
+
+void DeviceNull::setColorWrite(bool) noexcept
+{
+	++mCounters.stateChanges;
+}
+
+void DeviceNull::setPolygonFill(
+	PolygonFillMode,
+	float,
+	bool) noexcept
+{
+	++mCounters.stateChanges;
+}
+
+void DeviceNull::setFramebuffer(Framebuffer* frameBuffer) noexcept
+{
+	if (frameBuffer == nullptr)
+	{
+		mDefaultFramebuffer->bind();
+	}
+	else
+	{
+		frameBuffer->bind();
+	}
+}
+
+void DeviceNull::setViewport(const Rectangle2u&) noexcept
+{
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,192 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <memory>
+
+#include "../../GraphicsDeviceBase.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Graphics device which does no rendering.
+	The device and its objects only count the calls made to them.
+	Used to measure the CPU cost of the renderer and the scene
+	without a graphics context and driver.
+*/
+class DeviceNull final : public GraphicsDeviceBase
+{
+public:
+	/// Constructor
+	explicit DeviceNull(Window& window);
+
+	/// Destructor. Releases the device objects.
+	~DeviceNull() noexcept final;
+
+	/// Clears the current render target with a specific color
+	void clear(
+		const Color* color,
+		bool depth) noexcept final;
+
+	/// Does nothing, there is no presentation
+	void enableVSync(bool) noexcept final
+	{
+	}
+
+	/// Returns the default framebuffer of the window size
+	Framebuffer* getDefaultFramebuffer() const noexcept final
+	{
+		return mDefaultFramebuffer.get();
+	}
+
+	/// Creates a geometry
+	std::unique_ptr<Geometry> createBackendGeometry(
+		VertexFormat vertexFormat,
+		u32 vertexCount,
+		const float* vertices,
+		u32 indexCount,
+		const u32* indices) final;
+
+	/// Creates a shader
+	std::unique_ptr<Shader> createBackendShader(
+		const char* vertexShader,
+		const char* fragmentShader) final;
+
+	/// Creates a shader uniform buffer
+	std::unique_ptr<ShaderUniformBuffer> createBackendShaderUniformBuffer(
+		u32 sizeInBytes) final;
+
+	/// Creates a texture
+	std::unique_ptr<Texture2> createBackendTexture2(
+		const TextureData& data,
+		const TextureParameters& parameters) final;
+
+	/// Creates a 2D texture array
+	std::unique_ptr<Texture2Array> createBackendTexture2Array(
+		const Point2u& size,
+		TextureFormat format,
+		u32 layerCount,
+		const TextureParameters& parameters) final;
+
+	/// Creates a texture cubemap
+	std::unique_ptr<TextureCubemap> createBackendTextureCubemap(
+		const TextureData& minusXData,
+		const TextureData& plusXData,
+		const TextureData& minusYData,
+		const TextureData& plusYData,
+		const TextureData& minusZData,
+		const TextureData& plusZData,
+		const TextureParameters& parameters) final;
+
+	/// Creates a framebuffer
+	std::unique_ptr<TextureFramebuffer> createBackendTextureFramebuffer(
+		Texture2* color,
+		Texture2* depth) final;
+
+	/// Binds a texture to a slot
+	void bindTexture(const Texture* texture, u32 slot) noexcept final;
+
+	/// Returns true, the null device counts the binds of the texture arrays
+	bool isTextureArraySupported() const noexcept final
+	{
+		return true;
+	}
+
+	/// Returns false, the null device has no bindless handles
+	bool isBindlessTextureSupported() const noexcept final
+	{
+		return false;
+	}
+
+	/// Binds a shader uniform buffer to a binding point
+	void bindShaderUniformBuffer(
+		const ShaderUniformBuffer* buffer,
+		u32 bindingPoint) noexcept final;
+
+	/// Binds a range of a shader uniform buffer to a binding point
+	void bindShaderUniformBufferRange(
+		const ShaderUniformBuffer* buffer,
+		u32 bindingPoint,
+		u32 offset,
+		u32 size) noexcept final;
+
+	/// Returns the common alignment of the uniform buffer range offsets
+	u32 getShaderUniformBufferAlignment() const noexcept final
+	{
+		return 256;
+	}
+
+	/// Returns the common maximum size of a uniform block
+	u32 getMaxShaderUniformBlockSize() const noexcept final
+	{
+		return 65536;
+	}
+
+	/// Set face cull mode
+	void setFaceCulling(FaceCullingMode mode) noexcept final;
+
+	/// Enable or disables blending
+	void setBlending(bool enabled) noexcept final;
+
+	/// Sets the depth function
+	void setDepthTest(DepthTestMode mode) noexcept final;
+
+	/// Counts the state change
+	void setDepthWrite(bool enabled) noexcept final;
+
+	/// Counts the state change
+	void setColorWrite(bool enabled) noexcept final;
+
+	/// Sets the polygon fill mode
+	void setPolygonFill(
+		PolygonFillMode mode,
+		float size = 1.0f,
+		bool enableSizeInShader = false) noexcept final;
+
+	/// Returns nullptr, the device does not support the occlusion queries
+	OcclusionQueryPool* getOcclusionQueries() noexcept final
+	{
+		return nullptr;
+	}
+
+	/// Returns nullptr, the device does not support the timer queries
+	ProfilerQueryPool* getProfilerQueries() noexcept final
+	{
+		return nullptr;
+	}
+
+	/// Returns the call counters
+	GraphicsDeviceCallCounters* getCallCounters() noexcept final
+	{
+		return &mCounters;
+	}
+
+private:
+	/// Sets a framebuffer for rendering
+	void setFramebuffer(Framebuffer* frameBuffer) noexcept final;
+
+	/// Sets the viewport for rendering
+	void setViewport(const Rectangle2u& viewport) noexcept final;
+
+	/// Returns a new unique object id
+	u32 getNextId() noexcept
+	{
+		return ++mLastId;
+	}
+
+	/// The call counters shared by the device objects
+	GraphicsDeviceCallCounters mCounters;
+
+	/// The last assigned object id
+	u32 mLastId = 0;
+
+	/// The default framebuffer
+	std::unique_ptr<Framebuffer> mDefaultFramebuffer;
+};
+
+// End of the namespace gltut
+}
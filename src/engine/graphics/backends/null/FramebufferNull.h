@@ -0,0 +1,97 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDeviceCallCounters.h"
+#include "engine/window/Window.h"
+
+#include "../../framebuffer/TextureFramebufferBase.h"
+
+namespace gltut
+{
+// Global classes
+/// Default framebuffer of the window size which counts the binds
+class WindowFramebufferNull final : public Framebuffer, public NonCopyable
+{
+public:
+	/// Constructor
+	WindowFramebufferNull(
+		GraphicsDeviceCallCounters& counters,
+		const Window& window) noexcept :
+
+		mCounters(counters),
+		mWindow(window)
+	{
+	}
+
+	/// Returns the size of the framebuffer
+	Point2u getSize() const noexcept final
+	{
+		return mWindow.getSize();
+	}
+
+	/// Counts the framebuffer bind
+	void bind() const noexcept final
+	{
+		++mCounters.framebufferBinds;
+	}
+
+	/// Returns false, there is no content to read
+	bool readColor(u8*) const noexcept final
+	{
+		return false;
+	}
+
+private:
+	/// The call counters
+	GraphicsDeviceCallCounters& mCounters;
+
+	/// The window
+	const Window& mWindow;
+};
+
+/// Texture framebuffer which counts the binds
+class TextureFramebufferNull final : public TextureFramebufferBase
+{
+public:
+	/**
+		Constructor
+		\throw std::runtime_error If both textures are null
+	*/
+	TextureFramebufferNull(
+		GraphicsDeviceCallCounters& counters,
+		Texture2* color,
+		Texture2* depth) :
+
+		mCounters(counters)
+	{
+		setColor(color);
+		setDepth(depth);
+		GLTUT_CHECK(
+			getColor() != nullptr || getDepth() != nullptr,
+			"Framebuffer is not valid");
+	}
+
+	/// Counts the framebuffer bind
+	void bind() const noexcept final
+	{
+		++mCounters.framebufferBinds;
+	}
+
+	/// Returns false, there is no content to read
+	bool readColor(u8*) const noexcept final
+	{
+		return false;
+	}
+
+private:
+	/// The call counters
+	GraphicsDeviceCallCounters& mCounters;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,77 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/core/Check.h"
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDeviceCallCounters.h"
+
+#include "../../geometry/GeometryBase.h"
+
+namespace gltut
+{
+// Global classes
+/// Geometry which counts the draw calls instead of drawing
+class GeometryNull final : public GeometryBase, public NonCopyable
+{
+public:
+	/// Constructor
+	GeometryNull(
+		GraphicsDeviceCallCounters& counters,
+		VertexFormat vertexFormat,
+		u32 vertexCount,
+		const float* vertices,
+		u32 indexCount,
+		const u32* indices) :
+
+		GeometryBase(vertexFormat, vertexCount, vertices),
+		mCounters(counters),
+		mIndexCount(indexCount)
+	{
+		GLTUT_CHECK(vertexCount > 0, "Vertex count must be greater than 0");
+		GLTUT_CHECK(vertices != nullptr, "Vertex data must not be null");
+
+		GLTUT_CHECK(indexCount > 0, "Index count must be greater than 0");
+		GLTUT_CHECK(indexCount % 3 == 0, "Index count must be a multiple of 3");
+		GLTUT_CHECK(indices != nullptr, "Index data must not be null");
+
+		mCounters.uploadedBytes +=
+			static_cast<u64>(vertexCount) * vertexFormat.getTotalSizeInBytes() +
+			static_cast<u64>(indexCount) * sizeof(u32);
+	}
+
+	/// Counts the draw call
+	void render() const noexcept final
+	{
+		++mCounters.drawCalls;
+		mCounters.drawnIndices += mIndexCount;
+	}
+
+	/// Counts the instanced draw call and the upload of the instances
+	void renderInstanced(
+		const GeometryInstance* instances,
+		u32 instanceCount) const noexcept final
+	{
+		if (instances == nullptr || instanceCount == 0)
+		{
+			return;
+		}
+
+		++mCounters.drawCalls;
+		mCounters.drawnIndices += static_cast<u64>(mIndexCount) * instanceCount;
+		mCounters.uploadedBytes += static_cast<u64>(instanceCount) * sizeof(GeometryInstance);
+	}
+
+private:
+	/// The call counters
+	GraphicsDeviceCallCounters& mCounters;
+
+	/// Indices count
+	u32 mIndexCount;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,34 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "ShaderNull.h"
+
+namespace gltut
+{
+// Global classes
+int32 ShaderNull::getParameterLocation(const char* name) const noexcept
+{
+	return getLocation(mParameterLocations, name);
+}
+
+int32 ShaderNull::getUniformBlockIndex(const char* name) const noexcept
+{
+	return getLocation(mUniformBlockIndices, name);
+}
+
+int32 ShaderNull::getLocation(
+	std::unordered_map<std::string, int32>& locations,
+	const char* name) noexcept
+{
+	GLTUT_ASSERT_STRING(name);
+	int32 result = -1;
+	GLTUT_CATCH_ALL_BEGIN
+	result = locations.emplace(name, static_cast<int32>(locations.size())).first->second;
+	GLTUT_CATCH_ALL_END("Cannot add a shader parameter")
+	return result;
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,144 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <string>
+#include <unordered_map>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDeviceCallCounters.h"
+#include "engine/graphics/shader/Shader.h"
+
+#include "../../shader/UniformBlockLayout.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Shader which counts the binds and the parameter sets.
+	The shader code is not compiled, so every requested parameter
+	and uniform block exists and gets a unique location on the first request.
+	The std140 layouts of the uniform blocks are read from the shader source.
+*/
+class ShaderNull final : public Shader, public NonCopyable
+{
+public:
+	/**
+		\brief Constructor
+		\throw std::runtime_error If a shader source is null
+	*/
+	ShaderNull(
+		GraphicsDeviceCallCounters& counters,
+		const char* vertexShader,
+		const char* fragmentShader) :
+
+		mCounters(counters)
+	{
+		addUniformBlockLayouts(vertexShader, mUniformBlockLayouts);
+		addUniformBlockLayouts(fragmentShader, mUniformBlockLayouts);
+	}
+
+	/// Returns the location of a shader variable
+	int32 getParameterLocation(const char* name) const noexcept final;
+
+	/// Returns the index of a shader uniform block
+	int32 getUniformBlockIndex(const char* name) const noexcept final;
+
+	/// Sets an integer value to a shader variable
+	void setInt(int32, int) noexcept final
+	{
+		++mCounters.uniformSets;
+	}
+
+	/// Sets a float value to a shader variable
+	void setFloat(int32, float) noexcept final
+	{
+		++mCounters.uniformSets;
+	}
+
+	/// Sets a 2D vector to a shader variable
+	void setVec2(int32, float, float) noexcept final
+	{
+		++mCounters.uniformSets;
+	}
+
+	/// Sets a 2D unsigned integer vector to a shader variable
+	void setUvec2(int32, u32, u32) noexcept final
+	{
+		++mCounters.uniformSets;
+	}
+
+	/// Sets a 3D vector to a shader variable
+	void setVec3(int32, float, float, float) noexcept final
+	{
+		++mCounters.uniformSets;
+	}
+
+	/// Sets a 4D vector to a shader variable
+	void setVec4(int32, float, float, float, float) noexcept final
+	{
+		++mCounters.uniformSets;
+	}
+
+	/// Sets a 3x3 matrix to a shader variable
+	void setMat3(int32, const float*) noexcept final
+	{
+		++mCounters.uniformSets;
+	}
+
+	/// Sets a 4x4 matrix to a shader variable
+	void setMat4(int32, const float*) noexcept final
+	{
+		++mCounters.uniformSets;
+	}
+
+	/// Sets a binding point to a shader uniform block
+	void setUniformBlockBindingPoint(int32, u32) noexcept final
+	{
+		++mCounters.uniformSets;
+	}
+
+	/// Counts the shader bind
+	void bind() const noexcept final
+	{
+		++mCounters.shaderBinds;
+	}
+
+	/// Returns the size of a uniform block in bytes, 0 if the source has no such block
+	u32 getUniformBlockSize(const char* blockName) const noexcept final
+	{
+		return gltut::getUniformBlockSize(mUniformBlockLayouts, blockName);
+	}
+
+	/// Returns the offset of a member of a uniform block in bytes, -1 if the block has no such member
+	int32 getUniformBlockMemberOffset(
+		const char* blockName,
+		const char* memberName) const noexcept final
+	{
+		return gltut::getUniformBlockMemberOffset(mUniformBlockLayouts, blockName, memberName);
+	}
+
+private:
+	/// Returns the location of a name, adding the name if it is new
+	static int32 getLocation(
+		std::unordered_map<std::string, int32>& locations,
+		const char* name) noexcept;
+
+	/// The call counters
+	GraphicsDeviceCallCounters& mCounters;
+
+	/// The locations of the requested parameters
+	mutable std::unordered_map<std::string, int32> mParameterLocations;
+
+	/// The indices of the requested uniform blocks
+	mutable std::unordered_map<std::string, int32> mUniformBlockIndices;
+
+	/// The layouts of the uniform blocks of the source
+	UniformBlockLayouts mUniformBlockLayouts;
+};
+
+// End of the namespace gltut
+}
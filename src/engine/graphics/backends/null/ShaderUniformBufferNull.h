@@ -0,0 +1,64 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/core/Check.h"
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDeviceCallCounters.h"
+#include "engine/graphics/shader/ShaderUniformBuffer.h"
+
+namespace gltut
+{
+// Global classes
+/// Shader uniform buffer which counts the data updates instead of storing the data
+class ShaderUniformBufferNull final : public ShaderUniformBuffer, public NonCopyable
+{
+public:
+	/// Constructor
+	ShaderUniformBufferNull(
+		GraphicsDeviceCallCounters& counters,
+		u32 id,
+		u32 sizeInBytes) :
+
+		mCounters(counters),
+		mId(id),
+		mSizeInBytes(sizeInBytes)
+	{
+		GLTUT_CHECK(sizeInBytes > 0, "Uniform buffer size must be greater than 0");
+	}
+
+	/// Returns the id of the uniform buffer
+	u32 getId() const noexcept final
+	{
+		return mId;
+	}
+
+	/// Counts the data update
+	void setData(const void* data, u32 size, u32 offset) noexcept final
+	{
+		if (GLTUT_ASSERT(data != nullptr) &&
+			GLTUT_ASSERT(size > 0) &&
+			GLTUT_ASSERT(offset + size <= mSizeInBytes))
+		{
+			++mCounters.uniformBufferUpdates;
+			mCounters.uniformBufferBytes += size;
+			mCounters.uploadedBytes += size;
+		}
+	}
+
+private:
+	/// The call counters
+	GraphicsDeviceCallCounters& mCounters;
+
+	/// ShaderUniformBuffer id
+	u32 mId;
+
+	/// Size of the uniform buffer in bytes
+	u32 mSizeInBytes;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,136 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "TextureNull.h"
+#include <array>
+
+namespace gltut
+{
+// Global functions
+u64 getTextureDataSizeInBytes(const TextureData& data) noexcept
+{
+	if (data.data == nullptr)
+	{
+		return 0;
+	}
+
+	u64 pixelSize = 0;
+	switch (data.format)
+	{
+	case TextureFormat::R:
+		pixelSize = 1;
+		break;
+
+	case TextureFormat::RGB:
+		pixelSize = 3;
+		break;
+
+	case TextureFormat::RGBA:
+		pixelSize = 4;
+		break;
+
+	case TextureFormat::FLOAT:
+		pixelSize = sizeof(float);
+		break;
+
+		GLTUT_UNEXPECTED_SWITCH_DEFAULT_CASE(data.format)
+	}
+	return pixelSize * data.size.x * data.size.y;
+}
+
+// Global classes
+Texture2Null::Texture2Null(
+	GraphicsDeviceCallCounters& counters,
+	u32 id,
+	const TextureData& data,
+	const TextureParameters& parameters) :
+
+	TextureTNull<Texture2>(counters, id, parameters),
+	mSize(data.size),
+	mFormat(data.format)
+{
+	GLTUT_CHECK(data.size.x > 0, "Texture width is 0");
+	GLTUT_CHECK(data.size.y > 0, "Texture height is 0");
+	upload(data);
+}
+
+void Texture2Null::setSize(const Point2u& size) noexcept
+{
+	GLTUT_ASSERT(size.x > 0);
+	GLTUT_ASSERT(size.y > 0);
+
+	if (size.x == 0 || size.y == 0)
+	{
+		return;
+	}
+	mSize = size;
+}
+
+Texture2ArrayNull::Texture2ArrayNull(
+	GraphicsDeviceCallCounters& counters,
+	u32 id,
+	const Point2u& size,
+	TextureFormat format,
+	u32 layerCount,
+	const TextureParameters& parameters) :
+
+	TextureTNull<Texture2Array>(counters, id, parameters),
+	mSize(size),
+	mFormat(format),
+	mLayerCount(layerCount)
+{
+	GLTUT_CHECK(size.x > 0, "Texture width is 0");
+	GLTUT_CHECK(size.y > 0, "Texture height is 0");
+	GLTUT_CHECK(layerCount > 0, "Texture array layer count is 0");
+}
+
+void Texture2ArrayNull::setLayerCount(u32 count) noexcept
+{
+	GLTUT_ASSERT(count > 0);
+	if (count > 0)
+	{
+		mLayerCount = count;
+	}
+}
+
+void Texture2ArrayNull::setLayer(u32 layer, const Texture2& texture) noexcept
+{
+	GLTUT_ASSERT(layer < mLayerCount);
+	GLTUT_ASSERT(texture.getFormat() == mFormat);
+	GLTUT_ASSERT(texture.getSize().x == mSize.x && texture.getSize().y == mSize.y);
+}
+
+TextureCubemapNull::TextureCubemapNull(
+	GraphicsDeviceCallCounters& counters,
+	u32 id,
+	const TextureData& minusXData,
+	const TextureData& plusXData,
+	const TextureData& minusYData,
+	const TextureData& plusYData,
+	const TextureData& minusZData,
+	const TextureData& plusZData,
+	const TextureParameters& parameters) :
+
+	TextureTNull<TextureCubemap>(counters, id, parameters)
+{
+	const std::array<const TextureData*, 6> faces = {
+		&plusXData,
+		&minusXData,
+		&plusYData,
+		&minusYData,
+		&plusZData,
+		&minusZData};
+
+	for (const TextureData* faceData : faces)
+	{
+		GLTUT_CHECK(faceData->data != nullptr, "Texture data is null");
+		GLTUT_CHECK(faceData->size.x > 0, "Texture width is 0");
+		GLTUT_CHECK(faceData->size.y > 0, "Texture height is 0");
+		upload(*faceData);
+	}
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,197 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/core/Check.h"
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDeviceCallCounters.h"
+#include "engine/graphics/texture/Texture2.h"
+#include "engine/graphics/texture/Texture2Array.h"
+#include "engine/graphics/texture/TextureCubemap.h"
+
+namespace gltut
+{
+// Global functions
+/// Returns the size of texture data in bytes, 0 if the data is null
+u64 getTextureDataSizeInBytes(const TextureData& data) noexcept;
+
+// Global classes
+/// Template class for textures which count the binds instead of binding
+template <typename TextureInterfaceType>
+class TextureTNull : public TextureInterfaceType, public NonCopyable
+{
+public:
+	/// Constructor
+	TextureTNull(
+		GraphicsDeviceCallCounters& counters,
+		u32 id,
+		const TextureParameters& parameters) noexcept :
+
+		mCounters(counters),
+		mId(id),
+		mParameters(parameters)
+	{
+	}
+
+	/// Returns the texture id
+	u32 getId() const noexcept final
+	{
+		return mId;
+	}
+
+	/// Returns the texture parameters
+	const TextureParameters& getParameters() const noexcept final
+	{
+		return mParameters;
+	}
+
+	/// Sets the texture parameters
+	void setParameters(const TextureParameters& parameters) noexcept final
+	{
+		mParameters = parameters;
+	}
+
+	/// Counts the texture bind
+	void bind(u32 slot) const noexcept final
+	{
+		GLTUT_ASSERT(slot < Texture::TEXTURE_SLOTS);
+		++mCounters.textureBinds;
+	}
+
+	/// Returns 0, the null device does not support the bindless textures
+	u64 getBindlessHandle() const noexcept final
+	{
+		return 0;
+	}
+
+protected:
+	/// Counts the data upload
+	void upload(const TextureData& data) noexcept
+	{
+		mCounters.uploadedBytes += getTextureDataSizeInBytes(data);
+	}
+
+private:
+	/// The call counters
+	GraphicsDeviceCallCounters& mCounters;
+
+	/// Texture ID
+	u32 mId;
+
+	/// Texture parameters
+	TextureParameters mParameters;
+};
+
+/// 2D texture which counts the calls
+class Texture2Null final : public TextureTNull<Texture2>
+{
+public:
+	/**
+		Constructor
+		\throw std::runtime_error If the texture size is 0
+	*/
+	Texture2Null(
+		GraphicsDeviceCallCounters& counters,
+		u32 id,
+		const TextureData& data,
+		const TextureParameters& parameters);
+
+	/// Returns the texture size
+	const Point2u& getSize() const noexcept final
+	{
+		return mSize;
+	}
+
+	/// Returns the texture format
+	TextureFormat getFormat() const noexcept final
+	{
+		return mFormat;
+	}
+
+	/// Sets the size of the texture
+	void setSize(const Point2u& size) noexcept final;
+
+private:
+	/// Texture size
+	Point2u mSize;
+
+	/// Texture format
+	TextureFormat mFormat;
+};
+
+/// 2D texture array which counts the calls
+class Texture2ArrayNull final : public TextureTNull<Texture2Array>
+{
+public:
+	/**
+		Constructor
+		\throw std::runtime_error If the size or the layer count is 0
+	*/
+	Texture2ArrayNull(
+		GraphicsDeviceCallCounters& counters,
+		u32 id,
+		const Point2u& size,
+		TextureFormat format,
+		u32 layerCount,
+		const TextureParameters& parameters);
+
+	/// Returns the format of the layers
+	TextureFormat getFormat() const noexcept final
+	{
+		return mFormat;
+	}
+
+	/// Returns the size of the layers
+	const Point2u& getSize() const noexcept final
+	{
+		return mSize;
+	}
+
+	/// Returns the number of the layers
+	u32 getLayerCount() const noexcept final
+	{
+		return mLayerCount;
+	}
+
+	/// Sets the number of the layers
+	void setLayerCount(u32 count) noexcept final;
+
+	/// Checks the copied texture
+	void setLayer(u32 layer, const Texture2& texture) noexcept final;
+
+private:
+	/// The size of the layers
+	Point2u mSize;
+
+	/// The format of the layers
+	TextureFormat mFormat;
+
+	/// The number of the layers
+	u32 mLayerCount;
+};
+
+/// Cubemap texture which counts the calls
+class TextureCubemapNull final : public TextureTNull<TextureCubemap>
+{
+public:
+	/**
+		Constructor
+		\throw std::runtime_error If the data of a face is null or has 0 size
+	*/
+	TextureCubemapNull(
+		GraphicsDeviceCallCounters& counters,
+		u32 id,
+		const TextureData& minusXData,
+		const TextureData& plusXData,
+		const TextureData& minusYData,
+		const TextureData& plusYData,
+		const TextureData& minusZData,
+		const TextureData& plusZData,
+		const TextureParameters& parameters);
+};
+
+// End of the namespace gltut
+}
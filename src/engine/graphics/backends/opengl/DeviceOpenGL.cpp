@@ -5,57 +5,67 @@
 // Includes
 #include "DeviceOpenGL.h"
 
+#include <algorithm>
 #include <iostream>
-#undef APIENTRY
-#define NOMINMAX
-#include <Windows.h>
 #include <glad/glad.h>
 
+#include "ExtensionsOpenGL.h"
 #include "GeometryOpenGL.h"
 #include "engine/core/Check.h"
 #include "shader/ShaderOpenGL.h"
 #include "shader/ShaderUniformBufferOpenGL.h"
+#include "texture/Texture2ArrayOpenGL.h"
 #include "texture/Texture2OpenGL.h"
 #include "texture/TextureCubemapOpenGL.h"
 
 #include "../../../core/File.h"
+#include "./framebuffer/OffscreenFramebufferOpenGL.h"
 #include "./framebuffer/TextureFramebufferOpenGL.h"
+#include "./framebuffer/WindowFramebufferOpenGL.h"
 
 namespace gltut
 {
-
-// Define the function pointer type
-typedef BOOL(WINAPI* PFNWGLSWAPINTERVALEXTPROC)(int interval);
-
 // Global classes
-DeviceOpenGL::DeviceOpenGL(Window& window) :
+DeviceOpenGL::DeviceOpenGL(
+	Window& window,
+	std::unique_ptr<ContextOpenGL> context) :
+
 	GraphicsDeviceBase(window),
-	mWindowFramebuffer(std::make_unique<WindowFramebufferOpenGL>(window))
+	mContext(std::move(context))
 {
-	GLTUT_CHECK(window.getDeviceContext() != nullptr, "Device context is null")
+	GLTUT_CHECK(mContext != nullptr, "OpenGL context is null")
 
-	HDC hdc = static_cast<HDC>(window.getDeviceContext());
+	// Load GLAD
+	if (!mContext->loadFunctions())
+	{
+		GLTUT_CHECK(false, "Failed to load GLAD");
+	}
 
-	PIXELFORMATDESCRIPTOR pfd = {};
-	pfd.nSize = sizeof(PIXELFORMATDESCRIPTOR);
-	pfd.nVersion = 1;
-	pfd.dwFlags = PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER;
-	pfd.iPixelType = PFD_TYPE_RGBA;
-	pfd.cColorBits = 32;
-	pfd.cDepthBits = 24;
-	pfd.cStencilBits = 8;
-	int pixelFormat = ChoosePixelFormat(hdc, &pfd);
+	mInstanceBuffer = std::make_unique<InstanceBufferOpenGL>();
+	mBindlessTextures = loadBindlessTextureFunctionsOpenGL(*mContext);
 
-	GLTUT_CHECK(SetPixelFormat(hdc, pixelFormat, &pfd), "Failed to set the pixel format");
+	GLint alignment = 0;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	if (alignment > 0)
+	{
+		mShaderUniformBufferAlignment = static_cast<u32>(alignment);
+	}
 
-	HGLRC hglrc = wglCreateContext(hdc);
-	GLTUT_CHECK(hglrc != nullptr, "Failed to create the OpenGL context");
-	GLTUT_CHECK(wglMakeCurrent(hdc, hglrc), "Failed to make the OpenGL context current");
+	GLint maxUniformBlockSize = 0;
+	glGetIntegerv(GL_MAX_UNIFORM_BLOCK_SIZE, &maxUniformBlockSize);
+	if (maxUniformBlockSize > 0)
+	{
+		mMaxShaderUniformBlockSize = static_cast<u32>(maxUniformBlockSize);
+	}
 
-	// Load GLAD
-	if (!gladLoadGL())
+	if (window.getDeviceContext() != nullptr)
 	{
-		GLTUT_CHECK(false, "Failed to load GLAD");
+		mDefaultFramebuffer = std::make_unique<WindowFramebufferOpenGL>(mStateCache, window);
+	}
+	else
+	{
+		// A window without a device context has no on-screen framebuffer
+		mDefaultFramebuffer = std::make_unique<OffscreenFramebufferOpenGL>(mStateCache, window);
 	}
 
 	// Check that the current shader program is 0
@@ -74,12 +84,28 @@ DeviceOpenGL::DeviceOpenGL(Window& window) :
 
 	// Enable scissor test
 	glEnable(GL_SCISSOR_TEST);
+
+	// Binds its shader through the state cache, so it goes after the check of the current program
+	mOcclusionQueries = std::make_unique<OcclusionQueryPoolOpenGL>(mStateCache);
+	mProfilerQueries = std::make_unique<ProfilerQueryPoolOpenGL>();
+}
+
+DeviceOpenGL::~DeviceOpenGL() noexcept
+{
+	removeAllObjects();
+	mDefaultFramebuffer.reset();
+	mOcclusionQueries.reset();
+	mProfilerQueries.reset();
 }
 
 void DeviceOpenGL::clear(
 	const Color* color,
 	bool depth) noexcept
 {
+	++mStateCache.getCounters().clears;
+	// The write masks apply to the clearing too
+	const bool colorMasked = color != nullptr && !mStateCache.getColorMask();
+	const bool depthMasked = depth && !mStateCache.getDepthMask();
 	GLbitfield clearMask = 0;
 	if (color != nullptr)
 	{
@@ -91,20 +117,34 @@ void DeviceOpenGL::clear(
 	{
 		clearMask |= GL_DEPTH_BUFFER_BIT;
 	}
+
+	if (colorMasked)
+	{
+		mStateCache.setColorMask(true);
+	}
+
+	if (depthMasked)
+	{
+		mStateCache.setDepthMask(true);
+	}
+
 	glClear(clearMask);
+	if (colorMasked)
+	{
+		mStateCache.setColorMask(false);
+	}
+
+	if (depthMasked)
+	{
+		mStateCache.setDepthMask(false);
+	}
 }
 
 void DeviceOpenGL::enableVSync(bool vSync) noexcept
 {
-	PFNWGLSWAPINTERVALEXTPROC wglSwapIntervalEXT =
-		(PFNWGLSWAPINTERVALEXTPROC)wglGetProcAddress("wglSwapIntervalEXT");
-	if (wglSwapIntervalEXT != nullptr)
-	{
-		wglSwapIntervalEXT(vSync ? 1 : 0);
-	}
-	else
+	if (!mContext->setSwapInterval(vSync ? 1 : 0) && vSync)
 	{
-		std::cerr << "wglSwapIntervalEXT is not supported, VSync cannot be enabled." << std::endl;
+		std::cerr << "The swap interval is not supported, VSync cannot be enabled." << std::endl;
 	}
 }
 
@@ -112,7 +152,7 @@ void DeviceOpenGL::setFramebuffer(Framebuffer* frameBuffer) noexcept
 {
 	if (frameBuffer == nullptr)
 	{
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		mDefaultFramebuffer->bind();
 	}
 	else
 	{
@@ -122,19 +162,7 @@ void DeviceOpenGL::setFramebuffer(Framebuffer* frameBuffer) noexcept
 
 void DeviceOpenGL::setViewport(const Rectangle2u& viewport) noexcept
 {
-	const auto& min = viewport.getMin();
-	const auto& max = viewport.getMax();
-	glViewport(
-		static_cast<GLint>(min.x),
-		static_cast<GLint>(min.y),
-		static_cast<GLsizei>(max.x - min.x),
-		static_cast<GLsizei>(max.y - min.y));
-
-	glScissor(
-		static_cast<GLint>(min.x),
-		static_cast<GLint>(min.y),
-		static_cast<GLsizei>(max.x - min.x),
-		static_cast<GLsizei>(max.y - min.y));
+	mStateCache.setViewport(viewport);
 }
 
 std::unique_ptr<Geometry> DeviceOpenGL::createBackendGeometry(
@@ -144,8 +172,27 @@ std::unique_ptr<Geometry> DeviceOpenGL::createBackendGeometry(
 	u32 indexCount,
 	const u32* indices)
 {
+	auto arena = std::find_if(
+		mGeometryArenas.begin(),
+		mGeometryArenas.end(),
+		[vertexFormat](const auto& item)
+		{
+			return item->getVertexFormat() == vertexFormat;
+		});
+
+	if (arena == mGeometryArenas.end())
+	{
+		mGeometryArenas.push_back(std::make_unique<GeometryArenaOpenGL>(
+			mStateCache,
+			*mInstanceBuffer,
+			vertexFormat));
+		arena = std::prev(mGeometryArenas.end());
+	}
+
 	return std::make_unique<GeometryOpenGL>(
-		vertexFormat,
+		mStateCache,
+		*mInstanceBuffer,
+		**arena,
 		vertexCount,
 		vertices,
 		indexCount,
@@ -156,20 +203,34 @@ std::unique_ptr<Shader> DeviceOpenGL::createBackendShader(
 	const char* vertexShader,
 	const char* fragmentShader)
 {
-	return std::make_unique<ShaderOpenGL>(vertexShader, fragmentShader);
+	return std::make_unique<ShaderOpenGL>(mStateCache, vertexShader, fragmentShader);
 }
 
 std::unique_ptr<ShaderUniformBuffer> DeviceOpenGL::createBackendShaderUniformBuffer(
 	u32 sizeInBytes)
 {
-	return std::make_unique<ShaderUniformBufferOpenGL>(sizeInBytes);
+	return std::make_unique<ShaderUniformBufferOpenGL>(mStateCache, sizeInBytes);
 }
 
 std::unique_ptr<Texture2> DeviceOpenGL::createBackendTexture2(
 	const TextureData& data,
 	const TextureParameters& parameters)
 {
-	return std::make_unique<Texture2OpenGL>(data, parameters);
+	return std::make_unique<Texture2OpenGL>(mStateCache, data, parameters);
+}
+
+std::unique_ptr<Texture2Array> DeviceOpenGL::createBackendTexture2Array(
+	const Point2u& size,
+	TextureFormat format,
+	u32 layerCount,
+	const TextureParameters& parameters)
+{
+	return std::make_unique<Texture2ArrayOpenGL>(
+		mStateCache,
+		size,
+		format,
+		layerCount,
+		parameters);
 }
 
 std::unique_ptr<TextureCubemap> DeviceOpenGL::createBackendTextureCubemap(
@@ -182,6 +243,7 @@ std::unique_ptr<TextureCubemap> DeviceOpenGL::createBackendTextureCubemap(
 	const TextureParameters& parameters)
 {
 	return std::make_unique<TextureCubemapOpenGL>(
+		mStateCache,
 		minusXData,
 		plusXData,
 		minusYData,
@@ -195,7 +257,7 @@ std::unique_ptr<TextureFramebuffer> DeviceOpenGL::createBackendTextureFramebuffe
 	Texture2* color,
 	Texture2* depth)
 {
-	return std::make_unique<TextureFramebufferOpenGL>(color, depth);
+	return std::make_unique<TextureFramebufferOpenGL>(mStateCache, color, depth);
 }
 
 void DeviceOpenGL::bindTexture(const Texture* texture, u32 slot) noexcept
@@ -205,10 +267,11 @@ void DeviceOpenGL::bindTexture(const Texture* texture, u32 slot) noexcept
 		return;
 	}
 
-	glActiveTexture(GL_TEXTURE0 + slot);
 	if (texture == nullptr)
 	{
-		glBindTexture(GL_TEXTURE_2D, 0);
+		// The slot may be sampled as a 2D texture or a 2D texture array
+		mStateCache.bindTexture(slot, GL_TEXTURE_2D, 0);
+		mStateCache.bindTexture(slot, GL_TEXTURE_2D_ARRAY, 0);
 	}
 	else
 	{
@@ -220,33 +283,52 @@ void DeviceOpenGL::bindShaderUniformBuffer(
 	const ShaderUniformBuffer* buffer,
 	u32 bindingPoint) noexcept
 {
-	glBindBufferBase(
-		GL_UNIFORM_BUFFER,
-		static_cast<GLuint>(bindingPoint),
+	mStateCache.bindUniformBuffer(
+		bindingPoint,
 		buffer != nullptr ? static_cast<GLuint>(buffer->getId()) : 0);
 }
 
+void DeviceOpenGL::bindShaderUniformBufferRange(
+	const ShaderUniformBuffer* buffer,
+	u32 bindingPoint,
+	u32 offset,
+	u32 size) noexcept
+{
+	if (buffer == nullptr || size == 0)
+	{
+		bindShaderUniformBuffer(buffer, bindingPoint);
+		return;
+	}
+
+	GLTUT_ASSERT(offset % mShaderUniformBufferAlignment == 0);
+	mStateCache.bindUniformBuffer(
+		bindingPoint,
+		static_cast<GLuint>(buffer->getId()),
+		offset,
+		size);
+}
+
 void DeviceOpenGL::setFaceCulling(FaceCullingMode mode) noexcept
 {
 	switch (mode)
 	{
 	case FaceCullingMode::BACK:
 	{
-		glEnable(GL_CULL_FACE);
-		glCullFace(GL_BACK);
+		mStateCache.setEnabled(GL_CULL_FACE, true);
+		mStateCache.setCullFace(GL_BACK);
 	}
 	break;
 
 	case FaceCullingMode::FRONT:
 	{
-		glEnable(GL_CULL_FACE);
-		glCullFace(GL_FRONT);
+		mStateCache.setEnabled(GL_CULL_FACE, true);
+		mStateCache.setCullFace(GL_FRONT);
 	}
 	break;
 
 	case FaceCullingMode::NONE:
 	{
-		glDisable(GL_CULL_FACE);
+		mStateCache.setEnabled(GL_CULL_FACE, false);
 	}
 	break;
 
@@ -256,14 +338,7 @@ void DeviceOpenGL::setFaceCulling(FaceCullingMode mode) noexcept
 
 void DeviceOpenGL::setBlending(bool enabled) noexcept
 {
-	if (enabled)
-	{
-		glEnable(GL_BLEND);
-	}
-	else
-	{
-		glDisable(GL_BLEND);
-	}
+	mStateCache.setEnabled(GL_BLEND, enabled);
 }
 
 void DeviceOpenGL::setDepthTest(DepthTestMode mode) noexcept
@@ -308,7 +383,7 @@ void DeviceOpenGL::setDepthTest(DepthTestMode mode) noexcept
 
 	if (glFunction != 0)
 	{
-		glDepthFunc(glFunction);
+		mStateCache.setDepthFunc(glFunction);
 	}
 }
 
@@ -321,29 +396,22 @@ void DeviceOpenGL::setPolygonFill(
 	{
 	case PolygonFillMode::SOLID:
 	{
-		glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+		mStateCache.setPolygonMode(GL_FILL);
 	}
 	break;
 
 	case PolygonFillMode::LINE:
 	{
-		glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-		glLineWidth(size);
+		mStateCache.setPolygonMode(GL_LINE);
+		mStateCache.setLineWidth(size);
 	}
 	break;
 
 	case PolygonFillMode::POINT:
 	{
-		glPolygonMode(GL_FRONT_AND_BACK, GL_POINT);
-		glPointSize(size);
-		if (enableSizeInShader)
-		{
-			glEnable(GL_PROGRAM_POINT_SIZE);
-		}
-		else
-		{
-			glDisable(GL_PROGRAM_POINT_SIZE);
-		}
+		mStateCache.setPolygonMode(GL_POINT);
+		mStateCache.setPointSize(size);
+		mStateCache.setEnabled(GL_PROGRAM_POINT_SIZE, enableSizeInShader);
 	}
 	break;
 
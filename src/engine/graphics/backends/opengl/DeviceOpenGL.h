@@ -9,7 +9,12 @@
 #include <vector>
 
 #include "../../GraphicsDeviceBase.h"
-#include "./framebuffer/WindowFramebufferOpenGL.h"
+#include "./context/ContextOpenGL.h"
+#include "GeometryArenaOpenGL.h"
+#include "InstanceBufferOpenGL.h"
+#include "OcclusionQueryPoolOpenGL.h"
+#include "ProfilerQueryPoolOpenGL.h"
+#include "StateCacheOpenGL.h"
 
 namespace gltut
 {
@@ -18,8 +23,18 @@ namespace gltut
 class DeviceOpenGL final : public GraphicsDeviceBase
 {
 public:
-	/// Constructor
-	DeviceOpenGL(Window& window);
+	/**
+		\brief Constructor
+		\param window The window. If the window has no device context,
+		rendering to the default framebuffer goes to an offscreen framebuffer.
+		\param context The OpenGL context, created and made current for the device
+	*/
+	DeviceOpenGL(
+		Window& window,
+		std::unique_ptr<ContextOpenGL> context);
+
+	/// Destructor. Releases the device objects while the context is still alive.
+	~DeviceOpenGL() noexcept final;
 
 	/// Clears the current render target with a specific color
 	void clear(
@@ -29,10 +44,10 @@ public:
 	/// Enables or disables vertical synchronization
 	void enableVSync(bool vSync) noexcept final;
 
-	/// Returns the default (window) framebuffer
+	/// Returns the default (window or offscreen) framebuffer
 	Framebuffer* getDefaultFramebuffer() const noexcept final
 	{
-		return mWindowFramebuffer.get();
+		return mDefaultFramebuffer.get();
 	}
 
 	std::unique_ptr<Geometry> createBackendGeometry(
@@ -56,6 +71,13 @@ public:
 		const TextureData& data,
 		const TextureParameters& parameters) final;
 
+	/// Creates a 2D texture array
+	std::unique_ptr<Texture2Array> createBackendTexture2Array(
+		const Point2u& size,
+		TextureFormat format,
+		u32 layerCount,
+		const TextureParameters& parameters) final;
+
 	/// Creates a texture cubemap for a specific graphics backend
 	std::unique_ptr<TextureCubemap> createBackendTextureCubemap(
 		const TextureData& minusXData,
@@ -74,11 +96,42 @@ public:
 	/// Binds a texture to a slot
 	void bindTexture(const Texture* texture, u32 slot) noexcept final;
 
+	/// Returns true, OpenGL 3.3 supports the 2D texture arrays
+	bool isTextureArraySupported() const noexcept final
+	{
+		return true;
+	}
+
+	/// Returns if the context supports ARB_bindless_texture
+	bool isBindlessTextureSupported() const noexcept final
+	{
+		return mBindlessTextures;
+	}
+
 	/// Binds a shader uniform buffer to a binding point
 	void bindShaderUniformBuffer(
 		const ShaderUniformBuffer* buffer,
 		u32 bindingPoint) noexcept final;
 
+	/// Binds a range of a shader uniform buffer to a binding point
+	void bindShaderUniformBufferRange(
+		const ShaderUniformBuffer* buffer,
+		u32 bindingPoint,
+		u32 offset,
+		u32 size) noexcept final;
+
+	/// Returns the alignment of the shader uniform buffer range offsets
+	u32 getShaderUniformBufferAlignment() const noexcept final
+	{
+		return mShaderUniformBufferAlignment;
+	}
+
+	/// Returns the maximum size of a shader uniform block in bytes
+	u32 getMaxShaderUniformBlockSize() const noexcept final
+	{
+		return mMaxShaderUniformBlockSize;
+	}
+
 	/// Set face cull mode
 	void setFaceCulling(FaceCullingMode mode) noexcept final;
 
@@ -88,11 +141,46 @@ public:
 	/// Sets the depth function
 	void setDepthTest(DepthTestMode mode) noexcept final;
 
+	/// Enables or disables the depth writes
+	void setDepthWrite(bool enabled) noexcept final
+	{
+		mStateCache.setDepthMask(enabled);
+	}
+
+	/// Enables or disables the color writes
+	void setColorWrite(bool enabled) noexcept final
+	{
+		mStateCache.setColorMask(enabled);
+	}
+
 	void setPolygonFill(
 		PolygonFillMode mode,
 		float size = 1.0f,
 		bool enableSizeInShader = false) noexcept final;
 
+	/// Returns the occlusion query pool
+	OcclusionQueryPool* getOcclusionQueries() noexcept final
+	{
+		return mOcclusionQueries.get();
+	}
+
+	/// Returns the profiler query pool
+	ProfilerQueryPool* getProfilerQueries() noexcept final
+	{
+		return mProfilerQueries.get();
+	}
+
+	/**
+		\brief Returns the counters of the calls passed to OpenGL
+		and of the calls filtered by the state cache.
+		The framebuffer binds and the uploads to geometries, textures
+		and uniform buffers are not counted.
+	*/
+	GraphicsDeviceCallCounters* getCallCounters() noexcept final
+	{
+		return &mStateCache.getCounters();
+	}
+
 private:
 	/// Sets a framebuffer for rendering
 	void setFramebuffer(Framebuffer* frameBuffer) noexcept final;
@@ -100,8 +188,35 @@ private:
 	/// Sets the viewport for rendering
 	void setViewport(const Rectangle2u& viewport) noexcept final;
 
-	/// The window framebuffer
-	std::unique_ptr<WindowFramebufferOpenGL> mWindowFramebuffer;
+	/// The OpenGL context
+	std::unique_ptr<ContextOpenGL> mContext;
+
+	/// The shadow copy of the context state
+	StateCacheOpenGL mStateCache;
+
+	/// The instance buffer shared by the geometries
+	std::unique_ptr<InstanceBufferOpenGL> mInstanceBuffer;
+
+	/// The occlusion query pool
+	std::unique_ptr<OcclusionQueryPoolOpenGL> mOcclusionQueries;
+
+	/// The profiler query pool
+	std::unique_ptr<ProfilerQueryPoolOpenGL> mProfilerQueries;
+
+	/// The geometry arenas, one per vertex format
+	std::vector<std::unique_ptr<GeometryArenaOpenGL>> mGeometryArenas;
+
+	/// The default framebuffer
+	std::unique_ptr<Framebuffer> mDefaultFramebuffer;
+
+	/// The alignment of the uniform buffer range offsets
+	u32 mShaderUniformBufferAlignment = 256;
+
+	/// The maximum size of a uniform block, the OpenGL 3.3 minimum by default
+	u32 mMaxShaderUniformBlockSize = 16384;
+
+	/// If the context supports the bindless textures
+	bool mBindlessTextures = false;
 };
 
 // End of the namespace gltut
@@ -0,0 +1,101 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "ExtensionsOpenGL.h"
+
+#include <cstring>
+#include <glad/glad.h>
+
+namespace gltut
+{
+
+namespace
+{
+// Local types
+/// glGetTextureHandleARB
+using GetTextureHandle = GLuint64 (APIENTRYP)(GLuint texture);
+
+/// glMakeTextureHandleResidentARB and glMakeTextureHandleNonResidentARB
+using SetTextureHandleResidency = void (APIENTRYP)(GLuint64 handle);
+
+// Local variables
+/// The functions of ARB_bindless_texture, null if the extension is not supported
+GetTextureHandle glGetTextureHandle = nullptr;
+SetTextureHandleResidency glMakeTextureHandleResident = nullptr;
+SetTextureHandleResidency glMakeTextureHandleNonResident = nullptr;
+
+// End of the anonymous namespace
+}
+
+// Global functions
+bool hasExtensionOpenGL(const char* name) noexcept
+{
+	GLint count = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for (GLint i = 0; i < count; ++i)
+	{
+		const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+		if (extension != nullptr && std::strcmp(extension, name) == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool loadBindlessTextureFunctionsOpenGL(ContextOpenGL& context) noexcept
+{
+	glGetTextureHandle = nullptr;
+	glMakeTextureHandleResident = nullptr;
+	glMakeTextureHandleNonResident = nullptr;
+	if (!hasExtensionOpenGL("GL_ARB_bindless_texture"))
+	{
+		return false;
+	}
+
+	auto* getTextureHandle = reinterpret_cast<GetTextureHandle>(
+		context.getProcAddress("glGetTextureHandleARB"));
+	auto* makeResident = reinterpret_cast<SetTextureHandleResidency>(
+		context.getProcAddress("glMakeTextureHandleResidentARB"));
+	auto* makeNonResident = reinterpret_cast<SetTextureHandleResidency>(
+		context.getProcAddress("glMakeTextureHandleNonResidentARB"));
+	if (getTextureHandle == nullptr ||
+		makeResident == nullptr ||
+		makeNonResident == nullptr)
+	{
+		return false;
+	}
+
+	glGetTextureHandle = getTextureHandle;
+	glMakeTextureHandleResident = makeResident;
+	glMakeTextureHandleNonResident = makeNonResident;
+	return true;
+}
+
+u64 getBindlessTextureHandleOpenGL(u32 texture) noexcept
+{
+	if (glGetTextureHandle == nullptr)
+	{
+		return 0;
+	}
+
+	const GLuint64 handle = glGetTextureHandle(texture);
+	if (handle != 0)
+	{
+		glMakeTextureHandleResident(handle);
+	}
+	return handle;
+}
+
+void releaseBindlessTextureHandleOpenGL(u64 handle) noexcept
+{
+	if (glMakeTextureHandleNonResident != nullptr && handle != 0)
+	{
+		glMakeTextureHandleNonResident(handle);
+	}
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,31 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/core/Types.h"
+
+#include "./context/ContextOpenGL.h"
+
+namespace gltut
+{
+// Global functions
+/// Returns if the current context has an extension
+bool hasExtensionOpenGL(const char* name) noexcept;
+
+/**
+	\brief Loads the functions of ARB_bindless_texture, not defined by the OpenGL 3.3 loader
+	\return true if the current context supports the bindless textures
+*/
+bool loadBindlessTextureFunctionsOpenGL(ContextOpenGL& context) noexcept;
+
+/// Returns the bindless handle of a texture and makes it resident, 0 without the bindless textures
+u64 getBindlessTextureHandleOpenGL(u32 texture) noexcept;
+
+/// Makes a handle returned by getBindlessTextureHandleOpenGL non-resident
+void releaseBindlessTextureHandleOpenGL(u64 handle) noexcept;
+
+// End of the namespace gltut
+}
@@ -0,0 +1,243 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "GeometryArenaOpenGL.h"
+
+#include <algorithm>
+
+#include "engine/core/Check.h"
+#include "engine/graphics/geometry/Geometry.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The minimum capacity of the vertex buffer, in vertices
+constexpr u32 MIN_VERTEX_CAPACITY = 1 << 16;
+
+/// The minimum capacity of the index buffer, in indices
+constexpr u32 MIN_INDEX_CAPACITY = 3 << 16;
+
+// Local functions
+/// Creates a buffer of a size without data
+GLuint createBuffer(size_t size) noexcept
+{
+	GLuint buffer = 0;
+	glGenBuffers(1, &buffer);
+	GLTUT_ASSERT(buffer != 0);
+
+	// The copy targets are not a part of the vertex array state
+	glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+	glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, GL_STATIC_DRAW);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	return buffer;
+}
+
+/// Returns the capacity which fits the used and the requested sizes
+u32 getGrownCapacity(const RangeAllocator& allocator, u32 size, u32 minCapacity) noexcept
+{
+	const u32 capacity = allocator.getCapacity();
+	const u32 required = capacity - allocator.getFreeSize() + size;
+	return required <= capacity ?
+		capacity :
+		std::max({required, capacity * 2, minCapacity});
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+GeometryArenaOpenGL::GeometryArenaOpenGL(
+	StateCacheOpenGL& stateCache,
+	const InstanceBufferOpenGL& instanceBuffer,
+	VertexFormat vertexFormat) :
+
+	mStateCache(stateCache),
+	mInstanceBuffer(instanceBuffer),
+	mVertexFormat(vertexFormat)
+{
+	GLTUT_CHECK(
+		vertexFormat.getComponentSize(Geometry::INSTANCE_TRANSFORM_LOCATION) == 0,
+		"The vertex components overlap the instance attributes");
+
+	glGenVertexArrays(1, &mVertexArray);
+	GLTUT_CHECK(mVertexArray != 0, "Failed to create a vertex array");
+}
+
+GeometryArenaOpenGL::~GeometryArenaOpenGL() noexcept
+{
+	mStateCache.onVertexArrayDeleted(mVertexArray);
+	glDeleteVertexArrays(1, &mVertexArray);
+	mStateCache.onBufferDeleted(mVertexBuffer);
+	glDeleteBuffers(1, &mVertexBuffer);
+	mStateCache.onBufferDeleted(mIndexBuffer);
+	glDeleteBuffers(1, &mIndexBuffer);
+}
+
+u32 GeometryArenaOpenGL::allocate(
+	u32 vertexCount,
+	const float* vertices,
+	u32 indexCount,
+	const u32* indices) noexcept
+{
+	std::optional<u32> firstVertex = mVertexAllocator.allocate(vertexCount);
+	std::optional<u32> firstIndex = mIndexAllocator.allocate(indexCount);
+	if (!firstVertex || !firstIndex)
+	{
+		if (firstVertex)
+		{
+			mVertexAllocator.free(*firstVertex, vertexCount);
+		}
+
+		if (firstIndex)
+		{
+			mIndexAllocator.free(*firstIndex, indexCount);
+		}
+
+		relocate(
+			getGrownCapacity(mVertexAllocator, vertexCount, MIN_VERTEX_CAPACITY),
+			getGrownCapacity(mIndexAllocator, indexCount, MIN_INDEX_CAPACITY));
+
+		// The free space is a single range at the end after the relocation
+		firstVertex = mVertexAllocator.allocate(vertexCount);
+		firstIndex = mIndexAllocator.allocate(indexCount);
+		GLTUT_ASSERT(firstVertex && firstIndex);
+	}
+
+	const size_t vertexSize = mVertexFormat.getTotalSizeInBytes();
+	glBindBuffer(GL_COPY_WRITE_BUFFER, mVertexBuffer);
+	glBufferSubData(
+		GL_COPY_WRITE_BUFFER,
+		*firstVertex * vertexSize,
+		vertexCount * vertexSize,
+		vertices);
+
+	glBindBuffer(GL_COPY_WRITE_BUFFER, mIndexBuffer);
+	glBufferSubData(
+		GL_COPY_WRITE_BUFFER,
+		*firstIndex * sizeof(u32),
+		indexCount * sizeof(u32),
+		indices);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	const Range range = {*firstVertex, vertexCount, *firstIndex, indexCount};
+	if (mFreeHandles.empty())
+	{
+		mRanges.push_back(range);
+		return static_cast<u32>(mRanges.size() - 1);
+	}
+
+	const u32 handle = mFreeHandles.back();
+	mFreeHandles.pop_back();
+	mRanges[handle] = range;
+	return handle;
+}
+
+void GeometryArenaOpenGL::free(u32 handle) noexcept
+{
+	if (!GLTUT_ASSERT(handle < mRanges.size() && mRanges[handle].vertexCount != 0))
+	{
+		return;
+	}
+
+	Range& range = mRanges[handle];
+	mVertexAllocator.free(range.firstVertex, range.vertexCount);
+	mIndexAllocator.free(range.firstIndex, range.indexCount);
+	range = {};
+	mFreeHandles.push_back(handle);
+}
+
+void GeometryArenaOpenGL::relocate(u32 vertexCapacity, u32 indexCapacity) noexcept
+{
+	const size_t vertexSize = mVertexFormat.getTotalSizeInBytes();
+	const GLuint vertexBuffer = createBuffer(vertexCapacity * vertexSize);
+	const GLuint indexBuffer = createBuffer(indexCapacity * sizeof(u32));
+
+	// The indices are relative to the first vertex, so only the ranges move
+	u32 vertexCount = 0;
+	u32 indexCount = 0;
+	for (Range& range : mRanges)
+	{
+		if (range.vertexCount == 0)
+		{
+			continue;
+		}
+
+		glBindBuffer(GL_COPY_READ_BUFFER, mVertexBuffer);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, vertexBuffer);
+		glCopyBufferSubData(
+			GL_COPY_READ_BUFFER,
+			GL_COPY_WRITE_BUFFER,
+			range.firstVertex * vertexSize,
+			vertexCount * vertexSize,
+			range.vertexCount * vertexSize);
+
+		glBindBuffer(GL_COPY_READ_BUFFER, mIndexBuffer);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, indexBuffer);
+		glCopyBufferSubData(
+			GL_COPY_READ_BUFFER,
+			GL_COPY_WRITE_BUFFER,
+			range.firstIndex * sizeof(u32),
+			indexCount * sizeof(u32),
+			range.indexCount * sizeof(u32));
+
+		range.firstVertex = vertexCount;
+		range.firstIndex = indexCount;
+		vertexCount += range.vertexCount;
+		indexCount += range.indexCount;
+	}
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	mStateCache.onBufferDeleted(mVertexBuffer);
+	glDeleteBuffers(1, &mVertexBuffer);
+	mStateCache.onBufferDeleted(mIndexBuffer);
+	glDeleteBuffers(1, &mIndexBuffer);
+
+	mVertexBuffer = vertexBuffer;
+	mIndexBuffer = indexBuffer;
+	mVertexAllocator.reset(vertexCapacity, vertexCount);
+	mIndexAllocator.reset(indexCapacity, indexCount);
+	setVertexArray();
+}
+
+void GeometryArenaOpenGL::setVertexArray() const noexcept
+{
+	mStateCache.bindVertexArray(mVertexArray);
+	glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+
+	const u32 stride = mVertexFormat.getTotalSizeInBytes();
+	size_t offset = 0;
+	for (u32 i = 0; i < VertexFormat::MAX_VERTEX_COMPONENTS; ++i)
+	{
+		if (mVertexFormat.getComponentSize(i) == 0)
+		{
+			break;
+		}
+
+		glVertexAttribPointer(
+			i,
+			mVertexFormat.getComponentSize(i),
+			GL_FLOAT,
+			GL_FALSE,
+			stride,
+			reinterpret_cast<const void*>(offset));
+
+		glEnableVertexAttribArray(i);
+
+		offset += mVertexFormat.getComponentSizeInBytes(i);
+	}
+
+	mInstanceBuffer.setAttributes();
+
+	mStateCache.bindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// End of the namespace gltut
+}
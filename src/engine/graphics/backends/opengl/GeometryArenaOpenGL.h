@@ -0,0 +1,133 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <vector>
+#include <glad/glad.h>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/geometry/VertexFormat.h"
+
+#include "../../../core/RangeAllocator.h"
+#include "InstanceBufferOpenGL.h"
+#include "StateCacheOpenGL.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Shared vertex and index buffers of the geometries of a vertex format.
+	The geometries sub-allocate their vertex and index ranges from the buffers
+	and are drawn with the base vertex from the single vertex array of the arena,
+	so the consecutive draws of different geometries do not switch the vertex arrays.
+	When a range does not fit, the live ranges are compacted to the beginning
+	of the buffers, which are grown if the free space is not enough.
+*/
+class GeometryArenaOpenGL : public NonCopyable
+{
+public:
+	/// The vertex and index ranges of a geometry
+	struct Range
+	{
+		/// The first vertex
+		u32 firstVertex;
+
+		/// The number of vertices, 0 for a free handle
+		u32 vertexCount;
+
+		/// The first index
+		u32 firstIndex;
+
+		/// The number of indices
+		u32 indexCount;
+	};
+
+	/**
+		\brief Constructor
+		\throw std::runtime_error If the vertex components overlap the instance attributes
+	*/
+	GeometryArenaOpenGL(
+		StateCacheOpenGL& stateCache,
+		const InstanceBufferOpenGL& instanceBuffer,
+		VertexFormat vertexFormat);
+
+	/// Destructor
+	~GeometryArenaOpenGL() noexcept;
+
+	/// Returns the vertex format
+	VertexFormat getVertexFormat() const noexcept
+	{
+		return mVertexFormat;
+	}
+
+	/// Returns the vertex array
+	GLuint getVertexArray() const noexcept
+	{
+		return mVertexArray;
+	}
+
+	/**
+		\brief Allocates and uploads the vertices and the indices of a geometry
+		\return The handle of the geometry ranges
+	*/
+	u32 allocate(
+		u32 vertexCount,
+		const float* vertices,
+		u32 indexCount,
+		const u32* indices) noexcept;
+
+	/// Frees the ranges of a geometry
+	void free(u32 handle) noexcept;
+
+	/// Returns the ranges of a geometry. Valid until the next allocation
+	const Range& getRange(u32 handle) const noexcept
+	{
+		return mRanges[handle];
+	}
+
+private:
+	/**
+		\brief Moves the live ranges to the beginning of new buffers of the capacities.
+		Compacts the ranges when the capacities are the current ones
+	*/
+	void relocate(u32 vertexCapacity, u32 indexCapacity) noexcept;
+
+	/// Sets the vertex attributes and the index buffer of the vertex array
+	void setVertexArray() const noexcept;
+
+	/// The state cache of the device
+	StateCacheOpenGL& mStateCache;
+
+	/// The instance buffer of the device
+	const InstanceBufferOpenGL& mInstanceBuffer;
+
+	/// The vertex format
+	VertexFormat mVertexFormat;
+
+	/// The vertex buffer
+	GLuint mVertexBuffer = 0;
+
+	/// The index buffer
+	GLuint mIndexBuffer = 0;
+
+	/// The vertex array
+	GLuint mVertexArray = 0;
+
+	/// The allocator of the vertices
+	RangeAllocator mVertexAllocator;
+
+	/// The allocator of the indices
+	RangeAllocator mIndexAllocator;
+
+	/// The ranges of the geometries, indexed by the handles
+	std::vector<Range> mRanges;
+
+	/// The free handles
+	std::vector<u32> mFreeHandles;
+};
+
+// End of the namespace gltut
+}
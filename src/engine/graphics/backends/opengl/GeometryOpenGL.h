@@ -6,18 +6,22 @@
 
 // Includes
 #include "engine/core/NonCopyable.h"
-#include "engine/graphics/geometry/Geometry.h"
+
+#include "../../geometry/GeometryBase.h"
+#include "GeometryArenaOpenGL.h"
 
 namespace gltut
 {
 // Global classes
-/// OpenGL implementation of a geometry
-class GeometryOpenGL final : public Geometry, public NonCopyable
+/// OpenGL implementation of a geometry, stored in the arena of its vertex format
+class GeometryOpenGL final : public GeometryBase, public NonCopyable
 {
 public:
 	/// Constructor
 	GeometryOpenGL(
-		VertexFormat vertexFormat,
+		StateCacheOpenGL& stateCache,
+		InstanceBufferOpenGL& instanceBuffer,
+		GeometryArenaOpenGL& arena,
 		u32 vertexCount,
 		const float* vertices,
 		u32 indexCount,
@@ -29,18 +33,23 @@ public:
 	/// Renders the geometry
 	void render() const noexcept final;
 
+	/// Renders instances of the geometry with a single draw call
+	void renderInstanced(
+		const GeometryInstance* instances,
+		u32 instanceCount) const noexcept final;
+
 private:
-	/// Indices count
-	u32 mIndexCount;
+	/// The state cache of the device
+	StateCacheOpenGL& mStateCache;
 
-	/// The vertex buffer object
-	u32 mVertexBuffer = 0;
+	/// The instance buffer of the device
+	InstanceBufferOpenGL& mInstanceBuffer;
 
-	/// The element buffer object
-	u32 mIndexBuffer = 0;
+	/// The arena of the geometry
+	GeometryArenaOpenGL& mArena;
 
-	/// The vertex array object
-	u32 mVertexArray = 0;
+	/// The handle of the geometry ranges in the arena
+	u32 mHandle;
 };
 
 // End of the namespace gltut
@@ -0,0 +1,79 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "InstanceBufferOpenGL.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "engine/core/Check.h"
+
+namespace gltut
+{
+// Global classes
+InstanceBufferOpenGL::InstanceBufferOpenGL()
+{
+	glGenBuffers(1, &mBuffer);
+	GLTUT_CHECK(mBuffer != 0, "Failed to create the instance buffer");
+
+	const GeometryInstance identity{Matrix4::identity(), Matrix3::identity()};
+	upload(&identity, 1);
+}
+
+InstanceBufferOpenGL::~InstanceBufferOpenGL() noexcept
+{
+	glDeleteBuffers(1, &mBuffer);
+}
+
+void InstanceBufferOpenGL::setAttributes() const noexcept
+{
+	glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+	const auto setAttribute = [](u32 location, u32 size, size_t offset)
+	{
+		glVertexAttribPointer(
+			location,
+			size,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(GeometryInstance),
+			reinterpret_cast<const void*>(offset));
+		glVertexAttribDivisor(location, 1);
+		glEnableVertexAttribArray(location);
+	};
+
+	for (u32 column = 0; column < 4; ++column)
+	{
+		setAttribute(
+			Geometry::INSTANCE_TRANSFORM_LOCATION + column,
+			4,
+			offsetof(GeometryInstance, transform) + column * 4 * sizeof(float));
+	}
+
+	for (u32 column = 0; column < 3; ++column)
+	{
+		setAttribute(
+			Geometry::INSTANCE_NORMAL_MATRIX_LOCATION + column,
+			3,
+			offsetof(GeometryInstance, normalMatrix) + column * 3 * sizeof(float));
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void InstanceBufferOpenGL::upload(const GeometryInstance* instances, u32 instanceCount) noexcept
+{
+	if (instances == nullptr || instanceCount == 0)
+	{
+		return;
+	}
+
+	mCapacity = std::max(mCapacity, instanceCount);
+	glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+	glBufferData(GL_ARRAY_BUFFER, mCapacity * sizeof(GeometryInstance), nullptr, GL_STREAM_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, instanceCount * sizeof(GeometryInstance), instances);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,47 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <glad/glad.h>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/geometry/Geometry.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Streaming vertex buffer of the geometry instances, shared by all the geometries.
+	The vertex arrays of the geometries source the instance attributes from it,
+	so an instanced draw call only uploads the instances.
+	The buffer always holds at least one instance, so the non-instanced
+	draw calls read valid instance attributes.
+*/
+class InstanceBufferOpenGL : public NonCopyable
+{
+public:
+	/// Constructor. Creates the buffer with one identity instance
+	InstanceBufferOpenGL();
+
+	/// Destructor
+	~InstanceBufferOpenGL() noexcept;
+
+	/// Sets the instance attributes of the bound vertex array
+	void setAttributes() const noexcept;
+
+	/// Uploads instances, orphaning the previous buffer storage
+	void upload(const GeometryInstance* instances, u32 instanceCount) noexcept;
+
+private:
+	/// The buffer
+	GLuint mBuffer = 0;
+
+	/// The buffer capacity, in instances
+	u32 mCapacity = 0;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,207 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "OcclusionQueryPoolOpenGL.h"
+
+#include <array>
+
+#include "engine/core/Check.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The conservative query target of OpenGL 4.3, not defined by the OpenGL 3.3 loader
+constexpr GLenum ANY_SAMPLES_PASSED_CONSERVATIVE = 0x8D6A;
+
+/// The corners of the unit cube, the bits 0, 1, 2 of a corner index select x, y, z = 1
+constexpr std::array<float, 24> CUBE_VERTICES = {
+	0.0f, 0.0f, 0.0f,
+	1.0f, 0.0f, 0.0f,
+	0.0f, 1.0f, 0.0f,
+	1.0f, 1.0f, 0.0f,
+	0.0f, 0.0f, 1.0f,
+	1.0f, 0.0f, 1.0f,
+	0.0f, 1.0f, 1.0f,
+	1.0f, 1.0f, 1.0f};
+
+/// The triangles of the faces of the unit cube
+constexpr std::array<u32, 36> CUBE_INDICES = {
+	0, 2, 6, 0, 6, 4,
+	1, 5, 7, 1, 7, 3,
+	0, 4, 5, 0, 5, 1,
+	2, 3, 7, 2, 7, 6,
+	0, 1, 3, 0, 3, 2,
+	4, 6, 7, 4, 7, 5};
+
+/// The vertex shader of the boxes
+const char* const BOX_VERTEX_SHADER = R"(
+#version 330 core
+layout (location = 0) in vec3 position;
+uniform mat4 boxTransform;
+
+void main()
+{
+	gl_Position = boxTransform * vec4(position, 1.0);
+}
+)";
+
+/// The fragment shader of the boxes, the color is not written
+const char* const BOX_FRAGMENT_SHADER = R"(
+#version 330 core
+
+void main()
+{
+}
+)";
+
+// End of the anonymous namespace
+}
+
+// Global classes
+OcclusionQueryPoolOpenGL::OcclusionQueryPoolOpenGL(StateCacheOpenGL& stateCache) :
+
+	mStateCache(stateCache)
+{
+	GLint majorVersion = 0;
+	GLint minorVersion = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
+	glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
+	if (majorVersion > 4 || (majorVersion == 4 && minorVersion >= 3))
+	{
+		mTarget = ANY_SAMPLES_PASSED_CONSERVATIVE;
+	}
+
+	mShader = std::make_unique<ShaderOpenGL>(stateCache, BOX_VERTEX_SHADER, BOX_FRAGMENT_SHADER);
+	mTransformLocation = mShader->getParameterLocation("boxTransform");
+	GLTUT_CHECK(mTransformLocation >= 0, "The box shader has no transform");
+
+	glGenVertexArrays(1, &mVertexArray);
+	glGenBuffers(1, &mVertexBuffer);
+	glGenBuffers(1, &mIndexBuffer);
+	GLTUT_CHECK(
+		mVertexArray != 0 && mVertexBuffer != 0 && mIndexBuffer != 0,
+		"Failed to create the occlusion query boxes");
+
+	mStateCache.bindVertexArray(mVertexArray);
+	glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(CUBE_VERTICES), CUBE_VERTICES.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(CUBE_INDICES), CUBE_INDICES.data(), GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr);
+	glEnableVertexAttribArray(0);
+	mStateCache.bindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+OcclusionQueryPoolOpenGL::~OcclusionQueryPoolOpenGL() noexcept
+{
+	if (!mQueries.empty())
+	{
+		glDeleteQueries(static_cast<GLsizei>(mQueries.size()), mQueries.data());
+	}
+
+	mStateCache.onVertexArrayDeleted(mVertexArray);
+	glDeleteVertexArrays(1, &mVertexArray);
+	mStateCache.onBufferDeleted(mVertexBuffer);
+	glDeleteBuffers(1, &mVertexBuffer);
+	mStateCache.onBufferDeleted(mIndexBuffer);
+	glDeleteBuffers(1, &mIndexBuffer);
+}
+
+u32 OcclusionQueryPoolOpenGL::acquire() noexcept
+{
+	if (!mFreeQueries.empty())
+	{
+		const GLuint query = mFreeQueries.back();
+		mFreeQueries.pop_back();
+		return query;
+	}
+
+	GLuint query = 0;
+	GLTUT_CATCH_ALL_BEGIN
+	// Reserves the place in the free list, so the release does not allocate
+	mFreeQueries.reserve(mQueries.size() + 1);
+	mQueries.reserve(mQueries.size() + 1);
+	glGenQueries(1, &query);
+	if (query != 0)
+	{
+		mQueries.push_back(query);
+	}
+	GLTUT_CATCH_ALL_END("Cannot create an occlusion query")
+	return query;
+}
+
+void OcclusionQueryPoolOpenGL::release(u32 query) noexcept
+{
+	if (query != 0 && GLTUT_ASSERT(mFreeQueries.size() < mQueries.size()))
+	{
+		mFreeQueries.push_back(query);
+	}
+}
+
+void OcclusionQueryPoolOpenGL::beginBoxes() noexcept
+{
+	mShader->bind();
+	mStateCache.bindVertexArray(mVertexArray);
+	mColorMask = mStateCache.getColorMask();
+	mStateCache.setColorMask(false);
+	mDepthMask = mStateCache.getDepthMask();
+	mStateCache.setDepthMask(false);
+
+	// Both sides of the boxes are tested, so the boxes work with any culling mode
+	mFaceCulling = mStateCache.isEnabled(GL_CULL_FACE);
+	mStateCache.setEnabled(GL_CULL_FACE, false);
+}
+
+void OcclusionQueryPoolOpenGL::queryBox(u32 query, const Matrix4& transform) noexcept
+{
+	mShader->setMat4(mTransformLocation, transform.data());
+	glBeginQuery(mTarget, query);
+	glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(CUBE_INDICES.size()), GL_UNSIGNED_INT, nullptr);
+	glEndQuery(mTarget);
+
+	GraphicsDeviceCallCounters& counters = mStateCache.getCounters();
+	++counters.occlusionQueries;
+	++counters.drawCalls;
+	counters.drawnIndices += CUBE_INDICES.size();
+}
+
+void OcclusionQueryPoolOpenGL::endBoxes() noexcept
+{
+	mStateCache.setColorMask(mColorMask);
+	mStateCache.setDepthMask(mDepthMask);
+	mStateCache.setEnabled(GL_CULL_FACE, mFaceCulling);
+}
+
+std::optional<bool> OcclusionQueryPoolOpenGL::getResult(u32 query) noexcept
+{
+	GLuint available = GL_FALSE;
+	glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+	if (available == GL_FALSE)
+	{
+		return std::nullopt;
+	}
+
+	GLuint result = 0;
+	glGetQueryObjectuiv(query, GL_QUERY_RESULT, &result);
+	return result != 0;
+}
+
+void OcclusionQueryPoolOpenGL::beginConditionalRender(u32 query) noexcept
+{
+	glBeginConditionalRender(query, GL_QUERY_NO_WAIT);
+	++mStateCache.getCounters().conditionalRenders;
+}
+
+void OcclusionQueryPoolOpenGL::endConditionalRender() noexcept
+{
+	glEndConditionalRender();
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,100 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <memory>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/query/OcclusionQueryPool.h"
+
+#include "StateCacheOpenGL.h"
+#include "shader/ShaderOpenGL.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief OpenGL implementation of the occlusion query pool.
+	Uses GL_ANY_SAMPLES_PASSED_CONSERVATIVE on OpenGL 4.3+ and GL_ANY_SAMPLES_PASSED otherwise.
+	The released queries are kept for reuse and deleted with the pool
+*/
+class OcclusionQueryPoolOpenGL final : public OcclusionQueryPool, public NonCopyable
+{
+public:
+	/**
+		\brief Constructor
+		\throw std::runtime_error If the box shader or buffers cannot be created
+	*/
+	explicit OcclusionQueryPoolOpenGL(StateCacheOpenGL& stateCache);
+
+	/// Destructor
+	~OcclusionQueryPoolOpenGL() noexcept final;
+
+	/// Acquires a query
+	u32 acquire() noexcept final;
+
+	/// Returns a query to the pool
+	void release(u32 query) noexcept final;
+
+	/// Starts rendering the query boxes
+	void beginBoxes() noexcept final;
+
+	/// Renders a box into a query
+	void queryBox(u32 query, const Matrix4& transform) noexcept final;
+
+	/// Restores the state changed by beginBoxes()
+	void endBoxes() noexcept final;
+
+	/// Returns the result of a query if it is available
+	std::optional<bool> getResult(u32 query) noexcept final;
+
+	/// Starts the conditional rendering, not waiting for the query result
+	void beginConditionalRender(u32 query) noexcept final;
+
+	/// Ends the conditional rendering
+	void endConditionalRender() noexcept final;
+
+private:
+	/// The state cache
+	StateCacheOpenGL& mStateCache;
+
+	/// The query target
+	GLenum mTarget = GL_ANY_SAMPLES_PASSED;
+
+	/// All the created queries
+	std::vector<GLuint> mQueries;
+
+	/// The released queries
+	std::vector<GLuint> mFreeQueries;
+
+	/// The shader of the boxes
+	std::unique_ptr<ShaderOpenGL> mShader;
+
+	/// The location of the box transform
+	int32 mTransformLocation = -1;
+
+	/// The vertex array of the unit cube
+	GLuint mVertexArray = 0;
+
+	/// The vertex buffer of the unit cube
+	GLuint mVertexBuffer = 0;
+
+	/// The index buffer of the unit cube
+	GLuint mIndexBuffer = 0;
+
+	/// If the face culling is enabled before beginBoxes()
+	bool mFaceCulling = false;
+
+	/// If the color writes are enabled before beginBoxes()
+	bool mColorMask = true;
+
+	/// If the depth writes are enabled before beginBoxes()
+	bool mDepthMask = true;
+};
+
+// End of the namespace gltut
+}
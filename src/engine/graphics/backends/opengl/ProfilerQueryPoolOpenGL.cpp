@@ -0,0 +1,135 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "ProfilerQueryPoolOpenGL.h"
+
+#include "engine/core/Check.h"
+#include "ExtensionsOpenGL.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The pipeline statistics query targets of OpenGL 4.6, not defined by the OpenGL 3.3 loader
+constexpr GLenum VERTICES_SUBMITTED = 0x82EE;
+constexpr GLenum PRIMITIVES_SUBMITTED = 0x82EF;
+constexpr GLenum FRAGMENT_SHADER_INVOCATIONS = 0x82F4;
+
+/// The query targets of a profiler query, in the order of its OpenGL queries
+constexpr GLenum TARGETS[] = {
+	GL_TIME_ELAPSED,
+	VERTICES_SUBMITTED,
+	PRIMITIVES_SUBMITTED,
+	FRAGMENT_SHADER_INVOCATIONS};
+
+// End of the anonymous namespace
+}
+
+// Global classes
+ProfilerQueryPoolOpenGL::ProfilerQueryPoolOpenGL() noexcept
+{
+	GLint majorVersion = 0;
+	GLint minorVersion = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
+	glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
+	mPipelineStatistics =
+		majorVersion > 4 ||
+		(majorVersion == 4 && minorVersion >= 6) ||
+		hasExtensionOpenGL("GL_ARB_pipeline_statistics_query");
+}
+
+ProfilerQueryPoolOpenGL::~ProfilerQueryPoolOpenGL() noexcept
+{
+	for (const QuerySet& queries : mQueries)
+	{
+		glDeleteQueries(TARGET_COUNT, queries.data());
+	}
+}
+
+u32 ProfilerQueryPoolOpenGL::acquire() noexcept
+{
+	if (!mFreeQueries.empty())
+	{
+		const u32 query = mFreeQueries.back();
+		mFreeQueries.pop_back();
+		return query;
+	}
+
+	u32 query = 0;
+	GLTUT_CATCH_ALL_BEGIN
+	// Reserves the place in the free list, so the release does not allocate
+	mFreeQueries.reserve(mQueries.size() + 1);
+	QuerySet& queries = mQueries.emplace_back();
+	glGenQueries(TARGET_COUNT, queries.data());
+	query = static_cast<u32>(mQueries.size());
+	GLTUT_CATCH_ALL_END("Cannot create a profiler query")
+	return query;
+}
+
+void ProfilerQueryPoolOpenGL::release(u32 query) noexcept
+{
+	if (query != 0 && GLTUT_ASSERT(mFreeQueries.size() < mQueries.size()))
+	{
+		mFreeQueries.push_back(query);
+	}
+}
+
+void ProfilerQueryPoolOpenGL::begin(u32 query) noexcept
+{
+	if (!GLTUT_ASSERT(query != 0 && query <= mQueries.size()))
+	{
+		return;
+	}
+
+	const QuerySet& queries = mQueries[query - 1];
+	for (u32 i = 0; i < getTargetCount(); ++i)
+	{
+		glBeginQuery(TARGETS[i], queries[i]);
+	}
+}
+
+void ProfilerQueryPoolOpenGL::end(u32 query) noexcept
+{
+	if (!GLTUT_ASSERT(query != 0 && query <= mQueries.size()))
+	{
+		return;
+	}
+
+	for (u32 i = 0; i < getTargetCount(); ++i)
+	{
+		glEndQuery(TARGETS[i]);
+	}
+}
+
+std::optional<ProfilerQueryPool::Result> ProfilerQueryPoolOpenGL::getResult(u32 query) noexcept
+{
+	if (!GLTUT_ASSERT(query != 0 && query <= mQueries.size()))
+	{
+		return std::nullopt;
+	}
+
+	const QuerySet& queries = mQueries[query - 1];
+	for (u32 i = 0; i < getTargetCount(); ++i)
+	{
+		GLuint available = GL_FALSE;
+		glGetQueryObjectuiv(queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (available == GL_FALSE)
+		{
+			return std::nullopt;
+		}
+	}
+
+	GLuint64 values[TARGET_COUNT] = {};
+	for (u32 i = 0; i < getTargetCount(); ++i)
+	{
+		glGetQueryObjectui64v(queries[i], GL_QUERY_RESULT, &values[i]);
+	}
+	return Result{values[0], values[1], values[2], values[3]};
+}
+
+// End of the namespace gltut
+}
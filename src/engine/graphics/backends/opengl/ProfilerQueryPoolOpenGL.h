@@ -0,0 +1,79 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <array>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/query/ProfilerQueryPool.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief OpenGL implementation of the profiler query pool.
+	Measures the time by GL_TIME_ELAPSED and, on OpenGL 4.6+ or with GL_ARB_pipeline_statistics_query,
+	counts the vertices, the primitives and the fragments by the pipeline statistics queries.
+	The released queries are kept for reuse and deleted with the pool
+*/
+class ProfilerQueryPoolOpenGL final : public ProfilerQueryPool, public NonCopyable
+{
+public:
+	/// Constructor
+	ProfilerQueryPoolOpenGL() noexcept;
+
+	/// Destructor
+	~ProfilerQueryPoolOpenGL() noexcept final;
+
+	/// Returns if the queries count the vertices, the primitives and the fragments
+	bool hasPipelineStatistics() const noexcept final
+	{
+		return mPipelineStatistics;
+	}
+
+	/// Acquires a query
+	u32 acquire() noexcept final;
+
+	/// Returns a query to the pool
+	void release(u32 query) noexcept final;
+
+	/// Starts measuring the commands into a query
+	void begin(u32 query) noexcept final;
+
+	/// Ends measuring the commands into a query
+	void end(u32 query) noexcept final;
+
+	/// Returns the result of a query if it is available
+	std::optional<Result> getResult(u32 query) noexcept final;
+
+private:
+	/// The number of the OpenGL queries of a profiler query: the time, the vertices, the primitives, the fragments
+	static constexpr u32 TARGET_COUNT = 4;
+
+	/// The OpenGL queries of a profiler query
+	using QuerySet = std::array<GLuint, TARGET_COUNT>;
+
+	/// Returns the number of the used OpenGL queries of a profiler query
+	u32 getTargetCount() const noexcept
+	{
+		return mPipelineStatistics ? TARGET_COUNT : 1;
+	}
+
+	/// If the pipeline statistics queries are supported
+	bool mPipelineStatistics = false;
+
+	/// All the created queries, a profiler query is the index of its set + 1
+	std::vector<QuerySet> mQueries;
+
+	/// The released queries
+	std::vector<u32> mFreeQueries;
+};
+
+// End of the namespace gltut
+}
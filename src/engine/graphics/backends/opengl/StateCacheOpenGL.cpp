@@ -0,0 +1,325 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "StateCacheOpenGL.h"
+
+#include "engine/core/Check.h"
+
+namespace gltut
+{
+// Global classes
+void StateCacheOpenGL::useProgram(GLuint program) noexcept
+{
+	if (mProgram == program)
+	{
+		++mCounters.filteredCalls;
+		return;
+	}
+
+	glUseProgram(program);
+	mProgram = program;
+	++mCounters.shaderBinds;
+}
+
+void StateCacheOpenGL::bindVertexArray(GLuint vertexArray) noexcept
+{
+	if (mVertexArray == vertexArray)
+	{
+		++mCounters.filteredCalls;
+		return;
+	}
+
+	glBindVertexArray(vertexArray);
+	mVertexArray = vertexArray;
+}
+
+void StateCacheOpenGL::bindTexture(u32 slot, GLenum target, GLuint texture) noexcept
+{
+	if (!GLTUT_ASSERT(slot < Texture::TEXTURE_SLOTS))
+	{
+		return;
+	}
+
+	GLuint& boundTexture = mTextures[slot][getTextureTargetIndex(target)];
+	if (boundTexture == texture)
+	{
+		++mCounters.filteredCalls;
+		return;
+	}
+
+	if (mActiveTextureSlot != slot)
+	{
+		glActiveTexture(GL_TEXTURE0 + slot);
+		mActiveTextureSlot = slot;
+	}
+	glBindTexture(target, texture);
+	boundTexture = texture;
+	++mCounters.textureBinds;
+}
+
+void StateCacheOpenGL::bindUniformBuffer(
+	u32 bindingPoint,
+	GLuint buffer,
+	u32 offset,
+	u32 size) noexcept
+{
+	if (bindingPoint < UNIFORM_BUFFER_BINDINGS)
+	{
+		UniformBufferRange& bound = mUniformBuffers[bindingPoint];
+		if (bound.buffer == buffer && bound.offset == offset && bound.size == size)
+		{
+			++mCounters.filteredCalls;
+			return;
+		}
+		bound = {buffer, offset, size};
+	}
+
+	if (size == 0)
+	{
+		glBindBufferBase(GL_UNIFORM_BUFFER, static_cast<GLuint>(bindingPoint), buffer);
+	}
+	else
+	{
+		glBindBufferRange(
+			GL_UNIFORM_BUFFER,
+			static_cast<GLuint>(bindingPoint),
+			buffer,
+			static_cast<GLintptr>(offset),
+			static_cast<GLsizeiptr>(size));
+	}
+	++mCounters.uniformBufferBinds;
+}
+
+bool StateCacheOpenGL::isEnabled(GLenum capability) const noexcept
+{
+	for (const Capability& tracked : mCapabilities)
+	{
+		if (tracked.capability == capability)
+		{
+			return tracked.enabled;
+		}
+	}
+	return false;
+}
+
+void StateCacheOpenGL::setEnabled(GLenum capability, bool enabled) noexcept
+{
+	for (Capability& tracked : mCapabilities)
+	{
+		if (tracked.capability == capability)
+		{
+			if (tracked.enabled == enabled)
+			{
+				++mCounters.filteredCalls;
+				return;
+			}
+			tracked.enabled = enabled;
+			break;
+		}
+	}
+
+	if (enabled)
+	{
+		glEnable(capability);
+	}
+	else
+	{
+		glDisable(capability);
+	}
+	++mCounters.stateChanges;
+}
+
+void StateCacheOpenGL::setCullFace(GLenum face) noexcept
+{
+	if (mCullFace == face)
+	{
+		++mCounters.filteredCalls;
+		return;
+	}
+
+	glCullFace(face);
+	mCullFace = face;
+	++mCounters.stateChanges;
+}
+
+void StateCacheOpenGL::setDepthFunc(GLenum function) noexcept
+{
+	if (mDepthFunc == function)
+	{
+		++mCounters.filteredCalls;
+		return;
+	}
+
+	glDepthFunc(function);
+	mDepthFunc = function;
+	++mCounters.stateChanges;
+}
+
+void StateCacheOpenGL::setDepthMask(bool enabled) noexcept
+{
+	if (mDepthMask == enabled)
+	{
+		++mCounters.filteredCalls;
+		return;
+	}
+
+	glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+	mDepthMask = enabled;
+	++mCounters.stateChanges;
+}
+
+void StateCacheOpenGL::setColorMask(bool enabled) noexcept
+{
+	if (mColorMask == enabled)
+	{
+		++mCounters.filteredCalls;
+		return;
+	}
+
+	const GLboolean mask = enabled ? GL_TRUE : GL_FALSE;
+	glColorMask(mask, mask, mask, mask);
+	mColorMask = enabled;
+	++mCounters.stateChanges;
+}
+
+void StateCacheOpenGL::setPolygonMode(GLenum mode) noexcept
+{
+	if (mPolygonMode == mode)
+	{
+		++mCounters.filteredCalls;
+		return;
+	}
+
+	glPolygonMode(GL_FRONT_AND_BACK, mode);
+	mPolygonMode = mode;
+	++mCounters.stateChanges;
+}
+
+void StateCacheOpenGL::setLineWidth(float width) noexcept
+{
+	if (mLineWidth == width)
+	{
+		++mCounters.filteredCalls;
+		return;
+	}
+
+	glLineWidth(width);
+	mLineWidth = width;
+	++mCounters.stateChanges;
+}
+
+void StateCacheOpenGL::setPointSize(float size) noexcept
+{
+	if (mPointSize == size)
+	{
+		++mCounters.filteredCalls;
+		return;
+	}
+
+	glPointSize(size);
+	mPointSize = size;
+	++mCounters.stateChanges;
+}
+
+void StateCacheOpenGL::setViewport(const Rectangle2u& viewport) noexcept
+{
+	const Point2u& min = viewport.getMin();
+	const Point2u& max = viewport.getMax();
+	if (mViewportKnown &&
+		mViewport.getMin().x == min.x &&
+		mViewport.getMin().y == min.y &&
+		mViewport.getMax().x == max.x &&
+		mViewport.getMax().y == max.y)
+	{
+		++mCounters.filteredCalls;
+		return;
+	}
+
+	glViewport(
+		static_cast<GLint>(min.x),
+		static_cast<GLint>(min.y),
+		static_cast<GLsizei>(max.x - min.x),
+		static_cast<GLsizei>(max.y - min.y));
+
+	glScissor(
+		static_cast<GLint>(min.x),
+		static_cast<GLint>(min.y),
+		static_cast<GLsizei>(max.x - min.x),
+		static_cast<GLsizei>(max.y - min.y));
+
+	mViewport = viewport;
+	mViewportKnown = true;
+}
+
+void StateCacheOpenGL::onProgramDeleted(GLuint program) noexcept
+{
+	// A deleted current program stays in use until another one is made current,
+	// while its name can be reused by a new program
+	if (mProgram == program)
+	{
+		glUseProgram(0);
+		mProgram = 0;
+	}
+}
+
+void StateCacheOpenGL::onVertexArrayDeleted(GLuint vertexArray) noexcept
+{
+	// Deleting a bound vertex array reverts the binding to 0
+	if (mVertexArray == vertexArray)
+	{
+		mVertexArray = 0;
+	}
+}
+
+void StateCacheOpenGL::onTextureDeleted(GLuint texture) noexcept
+{
+	// Deleting a bound texture reverts the bindings to 0
+	for (auto& slotTextures : mTextures)
+	{
+		for (GLuint& boundTexture : slotTextures)
+		{
+			if (boundTexture == texture)
+			{
+				boundTexture = 0;
+			}
+		}
+	}
+}
+
+void StateCacheOpenGL::onBufferDeleted(GLuint buffer) noexcept
+{
+	// Deleting a bound buffer reverts the bindings to 0
+	for (UniformBufferRange& bound : mUniformBuffers)
+	{
+		if (bound.buffer == buffer)
+		{
+			bound = {};
+		}
+	}
+}
+
+u32 StateCacheOpenGL::getTextureTargetIndex(GLenum target) noexcept
+{
+	switch (target)
+	{
+	case GL_TEXTURE_2D:
+		return 0;
+
+	case GL_TEXTURE_CUBE_MAP:
+		return 1;
+
+	case GL_TEXTURE_3D:
+		return 2;
+
+	case GL_TEXTURE_2D_ARRAY:
+		return 3;
+
+		GLTUT_UNEXPECTED_SWITCH_DEFAULT_CASE(target)
+	}
+	return 0;
+}
+
+// End of the namespace gltut
+}
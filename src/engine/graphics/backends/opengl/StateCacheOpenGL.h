@@ -0,0 +1,196 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <array>
+#include <glad/glad.h>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDeviceCallCounters.h"
+#include "engine/graphics/texture/Texture.h"
+#include "engine/math/Rectangle.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Shadow copy of the OpenGL state of a context.
+	Drops the calls which do not change the state and counts them.
+	All the OpenGL objects of a device change the tracked state only via this class.
+	Code which changes the tracked state directly (e.g. ImGui) must restore it.
+*/
+class StateCacheOpenGL : public NonCopyable
+{
+public:
+	/// The number of the cached uniform buffer binding points, the minimum of OpenGL 3.3
+	static constexpr u32 UNIFORM_BUFFER_BINDINGS = 36;
+
+	/// Constructor. Assumes the initial state of an OpenGL context
+	StateCacheOpenGL() noexcept = default;
+
+	/// Returns the call counters
+	GraphicsDeviceCallCounters& getCounters() noexcept
+	{
+		return mCounters;
+	}
+
+	/// Makes a program current
+	void useProgram(GLuint program) noexcept;
+
+	/// Binds a vertex array
+	void bindVertexArray(GLuint vertexArray) noexcept;
+
+	/// Binds a texture of a target (GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP, GL_TEXTURE_3D, GL_TEXTURE_2D_ARRAY) to a slot
+	void bindTexture(u32 slot, GLenum target, GLuint texture) noexcept;
+
+	/**
+		\brief Binds a uniform buffer or its range to an indexed binding point
+		\param size The range size, 0 to bind the whole buffer
+	*/
+	void bindUniformBuffer(
+		u32 bindingPoint,
+		GLuint buffer,
+		u32 offset = 0,
+		u32 size = 0) noexcept;
+
+	/// Enables or disables a capability (GL_BLEND, GL_CULL_FACE, GL_PROGRAM_POINT_SIZE)
+	void setEnabled(GLenum capability, bool enabled) noexcept;
+
+	/// Returns if a tracked capability is enabled, false for the untracked ones
+	bool isEnabled(GLenum capability) const noexcept;
+
+	/// Sets the culled faces
+	void setCullFace(GLenum face) noexcept;
+
+	/// Sets the depth function
+	void setDepthFunc(GLenum function) noexcept;
+
+	/// Enables or disables the depth writes
+	void setDepthMask(bool enabled) noexcept;
+
+	/// Returns if the depth writes are enabled
+	bool getDepthMask() const noexcept
+	{
+		return mDepthMask;
+	}
+
+	/// Enables or disables the writes of all color channels
+	void setColorMask(bool enabled) noexcept;
+
+	/// Returns if the color writes are enabled
+	bool getColorMask() const noexcept
+	{
+		return mColorMask;
+	}
+
+	/// Sets the polygon mode of the front and back faces
+	void setPolygonMode(GLenum mode) noexcept;
+
+	/// Sets the line width
+	void setLineWidth(float width) noexcept;
+
+	/// Sets the point size
+	void setPointSize(float size) noexcept;
+
+	/// Sets the viewport and the scissor box
+	void setViewport(const Rectangle2u& viewport) noexcept;
+
+	/// Forgets a deleted program
+	void onProgramDeleted(GLuint program) noexcept;
+
+	/// Forgets a deleted vertex array
+	void onVertexArrayDeleted(GLuint vertexArray) noexcept;
+
+	/// Forgets a deleted texture
+	void onTextureDeleted(GLuint texture) noexcept;
+
+	/// Forgets a deleted buffer
+	void onBufferDeleted(GLuint buffer) noexcept;
+
+private:
+	/// The number of the tracked texture targets
+	static constexpr u32 TEXTURE_TARGETS = 4;
+
+	/// Uniform buffer range bound to a binding point
+	struct UniformBufferRange
+	{
+		/// The buffer
+		GLuint buffer;
+
+		/// The range offset
+		u32 offset;
+
+		/// The range size, 0 for the whole buffer
+		u32 size;
+	};
+
+	/// Tracked capability
+	struct Capability
+	{
+		/// The OpenGL capability
+		GLenum capability;
+
+		/// If the capability is enabled
+		bool enabled;
+	};
+
+	/// Returns the index of a texture target
+	static u32 getTextureTargetIndex(GLenum target) noexcept;
+
+	/// The call counters
+	GraphicsDeviceCallCounters mCounters;
+
+	/// The current program
+	GLuint mProgram = 0;
+
+	/// The bound vertex array
+	GLuint mVertexArray = 0;
+
+	/// The active texture slot
+	u32 mActiveTextureSlot = 0;
+
+	/// The textures bound to the slots, per target
+	std::array<std::array<GLuint, TEXTURE_TARGETS>, Texture::TEXTURE_SLOTS> mTextures{};
+
+	/// The uniform buffer ranges bound to the binding points
+	std::array<UniformBufferRange, UNIFORM_BUFFER_BINDINGS> mUniformBuffers{};
+
+	/// The tracked capabilities
+	std::array<Capability, 3> mCapabilities = {{
+		{GL_BLEND, false},
+		{GL_CULL_FACE, false},
+		{GL_PROGRAM_POINT_SIZE, false}}};
+
+	/// The culled faces
+	GLenum mCullFace = GL_BACK;
+
+	/// The depth function
+	GLenum mDepthFunc = GL_LESS;
+
+	/// If the depth writes are enabled
+	bool mDepthMask = true;
+
+	/// If the color writes are enabled
+	bool mColorMask = true;
+
+	/// The polygon mode
+	GLenum mPolygonMode = GL_FILL;
+
+	/// The line width
+	float mLineWidth = 1.0f;
+
+	/// The point size
+	float mPointSize = 1.0f;
+
+	/// The viewport and the scissor box
+	Rectangle2u mViewport;
+
+	/// If the viewport is known. The initial viewport depends on the window
+	bool mViewportKnown = false;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,244 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "ContextOpenGL.h"
+
+#include "engine/core/Check.h"
+
+#ifndef _WIN32
+#include <cstring>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <glad/glad.h>
+#endif
+
+namespace gltut
+{
+
+#ifndef _WIN32
+
+namespace
+{
+// Local functions
+/// Checks if a space-separated extension list contains an extension
+bool hasExtension(const char* extensions, const char* extension) noexcept
+{
+	if (extensions == nullptr)
+	{
+		return false;
+	}
+
+	const size_t length = std::strlen(extension);
+	for (const char* start = extensions; (start = std::strstr(start, extension)) != nullptr; start += length)
+	{
+		const bool startsWord = start == extensions || start[-1] == ' ';
+		const bool endsWord = start[length] == ' ' || start[length] == '\0';
+		if (startsWord && endsWord)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+	\brief Returns the display for offscreen rendering.
+	Prefers the Mesa surfaceless platform, which does not need
+	a running display server, and falls back to the default display.
+*/
+EGLDisplay getOffscreenDisplay() noexcept
+{
+	const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+	if (hasExtension(clientExtensions, "EGL_MESA_platform_surfaceless") &&
+		hasExtension(clientExtensions, "EGL_EXT_platform_base"))
+	{
+		auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+			eglGetProcAddress("eglGetPlatformDisplayEXT"));
+
+		if (getPlatformDisplay != nullptr)
+		{
+			EGLDisplay display = getPlatformDisplay(
+				EGL_PLATFORM_SURFACELESS_MESA,
+				EGL_DEFAULT_DISPLAY,
+				nullptr);
+
+			if (display != EGL_NO_DISPLAY)
+			{
+				return display;
+			}
+		}
+	}
+	return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+/// Loads an OpenGL function via EGL
+void* getEglProcAddress(const char* name)
+{
+	return reinterpret_cast<void*>(eglGetProcAddress(name));
+}
+
+// Local classes
+/// EGL implementation of the offscreen OpenGL context
+class ContextEGL final : public ContextOpenGL
+{
+public:
+	/// Constructor
+	explicit ContextEGL(const Point2u& pbufferSize)
+	{
+		try
+		{
+			mDisplay = getOffscreenDisplay();
+			GLTUT_CHECK(mDisplay != EGL_NO_DISPLAY, "Failed to get an EGL display");
+
+			EGLint major = 0;
+			EGLint minor = 0;
+			GLTUT_CHECK(eglInitialize(mDisplay, &major, &minor), "Failed to initialize EGL");
+			mInitialized = true;
+
+			GLTUT_CHECK(eglBindAPI(EGL_OPENGL_API), "Failed to bind the OpenGL API");
+
+			const bool surfaceless = hasExtension(
+				eglQueryString(mDisplay, EGL_EXTENSIONS),
+				"EGL_KHR_surfaceless_context");
+
+			const EGLint configAttributes[] = {
+				EGL_SURFACE_TYPE, surfaceless ? 0 : EGL_PBUFFER_BIT,
+				EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+				EGL_RED_SIZE, 8,
+				EGL_GREEN_SIZE, 8,
+				EGL_BLUE_SIZE, 8,
+				EGL_ALPHA_SIZE, 8,
+				EGL_DEPTH_SIZE, 24,
+				EGL_STENCIL_SIZE, 8,
+				EGL_NONE};
+
+			EGLConfig config = nullptr;
+			EGLint configCount = 0;
+			GLTUT_CHECK(
+				eglChooseConfig(mDisplay, configAttributes, &config, 1, &configCount) &&
+					configCount > 0,
+				"Failed to choose an EGL config");
+
+			const EGLint contextAttributes[] = {
+				EGL_CONTEXT_MAJOR_VERSION, 3,
+				EGL_CONTEXT_MINOR_VERSION, 3,
+				EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+				EGL_NONE};
+
+			mContext = eglCreateContext(mDisplay, config, EGL_NO_CONTEXT, contextAttributes);
+			GLTUT_CHECK(mContext != EGL_NO_CONTEXT, "Failed to create the OpenGL 3.3 context");
+
+			if (!surfaceless)
+			{
+				const EGLint surfaceAttributes[] = {
+					EGL_WIDTH, static_cast<EGLint>(pbufferSize.x),
+					EGL_HEIGHT, static_cast<EGLint>(pbufferSize.y),
+					EGL_NONE};
+
+				mSurface = eglCreatePbufferSurface(mDisplay, config, surfaceAttributes);
+				GLTUT_CHECK(mSurface != EGL_NO_SURFACE, "Failed to create the pbuffer surface");
+			}
+
+			GLTUT_CHECK(
+				eglMakeCurrent(mDisplay, mSurface, mSurface, mContext),
+				"Failed to make the OpenGL context current");
+		}
+		catch (...)
+		{
+			cleanup();
+			throw;
+		}
+	}
+
+	/// Destructor
+	~ContextEGL() noexcept final
+	{
+		cleanup();
+	}
+
+	/// Loads the OpenGL function pointers
+	bool loadFunctions() noexcept final
+	{
+		return gladLoadGLLoader(getEglProcAddress) != 0;
+	}
+
+	/// Returns the address of an OpenGL function
+	void* getProcAddress(const char* name) noexcept final
+	{
+		return getEglProcAddress(name);
+	}
+
+	/// Sets the swap interval. Only pbuffer surfaces support it.
+	bool setSwapInterval(int interval) noexcept final
+	{
+		return mSurface != EGL_NO_SURFACE &&
+			   eglSwapInterval(mDisplay, interval) == EGL_TRUE;
+	}
+
+private:
+	/// Releases the EGL resources
+	void cleanup() noexcept
+	{
+		if (mDisplay == EGL_NO_DISPLAY)
+		{
+			return;
+		}
+
+		eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+		if (mSurface != EGL_NO_SURFACE)
+		{
+			eglDestroySurface(mDisplay, mSurface);
+			mSurface = EGL_NO_SURFACE;
+		}
+
+		if (mContext != EGL_NO_CONTEXT)
+		{
+			eglDestroyContext(mDisplay, mContext);
+			mContext = EGL_NO_CONTEXT;
+		}
+
+		if (mInitialized)
+		{
+			eglTerminate(mDisplay);
+			mInitialized = false;
+		}
+		mDisplay = EGL_NO_DISPLAY;
+	}
+
+	/// The EGL display
+	EGLDisplay mDisplay = EGL_NO_DISPLAY;
+
+	/// The display initialization flag
+	bool mInitialized = false;
+
+	/// The OpenGL context
+	EGLContext mContext = EGL_NO_CONTEXT;
+
+	/// The pbuffer surface, EGL_NO_SURFACE for surfaceless contexts
+	EGLSurface mSurface = EGL_NO_SURFACE;
+};
+
+// End of the anonymous namespace
+}
+
+// Global functions
+std::unique_ptr<ContextOpenGL> createContextEGL(const Point2u& pbufferSize)
+{
+	return std::make_unique<ContextEGL>(pbufferSize);
+}
+
+#else
+
+// Global functions
+std::unique_ptr<ContextOpenGL> createContextEGL(const Point2u&)
+{
+	GLTUT_CHECK(false, "EGL is not available on this platform");
+	return nullptr;
+}
+
+#endif
+
+// End of the namespace gltut
+}
@@ -0,0 +1,58 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <memory>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/window/Window.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Platform-specific OpenGL context.
+	The context is created and made current in the constructor
+	of the implementation and destroyed in its destructor.
+*/
+class ContextOpenGL : public NonCopyable
+{
+public:
+	/// Virtual destructor
+	virtual ~ContextOpenGL() noexcept = default;
+
+	/// Loads the OpenGL function pointers for the current context
+	virtual bool loadFunctions() noexcept = 0;
+
+	/// Returns the address of an OpenGL function, nullptr if the function is not available
+	virtual void* getProcAddress(const char* name) noexcept = 0;
+
+	/**
+		\brief Sets the swap interval
+		\return false if the context does not support changing the swap interval
+	*/
+	virtual bool setSwapInterval(int interval) noexcept = 0;
+};
+
+// Global functions
+/**
+	\brief Creates an OpenGL context for a native window using WGL
+	\throw std::runtime_error if the context cannot be created
+	or WGL is not available on the current platform
+*/
+std::unique_ptr<ContextOpenGL> createContextWGL(const Window& window);
+
+/**
+	\brief Creates an offscreen OpenGL 3.3 core context using EGL.
+	Uses a surfaceless context when EGL_KHR_surfaceless_context is supported,
+	otherwise a pbuffer surface of the specified size.
+	\throw std::runtime_error if the context cannot be created
+	or EGL is not available on the current platform
+*/
+std::unique_ptr<ContextOpenGL> createContextEGL(const Point2u& pbufferSize);
+
+// End of the namespace gltut
+}
@@ -0,0 +1,120 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "ContextOpenGL.h"
+
+#include "engine/core/Check.h"
+
+#ifdef _WIN32
+#undef APIENTRY
+#define NOMINMAX
+#include <Windows.h>
+#include <glad/glad.h>
+#endif
+
+namespace gltut
+{
+
+#ifdef _WIN32
+
+namespace
+{
+// Local types
+/// The function pointer type of wglSwapIntervalEXT
+typedef BOOL(WINAPI* PFNWGLSWAPINTERVALEXTPROC)(int interval);
+
+// Local classes
+/// WGL implementation of the OpenGL context
+class ContextWGL final : public ContextOpenGL
+{
+public:
+	/// Constructor
+	explicit ContextWGL(const Window& window) :
+		mDeviceContext(static_cast<HDC>(window.getDeviceContext()))
+	{
+		GLTUT_CHECK(mDeviceContext != nullptr, "Device context is null")
+
+		PIXELFORMATDESCRIPTOR pfd = {};
+		pfd.nSize = sizeof(PIXELFORMATDESCRIPTOR);
+		pfd.nVersion = 1;
+		pfd.dwFlags = PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER;
+		pfd.iPixelType = PFD_TYPE_RGBA;
+		pfd.cColorBits = 32;
+		pfd.cDepthBits = 24;
+		pfd.cStencilBits = 8;
+		int pixelFormat = ChoosePixelFormat(mDeviceContext, &pfd);
+
+		GLTUT_CHECK(SetPixelFormat(mDeviceContext, pixelFormat, &pfd), "Failed to set the pixel format");
+
+		mContext = wglCreateContext(mDeviceContext);
+		GLTUT_CHECK(mContext != nullptr, "Failed to create the OpenGL context");
+		if (!wglMakeCurrent(mDeviceContext, mContext))
+		{
+			wglDeleteContext(mContext);
+			GLTUT_CHECK(false, "Failed to make the OpenGL context current");
+		}
+	}
+
+	/// Destructor
+	~ContextWGL() noexcept final
+	{
+		wglMakeCurrent(nullptr, nullptr);
+		wglDeleteContext(mContext);
+	}
+
+	/// Loads the OpenGL function pointers
+	bool loadFunctions() noexcept final
+	{
+		return gladLoadGL() != 0;
+	}
+
+	/// Returns the address of an OpenGL extension function
+	void* getProcAddress(const char* name) noexcept final
+	{
+		return reinterpret_cast<void*>(wglGetProcAddress(name));
+	}
+
+	/// Sets the swap interval
+	bool setSwapInterval(int interval) noexcept final
+	{
+		PFNWGLSWAPINTERVALEXTPROC wglSwapIntervalEXT =
+			(PFNWGLSWAPINTERVALEXTPROC)wglGetProcAddress("wglSwapIntervalEXT");
+		if (wglSwapIntervalEXT == nullptr)
+		{
+			return false;
+		}
+		return wglSwapIntervalEXT(interval) != FALSE;
+	}
+
+private:
+	/// The window device context
+	HDC mDeviceContext = nullptr;
+
+	/// The OpenGL rendering context
+	HGLRC mContext = nullptr;
+};
+
+// End of the anonymous namespace
+}
+
+// Global functions
+std::unique_ptr<ContextOpenGL> createContextWGL(const Window& window)
+{
+	return std::make_unique<ContextWGL>(window);
+}
+
+#else
+
+// Global functions
+std::unique_ptr<ContextOpenGL> createContextWGL(const Window&)
+{
+	GLTUT_CHECK(false, "WGL is not available on this platform");
+	return nullptr;
+}
+
+#endif
+
+// End of the namespace gltut
+}
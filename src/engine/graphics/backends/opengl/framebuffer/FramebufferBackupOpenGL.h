@@ -7,6 +7,8 @@
 // Includes
 #include <glad/glad.h>
 
+#include "engine/graphics/framebuffer/Framebuffer.h"
+
 namespace gltut
 {
 // Global classes
@@ -31,5 +33,31 @@ private:
 	GLint mFramebuffer = 0;
 };
 
+// Global functions
+/// Reads the RGBA color content of an OpenGL framebuffer
+inline bool readFramebufferColorOpenGL(
+	const Framebuffer& framebuffer,
+	u8* data) noexcept
+{
+	if (!GLTUT_ASSERT(data != nullptr))
+	{
+		return false;
+	}
+
+	const Point2u size = framebuffer.getSize();
+	FramebufferBackupOpenGL backup;
+	framebuffer.bind();
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	glReadPixels(
+		0,
+		0,
+		static_cast<GLsizei>(size.x),
+		static_cast<GLsizei>(size.y),
+		GL_RGBA,
+		GL_UNSIGNED_BYTE,
+		data);
+	return true;
+}
+
 // End of the namespace gltut
 }
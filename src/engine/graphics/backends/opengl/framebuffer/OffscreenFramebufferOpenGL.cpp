@@ -0,0 +1,87 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "OffscreenFramebufferOpenGL.h"
+#include "FramebufferBackupOpenGL.h"
+#include "engine/core/Check.h"
+
+namespace gltut
+{
+// Global classes
+OffscreenFramebufferOpenGL::OffscreenFramebufferOpenGL(
+	StateCacheOpenGL& stateCache,
+	const Window& window) :
+
+	mStateCache(stateCache),
+	mSize(window.getSize())
+{
+	GLTUT_CHECK(mSize.x > 0 && mSize.y > 0, "Framebuffer size must be greater than 0");
+
+	try
+	{
+		glGenFramebuffers(1, &mId);
+		GLTUT_CHECK(mId != 0, "Failed to generate framebuffer");
+
+		glGenRenderbuffers(1, &mColorId);
+		glGenRenderbuffers(1, &mDepthStencilId);
+		GLTUT_CHECK(mColorId != 0 && mDepthStencilId != 0, "Failed to generate renderbuffers");
+
+		const GLsizei width = static_cast<GLsizei>(mSize.x);
+		const GLsizei height = static_cast<GLsizei>(mSize.y);
+
+		glBindRenderbuffer(GL_RENDERBUFFER, mColorId);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+
+		glBindRenderbuffer(GL_RENDERBUFFER, mDepthStencilId);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+		glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+		FramebufferBackupOpenGL backup;
+		bind();
+		glFramebufferRenderbuffer(
+			GL_FRAMEBUFFER,
+			GL_COLOR_ATTACHMENT0,
+			GL_RENDERBUFFER,
+			mColorId);
+
+		glFramebufferRenderbuffer(
+			GL_FRAMEBUFFER,
+			GL_DEPTH_STENCIL_ATTACHMENT,
+			GL_RENDERBUFFER,
+			mDepthStencilId);
+
+		GLTUT_CHECK(
+			glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE,
+			"Framebuffer is not valid");
+	}
+	catch (...)
+	{
+		cleanup();
+		throw;
+	}
+}
+
+OffscreenFramebufferOpenGL::~OffscreenFramebufferOpenGL() noexcept
+{
+	cleanup();
+}
+
+bool OffscreenFramebufferOpenGL::readColor(u8* data) const noexcept
+{
+	return readFramebufferColorOpenGL(*this, data);
+}
+
+void OffscreenFramebufferOpenGL::cleanup() noexcept
+{
+	glDeleteFramebuffers(1, &mId);
+	glDeleteRenderbuffers(1, &mColorId);
+	glDeleteRenderbuffers(1, &mDepthStencilId);
+	mId = 0;
+	mColorId = 0;
+	mDepthStencilId = 0;
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,74 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <glad/glad.h>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/framebuffer/Framebuffer.h"
+#include "engine/window/Window.h"
+
+#include "../StateCacheOpenGL.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Offscreen replacement of the window framebuffer.
+	Used as the default framebuffer by contexts without a window surface.
+	Has RGBA8 color and 24-bit depth / 8-bit stencil renderbuffers
+	of the window size.
+*/
+class OffscreenFramebufferOpenGL final : public Framebuffer, public NonCopyable
+{
+public:
+	/**
+		Constructor
+		\throw std::runtime_error If the framebuffer could not be created
+	*/
+	OffscreenFramebufferOpenGL(StateCacheOpenGL& stateCache, const Window& window);
+
+	/// Destructor. Deletes the framebuffer and the renderbuffers.
+	~OffscreenFramebufferOpenGL() noexcept final;
+
+	/// Returns the size of the framebuffer
+	Point2u getSize() const noexcept final
+	{
+		return mSize;
+	}
+
+	/// Binds the framebuffer as the current rendering target
+	void bind() const noexcept final
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, mId);
+		++mStateCache.getCounters().framebufferBinds;
+	}
+
+	/// Reads the color content of the framebuffer
+	bool readColor(u8* data) const noexcept final;
+
+private:
+	/// Deletes the OpenGL objects
+	void cleanup() noexcept;
+
+	/// The state cache of the device
+	StateCacheOpenGL& mStateCache;
+
+	/// The size of the framebuffer
+	Point2u mSize;
+
+	/// Framebuffer ID
+	GLuint mId = 0;
+
+	/// Color renderbuffer ID
+	GLuint mColorId = 0;
+
+	/// Depth-stencil renderbuffer ID
+	GLuint mDepthStencilId = 0;
+};
+
+// End of the namespace gltut
+}
@@ -11,8 +11,11 @@ namespace gltut
 {
 // Global classes
 TextureFramebufferOpenGL::TextureFramebufferOpenGL(
+	StateCacheOpenGL& stateCache,
 	Texture2* color,
-	Texture2* depth)
+	Texture2* depth) :
+
+	mStateCache(stateCache)
 {
 	glGenFramebuffers(1, &mId);
 	GLTUT_CHECK(mId != 0, "Failed to generate framebuffer");
@@ -84,6 +87,12 @@ void TextureFramebufferOpenGL::doSetDepth(Texture2* texture) noexcept
 void TextureFramebufferOpenGL::bind() const noexcept
 {
 	glBindFramebuffer(GL_FRAMEBUFFER, mId);
+	++mStateCache.getCounters().framebufferBinds;
+}
+
+bool TextureFramebufferOpenGL::readColor(u8* data) const noexcept
+{
+	return getColor() != nullptr && readFramebufferColorOpenGL(*this, data);
 }
 
 bool TextureFramebufferOpenGL::isValid() const noexcept
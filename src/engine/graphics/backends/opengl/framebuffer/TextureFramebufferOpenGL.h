@@ -8,6 +8,7 @@
 #include <glad/glad.h>
 
 #include "../../../framebuffer/TextureFramebufferBase.h"
+#include "../StateCacheOpenGL.h"
 
 namespace gltut
 {
@@ -21,6 +22,7 @@ public:
 		\throw std::runtime_error If the framebuffer could not be created
 	*/
 	TextureFramebufferOpenGL(
+		StateCacheOpenGL& stateCache,
 		Texture2* color,
 		Texture2* depth);
 
@@ -36,6 +38,9 @@ public:
 	/// Binds the framebuffer as the current rendering target
 	void bind() const noexcept final;
 
+	/// Reads the content of the color texture
+	bool readColor(u8* data) const noexcept final;
+
 private:
 	/// Sets the color texture without validation
 	void doSetColor(Texture2* texture) noexcept;
@@ -46,6 +51,9 @@ private:
 	/// Checks if the framebuffer is valid
 	bool isValid() const noexcept;
 
+	/// The state cache of the device
+	StateCacheOpenGL& mStateCache;
+
 	/// Framebuffer ID
 	GLuint mId = 0;
 };
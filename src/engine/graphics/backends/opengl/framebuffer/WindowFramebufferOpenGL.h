@@ -8,6 +8,8 @@
 #include <glad/glad.h>
 
 #include "../../../framebuffer/WindowFramebufferBase.h"
+#include "../StateCacheOpenGL.h"
+#include "FramebufferBackupOpenGL.h"
 
 namespace gltut
 {
@@ -17,13 +19,28 @@ class WindowFramebufferOpenGL final : public WindowFramebufferBase
 {
 public:
 	/// Constructor
-	using WindowFramebufferBase::WindowFramebufferBase;
+	WindowFramebufferOpenGL(StateCacheOpenGL& stateCache, const Window& window) :
+		WindowFramebufferBase(window),
+		mStateCache(stateCache)
+	{
+	}
 
 	/// Binds the framebuffer as the current rendering target
 	void bind() const noexcept final
 	{
 		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		++mStateCache.getCounters().framebufferBinds;
+	}
+
+	/// Reads the color content of the back buffer
+	bool readColor(u8* data) const noexcept final
+	{
+		return readFramebufferColorOpenGL(*this, data);
 	}
+
+private:
+	/// The state cache of the device
+	StateCacheOpenGL& mStateCache;
 };
 
 // End of the namespace gltut
@@ -5,6 +5,7 @@
 // Includes
 #include "ShaderOpenGL.h"
 
+#include <algorithm>
 #include <iostream>
 #include <glad/glad.h>
 #include "engine/core/Check.h"
@@ -47,9 +48,11 @@ unsigned createShader(
 }
 
 ShaderOpenGL::ShaderOpenGL(
+	StateCacheOpenGL& stateCache,
 	const std::string& vertexCode,
 	const std::string& fragmentCode) :
 
+	mStateCache(stateCache),
 	mProgram(0)
 {
 	unsigned vertexShader = createShader(
@@ -84,12 +87,13 @@ ShaderOpenGL::ShaderOpenGL(
 
 ShaderOpenGL::~ShaderOpenGL() noexcept
 {
+	mStateCache.onProgramDeleted(mProgram);
 	glDeleteProgram(mProgram);
 }
 
 void ShaderOpenGL::bind() const noexcept
 {
-	glUseProgram(mProgram);
+	mStateCache.useProgram(mProgram);
 }
 
 int32 ShaderOpenGL::getParameterLocation(const char* name) const noexcept
@@ -108,45 +112,100 @@ int32 ShaderOpenGL::getUniformBlockIndex(const char* name) const noexcept
 	return GLTUT_ASSERT(result != GL_INVALID_INDEX) ? static_cast<int32>(result) : -1;
 }
 
+u32 ShaderOpenGL::getUniformBlockSize(const char* blockName) const noexcept
+{
+	GLTUT_ASSERT_STRING(blockName);
+	const GLuint index = glGetUniformBlockIndex(mProgram, blockName);
+	if (index == GL_INVALID_INDEX)
+	{
+		return 0;
+	}
+
+	GLint size = 0;
+	glGetActiveUniformBlockiv(mProgram, index, GL_UNIFORM_BLOCK_DATA_SIZE, &size);
+	return static_cast<u32>(std::max(size, 0));
+}
+
+int32 ShaderOpenGL::getUniformBlockMemberOffset(
+	const char* blockName,
+	const char* memberName) const noexcept
+{
+	GLTUT_ASSERT_STRING(blockName);
+	GLTUT_ASSERT_STRING(memberName);
+	const GLuint blockIndex = glGetUniformBlockIndex(mProgram, blockName);
+	GLuint memberIndex = GL_INVALID_INDEX;
+	glGetUniformIndices(mProgram, 1, &memberName, &memberIndex);
+	if (blockIndex == GL_INVALID_INDEX || memberIndex == GL_INVALID_INDEX)
+	{
+		return -1;
+	}
+
+	// The uniforms of the default block and the other blocks have the same names
+	GLint memberBlock = -1;
+	glGetActiveUniformsiv(mProgram, 1, &memberIndex, GL_UNIFORM_BLOCK_INDEX, &memberBlock);
+	if (memberBlock != static_cast<GLint>(blockIndex))
+	{
+		return -1;
+	}
+
+	GLint offset = -1;
+	glGetActiveUniformsiv(mProgram, 1, &memberIndex, GL_UNIFORM_OFFSET, &offset);
+	return offset;
+}
+
 void ShaderOpenGL::setInt(int32 location, int value) noexcept
 {
 	bind();
+	++mStateCache.getCounters().uniformSets;
 	glUniform1i(location, value);
 }
 
 void ShaderOpenGL::setFloat(int32 location, float value) noexcept
 {
 	bind();
+	++mStateCache.getCounters().uniformSets;
 	glUniform1f(location, value);
 }
 
 void ShaderOpenGL::setVec2(int32 location, float x, float y) noexcept
 {
 	bind();
+	++mStateCache.getCounters().uniformSets;
 	glUniform2f(location, x, y);
 }
 
+void ShaderOpenGL::setUvec2(int32 location, u32 x, u32 y) noexcept
+{
+	bind();
+	++mStateCache.getCounters().uniformSets;
+	glUniform2ui(location, x, y);
+}
+
 void ShaderOpenGL::setVec3(int32 location, float x, float y, float z) noexcept
 {
 	bind();
+	++mStateCache.getCounters().uniformSets;
 	glUniform3f(location, x, y, z);
 }
 
 void ShaderOpenGL::setVec4(int32 location, float x, float y, float z, float w) noexcept
 {
 	bind();
+	++mStateCache.getCounters().uniformSets;
 	glUniform4f(location, x, y, z, w);
 }
 
 void ShaderOpenGL::setMat3(int32 location, const float* data) noexcept
 {
 	bind();
+	++mStateCache.getCounters().uniformSets;
 	glUniformMatrix3fv(location, 1, GL_FALSE, data);
 }
 
 void ShaderOpenGL::setMat4(int32 location, const float* data) noexcept
 {
 	bind();
+	++mStateCache.getCounters().uniformSets;
 	glUniformMatrix4fv(location, 1, GL_FALSE, data);
 }
 
@@ -155,6 +214,7 @@ void ShaderOpenGL::setUniformBlockBindingPoint(int32 location, u32 bindingPoint)
 	if GLTUT_ASSERT(location >= 0)
 	{
 		bind();
+		++mStateCache.getCounters().uniformSets;
 		glUniformBlockBinding(mProgram, static_cast<GLuint>(location), bindingPoint);
 	}
 }
@@ -7,6 +7,8 @@
 // Includes
 #include "engine/graphics/shader/Shader.h"
 
+#include "../StateCacheOpenGL.h"
+
 namespace gltut
 {
 // Global classes
@@ -20,6 +22,7 @@ public:
 		\throw std::runtime_error If the shader could not be created
 	*/
 	ShaderOpenGL(
+		StateCacheOpenGL& stateCache,
 		const std::string& vertexCode,
 		const std::string& fragmentCode);
 
@@ -41,6 +44,9 @@ public:
 	/// Sets a 2D vector to a shader variable
 	void setVec2(int32 location, float x, float y) noexcept final;
 
+	/// Sets a 2D unsigned integer vector to a shader variable
+	void setUvec2(int32 location, u32 x, u32 y) noexcept final;
+
 	/// Sets a 3D vector to a shader variable
 	void setVec3(int32 location, float x, float y, float z) noexcept final;
 
@@ -59,7 +65,18 @@ public:
 	/// Binds the shader
 	void bind() const noexcept final;
 
+	/// Returns the size of a uniform block in bytes, 0 if the program has no such block
+	u32 getUniformBlockSize(const char* blockName) const noexcept final;
+
+	/// Returns the offset of a member of a uniform block in bytes, -1 if the block has no such member
+	int32 getUniformBlockMemberOffset(
+		const char* blockName,
+		const char* memberName) const noexcept final;
+
 private:
+	/// The state cache of the device
+	StateCacheOpenGL& mStateCache;
+
 	/// Shader program
 	unsigned mProgram;
 };
@@ -14,7 +14,11 @@ namespace gltut
 
 static_assert(sizeof(GLuint) == sizeof(u32), "GLuint must be the same size as u32");
 
-ShaderUniformBufferOpenGL::ShaderUniformBufferOpenGL(u32 sizeInBytes) :
+ShaderUniformBufferOpenGL::ShaderUniformBufferOpenGL(
+	StateCacheOpenGL& stateCache,
+	u32 sizeInBytes) :
+
+	mStateCache(stateCache),
 	mSizeInBytes(sizeInBytes),
 	mId(0)
 {
@@ -31,6 +35,7 @@ ShaderUniformBufferOpenGL::~ShaderUniformBufferOpenGL() noexcept
 {
 	if (mId != 0)
 	{
+		mStateCache.onBufferDeleted(mId);
 		glDeleteBuffers(1, &mId);
 	}
 }
@@ -47,6 +52,11 @@ void ShaderUniformBufferOpenGL::setData(const void* data, u32 size, u32 offset)
 			static_cast<GLintptr>(offset),
 			static_cast<GLsizeiptr>(size),
 			data);
+
+		GraphicsDeviceCallCounters& counters = mStateCache.getCounters();
+		++counters.uniformBufferUpdates;
+		counters.uniformBufferBytes += size;
+		counters.uploadedBytes += size;
 	}
 }
 
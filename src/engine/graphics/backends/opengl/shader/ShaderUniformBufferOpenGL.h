@@ -7,6 +7,8 @@
 // Includes
 #include "engine/graphics/shader/ShaderUniformBuffer.h"
 
+#include "../StateCacheOpenGL.h"
+
 namespace gltut
 {
 
@@ -19,7 +21,9 @@ public:
 		Constructor
 		\throw std::runtime_error If the shader could not be created
 	*/
-	ShaderUniformBufferOpenGL(u32 sizeInBytes);
+	ShaderUniformBufferOpenGL(
+		StateCacheOpenGL& stateCache,
+		u32 sizeInBytes);
 
 	/// Virtual destructor
 	~ShaderUniformBufferOpenGL() noexcept final;
@@ -37,6 +41,9 @@ private:
 	/// Binds the uniform buffer
 	void bind() const noexcept;
 
+	/// The state cache of the device
+	StateCacheOpenGL& mStateCache;
+
 	/// Size of the uniform buffer in bytes
 	u32 mSizeInBytes;
 
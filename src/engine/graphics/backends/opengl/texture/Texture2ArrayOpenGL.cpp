@@ -0,0 +1,140 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "Texture2ArrayOpenGL.h"
+
+#include <algorithm>
+
+#include "../framebuffer/FramebufferBackupOpenGL.h"
+
+namespace gltut
+{
+// Global classes
+Texture2ArrayOpenGL::Texture2ArrayOpenGL(
+	StateCacheOpenGL& stateCache,
+	const Point2u& size,
+	TextureFormat format,
+	u32 layerCount,
+	const TextureParameters& parameters) :
+
+	TextureTOpenGL<Texture2Array, GL_TEXTURE_2D_ARRAY>(stateCache, parameters),
+	mSize(size),
+	mFormat(format),
+	mLayerCount(layerCount)
+{
+	GLTUT_CHECK(size.x > 0, "Texture width is 0");
+	GLTUT_CHECK(size.y > 0, "Texture height is 0");
+	GLTUT_CHECK(layerCount > 0, "Texture array layer count is 0");
+	// The layers are copied through a color attachment
+	GLTUT_CHECK(
+		format == TextureFormat::R ||
+			format == TextureFormat::RGB ||
+			format == TextureFormat::RGBA,
+		"Texture arrays support only the color formats");
+
+	glGenFramebuffers(1, &mFramebuffer);
+	GLTUT_CHECK(mFramebuffer != 0, "Failed to generate the texture array framebuffer");
+
+	TextureBackupOpenGL backup(GL_TEXTURE_2D_ARRAY);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, getId());
+	allocate(mLayerCount);
+	updateMipmap();
+}
+
+Texture2ArrayOpenGL::~Texture2ArrayOpenGL() noexcept
+{
+	glDeleteFramebuffers(1, &mFramebuffer);
+}
+
+void Texture2ArrayOpenGL::setLayerCount(u32 count) noexcept
+{
+	GLTUT_ASSERT(count > 0);
+	GLTUT_ASSERT(!hasBindlessHandle());
+	if (count == 0 || count == mLayerCount)
+	{
+		return;
+	}
+
+	const u32 keptLayers = std::min(count, mLayerCount);
+	FramebufferBackupOpenGL framebufferBackup;
+	TextureBackupOpenGL textureBackup(GL_TEXTURE_2D_ARRAY);
+	glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+
+	// Moves the kept layers to a temporary array, then reallocates the array and copies them back
+	GLuint temporary = 0;
+	glGenTextures(1, &temporary);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, temporary);
+	allocate(keptLayers);
+	for (u32 i = 0; i < keptLayers; ++i)
+	{
+		glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, getId(), 0, i);
+		copyLayer(i);
+	}
+
+	glBindTexture(GL_TEXTURE_2D_ARRAY, getId());
+	allocate(count);
+	for (u32 i = 0; i < keptLayers; ++i)
+	{
+		glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, temporary, 0, i);
+		copyLayer(i);
+	}
+
+	glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, 0, 0, 0);
+	glDeleteTextures(1, &temporary);
+	mLayerCount = count;
+	updateMipmap();
+}
+
+void Texture2ArrayOpenGL::setLayer(u32 layer, const Texture2& texture) noexcept
+{
+	if (!GLTUT_ASSERT(layer < mLayerCount) ||
+		!GLTUT_ASSERT(texture.getFormat() == mFormat) ||
+		!GLTUT_ASSERT(texture.getSize().x == mSize.x && texture.getSize().y == mSize.y))
+	{
+		return;
+	}
+
+	FramebufferBackupOpenGL framebufferBackup;
+	TextureBackupOpenGL textureBackup(GL_TEXTURE_2D_ARRAY);
+	glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture.getId(), 0);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, getId());
+	copyLayer(layer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+	updateMipmap();
+}
+
+void Texture2ArrayOpenGL::allocate(u32 layerCount) const noexcept
+{
+	glTexImage3D(
+		GL_TEXTURE_2D_ARRAY,
+		0,
+		toOpenGLFormat(mFormat),
+		mSize.x,
+		mSize.y,
+		layerCount,
+		0,
+		toOpenGLFormat(mFormat),
+		getChannelType(mFormat),
+		nullptr);
+}
+
+void Texture2ArrayOpenGL::copyLayer(u32 layer) const noexcept
+{
+	GLTUT_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+	glCopyTexSubImage3D(
+		GL_TEXTURE_2D_ARRAY,
+		0,
+		0,
+		0,
+		layer,
+		0,
+		0,
+		mSize.x,
+		mSize.y);
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,82 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "TextureTOpenGL.h"
+#include "engine/graphics/texture/Texture2Array.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief OpenGL 2D texture array.
+	The layers are copied from the textures by glCopyTexSubImage3D
+	through a framebuffer of the array, so the copies stay on the GPU
+*/
+class Texture2ArrayOpenGL final : public TextureTOpenGL<Texture2Array, GL_TEXTURE_2D_ARRAY>
+{
+public:
+	/**
+		Constructor
+		\throw std::runtime_error If the size or the layer count is 0
+		or the format is not a color one
+	*/
+	Texture2ArrayOpenGL(
+		StateCacheOpenGL& stateCache,
+		const Point2u& size,
+		TextureFormat format,
+		u32 layerCount,
+		const TextureParameters& parameters);
+
+	/// Destructor
+	~Texture2ArrayOpenGL() noexcept final;
+
+	/// Returns the format of the layers
+	TextureFormat getFormat() const noexcept final
+	{
+		return mFormat;
+	}
+
+	/// Returns the size of the layers
+	const Point2u& getSize() const noexcept final
+	{
+		return mSize;
+	}
+
+	/// Returns the number of the layers
+	u32 getLayerCount() const noexcept final
+	{
+		return mLayerCount;
+	}
+
+	/// Sets the number of the layers, keeping the contents of the remaining layers
+	void setLayerCount(u32 count) noexcept final;
+
+	/// Copies a 2D texture to a layer and updates the mipmaps
+	void setLayer(u32 layer, const Texture2& texture) noexcept final;
+
+private:
+	/// Specifies the storage of a bound array texture
+	void allocate(u32 layerCount) const noexcept;
+
+	/// Copies the color attachment of the bound framebuffer into a layer of the bound array texture
+	void copyLayer(u32 layer) const noexcept;
+
+	/// The size of the layers
+	Point2u mSize;
+
+	/// The format of the layers
+	TextureFormat mFormat;
+
+	/// The number of the layers
+	u32 mLayerCount;
+
+	/// The framebuffer reading the copied textures
+	GLuint mFramebuffer = 0;
+};
+
+// End of the namespace gltut
+}
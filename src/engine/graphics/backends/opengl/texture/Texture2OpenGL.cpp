@@ -10,10 +10,11 @@ namespace gltut
 
 // Global classes
 Texture2OpenGL::Texture2OpenGL(
+	StateCacheOpenGL& stateCache,
 	const TextureData& data,
 	const TextureParameters& parameters) :
 
-	TextureTOpenGL<Texture2, GL_TEXTURE_2D>(parameters),
+	TextureTOpenGL<Texture2, GL_TEXTURE_2D>(stateCache, parameters),
 	mSize(data.size),
 	mFormat(data.format)
 {
@@ -26,6 +27,7 @@ void Texture2OpenGL::setSize(const Point2u& size) noexcept
 {
 	GLTUT_ASSERT(size.x > 0);
 	GLTUT_ASSERT(size.y > 0);
+	GLTUT_ASSERT(!hasBindlessHandle());
 
 	if (size.x == 0 ||
 		size.y == 0 ||
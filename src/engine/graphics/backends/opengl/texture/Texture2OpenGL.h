@@ -24,6 +24,7 @@ public:
 		\throw std::runtime_error If the shader could not be created
 	*/
 	Texture2OpenGL(
+		StateCacheOpenGL& stateCache,
 		const TextureData& data,
 		const TextureParameters& parameters);
 
@@ -22,8 +22,9 @@ public:
 		GLTUT_ASSERT(
 			textureType == GL_TEXTURE_2D ||
 			textureType == GL_TEXTURE_CUBE_MAP ||
-			textureType == GL_TEXTURE_3D);
-		glGetIntegerv(mTextureType, &mTexture);
+			textureType == GL_TEXTURE_3D ||
+			textureType == GL_TEXTURE_2D_ARRAY);
+		glGetIntegerv(getBindingType(mTextureType), &mTexture);
 	}
 
 	/// Destructor, restores the previously bound texture
@@ -33,6 +34,22 @@ public:
 	}
 
 private:
+	/// Returns the binding query enum for the texture type
+	static GLenum getBindingType(GLenum textureType) noexcept
+	{
+		switch (textureType)
+		{
+		case GL_TEXTURE_CUBE_MAP:
+			return GL_TEXTURE_BINDING_CUBE_MAP;
+		case GL_TEXTURE_3D:
+			return GL_TEXTURE_BINDING_3D;
+		case GL_TEXTURE_2D_ARRAY:
+			return GL_TEXTURE_BINDING_2D_ARRAY;
+		default:
+			return GL_TEXTURE_BINDING_2D;
+		}
+	}
+
 	/// The texture type
 	GLenum mTextureType = 0;
 
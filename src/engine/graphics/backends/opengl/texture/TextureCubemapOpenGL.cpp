@@ -11,6 +11,7 @@ namespace gltut
 
 // Global classes
 TextureCubemapOpenGL::TextureCubemapOpenGL(
+	StateCacheOpenGL& stateCache,
 	const TextureData& minusXData,
 	const TextureData& plusXData,
 	const TextureData& minusYData,
@@ -19,7 +20,7 @@ TextureCubemapOpenGL::TextureCubemapOpenGL(
 	const TextureData& plusZData,
 	const TextureParameters& parameters) :
 
-	TextureTOpenGL<TextureCubemap, GL_TEXTURE_CUBE_MAP>(parameters)
+	TextureTOpenGL<TextureCubemap, GL_TEXTURE_CUBE_MAP>(stateCache, parameters)
 {
 	TextureBackupOpenGL backup(GL_TEXTURE_CUBE_MAP);
 
@@ -21,6 +21,7 @@ public:
 		\throw std::runtime_error If the texture could not be created
 	*/
 	TextureCubemapOpenGL(
+		StateCacheOpenGL& stateCache,
 		const TextureData& minusXData,
 		const TextureData& plusXData,
 		const TextureData& minusYData,
@@ -5,6 +5,8 @@
 #pragma once
 
 // Includes
+#include "../ExtensionsOpenGL.h"
+#include "../StateCacheOpenGL.h"
 #include "TextureBackupOpenGL.h"
 #include "engine/core/Check.h"
 #include "engine/core/NonCopyable.h"
@@ -35,10 +37,11 @@ template <typename TextureInterfaceType, GLenum glTextureType>
 class TextureTOpenGL : public TextureInterfaceType, public NonCopyable
 {
 	static_assert(
-		glTextureType == glTextureType ||
+		glTextureType == GL_TEXTURE_2D ||
 			glTextureType == GL_TEXTURE_CUBE_MAP ||
-			glTextureType == GL_TEXTURE_3D,
-		"glTextureType must be glTextureType, GL_TEXTURE_CUBE_MAP or GL_TEXTURE_3D");
+			glTextureType == GL_TEXTURE_3D ||
+			glTextureType == GL_TEXTURE_2D_ARRAY,
+		"glTextureType must be GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP, GL_TEXTURE_3D or GL_TEXTURE_2D_ARRAY");
 
 public:
 	/**
@@ -46,7 +49,11 @@ public:
 		\note IMPORTANT: don't forget to call updateMipmap()
 		in the derived class after creation of the texture data
 	*/
-	TextureTOpenGL(const TextureParameters& parameters) :
+	TextureTOpenGL(
+		StateCacheOpenGL& stateCache,
+		const TextureParameters& parameters) :
+
+		mStateCache(stateCache),
 		mParameters(parameters),
 		mId(0)
 	{
@@ -64,6 +71,11 @@ public:
 
 	~TextureTOpenGL() noexcept
 	{
+		if (mBindlessHandle != 0)
+		{
+			releaseBindlessTextureHandleOpenGL(mBindlessHandle);
+		}
+		mStateCache.onTextureDeleted(mId);
 		glDeleteTextures(1, &mId);
 	}
 
@@ -80,6 +92,11 @@ public:
 
 	void setParameters(const TextureParameters& parameters) noexcept final
 	{
+		// A texture with a bindless handle is immutable
+		if (!GLTUT_ASSERT(mBindlessHandle == 0))
+		{
+			return;
+		}
 		setMinFilter(parameters.minFilter, true);
 		setMagFilter(parameters.magFilter, true);
 		setWrap(parameters.wrapMode);
@@ -121,12 +138,26 @@ public:
 
 	void bind(u32 slot) const noexcept final
 	{
-		GLTUT_ASSERT(slot < Texture::TEXTURE_SLOTS);
-		glActiveTexture(GL_TEXTURE0 + slot);
-		glBindTexture(glTextureType, mId);
+		mStateCache.bindTexture(slot, glTextureType, mId);
+	}
+
+	/// Returns the bindless handle, making the texture resident on the first call
+	u64 getBindlessHandle() const noexcept final
+	{
+		if (mBindlessHandle == 0)
+		{
+			mBindlessHandle = getBindlessTextureHandleOpenGL(mId);
+		}
+		return mBindlessHandle;
 	}
 
 protected:
+	/// Returns if the bindless handle is created, the texture is immutable then
+	bool hasBindlessHandle() const noexcept
+	{
+		return mBindlessHandle != 0;
+	}
+
 	void updateMipmap()
 	{
 		if (mParameters.minFilter == TextureFilterMode::LINEAR_MIPMAP ||
@@ -165,11 +196,17 @@ private:
 		}
 	}
 
+	/// The state cache of the device
+	StateCacheOpenGL& mStateCache;
+
 	/// Texture parameters
 	TextureParameters mParameters;
 
 	/// Texture ID
 	GLuint mId;
+
+	/// The resident bindless handle, 0 until it is requested
+	mutable u64 mBindlessHandle = 0;
 };
 
 // End of the namespace gltut
@@ -0,0 +1,254 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "DeviceSoftware.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "GeometrySoftware.h"
+#include "ShaderSoftware.h"
+#include "ShaderUniformBufferSoftware.h"
+#include "TextureSoftware.h"
+
+namespace gltut
+{
+// Global classes
+DeviceSoftware::DeviceSoftware(Window& window) :
+
+	GraphicsDeviceBase(window),
+	mTaskPool(std::max(1u, std::thread::hardware_concurrency())),
+	mRasterizer(mTaskPool),
+	mDefaultFramebuffer(std::make_unique<WindowFramebufferSoftware>(*this, window))
+{
+	setRenderTarget(mDefaultFramebuffer.get());
+	setViewport({{0, 0}, window.getSize()});
+}
+
+DeviceSoftware::~DeviceSoftware() noexcept
+{
+	flush();
+	removeAllObjects();
+	mDefaultFramebuffer.reset();
+}
+
+void DeviceSoftware::clear(
+	const Color* color,
+	bool depth) noexcept
+{
+	mRasterizer.clear(color, depth, mDrawState.viewport);
+}
+
+std::unique_ptr<Geometry> DeviceSoftware::createBackendGeometry(
+	VertexFormat vertexFormat,
+	u32 vertexCount,
+	const float* vertices,
+	u32 indexCount,
+	const u32* indices)
+{
+	return std::make_unique<GeometrySoftware>(
+		*this,
+		vertexFormat,
+		vertexCount,
+		vertices,
+		indexCount,
+		indices);
+}
+
+std::unique_ptr<Shader> DeviceSoftware::createBackendShader(
+	const char* vertexShader,
+	const char* fragmentShader)
+{
+	return std::make_unique<ShaderSoftware>(*this, vertexShader, fragmentShader);
+}
+
+std::unique_ptr<ShaderUniformBuffer> DeviceSoftware::createBackendShaderUniformBuffer(
+	u32 sizeInBytes)
+{
+	return std::make_unique<ShaderUniformBufferSoftware>(getNextId(), sizeInBytes);
+}
+
+std::unique_ptr<Texture2> DeviceSoftware::createBackendTexture2(
+	const TextureData& data,
+	const TextureParameters& parameters)
+{
+	return std::make_unique<Texture2Software>(
+		*this,
+		getNextId(),
+		data,
+		parameters);
+}
+
+std::unique_ptr<Texture2Array> DeviceSoftware::createBackendTexture2Array(
+	const Point2u&,
+	TextureFormat,
+	u32,
+	const TextureParameters&)
+{
+	GLTUT_CHECK(false, "The software device does not support the texture arrays");
+	return nullptr;
+}
+
+std::unique_ptr<TextureCubemap> DeviceSoftware::createBackendTextureCubemap(
+	const TextureData& minusXData,
+	const TextureData& plusXData,
+	const TextureData& minusYData,
+	const TextureData& plusYData,
+	const TextureData& minusZData,
+	const TextureData& plusZData,
+	const TextureParameters& parameters)
+{
+	return std::make_unique<TextureCubemapSoftware>(
+		*this,
+		getNextId(),
+		minusXData,
+		plusXData,
+		minusYData,
+		plusYData,
+		minusZData,
+		plusZData,
+		parameters);
+}
+
+std::unique_ptr<TextureFramebuffer> DeviceSoftware::createBackendTextureFramebuffer(
+	Texture2* color,
+	Texture2* depth)
+{
+	return std::make_unique<TextureFramebufferSoftware>(*this, color, depth);
+}
+
+void DeviceSoftware::bindTexture(const Texture* texture, u32 slot) noexcept
+{
+	if (texture == nullptr)
+	{
+		setTexture(nullptr, slot);
+	}
+	else
+	{
+		texture->bind(slot);
+	}
+}
+
+void DeviceSoftware::bindShaderUniformBuffer(
+	const ShaderUniformBuffer* buffer,
+	u32 bindingPoint) noexcept
+{
+	if (GLTUT_ASSERT(bindingPoint < SOFTWARE_UNIFORM_BUFFER_BINDINGS))
+	{
+		// All the uniform buffers of the device are software ones
+		mShaderState.uniformBuffers[bindingPoint] =
+			static_cast<const ShaderUniformBufferSoftware*>(buffer);
+		mShaderState.uniformBufferOffsets[bindingPoint] = 0;
+	}
+}
+
+void DeviceSoftware::bindShaderUniformBufferRange(
+	const ShaderUniformBuffer* buffer,
+	u32 bindingPoint,
+	u32 offset,
+	u32) noexcept
+{
+	bindShaderUniformBuffer(buffer, bindingPoint);
+	if (bindingPoint < SOFTWARE_UNIFORM_BUFFER_BINDINGS)
+	{
+		mShaderState.uniformBufferOffsets[bindingPoint] = offset;
+	}
+}
+
+void DeviceSoftware::draw(
+	const GeometrySoftware& geometry,
+	const GeometryInstance* instance) noexcept
+{
+	if (mShader == nullptr)
+	{
+		return;
+	}
+
+	std::unique_ptr<ShaderInvocationSoftware> invocation;
+	mShaderState.instance = instance;
+	GLTUT_CATCH_ALL_BEGIN
+	invocation = mShader->getProgram().createInvocation(*mShader, mShaderState);
+	GLTUT_CATCH_ALL_END("Cannot create a shader invocation")
+	mShaderState.instance = nullptr;
+
+	if (invocation != nullptr)
+	{
+		mRasterizer.draw(geometry, std::move(invocation), mDrawState);
+	}
+}
+
+void DeviceSoftware::setTexture(const Texture2Software* texture, u32 slot) noexcept
+{
+	if (slot < Texture::TEXTURE_SLOTS)
+	{
+		mShaderState.textures[slot] = texture;
+	}
+}
+
+void DeviceSoftware::setRenderTarget(const FramebufferSoftware* framebuffer) noexcept
+{
+	// The buffers may be reallocated by getRenderTarget, so the pending rendering goes first
+	flush();
+	mFramebuffer = framebuffer;
+	mRasterizer.setRenderTarget(
+		framebuffer != nullptr ? framebuffer->getRenderTarget() : RenderTargetSoftware());
+}
+
+void DeviceSoftware::onShaderRemoved(const ShaderSoftware& shader) noexcept
+{
+	if (mShader == &shader)
+	{
+		mShader = nullptr;
+	}
+}
+
+void DeviceSoftware::onTextureResized(const Texture2Software&) noexcept
+{
+	// The texture may be attached to the current framebuffer
+	setRenderTarget(mFramebuffer);
+}
+
+void DeviceSoftware::onTextureRemoved(const Texture2Software& texture) noexcept
+{
+	flush();
+	for (auto& slotTexture : mShaderState.textures)
+	{
+		if (slotTexture == &texture)
+		{
+			slotTexture = nullptr;
+		}
+	}
+
+	RenderTargetSoftware target = mRasterizer.getRenderTarget();
+	if ((target.color != nullptr && target.color == texture.getColorData()) ||
+		(target.depth != nullptr && target.depth == texture.getDepthData()))
+	{
+		mRasterizer.setRenderTarget(RenderTargetSoftware());
+	}
+}
+
+void DeviceSoftware::onFramebufferRemoved(const FramebufferSoftware& framebuffer) noexcept
+{
+	flush();
+	if (mFramebuffer == &framebuffer)
+	{
+		setRenderTarget(mDefaultFramebuffer.get());
+	}
+}
+
+void DeviceSoftware::setFramebuffer(Framebuffer* frameBuffer) noexcept
+{
+	if (frameBuffer == nullptr)
+	{
+		mDefaultFramebuffer->bind();
+	}
+	else
+	{
+		frameBuffer->bind();
+	}
+}
+
+// End of the namespace gltut
+}
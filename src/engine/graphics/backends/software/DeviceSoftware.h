@@ -0,0 +1,275 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <memory>
+
+#include "../../GraphicsDeviceBase.h"
+
+#include "FramebufferSoftware.h"
+#include "RasterizerSoftware.h"
+#include "../../../core/TaskPool.h"
+
+namespace gltut
+{
+// Forward declarations
+class GeometrySoftware;
+class ShaderSoftware;
+class Texture2Software;
+
+// Global classes
+/**
+	\brief Graphics device which renders on the CPU.
+	The triangles are binned into the screen tiles and the tiles are shaded
+	on all the CPU cores. The shaders are C++ programs of the built-in
+	shader models, see createShaderProgramSoftware.
+	The rendering is deferred until the render target is changed, cleared or read.
+*/
+class DeviceSoftware final : public GraphicsDeviceBase
+{
+public:
+	/// Constructor
+	explicit DeviceSoftware(Window& window);
+
+	/// Destructor. Releases the device objects.
+	~DeviceSoftware() noexcept final;
+
+	/// Clears the current render target with a specific color
+	void clear(
+		const Color* color,
+		bool depth) noexcept final;
+
+	/// Does nothing, there is no presentation
+	void enableVSync(bool) noexcept final
+	{
+	}
+
+	/// Returns the default framebuffer of the window size
+	Framebuffer* getDefaultFramebuffer() const noexcept final
+	{
+		return mDefaultFramebuffer.get();
+	}
+
+	/// Creates a geometry
+	std::unique_ptr<Geometry> createBackendGeometry(
+		VertexFormat vertexFormat,
+		u32 vertexCount,
+		const float* vertices,
+		u32 indexCount,
+		const u32* indices) final;
+
+	/// Creates a shader
+	std::unique_ptr<Shader> createBackendShader(
+		const char* vertexShader,
+		const char* fragmentShader) final;
+
+	/// Creates a shader uniform buffer
+	std::unique_ptr<ShaderUniformBuffer> createBackendShaderUniformBuffer(
+		u32 sizeInBytes) final;
+
+	/// Creates a texture
+	std::unique_ptr<Texture2> createBackendTexture2(
+		const TextureData& data,
+		const TextureParameters& parameters) final;
+
+	/// Creates a 2D texture array
+	std::unique_ptr<Texture2Array> createBackendTexture2Array(
+		const Point2u& size,
+		TextureFormat format,
+		u32 layerCount,
+		const TextureParameters& parameters) final;
+
+	/// Creates a texture cubemap
+	std::unique_ptr<TextureCubemap> createBackendTextureCubemap(
+		const TextureData& minusXData,
+		const TextureData& plusXData,
+		const TextureData& minusYData,
+		const TextureData& plusYData,
+		const TextureData& minusZData,
+		const TextureData& plusZData,
+		const TextureParameters& parameters) final;
+
+	/// Creates a framebuffer
+	std::unique_ptr<TextureFramebuffer> createBackendTextureFramebuffer(
+		Texture2* color,
+		Texture2* depth) final;
+
+	/// Binds a texture to a slot
+	void bindTexture(const Texture* texture, u32 slot) noexcept final;
+
+	/// Returns false, the software shaders sample only the 2D textures
+	bool isTextureArraySupported() const noexcept final
+	{
+		return false;
+	}
+
+	/// Returns false, the software device has no bindless handles
+	bool isBindlessTextureSupported() const noexcept final
+	{
+		return false;
+	}
+
+	/// Binds a shader uniform buffer to a binding point
+	void bindShaderUniformBuffer(
+		const ShaderUniformBuffer* buffer,
+		u32 bindingPoint) noexcept final;
+
+	/// Binds a range of a shader uniform buffer to a binding point
+	void bindShaderUniformBufferRange(
+		const ShaderUniformBuffer* buffer,
+		u32 bindingPoint,
+		u32 offset,
+		u32 size) noexcept final;
+
+	/// Returns the alignment of the uniform buffer range offsets, the std140 vec4 alignment
+	u32 getShaderUniformBufferAlignment() const noexcept final
+	{
+		return 16;
+	}
+
+	/// Returns the maximum size of a uniform block, the common limit of the hardware devices
+	u32 getMaxShaderUniformBlockSize() const noexcept final
+	{
+		return 65536;
+	}
+
+	/// Set face cull mode
+	void setFaceCulling(FaceCullingMode mode) noexcept final
+	{
+		mDrawState.faceCulling = mode;
+	}
+
+	/// Enable or disables blending
+	void setBlending(bool enabled) noexcept final
+	{
+		mDrawState.blending = enabled;
+	}
+
+	/// Sets the depth function
+	void setDepthTest(DepthTestMode mode) noexcept final
+	{
+		mDrawState.depthTest = mode;
+	}
+
+	/// Enables or disables the depth writes
+	void setDepthWrite(bool enabled) noexcept final
+	{
+		mDrawState.depthWrite = enabled;
+	}
+
+	/// Enables or disables the color writes
+	void setColorWrite(bool enabled) noexcept final
+	{
+		mDrawState.colorWrite = enabled;
+	}
+
+	/// Sets the polygon fill mode. The polygons are always rendered solid.
+	void setPolygonFill(
+		PolygonFillMode,
+		float = 1.0f,
+		bool = false) noexcept final
+	{
+	}
+
+	/// Returns nullptr, the device does not support the occlusion queries
+	OcclusionQueryPool* getOcclusionQueries() noexcept final
+	{
+		return nullptr;
+	}
+
+	/// Returns nullptr, the device does not support the timer queries
+	ProfilerQueryPool* getProfilerQueries() noexcept final
+	{
+		return nullptr;
+	}
+
+	/// Returns nullptr, the device does not count the calls
+	GraphicsDeviceCallCounters* getCallCounters() noexcept final
+	{
+		return nullptr;
+	}
+
+	/**
+		\brief Draws a geometry with the current shader
+		\param instance The instance attributes, nullptr for a non-instanced draw
+	*/
+	void draw(
+		const GeometrySoftware& geometry,
+		const GeometryInstance* instance = nullptr) noexcept;
+
+	/// Finishes the pending rendering
+	void flush() noexcept
+	{
+		mRasterizer.flush();
+	}
+
+	/// Sets the current shader
+	void setShader(const ShaderSoftware* shader) noexcept
+	{
+		mShader = shader;
+	}
+
+	/// Sets a 2D texture to a slot, nullptr unbinds the slot
+	void setTexture(const Texture2Software* texture, u32 slot) noexcept;
+
+	/// Sets the current render target
+	void setRenderTarget(const FramebufferSoftware* framebuffer) noexcept;
+
+	/// Called when a shader is removed
+	void onShaderRemoved(const ShaderSoftware& shader) noexcept;
+
+	/// Called when a texture is resized
+	void onTextureResized(const Texture2Software& texture) noexcept;
+
+	/// Called when a texture is removed
+	void onTextureRemoved(const Texture2Software& texture) noexcept;
+
+	/// Called when a framebuffer is removed
+	void onFramebufferRemoved(const FramebufferSoftware& framebuffer) noexcept;
+
+private:
+	/// Sets a framebuffer for rendering
+	void setFramebuffer(Framebuffer* frameBuffer) noexcept final;
+
+	/// Sets the viewport for rendering
+	void setViewport(const Rectangle2u& viewport) noexcept final
+	{
+		mDrawState.viewport = viewport;
+	}
+
+	/// Returns a new unique object id
+	u32 getNextId() noexcept
+	{
+		return ++mLastId;
+	}
+
+	/// The worker threads
+	TaskPool mTaskPool;
+
+	/// The rasterizer
+	RasterizerSoftware mRasterizer;
+
+	/// The default framebuffer
+	std::unique_ptr<WindowFramebufferSoftware> mDefaultFramebuffer;
+
+	/// The current framebuffer
+	const FramebufferSoftware* mFramebuffer = nullptr;
+
+	/// The current shader
+	const ShaderSoftware* mShader = nullptr;
+
+	/// The bound textures and uniform buffers
+	ShaderStateSoftware mShaderState;
+
+	/// The fixed-function state
+	DrawStateSoftware mDrawState;
+
+	/// The last assigned object id
+	u32 mLastId = 0;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,123 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "FramebufferSoftware.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "DeviceSoftware.h"
+#include "TextureSoftware.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local functions
+/// Returns if two sizes are equal
+bool isSameSize(const Point2u& first, const Point2u& second) noexcept
+{
+	return first.x == second.x && first.y == second.y;
+}
+
+/// Copies the color buffer of a render target
+bool readRenderTargetColor(const RenderTargetSoftware& target, u8* data) noexcept
+{
+	if (!GLTUT_ASSERT(data != nullptr) || target.color == nullptr)
+	{
+		return false;
+	}
+
+	std::memcpy(data, target.color, static_cast<size_t>(target.size.x) * target.size.y * 4);
+	return true;
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+void WindowFramebufferSoftware::bind() const noexcept
+{
+	mDevice.setRenderTarget(this);
+}
+
+bool WindowFramebufferSoftware::readColor(u8* data) const noexcept
+{
+	mDevice.flush();
+	return readRenderTargetColor(getRenderTarget(), data);
+}
+
+RenderTargetSoftware WindowFramebufferSoftware::getRenderTarget() const noexcept
+{
+	const Point2u size = mWindow.getSize();
+	if (!isSameSize(size, mSize))
+	{
+		GLTUT_CATCH_ALL_BEGIN
+		const size_t pixelCount = static_cast<size_t>(size.x) * size.y;
+		mColor.assign(pixelCount * 4, 0);
+		mDepth.assign(pixelCount, 1.0f);
+		mSize = size;
+		GLTUT_CATCH_ALL_END("Cannot resize the window framebuffer")
+	}
+
+	if (!isSameSize(size, mSize))
+	{
+		return {};
+	}
+	return {mSize, mColor.data(), mDepth.data()};
+}
+
+TextureFramebufferSoftware::TextureFramebufferSoftware(
+	DeviceSoftware& device,
+	Texture2* color,
+	Texture2* depth) :
+
+	mDevice(device)
+{
+	setColor(color);
+	setDepth(depth);
+	GLTUT_CHECK(
+		getColor() != nullptr || getDepth() != nullptr,
+		"Framebuffer is not valid");
+}
+
+TextureFramebufferSoftware::~TextureFramebufferSoftware() noexcept
+{
+	mDevice.onFramebufferRemoved(*this);
+}
+
+void TextureFramebufferSoftware::bind() const noexcept
+{
+	mDevice.setRenderTarget(this);
+}
+
+bool TextureFramebufferSoftware::readColor(u8* data) const noexcept
+{
+	mDevice.flush();
+	return readRenderTargetColor(getRenderTarget(), data);
+}
+
+RenderTargetSoftware TextureFramebufferSoftware::getRenderTarget() const noexcept
+{
+	// All the textures of the device are software ones
+	auto* color = static_cast<Texture2Software*>(getColor());
+	auto* depth = static_cast<Texture2Software*>(getDepth());
+
+	// The buffers are addressed by the same rows, so they must have the same size
+	if (color != nullptr && depth != nullptr && !isSameSize(color->getSize(), depth->getSize()))
+	{
+		depth = nullptr;
+	}
+
+	RenderTargetSoftware result;
+	result.size = getSize();
+	result.color = color != nullptr ? color->getColorData() : nullptr;
+	result.depth = depth != nullptr ? depth->getDepthData() : nullptr;
+	return result;
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,130 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/window/Window.h"
+
+#include "../../framebuffer/TextureFramebufferBase.h"
+
+namespace gltut
+{
+// Forward declarations
+class DeviceSoftware;
+
+// Global classes
+/**
+	\brief The buffers the software device renders to.
+	The rows go from the bottom to the top, as in OpenGL.
+*/
+struct RenderTargetSoftware
+{
+	/// The size of the buffers
+	Point2u size = {0, 0};
+
+	/// The RGBA8 color buffer, may be null
+	u8* color = nullptr;
+
+	/// The depth buffer, may be null
+	float* depth = nullptr;
+};
+
+/// Interface of the framebuffers of the software device
+class FramebufferSoftware
+{
+public:
+	/// Virtual destructor
+	virtual ~FramebufferSoftware() noexcept = default;
+
+	/// Returns the buffers to render to
+	virtual RenderTargetSoftware getRenderTarget() const noexcept = 0;
+};
+
+/// Default framebuffer of the window size, stored in the system memory
+class WindowFramebufferSoftware final :
+	public Framebuffer,
+	public FramebufferSoftware,
+	public NonCopyable
+{
+public:
+	/// Constructor
+	WindowFramebufferSoftware(
+		DeviceSoftware& device,
+		const Window& window) noexcept :
+
+		mDevice(device),
+		mWindow(window)
+	{
+	}
+
+	/// Returns the size of the framebuffer
+	Point2u getSize() const noexcept final
+	{
+		return mWindow.getSize();
+	}
+
+	/// Binds the framebuffer
+	void bind() const noexcept final;
+
+	/// Reads the color buffer, finishing the pending rendering
+	bool readColor(u8* data) const noexcept final;
+
+	/// Returns the buffers, resizing them to the window size
+	RenderTargetSoftware getRenderTarget() const noexcept final;
+
+private:
+	/// The device
+	DeviceSoftware& mDevice;
+
+	/// The window
+	const Window& mWindow;
+
+	/// The size of the buffers
+	mutable Point2u mSize = {0, 0};
+
+	/// The color buffer
+	mutable std::vector<u8> mColor;
+
+	/// The depth buffer
+	mutable std::vector<float> mDepth;
+};
+
+/// Framebuffer rendering to textures of the software device
+class TextureFramebufferSoftware final :
+	public TextureFramebufferBase,
+	public FramebufferSoftware
+{
+public:
+	/**
+		Constructor
+		\throw std::runtime_error If both textures are null
+	*/
+	TextureFramebufferSoftware(
+		DeviceSoftware& device,
+		Texture2* color,
+		Texture2* depth);
+
+	/// Destructor
+	~TextureFramebufferSoftware() noexcept final;
+
+	/// Binds the framebuffer
+	void bind() const noexcept final;
+
+	/// Reads the color texture, finishing the pending rendering
+	bool readColor(u8* data) const noexcept final;
+
+	/// Returns the buffers of the textures
+	RenderTargetSoftware getRenderTarget() const noexcept final;
+
+private:
+	/// The device
+	DeviceSoftware& mDevice;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,81 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "GeometrySoftware.h"
+
+#include "DeviceSoftware.h"
+
+namespace gltut
+{
+// Global classes
+GeometrySoftware::GeometrySoftware(
+	DeviceSoftware& device,
+	VertexFormat vertexFormat,
+	u32 vertexCount,
+	const float* vertices,
+	u32 indexCount,
+	const u32* indices) :
+
+	GeometryBase(vertexFormat, vertexCount, vertices),
+	mDevice(device)
+{
+	GLTUT_CHECK(vertexCount > 0, "Vertex count must be greater than 0");
+	GLTUT_CHECK(vertices != nullptr, "Vertex data must not be null");
+
+	GLTUT_CHECK(indexCount > 0, "Index count must be greater than 0");
+	GLTUT_CHECK(indexCount % 3 == 0, "Index count must be a multiple of 3");
+	GLTUT_CHECK(indices != nullptr, "Index data must not be null");
+
+	const u32 vertexSize = vertexFormat.getTotalSize();
+	GLTUT_CHECK(vertexSize > 0, "Vertex size must be greater than 0");
+
+	mVertices.resize(vertexCount);
+	for (u32 i = 0; i < vertexCount; ++i)
+	{
+		const float* source = vertices + static_cast<size_t>(i) * vertexSize;
+		for (u32 attribute = 0; attribute < VertexFormat::MAX_VERTEX_COMPONENTS; ++attribute)
+		{
+			const u32 componentSize = vertexFormat.getComponentSize(attribute);
+			if (attribute < SOFTWARE_VERTEX_ATTRIBUTES)
+			{
+				float* target = mVertices[i].attributes[attribute];
+				for (u32 k = 0; k < 4; ++k)
+				{
+					target[k] = k < componentSize ? source[k] : (k == 3 ? 1.0f : 0.0f);
+				}
+			}
+			source += componentSize;
+		}
+	}
+
+	mIndices.assign(indices, indices + indexCount);
+	for (u32 index : mIndices)
+	{
+		GLTUT_CHECK(index < vertexCount, "Vertex index is out of range");
+	}
+}
+
+void GeometrySoftware::render() const noexcept
+{
+	mDevice.draw(*this);
+}
+
+void GeometrySoftware::renderInstanced(
+	const GeometryInstance* instances,
+	u32 instanceCount) const noexcept
+{
+	if (instances == nullptr)
+	{
+		return;
+	}
+
+	for (u32 i = 0; i < instanceCount; ++i)
+	{
+		mDevice.draw(*this, instances + i);
+	}
+}
+
+// End of the namespace gltut
+}
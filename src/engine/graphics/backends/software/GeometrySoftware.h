@@ -0,0 +1,69 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+
+#include "../../geometry/GeometryBase.h"
+#include "program/ShaderProgramSoftware.h"
+
+namespace gltut
+{
+// Forward declarations
+class DeviceSoftware;
+
+// Global classes
+/// Indexed triangle list stored in the system memory
+class GeometrySoftware final : public GeometryBase, public NonCopyable
+{
+public:
+	/**
+		Constructor
+		\throw std::runtime_error If the vertex or index data is invalid
+	*/
+	GeometrySoftware(
+		DeviceSoftware& device,
+		VertexFormat vertexFormat,
+		u32 vertexCount,
+		const float* vertices,
+		u32 indexCount,
+		const u32* indices);
+
+	/// Submits the geometry to the device
+	void render() const noexcept final;
+
+	/// Submits the geometry to the device once per instance
+	void renderInstanced(
+		const GeometryInstance* instances,
+		u32 instanceCount) const noexcept final;
+
+	/// Returns the vertices
+	const std::vector<VertexSoftware>& getVertices() const noexcept
+	{
+		return mVertices;
+	}
+
+	/// Returns the indices
+	const std::vector<u32>& getIndices() const noexcept
+	{
+		return mIndices;
+	}
+
+private:
+	/// The device
+	DeviceSoftware& mDevice;
+
+	/// The vertices
+	std::vector<VertexSoftware> mVertices;
+
+	/// The indices, 3 per triangle
+	std::vector<u32> mIndices;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,645 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "RasterizerSoftware.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "../../../core/Float4.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants and enums
+/// The size of the guard band in the clip space w units.
+/// The triangles crossing it are clipped to keep the edge functions precise.
+constexpr float GUARD_BAND = 4.0f;
+
+/// The clipping codes of a vertex, one bit per plane
+enum ClipCode : u8
+{
+	CLIP_NEAR = 1 << 0,
+	CLIP_LEFT = 1 << 1,
+	CLIP_RIGHT = 1 << 2,
+	CLIP_BOTTOM = 1 << 3,
+	CLIP_TOP = 1 << 4,
+	// The far plane is not clipped, the fragments behind it are rejected
+	CLIP_FAR = 1 << 5
+};
+
+/// The number of the clipping planes
+constexpr u32 CLIPPING_PLANES = 5;
+
+/// The clipping codes of the clipping planes
+constexpr u8 CLIPPING_PLANES_MASK = (1 << CLIPPING_PLANES) - 1;
+
+/// The maximum number of vertices of a clipped triangle, each plane adds one vertex
+constexpr u32 MAX_CLIPPED_VERTICES = 3 + CLIPPING_PLANES;
+
+/// The number of vertices processed by a task
+constexpr u32 VERTEX_TASK_SIZE = 256;
+
+// Local functions
+/// Returns the clipping codes of a clip space vertex
+u8 getClipCode(const float* vertex) noexcept
+{
+	const float x = vertex[0];
+	const float y = vertex[1];
+	const float z = vertex[2];
+	const float w = vertex[3];
+	const float guardBand = GUARD_BAND * w;
+
+	u8 result = 0;
+	result |= z < -w ? CLIP_NEAR : 0;
+	result |= x < -guardBand ? CLIP_LEFT : 0;
+	result |= x > guardBand ? CLIP_RIGHT : 0;
+	result |= y < -guardBand ? CLIP_BOTTOM : 0;
+	result |= y > guardBand ? CLIP_TOP : 0;
+	result |= z > w ? CLIP_FAR : 0;
+	return result;
+}
+
+/// Returns the signed distance of a clip space vertex to a clipping plane, >= 0 inside
+float getPlaneDistance(const float* vertex, u32 plane) noexcept
+{
+	const float guardBand = GUARD_BAND * vertex[3];
+	switch (plane)
+	{
+	case 0:
+		return vertex[2] + vertex[3];
+	case 1:
+		return vertex[0] + guardBand;
+	case 2:
+		return guardBand - vertex[0];
+	case 3:
+		return vertex[1] + guardBand;
+	default:
+		return guardBand - vertex[1];
+	}
+}
+
+/// Converts a color channel to 8 bits
+u8 toByte(float value) noexcept
+{
+	return static_cast<u8>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+/// Returns the lanes passing the depth test
+u32 testDepth(DepthTestMode mode, Float4 depth, Float4 bufferDepth) noexcept
+{
+	switch (mode)
+	{
+	case DepthTestMode::NEVER:
+		return 0;
+	case DepthTestMode::LESS:
+		return less(depth, bufferDepth);
+	case DepthTestMode::EQUAL:
+		return equal(depth, bufferDepth);
+	case DepthTestMode::LEQUAL:
+		return lessEqual(depth, bufferDepth);
+	case DepthTestMode::GREATER:
+		return less(bufferDepth, depth);
+	case DepthTestMode::NOTEQUAL:
+		return ~equal(depth, bufferDepth) & 0xF;
+	case DepthTestMode::GEQUAL:
+		return lessEqual(bufferDepth, depth);
+	default:
+		return 0xF;
+	}
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+void RasterizerSoftware::setRenderTarget(const RenderTargetSoftware& target) noexcept
+{
+	flush();
+
+	mTarget = target;
+	mTilesX = (target.size.x + TILE_SIZE - 1) / TILE_SIZE;
+	mTilesY = (target.size.y + TILE_SIZE - 1) / TILE_SIZE;
+
+	bool allocated = false;
+	GLTUT_CATCH_ALL_BEGIN
+	mTiles.resize(static_cast<size_t>(mTilesX) * mTilesY);
+	allocated = true;
+	GLTUT_CATCH_ALL_END("Cannot allocate the screen tiles")
+
+	if (!allocated)
+	{
+		// Without the tiles nothing can be rendered
+		mTarget = {};
+		mTilesX = 0;
+		mTilesY = 0;
+	}
+}
+
+void RasterizerSoftware::draw(
+	const GeometrySoftware& geometry,
+	std::unique_ptr<ShaderInvocationSoftware> invocation,
+	const DrawStateSoftware& state) noexcept
+{
+	if (!GLTUT_ASSERT(invocation != nullptr) ||
+		(mTarget.color == nullptr && mTarget.depth == nullptr) ||
+		state.viewport.getMin().x >= std::min(state.viewport.getMax().x, mTarget.size.x) ||
+		state.viewport.getMin().y >= std::min(state.viewport.getMax().y, mTarget.size.y))
+	{
+		return;
+	}
+
+	GLTUT_CATCH_ALL_BEGIN
+	const u32 varyingCount = invocation->getVaryingCount();
+	const u32 stride = 4 + varyingCount;
+
+	if (mDrawCount == mDraws.size())
+	{
+		mDraws.emplace_back();
+	}
+	const u32 drawIndex = mDrawCount++;
+	Draw& draw = mDraws[drawIndex];
+	draw.invocation = std::move(invocation);
+	draw.state = state;
+	draw.stride = stride;
+
+	const std::vector<VertexSoftware>& vertices = geometry.getVertices();
+	const u32 vertexCount = static_cast<u32>(vertices.size());
+	draw.vertices.resize(static_cast<size_t>(vertexCount) * stride);
+	mClipVertices.resize(static_cast<size_t>(vertexCount) * stride);
+	mClipCodes.resize(vertexCount);
+	for (auto& polygon : mClipPolygons)
+	{
+		polygon.resize(MAX_CLIPPED_VERTICES * (4 + SOFTWARE_MAX_VARYINGS));
+	}
+
+	// The vertex stage
+	const ShaderInvocationSoftware& program = *draw.invocation;
+	mTaskPool.run(
+		(vertexCount + VERTEX_TASK_SIZE - 1) / VERTEX_TASK_SIZE,
+		[&](u32 task)
+		{
+			const u32 end = std::min(vertexCount, (task + 1) * VERTEX_TASK_SIZE);
+			for (u32 i = task * VERTEX_TASK_SIZE; i < end; ++i)
+			{
+				float* clipVertex = &mClipVertices[static_cast<size_t>(i) * stride];
+				program.processVertex(vertices[i], clipVertex, clipVertex + 4);
+				mClipCodes[i] = getClipCode(clipVertex);
+				if ((mClipCodes[i] & CLIP_NEAR) == 0)
+				{
+					projectVertex(
+						clipVertex,
+						state,
+						varyingCount,
+						&draw.vertices[static_cast<size_t>(i) * stride]);
+				}
+			}
+		});
+
+	// The triangle setup and binning
+	const std::vector<u32>& indices = geometry.getIndices();
+	for (size_t i = 0; i < indices.size(); i += 3)
+	{
+		const u32 i0 = indices[i];
+		const u32 i1 = indices[i + 1];
+		const u32 i2 = indices[i + 2];
+		const u8 c0 = mClipCodes[i0];
+		const u8 c1 = mClipCodes[i1];
+		const u8 c2 = mClipCodes[i2];
+
+		if ((c0 & c1 & c2) != 0)
+		{
+			// Completely outside of a plane
+			continue;
+		}
+
+		if (((c0 | c1 | c2) & CLIPPING_PLANES_MASK) == 0)
+		{
+			addTriangle(drawIndex, i0 * stride, i1 * stride, i2 * stride);
+		}
+		else
+		{
+			clipTriangle(drawIndex, i0, i1, i2);
+		}
+	}
+	GLTUT_CATCH_ALL_END("Cannot draw a geometry")
+}
+
+void RasterizerSoftware::clear(
+	const Color* color,
+	bool depth,
+	const Rectangle2u& rectangle) noexcept
+{
+	flush();
+
+	const u32 minX = rectangle.getMin().x;
+	const u32 minY = rectangle.getMin().y;
+	const u32 maxX = std::min(rectangle.getMax().x, mTarget.size.x);
+	const u32 maxY = std::min(rectangle.getMax().y, mTarget.size.y);
+	if (minX >= maxX || minY >= maxY)
+	{
+		return;
+	}
+
+	if (color != nullptr && mTarget.color != nullptr)
+	{
+		const u8 texel[4] = {toByte(color->r), toByte(color->g), toByte(color->b), toByte(color->a)};
+		for (u32 y = minY; y < maxY; ++y)
+		{
+			u8* row = mTarget.color + (static_cast<size_t>(y) * mTarget.size.x + minX) * 4;
+			for (u32 x = minX; x < maxX; ++x, row += 4)
+			{
+				std::memcpy(row, texel, 4);
+			}
+		}
+	}
+
+	if (depth && mTarget.depth != nullptr)
+	{
+		for (u32 y = minY; y < maxY; ++y)
+		{
+			float* row = mTarget.depth + static_cast<size_t>(y) * mTarget.size.x;
+			std::fill(row + minX, row + maxX, 1.0f);
+		}
+	}
+}
+
+void RasterizerSoftware::flush() noexcept
+{
+	if (!mTriangles.empty())
+	{
+		mTaskPool.run(
+			static_cast<u32>(mTiles.size()),
+			[this](u32 tile)
+			{
+				shadeTile(tile);
+			});
+
+		for (auto& tile : mTiles)
+		{
+			tile.clear();
+		}
+		mTriangles.clear();
+	}
+
+	for (u32 i = 0; i < mDrawCount; ++i)
+	{
+		mDraws[i].invocation.reset();
+		mDraws[i].vertices.clear();
+	}
+	mDrawCount = 0;
+}
+
+void RasterizerSoftware::addTriangle(u32 drawIndex, u32 v0, u32 v1, u32 v2)
+{
+	const Draw& draw = mDraws[drawIndex];
+	const float* p0 = &draw.vertices[v0];
+	const float* p1 = &draw.vertices[v1];
+	const float* p2 = &draw.vertices[v2];
+
+	float doubleArea = (p1[0] - p0[0]) * (p2[1] - p0[1]) - (p2[0] - p0[0]) * (p1[1] - p0[1]);
+	// Rejects the degenerate triangles and NaNs
+	if (!(std::abs(doubleArea) > 0.0f))
+	{
+		return;
+	}
+
+	// The counter-clockwise triangles are front-facing
+	const bool frontFacing = doubleArea > 0.0f;
+	if ((draw.state.faceCulling == FaceCullingMode::BACK && !frontFacing) ||
+		(draw.state.faceCulling == FaceCullingMode::FRONT && frontFacing))
+	{
+		return;
+	}
+
+	if (!frontFacing)
+	{
+		std::swap(v1, v2);
+		std::swap(p1, p2);
+		doubleArea = -doubleArea;
+	}
+
+	// The pixel (x, y) is covered if its center (x + 0.5, y + 0.5) is inside
+	const Rectangle2u& viewport = draw.state.viewport;
+	Triangle triangle;
+	triangle.minX = std::max(
+		static_cast<int32>(std::ceil(std::min({p0[0], p1[0], p2[0]}) - 0.5f)),
+		static_cast<int32>(viewport.getMin().x));
+	triangle.minY = std::max(
+		static_cast<int32>(std::ceil(std::min({p0[1], p1[1], p2[1]}) - 0.5f)),
+		static_cast<int32>(viewport.getMin().y));
+	triangle.maxX = std::min(
+		static_cast<int32>(std::floor(std::max({p0[0], p1[0], p2[0]}) - 0.5f)),
+		static_cast<int32>(std::min(viewport.getMax().x, mTarget.size.x)) - 1);
+	triangle.maxY = std::min(
+		static_cast<int32>(std::floor(std::max({p0[1], p1[1], p2[1]}) - 0.5f)),
+		static_cast<int32>(std::min(viewport.getMax().y, mTarget.size.y)) - 1);
+
+	if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+	{
+		return;
+	}
+
+	triangle.draw = drawIndex;
+	triangle.vertices[0] = v0;
+	triangle.vertices[1] = v1;
+	triangle.vertices[2] = v2;
+	triangle.invArea = 1.0f / doubleArea;
+
+	const float* edgeVertices[3][2] = {{p1, p2}, {p2, p0}, {p0, p1}};
+	for (u32 i = 0; i < 3; ++i)
+	{
+		const float* start = edgeVertices[i][0];
+		const float* end = edgeVertices[i][1];
+		const float dx = end[0] - start[0];
+		const float dy = end[1] - start[1];
+		triangle.edgeA[i] = -dy;
+		triangle.edgeB[i] = dx;
+		triangle.edgeC[i] = start[0] * end[1] - start[1] * end[0];
+		// The left edges go down and the top edges go left for the counter-clockwise order
+		triangle.edgeInclusive[i] = dy < 0.0f || (dy == 0.0f && dx < 0.0f);
+	}
+
+	const u32 triangleIndex = static_cast<u32>(mTriangles.size());
+	mTriangles.push_back(triangle);
+
+	const u32 tileMaxX = static_cast<u32>(triangle.maxX) / TILE_SIZE;
+	const u32 tileMaxY = static_cast<u32>(triangle.maxY) / TILE_SIZE;
+	for (u32 tileY = static_cast<u32>(triangle.minY) / TILE_SIZE; tileY <= tileMaxY; ++tileY)
+	{
+		for (u32 tileX = static_cast<u32>(triangle.minX) / TILE_SIZE; tileX <= tileMaxX; ++tileX)
+		{
+			mTiles[tileY * mTilesX + tileX].push_back(triangleIndex);
+		}
+	}
+}
+
+void RasterizerSoftware::clipTriangle(u32 drawIndex, u32 i0, u32 i1, u32 i2)
+{
+	Draw& draw = mDraws[drawIndex];
+	const u32 stride = draw.stride;
+	const size_t vertexSize = stride * sizeof(float);
+
+	float* input = mClipPolygons[0].data();
+	float* output = mClipPolygons[1].data();
+	std::memcpy(input, &mClipVertices[static_cast<size_t>(i0) * stride], vertexSize);
+	std::memcpy(input + stride, &mClipVertices[static_cast<size_t>(i1) * stride], vertexSize);
+	std::memcpy(input + 2 * stride, &mClipVertices[static_cast<size_t>(i2) * stride], vertexSize);
+
+	const u8 codes = mClipCodes[i0] | mClipCodes[i1] | mClipCodes[i2];
+	u32 count = 3;
+	for (u32 plane = 0; plane < CLIPPING_PLANES; ++plane)
+	{
+		if ((codes & (1 << plane)) == 0)
+		{
+			continue;
+		}
+
+		u32 outputCount = 0;
+		for (u32 i = 0; i < count; ++i)
+		{
+			const float* start = input + i * stride;
+			const float* end = input + ((i + 1) % count) * stride;
+			const float startDistance = getPlaneDistance(start, plane);
+			const float endDistance = getPlaneDistance(end, plane);
+
+			if (startDistance >= 0.0f)
+			{
+				std::memcpy(output + outputCount * stride, start, vertexSize);
+				++outputCount;
+			}
+
+			if ((startDistance >= 0.0f) != (endDistance >= 0.0f))
+			{
+				const float t = startDistance / (startDistance - endDistance);
+				float* vertex = output + outputCount * stride;
+				for (u32 k = 0; k < stride; ++k)
+				{
+					vertex[k] = start[k] + (end[k] - start[k]) * t;
+				}
+				++outputCount;
+			}
+		}
+
+		std::swap(input, output);
+		count = outputCount;
+		if (count < 3)
+		{
+			return;
+		}
+	}
+
+	const u32 first = static_cast<u32>(draw.vertices.size());
+	draw.vertices.resize(draw.vertices.size() + static_cast<size_t>(count) * stride);
+	for (u32 i = 0; i < count; ++i)
+	{
+		projectVertex(
+			input + i * stride,
+			draw.state,
+			stride - 4,
+			&draw.vertices[first + i * stride]);
+	}
+
+	for (u32 i = 1; i + 1 < count; ++i)
+	{
+		addTriangle(drawIndex, first, first + i * stride, first + (i + 1) * stride);
+	}
+}
+
+void RasterizerSoftware::projectVertex(
+	const float* clipVertex,
+	const DrawStateSoftware& state,
+	u32 varyingCount,
+	float* screenVertex) noexcept
+{
+	const Point2u& viewportMin = state.viewport.getMin();
+	const Point2u viewportSize = state.viewport.getSize();
+
+	const float invW = 1.0f / clipVertex[3];
+	screenVertex[0] = static_cast<float>(viewportMin.x) +
+		(clipVertex[0] * invW * 0.5f + 0.5f) * static_cast<float>(viewportSize.x);
+	screenVertex[1] = static_cast<float>(viewportMin.y) +
+		(clipVertex[1] * invW * 0.5f + 0.5f) * static_cast<float>(viewportSize.y);
+	screenVertex[2] = clipVertex[2] * invW * 0.5f + 0.5f;
+	screenVertex[3] = invW;
+	for (u32 i = 0; i < varyingCount; ++i)
+	{
+		screenVertex[4 + i] = clipVertex[4 + i] * invW;
+	}
+}
+
+void RasterizerSoftware::shadeTile(u32 tileIndex) const noexcept
+{
+	const std::vector<u32>& triangles = mTiles[tileIndex];
+	if (triangles.empty())
+	{
+		return;
+	}
+
+	const int32 minX = static_cast<int32>((tileIndex % mTilesX) * TILE_SIZE);
+	const int32 minY = static_cast<int32>((tileIndex / mTilesX) * TILE_SIZE);
+	const int32 maxX = std::min(minX + static_cast<int32>(TILE_SIZE), static_cast<int32>(mTarget.size.x)) - 1;
+	const int32 maxY = std::min(minY + static_cast<int32>(TILE_SIZE), static_cast<int32>(mTarget.size.y)) - 1;
+
+	for (u32 index : triangles)
+	{
+		const Triangle& triangle = mTriangles[index];
+		shadeTriangle(
+			triangle,
+			std::max(triangle.minX, minX),
+			std::max(triangle.minY, minY),
+			std::min(triangle.maxX, maxX),
+			std::min(triangle.maxY, maxY));
+	}
+}
+
+void RasterizerSoftware::shadeTriangle(
+	const Triangle& triangle,
+	int32 minX,
+	int32 minY,
+	int32 maxX,
+	int32 maxY) const noexcept
+{
+	const Draw& draw = mDraws[triangle.draw];
+	const ShaderInvocationSoftware& program = *draw.invocation;
+	const u32 varyingCount = program.getVaryingCount();
+	const DepthTestMode depthTest = draw.state.depthTest;
+	const bool blending = draw.state.blending;
+	const bool depthWrite = draw.state.depthWrite;
+	u8* colorBuffer = program.hasColorOutput() && draw.state.colorWrite ? mTarget.color : nullptr;
+	float* depthBuffer = mTarget.depth;
+	const int32 width = static_cast<int32>(mTarget.size.x);
+
+	const float* v0 = &draw.vertices[triangle.vertices[0]];
+	const float* v1 = &draw.vertices[triangle.vertices[1]];
+	const float* v2 = &draw.vertices[triangle.vertices[2]];
+
+	const Float4 zero = splat(0.0f);
+	const Float4 one = splat(1.0f);
+	const Float4 invArea = splat(triangle.invArea);
+	const Float4 z0 = splat(v0[2]);
+	const Float4 dz1 = splat(v1[2] - v0[2]);
+	const Float4 dz2 = splat(v2[2] - v0[2]);
+	const Float4 edgeA[3] = {
+		splat(triangle.edgeA[0]),
+		splat(triangle.edgeA[1]),
+		splat(triangle.edgeA[2])};
+
+	float varyings[SOFTWARE_MAX_VARYINGS];
+	float b1Lanes[4];
+	float b2Lanes[4];
+	float depthLanes[4];
+
+	for (int32 y = minY; y <= maxY; ++y)
+	{
+		const float pixelY = static_cast<float>(y) + 0.5f;
+		const Float4 rowEdge[3] = {
+			splat(triangle.edgeB[0] * pixelY + triangle.edgeC[0]),
+			splat(triangle.edgeB[1] * pixelY + triangle.edgeC[1]),
+			splat(triangle.edgeB[2] * pixelY + triangle.edgeC[2])};
+		const size_t row = static_cast<size_t>(y) * width;
+
+		for (int32 x = minX; x <= maxX; x += 4)
+		{
+			const Float4 pixelX = sequence(static_cast<float>(x) + 0.5f);
+			Float4 edges[3];
+			u32 mask = maxX - x >= 3 ? 0xF : (1u << (maxX - x + 1)) - 1;
+			for (u32 i = 0; i < 3; ++i)
+			{
+				edges[i] = add(multiply(edgeA[i], pixelX), rowEdge[i]);
+				mask &= triangle.edgeInclusive[i] ? lessEqual(zero, edges[i]) : less(zero, edges[i]);
+			}
+
+			if (mask == 0)
+			{
+				continue;
+			}
+
+			// The barycentric coordinates of the vertices 1 and 2
+			const Float4 b1 = multiply(edges[1], invArea);
+			const Float4 b2 = multiply(edges[2], invArea);
+			const Float4 depth = add(z0, add(multiply(b1, dz1), multiply(b2, dz2)));
+			mask &= lessEqual(zero, depth) & lessEqual(depth, one);
+
+			if (depthBuffer != nullptr && mask != 0)
+			{
+				Float4 bufferDepth;
+				if (x + 4 <= width)
+				{
+					bufferDepth = load(depthBuffer + row + x);
+				}
+				else
+				{
+					float lanes[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+					std::copy(depthBuffer + row + x, depthBuffer + row + width, lanes);
+					bufferDepth = load(lanes);
+				}
+				mask &= testDepth(depthTest, depth, bufferDepth);
+			}
+
+			if (mask == 0)
+			{
+				continue;
+			}
+
+			store(b1Lanes, b1);
+			store(b2Lanes, b2);
+			store(depthLanes, depth);
+			for (u32 lane = 0; lane < 4; ++lane)
+			{
+				if ((mask & (1u << lane)) == 0)
+				{
+					continue;
+				}
+
+				// Perspective-correct interpolation of the varyings
+				const float lb1 = b1Lanes[lane];
+				const float lb2 = b2Lanes[lane];
+				const float w = 1.0f / (v0[3] + (v1[3] - v0[3]) * lb1 + (v2[3] - v0[3]) * lb2);
+				for (u32 i = 4; i < 4 + varyingCount; ++i)
+				{
+					varyings[i - 4] = (v0[i] + (v1[i] - v0[i]) * lb1 + (v2[i] - v0[i]) * lb2) * w;
+				}
+
+				float color[4];
+				if (!program.processFragment(varyings, color))
+				{
+					continue;
+				}
+
+				const size_t pixel = row + x + lane;
+				if (depthBuffer != nullptr && depthWrite)
+				{
+					depthBuffer[pixel] = depthLanes[lane];
+				}
+
+				if (colorBuffer != nullptr)
+				{
+					u8* target = colorBuffer + pixel * 4;
+					if (blending)
+					{
+						const float alpha = std::clamp(color[3], 0.0f, 1.0f);
+						for (u32 i = 0; i < 4; ++i)
+						{
+							const float source = std::clamp(color[i], 0.0f, 1.0f);
+							color[i] = source * alpha + target[i] * (1.0f / 255.0f) * (1.0f - alpha);
+						}
+					}
+
+					for (u32 i = 0; i < 4; ++i)
+					{
+						target[i] = toByte(color[i]);
+					}
+				}
+			}
+		}
+	}
+}
+
+// End of the namespace gltut
+}
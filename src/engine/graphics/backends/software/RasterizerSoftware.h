@@ -0,0 +1,199 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <memory>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/RenderModes.h"
+#include "engine/math/Color.h"
+#include "engine/math/Rectangle.h"
+
+#include "FramebufferSoftware.h"
+#include "GeometrySoftware.h"
+#include "../../../core/TaskPool.h"
+#include "program/ShaderProgramSoftware.h"
+
+namespace gltut
+{
+// Global classes
+/// The fixed-function state of a draw call
+struct DrawStateSoftware
+{
+	/// The viewport, also used as the scissor rectangle
+	Rectangle2u viewport;
+
+	/// The face culling mode
+	FaceCullingMode faceCulling = FaceCullingMode::NONE;
+
+	/// The depth test function
+	DepthTestMode depthTest = DepthTestMode::LESS;
+
+	/// If the depth writes are enabled
+	bool depthWrite = true;
+
+	/// If the color writes are enabled
+	bool colorWrite = true;
+
+	/// If the alpha blending is enabled
+	bool blending = false;
+};
+
+/**
+	\brief Tile-based triangle rasterizer.
+	The draw calls run the vertex stage, clip the triangles
+	and bin them into the screen tiles. The flush shades the tiles
+	in parallel, each tile processes its triangles in the submission order.
+	The coverage and the depth test are evaluated for 4 pixels at once
+	with SSE2 if it is available.
+*/
+class RasterizerSoftware : public NonCopyable
+{
+public:
+	/// The size of a screen tile in pixels
+	static constexpr u32 TILE_SIZE = 32;
+
+	/// Constructor
+	explicit RasterizerSoftware(TaskPool& taskPool) noexcept :
+		mTaskPool(taskPool)
+	{
+	}
+
+	/// Returns the render target
+	const RenderTargetSoftware& getRenderTarget() const noexcept
+	{
+		return mTarget;
+	}
+
+	/// Sets the render target, finishing the pending rendering
+	void setRenderTarget(const RenderTargetSoftware& target) noexcept;
+
+	/// Queues the triangles of a geometry
+	void draw(
+		const GeometrySoftware& geometry,
+		std::unique_ptr<ShaderInvocationSoftware> invocation,
+		const DrawStateSoftware& state) noexcept;
+
+	/// Clears the render target within a rectangle, finishing the pending rendering
+	void clear(
+		const Color* color,
+		bool depth,
+		const Rectangle2u& rectangle) noexcept;
+
+	/// Shades the queued triangles
+	void flush() noexcept;
+
+private:
+	/// The queued draw call
+	struct Draw
+	{
+		/// The invocation of the shader program
+		std::unique_ptr<ShaderInvocationSoftware> invocation;
+
+		/// The fixed-function state
+		DrawStateSoftware state;
+
+		/**
+			\brief The screen space vertices: x, y, z, 1 / w
+			and the varyings divided by w
+		*/
+		std::vector<float> vertices;
+
+		/// The number of floats in a vertex
+		u32 stride = 0;
+	};
+
+	/// The set up triangle
+	struct Triangle
+	{
+		/// The index of the draw call
+		u32 draw;
+
+		/// The offsets of the vertices in the vertices of the draw call
+		u32 vertices[3];
+
+		/// The edge functions E(x, y) = a * x + b * y + c, edge i is opposite to the vertex i
+		float edgeA[3];
+		float edgeB[3];
+		float edgeC[3];
+
+		/// If the edge includes the pixels on it, by the top-left rule
+		bool edgeInclusive[3];
+
+		/// The inverse of the doubled triangle area
+		float invArea;
+
+		/// The covered pixel range, inclusive
+		int32 minX;
+		int32 minY;
+		int32 maxX;
+		int32 maxY;
+	};
+
+	/// Sets up a screen space triangle and bins it into the tiles
+	void addTriangle(u32 drawIndex, u32 v0, u32 v1, u32 v2);
+
+	/**
+		\brief Clips a triangle by the near plane and the guard band,
+		adds the resulting triangles
+	*/
+	void clipTriangle(u32 drawIndex, u32 i0, u32 i1, u32 i2);
+
+	/// Projects a clip space vertex to the screen vertices of a draw call
+	static void projectVertex(
+		const float* clipVertex,
+		const DrawStateSoftware& state,
+		u32 varyingCount,
+		float* screenVertex) noexcept;
+
+	/// Shades the triangles of a tile
+	void shadeTile(u32 tileIndex) const noexcept;
+
+	/// Shades a triangle within a pixel rectangle
+	void shadeTriangle(
+		const Triangle& triangle,
+		int32 minX,
+		int32 minY,
+		int32 maxX,
+		int32 maxY) const noexcept;
+
+	/// The tasks pool
+	TaskPool& mTaskPool;
+
+	/// The render target
+	RenderTargetSoftware mTarget;
+
+	/// The number of tiles along x
+	u32 mTilesX = 0;
+
+	/// The number of tiles along y
+	u32 mTilesY = 0;
+
+	/// The triangles of the tiles
+	std::vector<std::vector<u32>> mTiles;
+
+	/// The queued draw calls, reused between the flushes
+	std::vector<Draw> mDraws;
+
+	/// The number of the queued draw calls
+	u32 mDrawCount = 0;
+
+	/// The set up triangles
+	std::vector<Triangle> mTriangles;
+
+	/// The clip space vertices of the current draw call: x, y, z, w and the varyings
+	std::vector<float> mClipVertices;
+
+	/// The clip codes of the current draw call vertices
+	std::vector<u8> mClipCodes;
+
+	/// The clipping polygons
+	std::vector<float> mClipPolygons[2];
+};
+
+// End of the namespace gltut
+}
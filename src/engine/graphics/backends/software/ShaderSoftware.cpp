@@ -0,0 +1,169 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "ShaderSoftware.h"
+
+#include <algorithm>
+
+#include "DeviceSoftware.h"
+
+namespace gltut
+{
+// Global classes
+const UniformSoftware ShaderSoftware::ZERO_PARAMETER;
+
+ShaderSoftware::ShaderSoftware(
+	DeviceSoftware& device,
+	const char* vertexShader,
+	const char* fragmentShader) :
+
+	mDevice(device)
+{
+	GLTUT_CHECK(vertexShader != nullptr, "Vertex shader source is null");
+	GLTUT_CHECK(fragmentShader != nullptr, "Fragment shader source is null");
+	addUniformBlockLayouts(vertexShader, mUniformBlockLayouts);
+	addUniformBlockLayouts(fragmentShader, mUniformBlockLayouts);
+	mProgram = createShaderProgramSoftware(*this, vertexShader, fragmentShader);
+	GLTUT_CHECK(mProgram != nullptr, "Failed to create shader program");
+}
+
+ShaderSoftware::~ShaderSoftware() noexcept
+{
+	mDevice.onShaderRemoved(*this);
+}
+
+int32 ShaderSoftware::getParameterLocation(const char* name) const noexcept
+{
+	GLTUT_ASSERT_STRING(name);
+	int32 result = -1;
+	GLTUT_CATCH_ALL_BEGIN
+	const auto [iterator, inserted] = mParameterLocations.emplace(
+		name,
+		static_cast<int32>(mParameters.size()));
+	if (inserted)
+	{
+		mParameters.emplace_back();
+	}
+	result = iterator->second;
+	GLTUT_CATCH_ALL_END("Cannot add a shader parameter")
+	return result;
+}
+
+int32 ShaderSoftware::getUniformBlockIndex(const char* name) const noexcept
+{
+	GLTUT_ASSERT_STRING(name);
+	int32 result = -1;
+	GLTUT_CATCH_ALL_BEGIN
+	const auto [iterator, inserted] = mUniformBlockIndices.emplace(
+		name,
+		static_cast<int32>(mUniformBlockBindingPoints.size()));
+	if (inserted)
+	{
+		mUniformBlockBindingPoints.push_back(0);
+	}
+	result = iterator->second;
+	GLTUT_CATCH_ALL_END("Cannot add a shader uniform block")
+	return result;
+}
+
+void ShaderSoftware::setInt(int32 location, int value) noexcept
+{
+	if (UniformSoftware* parameter = setParameter(location))
+	{
+		parameter->intValue = value;
+		parameter->values[0] = static_cast<float>(value);
+	}
+}
+
+void ShaderSoftware::setFloat(int32 location, float value) noexcept
+{
+	if (UniformSoftware* parameter = setParameter(location))
+	{
+		parameter->values[0] = value;
+	}
+}
+
+void ShaderSoftware::setVec2(int32 location, float x, float y) noexcept
+{
+	if (UniformSoftware* parameter = setParameter(location))
+	{
+		parameter->values[0] = x;
+		parameter->values[1] = y;
+	}
+}
+
+void ShaderSoftware::setUvec2(int32 location, u32 x, u32 y) noexcept
+{
+	if (UniformSoftware* parameter = setParameter(location))
+	{
+		parameter->values[0] = static_cast<float>(x);
+		parameter->values[1] = static_cast<float>(y);
+	}
+}
+
+void ShaderSoftware::setVec3(int32 location, float x, float y, float z) noexcept
+{
+	if (UniformSoftware* parameter = setParameter(location))
+	{
+		parameter->values[0] = x;
+		parameter->values[1] = y;
+		parameter->values[2] = z;
+	}
+}
+
+void ShaderSoftware::setVec4(int32 location, float x, float y, float z, float w) noexcept
+{
+	if (UniformSoftware* parameter = setParameter(location))
+	{
+		parameter->values[0] = x;
+		parameter->values[1] = y;
+		parameter->values[2] = z;
+		parameter->values[3] = w;
+	}
+}
+
+void ShaderSoftware::setMat3(int32 location, const float* data) noexcept
+{
+	UniformSoftware* parameter = setParameter(location);
+	if (parameter != nullptr && GLTUT_ASSERT(data != nullptr))
+	{
+		std::copy(data, data + 9, parameter->values.begin());
+	}
+}
+
+void ShaderSoftware::setMat4(int32 location, const float* data) noexcept
+{
+	UniformSoftware* parameter = setParameter(location);
+	if (parameter != nullptr && GLTUT_ASSERT(data != nullptr))
+	{
+		std::copy(data, data + 16, parameter->values.begin());
+	}
+}
+
+void ShaderSoftware::setUniformBlockBindingPoint(int32 location, u32 bindingPoint) noexcept
+{
+	if (location >= 0 &&
+		static_cast<size_t>(location) < mUniformBlockBindingPoints.size() &&
+		GLTUT_ASSERT(bindingPoint < SOFTWARE_UNIFORM_BUFFER_BINDINGS))
+	{
+		mUniformBlockBindingPoints[location] = bindingPoint;
+	}
+}
+
+void ShaderSoftware::bind() const noexcept
+{
+	mDevice.setShader(this);
+}
+
+UniformSoftware* ShaderSoftware::setParameter(int32 location) noexcept
+{
+	bind();
+	return location >= 0 && static_cast<size_t>(location) < mParameters.size() ?
+		&mParameters[location] :
+		nullptr;
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,161 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/shader/Shader.h"
+
+#include "../../shader/UniformBlockLayout.h"
+#include "program/ShaderProgramSoftware.h"
+
+namespace gltut
+{
+// Forward declarations
+class DeviceSoftware;
+
+// Global classes
+/// Value of a shader uniform of the software device
+struct UniformSoftware
+{
+	/// The float values, up to a 4x4 matrix
+	std::array<float, 16> values = {};
+
+	/// The integer value
+	int intValue = 0;
+};
+
+/**
+	\brief Shader of the software device, running a C++ program.
+	Every requested parameter and uniform block exists
+	and gets a unique location on the first request.
+	The parameters which are not set are 0 as in OpenGL.
+	The std140 layouts of the uniform blocks are read from the shader source.
+	As in the OpenGL backend, setting a parameter binds the shader.
+*/
+class ShaderSoftware final : public Shader, public NonCopyable
+{
+public:
+	/**
+		Constructor
+		\throw std::runtime_error If there is no program for the shader source
+	*/
+	ShaderSoftware(
+		DeviceSoftware& device,
+		const char* vertexShader,
+		const char* fragmentShader);
+
+	/// Destructor
+	~ShaderSoftware() noexcept final;
+
+	/// Returns the location of a shader variable
+	int32 getParameterLocation(const char* name) const noexcept final;
+
+	/// Returns the index of a shader uniform block
+	int32 getUniformBlockIndex(const char* name) const noexcept final;
+
+	/// Sets an integer value to a shader variable
+	void setInt(int32 location, int value) noexcept final;
+
+	/// Sets a float value to a shader variable
+	void setFloat(int32 location, float value) noexcept final;
+
+	/// Sets a 2D vector to a shader variable
+	void setVec2(int32 location, float x, float y) noexcept final;
+
+	/// Sets a 2D unsigned integer vector to a shader variable
+	void setUvec2(int32 location, u32 x, u32 y) noexcept final;
+
+	/// Sets a 3D vector to a shader variable
+	void setVec3(int32 location, float x, float y, float z) noexcept final;
+
+	/// Sets a 4D vector to a shader variable
+	void setVec4(int32 location, float x, float y, float z, float w) noexcept final;
+
+	/// Sets a 3x3 matrix to a shader variable
+	void setMat3(int32 location, const float* data) noexcept final;
+
+	/// Sets a 4x4 matrix to a shader variable
+	void setMat4(int32 location, const float* data) noexcept final;
+
+	/// Sets a binding point to a shader uniform block
+	void setUniformBlockBindingPoint(int32 location, u32 bindingPoint) noexcept final;
+
+	/// Binds the shader
+	void bind() const noexcept final;
+
+	/// Returns the size of a uniform block in bytes, 0 if the source has no such block
+	u32 getUniformBlockSize(const char* blockName) const noexcept final
+	{
+		return gltut::getUniformBlockSize(mUniformBlockLayouts, blockName);
+	}
+
+	/// Returns the offset of a member of a uniform block in bytes, -1 if the block has no such member
+	int32 getUniformBlockMemberOffset(
+		const char* blockName,
+		const char* memberName) const noexcept final
+	{
+		return gltut::getUniformBlockMemberOffset(mUniformBlockLayouts, blockName, memberName);
+	}
+
+	/// Returns the value of a parameter, the zero value for invalid locations
+	const UniformSoftware& getParameter(int32 location) const noexcept
+	{
+		return location >= 0 && static_cast<size_t>(location) < mParameters.size() ?
+			mParameters[location] :
+			ZERO_PARAMETER;
+	}
+
+	/// Returns the binding point of a uniform block, 0 for invalid indices
+	u32 getUniformBlockBindingPoint(int32 index) const noexcept
+	{
+		return index >= 0 && static_cast<size_t>(index) < mUniformBlockBindingPoints.size() ?
+			mUniformBlockBindingPoints[index] :
+			0;
+	}
+
+	/// Returns the program of the shader
+	const ShaderProgramSoftware& getProgram() const noexcept
+	{
+		return *mProgram;
+	}
+
+private:
+	/// The value of the parameters which are not requested
+	static const UniformSoftware ZERO_PARAMETER;
+
+	/// Returns the parameter of a location, binding the shader
+	UniformSoftware* setParameter(int32 location) noexcept;
+
+	/// The device
+	DeviceSoftware& mDevice;
+
+	/// The locations of the requested parameters
+	mutable std::unordered_map<std::string, int32> mParameterLocations;
+
+	/// The values of the parameters, by location
+	mutable std::vector<UniformSoftware> mParameters;
+
+	/// The indices of the requested uniform blocks
+	mutable std::unordered_map<std::string, int32> mUniformBlockIndices;
+
+	/// The binding points of the uniform blocks, by index
+	mutable std::vector<u32> mUniformBlockBindingPoints;
+
+	/// The layouts of the uniform blocks of the source
+	UniformBlockLayouts mUniformBlockLayouts;
+
+	/// The program
+	std::unique_ptr<ShaderProgramSoftware> mProgram;
+};
+
+// End of the namespace gltut
+}
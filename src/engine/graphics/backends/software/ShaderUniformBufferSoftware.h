@@ -0,0 +1,71 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "engine/core/Check.h"
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/shader/ShaderUniformBuffer.h"
+
+namespace gltut
+{
+// Global classes
+/// Shader uniform buffer stored in the system memory
+class ShaderUniformBufferSoftware final : public ShaderUniformBuffer, public NonCopyable
+{
+public:
+	/// Constructor
+	ShaderUniformBufferSoftware(
+		u32 id,
+		u32 sizeInBytes) :
+
+		mId(id)
+	{
+		GLTUT_CHECK(sizeInBytes > 0, "Uniform buffer size must be greater than 0");
+		mData.resize(sizeInBytes, 0);
+	}
+
+	/// Returns the id of the uniform buffer
+	u32 getId() const noexcept final
+	{
+		return mId;
+	}
+
+	/// Sets the data of the uniform buffer
+	void setData(const void* data, u32 size, u32 offset) noexcept final
+	{
+		if (GLTUT_ASSERT(data != nullptr) &&
+			GLTUT_ASSERT(size > 0) &&
+			GLTUT_ASSERT(offset + size <= mData.size()))
+		{
+			std::memcpy(mData.data() + offset, data, size);
+		}
+	}
+
+	/// Copies the data of the buffer, clamping the range by the buffer size
+	void getData(void* data, u32 size, u32 offset) const noexcept
+	{
+		const u32 bufferSize = static_cast<u32>(mData.size());
+		if (offset >= bufferSize)
+		{
+			return;
+		}
+		std::memcpy(data, mData.data() + offset, std::min(size, bufferSize - offset));
+	}
+
+private:
+	/// ShaderUniformBuffer id
+	u32 mId;
+
+	/// The buffer data
+	std::vector<u8> mData;
+};
+
+// End of the namespace gltut
+}
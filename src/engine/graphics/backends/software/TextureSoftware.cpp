@@ -0,0 +1,247 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "TextureSoftware.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+#include "DeviceSoftware.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The multiplier converting 8-bit texel values to [0, 1]
+constexpr float TEXEL_SCALE = 1.0f / 255.0f;
+
+/// The maximum absolute value of a sampled texture coordinate
+constexpr float MAX_TEXTURE_COORDINATE = 1024.0f;
+
+// Local functions
+/// Returns the texel coordinate according to the wrap mode
+int32 wrapCoordinate(int32 coordinate, int32 size, TextureWrapMode mode) noexcept
+{
+	if (mode == TextureWrapMode::REPEAT)
+	{
+		coordinate %= size;
+		return coordinate < 0 ? coordinate + size : coordinate;
+	}
+	return coordinate < 0 ? 0 : (coordinate >= size ? size - 1 : coordinate);
+}
+
+/// Returns the texture coordinate limited to the range convertible to the texel indices
+float getSafeCoordinate(float coordinate) noexcept
+{
+	return std::isfinite(coordinate) ?
+		std::clamp(coordinate, -MAX_TEXTURE_COORDINATE, MAX_TEXTURE_COORDINATE) :
+		0.0f;
+}
+
+/// Checks the data of a cubemap face
+void checkCubemapFace(const TextureData& data)
+{
+	GLTUT_CHECK(data.data != nullptr, "Texture data is null");
+	GLTUT_CHECK(data.size.x > 0, "Texture width is 0");
+	GLTUT_CHECK(data.size.y > 0, "Texture height is 0");
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+Texture2Software::Texture2Software(
+	DeviceSoftware& device,
+	u32 id,
+	const TextureData& data,
+	const TextureParameters& parameters) :
+
+	TextureTSoftware<Texture2>(device, id, parameters),
+	mSize(data.size),
+	mFormat(data.format)
+{
+	GLTUT_CHECK(data.size.x > 0, "Texture width is 0");
+	GLTUT_CHECK(data.size.y > 0, "Texture height is 0");
+	GLTUT_CHECK(
+		data.format < TextureFormat::TOTAL_COUNT,
+		"Invalid texture format");
+
+	allocate();
+	if (data.data == nullptr)
+	{
+		return;
+	}
+
+	const size_t texelCount = static_cast<size_t>(mSize.x) * mSize.y;
+	switch (mFormat)
+	{
+	case TextureFormat::R:
+		for (size_t i = 0; i < texelCount; ++i)
+		{
+			mColor[i * 4] = data.data[i];
+		}
+		break;
+
+	case TextureFormat::RGB:
+		for (size_t i = 0; i < texelCount; ++i)
+		{
+			std::memcpy(&mColor[i * 4], &data.data[i * 3], 3);
+		}
+		break;
+
+	case TextureFormat::RGBA:
+		std::memcpy(mColor.data(), data.data, texelCount * 4);
+		break;
+
+	case TextureFormat::FLOAT:
+		std::memcpy(mDepth.data(), data.data, texelCount * sizeof(float));
+		break;
+
+		GLTUT_UNEXPECTED_SWITCH_DEFAULT_CASE(mFormat)
+	}
+}
+
+Texture2Software::~Texture2Software() noexcept
+{
+	mDevice.onTextureRemoved(*this);
+}
+
+void Texture2Software::setSize(const Point2u& size) noexcept
+{
+	GLTUT_ASSERT(size.x > 0);
+	GLTUT_ASSERT(size.y > 0);
+
+	if (size.x == 0 || size.y == 0)
+	{
+		return;
+	}
+
+	// The pending rendering may use the texture
+	mDevice.flush();
+	GLTUT_CATCH_ALL_BEGIN
+	mSize = size;
+	allocate();
+	GLTUT_CATCH_ALL_END("Cannot resize a texture")
+	mDevice.onTextureResized(*this);
+}
+
+void Texture2Software::bind(u32 slot) const noexcept
+{
+	mDevice.setTexture(this, slot);
+}
+
+void Texture2Software::sample(float u, float v, float* result) const noexcept
+{
+	const int32 width = static_cast<int32>(mSize.x);
+	const int32 height = static_cast<int32>(mSize.y);
+	const float x = getSafeCoordinate(u) * static_cast<float>(width);
+	const float y = getSafeCoordinate(v) * static_cast<float>(height);
+
+	if (getParameters().magFilter == TextureFilterMode::NEAREST ||
+		getParameters().magFilter == TextureFilterMode::NEAREST_MIPMAP_NEAREST)
+	{
+		fetch(
+			static_cast<int32>(std::floor(x)),
+			static_cast<int32>(std::floor(y)),
+			result);
+		return;
+	}
+
+	const float fx = std::floor(x - 0.5f);
+	const float fy = std::floor(y - 0.5f);
+	const float wx = x - 0.5f - fx;
+	const float wy = y - 0.5f - fy;
+	const int32 x0 = static_cast<int32>(fx);
+	const int32 y0 = static_cast<int32>(fy);
+
+	std::array<float, 4> t00;
+	std::array<float, 4> t10;
+	std::array<float, 4> t01;
+	std::array<float, 4> t11;
+	fetch(x0, y0, t00.data());
+	fetch(x0 + 1, y0, t10.data());
+	fetch(x0, y0 + 1, t01.data());
+	fetch(x0 + 1, y0 + 1, t11.data());
+
+	for (u32 i = 0; i < 4; ++i)
+	{
+		const float bottom = t00[i] + (t10[i] - t00[i]) * wx;
+		const float top = t01[i] + (t11[i] - t01[i]) * wx;
+		result[i] = bottom + (top - bottom) * wy;
+	}
+}
+
+void Texture2Software::allocate()
+{
+	const size_t texelCount = static_cast<size_t>(mSize.x) * mSize.y;
+	if (mFormat == TextureFormat::FLOAT)
+	{
+		mDepth.assign(texelCount, 0.0f);
+		return;
+	}
+
+	// The missing channels are (0, 0, 1) as in OpenGL
+	mColor.assign(texelCount * 4, 0);
+	for (size_t i = 0; i < texelCount; ++i)
+	{
+		mColor[i * 4 + 3] = 255;
+	}
+}
+
+void Texture2Software::fetch(int32 x, int32 y, float* result) const noexcept
+{
+	const TextureWrapMode wrapMode = getParameters().wrapMode;
+	const size_t index =
+		static_cast<size_t>(wrapCoordinate(y, static_cast<int32>(mSize.y), wrapMode)) * mSize.x +
+		static_cast<size_t>(wrapCoordinate(x, static_cast<int32>(mSize.x), wrapMode));
+
+	if (mFormat == TextureFormat::FLOAT)
+	{
+		result[0] = mDepth[index];
+		result[1] = 0.0f;
+		result[2] = 0.0f;
+		result[3] = 1.0f;
+		return;
+	}
+
+	const u8* texel = &mColor[index * 4];
+	result[0] = texel[0] * TEXEL_SCALE;
+	result[1] = texel[1] * TEXEL_SCALE;
+	result[2] = texel[2] * TEXEL_SCALE;
+	result[3] = texel[3] * TEXEL_SCALE;
+}
+
+TextureCubemapSoftware::TextureCubemapSoftware(
+	DeviceSoftware& device,
+	u32 id,
+	const TextureData& minusXData,
+	const TextureData& plusXData,
+	const TextureData& minusYData,
+	const TextureData& plusYData,
+	const TextureData& minusZData,
+	const TextureData& plusZData,
+	const TextureParameters& parameters) :
+
+	TextureTSoftware<TextureCubemap>(device, id, parameters)
+{
+	checkCubemapFace(minusXData);
+	checkCubemapFace(plusXData);
+	checkCubemapFace(minusYData);
+	checkCubemapFace(plusYData);
+	checkCubemapFace(minusZData);
+	checkCubemapFace(plusZData);
+}
+
+void TextureCubemapSoftware::bind(u32 slot) const noexcept
+{
+	mDevice.setTexture(nullptr, slot);
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,192 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <vector>
+
+#include "engine/core/Check.h"
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/texture/Texture2.h"
+#include "engine/graphics/texture/TextureCubemap.h"
+
+namespace gltut
+{
+// Forward declarations
+class DeviceSoftware;
+
+// Global classes
+/// Template class for textures stored in the system memory
+template <typename TextureInterfaceType>
+class TextureTSoftware : public TextureInterfaceType, public NonCopyable
+{
+public:
+	/// Constructor
+	TextureTSoftware(
+		DeviceSoftware& device,
+		u32 id,
+		const TextureParameters& parameters) noexcept :
+
+		mDevice(device),
+		mId(id),
+		mParameters(parameters)
+	{
+	}
+
+	/// Returns the texture id
+	u32 getId() const noexcept final
+	{
+		return mId;
+	}
+
+	/// Returns the texture parameters
+	const TextureParameters& getParameters() const noexcept final
+	{
+		return mParameters;
+	}
+
+	/// Sets the texture parameters
+	void setParameters(const TextureParameters& parameters) noexcept final
+	{
+		mParameters = parameters;
+	}
+
+	/// Returns 0, the software device does not support the bindless textures
+	u64 getBindlessHandle() const noexcept final
+	{
+		return 0;
+	}
+
+protected:
+	/// The device
+	DeviceSoftware& mDevice;
+
+private:
+	/// Texture ID
+	u32 mId;
+
+	/// Texture parameters
+	TextureParameters mParameters;
+};
+
+/**
+	\brief 2D texture stored in the system memory.
+	R, RGB and RGBA textures are stored as RGBA8 texels,
+	FLOAT textures are stored as 32-bit floats.
+	The rows go from the bottom to the top, as in OpenGL.
+*/
+class Texture2Software final : public TextureTSoftware<Texture2>
+{
+public:
+	/**
+		Constructor
+		\throw std::runtime_error If the texture size is 0
+	*/
+	Texture2Software(
+		DeviceSoftware& device,
+		u32 id,
+		const TextureData& data,
+		const TextureParameters& parameters);
+
+	/// Destructor
+	~Texture2Software() noexcept final;
+
+	/// Returns the texture size
+	const Point2u& getSize() const noexcept final
+	{
+		return mSize;
+	}
+
+	/// Returns the texture format
+	TextureFormat getFormat() const noexcept final
+	{
+		return mFormat;
+	}
+
+	/// Sets the size of the texture
+	void setSize(const Point2u& size) noexcept final;
+
+	/// Binds the texture to a slot of the device
+	void bind(u32 slot) const noexcept final;
+
+	/// Returns the RGBA8 texels, nullptr for FLOAT textures
+	u8* getColorData() noexcept
+	{
+		return mFormat == TextureFormat::FLOAT ? nullptr : mColor.data();
+	}
+
+	/// Returns the RGBA8 texels, nullptr for FLOAT textures
+	const u8* getColorData() const noexcept
+	{
+		return mFormat == TextureFormat::FLOAT ? nullptr : mColor.data();
+	}
+
+	/// Returns the float texels, nullptr for non-FLOAT textures
+	float* getDepthData() noexcept
+	{
+		return mFormat == TextureFormat::FLOAT ? mDepth.data() : nullptr;
+	}
+
+	/// Returns the float texels, nullptr for non-FLOAT textures
+	const float* getDepthData() const noexcept
+	{
+		return mFormat == TextureFormat::FLOAT ? mDepth.data() : nullptr;
+	}
+
+	/**
+		\brief Samples the texture at the texture coordinates.
+		There are no mipmaps, the level 0 is sampled with the magnification filter.
+		\param result The sampled RGBA value
+	*/
+	void sample(float u, float v, float* result) const noexcept;
+
+private:
+	/// Allocates the texel storage of the current size and format
+	void allocate();
+
+	/// Returns the RGBA value of a texel
+	void fetch(int32 x, int32 y, float* result) const noexcept;
+
+	/// Texture size
+	Point2u mSize;
+
+	/// Texture format
+	TextureFormat mFormat;
+
+	/// The RGBA8 texels
+	std::vector<u8> mColor;
+
+	/// The float texels
+	std::vector<float> mDepth;
+};
+
+/**
+	\brief Cubemap texture of the software device.
+	The data is validated but not stored, the cubemaps are not sampled.
+*/
+class TextureCubemapSoftware final : public TextureTSoftware<TextureCubemap>
+{
+public:
+	/**
+		Constructor
+		\throw std::runtime_error If the data of a face is null or has 0 size
+	*/
+	TextureCubemapSoftware(
+		DeviceSoftware& device,
+		u32 id,
+		const TextureData& minusXData,
+		const TextureData& plusXData,
+		const TextureData& minusYData,
+		const TextureData& plusYData,
+		const TextureData& minusZData,
+		const TextureData& plusZData,
+		const TextureParameters& parameters);
+
+	/// Unbinds the 2D texture of the slot
+	void bind(u32 slot) const noexcept final;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,104 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "ShaderFunctionsSoftware.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local classes
+/// Depth-only rendering of a draw call
+class DepthInvocationSoftware final : public ShaderInvocationSoftware
+{
+public:
+	/// Constructor
+	explicit DepthInvocationSoftware(const Matrix4Software& modelViewProjection) noexcept :
+
+		ShaderInvocationSoftware(0),
+		mModelViewProjection(modelViewProjection)
+	{
+	}
+
+	/// Returns false, only the depth is written
+	bool hasColorOutput() const noexcept final
+	{
+		return false;
+	}
+
+	/// Transforms the position
+	void processVertex(
+		const VertexSoftware& vertex,
+		float* position,
+		float*) const noexcept final
+	{
+		const float* inPos = vertex.attributes[0];
+		transformPoint(mModelViewProjection, inPos[0], inPos[1], inPos[2], position);
+	}
+
+	/// Accepts the fragment
+	bool processFragment(
+		const float*,
+		float*) const noexcept final
+	{
+		return true;
+	}
+
+private:
+	/// The model-view-projection matrix
+	Matrix4Software mModelViewProjection;
+};
+
+/// Port of the depth shader
+class DepthProgramSoftware final : public ShaderProgramSoftware
+{
+public:
+	/// Constructor
+	explicit DepthProgramSoftware(ShaderSoftware& shader) noexcept :
+
+		mMatrices(getMatrixSourceLocations(shader)),
+		mView(shader.getParameterLocation("view")),
+		mProjection(shader.getParameterLocation("projection"))
+	{
+	}
+
+	/// Creates the invocation for a draw call
+	std::unique_ptr<ShaderInvocationSoftware> createInvocation(
+		const ShaderSoftware& shader,
+		const ShaderStateSoftware& state) const final
+	{
+		// The same product as of the Phong program, so the depth pre-pass matches its depth exactly
+		return std::make_unique<DepthInvocationSoftware>(
+			multiply(
+				multiply(getMatrix4(shader, mProjection), getMatrix4(shader, mView)),
+				getModelMatrix(shader, state, mMatrices)));
+	}
+
+private:
+	/// The locations of the model matrix parameters
+	MatrixSourceLocations mMatrices;
+
+	/// The location of the view matrix
+	int32 mView;
+
+	/// The location of the projection matrix
+	int32 mProjection;
+};
+
+// End of the anonymous namespace
+}
+
+// Global functions
+std::unique_ptr<ShaderProgramSoftware> createDepthProgramSoftware(
+	ShaderSoftware& shader,
+	const char*,
+	const char*)
+{
+	return std::make_unique<DepthProgramSoftware>(shader);
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,117 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "ShaderFunctionsSoftware.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local classes
+/// Flat color shading of a draw call
+class FlatColorInvocationSoftware final : public ShaderInvocationSoftware
+{
+public:
+	/// Constructor
+	FlatColorInvocationSoftware(
+		const Matrix4Software& modelViewProjection,
+		const Texture2Software* colorTexture,
+		float transparencyThreshold) noexcept :
+
+		ShaderInvocationSoftware(2),
+		mModelViewProjection(modelViewProjection),
+		mColorTexture(colorTexture),
+		mTransparencyThreshold(transparencyThreshold)
+	{
+	}
+
+	/// Transforms the position and passes the texture coordinates
+	void processVertex(
+		const VertexSoftware& vertex,
+		float* position,
+		float* varyings) const noexcept final
+	{
+		const float* inPos = vertex.attributes[0];
+		transformPoint(mModelViewProjection, inPos[0], inPos[1], inPos[2], position);
+		varyings[0] = vertex.attributes[2][0];
+		varyings[1] = vertex.attributes[2][1];
+	}
+
+	/// Samples the color texture
+	bool processFragment(
+		const float* varyings,
+		float* color) const noexcept final
+	{
+		sampleTexture(mColorTexture, varyings[0], varyings[1], color);
+		return mTransparencyThreshold == 0.0f || color[3] >= mTransparencyThreshold;
+	}
+
+private:
+	/// The model-view-projection matrix
+	Matrix4Software mModelViewProjection;
+
+	/// The color texture
+	const Texture2Software* mColorTexture;
+
+	/// The alpha threshold of the discarded fragments, 0 to disable
+	float mTransparencyThreshold;
+};
+
+/// Port of the flat color shader
+class FlatColorProgramSoftware final : public ShaderProgramSoftware
+{
+public:
+	/// Constructor
+	explicit FlatColorProgramSoftware(ShaderSoftware& shader) noexcept :
+
+		mMatrices(getMatrixSourceLocations(shader)),
+		mColorSampler(shader.getParameterLocation("colorSampler")),
+		mTransparencyThreshold(shader.getParameterLocation("transparencyThreshold")),
+		mViewProjection(shader.getUniformBlockIndex("ViewProjection"))
+	{
+	}
+
+	/// Creates the invocation for a draw call
+	std::unique_ptr<ShaderInvocationSoftware> createInvocation(
+		const ShaderSoftware& shader,
+		const ShaderStateSoftware& state) const final
+	{
+		return std::make_unique<FlatColorInvocationSoftware>(
+			multiply(
+				getViewProjection(shader, state, mViewProjection),
+				getModelMatrix(shader, state, mMatrices)),
+			getSamplerTexture(shader, state, mColorSampler),
+			shader.getParameter(mTransparencyThreshold).values[0]);
+	}
+
+private:
+	/// The locations of the model matrix parameters
+	MatrixSourceLocations mMatrices;
+
+	/// The location of the color sampler
+	int32 mColorSampler;
+
+	/// The location of the transparency threshold
+	int32 mTransparencyThreshold;
+
+	/// The index of the view-projection uniform block
+	int32 mViewProjection;
+};
+
+// End of the anonymous namespace
+}
+
+// Global functions
+std::unique_ptr<ShaderProgramSoftware> createFlatColorProgramSoftware(
+	ShaderSoftware& shader,
+	const char*,
+	const char*)
+{
+	return std::make_unique<FlatColorProgramSoftware>(shader);
+}
+
+// End of the namespace gltut
+}
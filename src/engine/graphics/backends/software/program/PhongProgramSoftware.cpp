@@ -0,0 +1,941 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "ShaderFunctionsSoftware.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The number of varyings of the position, the normal and the texture coordinates
+constexpr u32 BASE_VARYINGS = 8;
+
+/// The number of varyings of the tangent space: TBN matrix, view position and position
+constexpr u32 TANGENT_SPACE_VARYINGS = 15;
+
+/// The number of varyings of a shadow space position
+constexpr u32 SHADOW_VARYINGS = 4;
+
+/// The minimum number of the parallax mapping layers
+constexpr float PARALLAX_MIN_LAYERS = 8.0f;
+
+/// The maximum number of the parallax mapping layers
+constexpr float PARALLAX_MAX_LAYERS = 32.0f;
+
+/// The limit of the parallax mapping steps, for the depth maps with values above 1
+constexpr u32 PARALLAX_MAX_STEPS = 64;
+
+// Local classes
+/// The light colors
+struct LightColorSoftware
+{
+	Vector3 ambient;
+	Vector3 diffuse;
+	Vector3 specular;
+};
+
+/// The directional light uniforms
+struct DirectionalLightSoftware
+{
+	LightColorSoftware color;
+	Vector3 dir;
+	Matrix4Software shadowMatrix;
+	const Texture2Software* shadowMap;
+};
+
+/// The point light uniforms
+struct PointLightSoftware
+{
+	LightColorSoftware color;
+	Vector3 pos;
+	float linAttenuation;
+	float quadAttenuation;
+};
+
+/// The spot light uniforms
+struct SpotLightSoftware
+{
+	LightColorSoftware color;
+	Vector3 pos;
+	Vector3 dir;
+	float innerAngleCos;
+	float outerAngleCos;
+	float linAttenuation;
+	float quadAttenuation;
+	Matrix4Software shadowMatrix;
+	float shadowNear;
+	float shadowFar;
+	const Texture2Software* shadowMap;
+};
+
+/// The locations of the light color uniforms
+struct LightColorLocations
+{
+	int32 ambient;
+	int32 diffuse;
+	int32 specular;
+};
+
+/// The locations of the directional light uniforms
+struct DirectionalLightLocations
+{
+	LightColorLocations color;
+	int32 dir;
+	int32 shadowMatrix;
+};
+
+/// The locations of the point light uniforms
+struct PointLightLocations
+{
+	LightColorLocations color;
+	int32 pos;
+	int32 linAttenuation;
+	int32 quadAttenuation;
+};
+
+/// The locations of the spot light uniforms
+struct SpotLightLocations
+{
+	LightColorLocations color;
+	int32 pos;
+	int32 dir;
+	int32 innerAngleCos;
+	int32 outerAngleCos;
+	int32 linAttenuation;
+	int32 quadAttenuation;
+	int32 shadowMatrix;
+	int32 shadowNear;
+	int32 shadowFar;
+};
+
+/// The clustered lights, see LightClusters
+struct ClusteredLightsSoftware
+{
+	/// The number of the clusters along the screen width, the screen height and the view depth
+	u32 countX;
+	u32 countY;
+	u32 countZ;
+	Matrix4Software viewProjection;
+	float viewDepth[4];
+	float depthSlicing[4];
+	Vector3 ambient;
+
+	/// The light lists of the clusters: the offset in the low 16 bits, the count in the high ones
+	std::vector<u32> ranges;
+
+	/// The light indices of the lists
+	std::vector<u16> lightIndices;
+
+	/// The packed lights, 16 floats per light
+	std::vector<float> lights;
+};
+
+/// The locations of the clustered lights blocks
+struct ClusteredLightsLocations
+{
+	int32 lightsBlock;
+	int32 clustersBlock;
+	int32 viewProjection;
+	int32 viewDepth;
+	int32 depthSlicing;
+	int32 ambient;
+	int32 ranges;
+	int32 lightIndices;
+};
+
+/// The material and transformation uniforms
+struct PhongUniformsSoftware
+{
+	Matrix4Software model;
+	Matrix4Software modelViewProjection;
+	Matrix3Software normalMat;
+	Vector3 viewPos;
+	const Texture2Software* diffuseTexture;
+	const Texture2Software* specularTexture;
+	const Texture2Software* normalTexture;
+	const Texture2Software* depthTexture;
+	bool normalMap;
+	float depthScale;
+	float shininess;
+	float minShadowMapBias;
+	float maxShadowMapBias;
+};
+
+// Local functions
+/// Returns the value of a "#define <name> <value>" line of a shader source
+u32 getDefinition(const char* source, const char* name)
+{
+	const std::string definition = std::string("#define ") + name + " ";
+	const char* found = std::strstr(source, definition.c_str());
+	GLTUT_CHECK(found != nullptr, "Phong shader definition is not found: " + std::string(name));
+	return static_cast<u32>(std::strtoul(found + definition.size(), nullptr, 10));
+}
+
+/// Returns the clustered lights of a draw call, reads only the used parts of the blocks
+std::unique_ptr<ClusteredLightsSoftware> getClusteredLights(
+	const ShaderSoftware& shader,
+	const ShaderStateSoftware& state,
+	const ClusteredLightsLocations& locations,
+	u32 countX,
+	u32 countY,
+	u32 countZ)
+{
+	auto result = std::make_unique<ClusteredLightsSoftware>();
+	result->countX = countX;
+	result->countY = countY;
+	result->countZ = countZ;
+
+	const int32 block = locations.clustersBlock;
+	getUniformBlockData(shader, state, block, locations.viewProjection,
+		result->viewProjection.data(), sizeof(result->viewProjection));
+	getUniformBlockData(shader, state, block, locations.viewDepth,
+		result->viewDepth, sizeof(result->viewDepth));
+	getUniformBlockData(shader, state, block, locations.depthSlicing,
+		result->depthSlicing, sizeof(result->depthSlicing));
+
+	float ambient[4];
+	getUniformBlockData(shader, state, block, locations.ambient, ambient, sizeof(ambient));
+	result->ambient = {ambient[0], ambient[1], ambient[2]};
+
+	result->ranges.resize(countX * countY * countZ);
+	getUniformBlockData(shader, state, block, locations.ranges,
+		result->ranges.data(), static_cast<u32>(result->ranges.size() * sizeof(u32)));
+
+	u32 indexCount = 0;
+	for (const u32 range : result->ranges)
+	{
+		indexCount = std::max(indexCount, (range & 0xFFFFu) + (range >> 16));
+	}
+	result->lightIndices.resize(indexCount);
+	getUniformBlockData(shader, state, block, locations.lightIndices,
+		result->lightIndices.data(), indexCount * static_cast<u32>(sizeof(u16)));
+
+	u32 lightCount = 0;
+	for (const u16 light : result->lightIndices)
+	{
+		lightCount = std::max(lightCount, static_cast<u32>(light) + 1);
+	}
+	result->lights.resize(lightCount * 16);
+	getUniformBlockData(shader, state, locations.lightsBlock, 0,
+		result->lights.data(), static_cast<u32>(result->lights.size() * sizeof(float)));
+	return result;
+}
+
+/// Returns the locations of the light color uniforms
+LightColorLocations getColorLocations(const ShaderSoftware& shader, const std::string& prefix)
+{
+	return {
+		shader.getParameterLocation((prefix + ".color.ambient").c_str()),
+		shader.getParameterLocation((prefix + ".color.diffuse").c_str()),
+		shader.getParameterLocation((prefix + ".color.specular").c_str())};
+}
+
+/// Returns the light colors
+LightColorSoftware getColor(const ShaderSoftware& shader, const LightColorLocations& locations) noexcept
+{
+	return {
+		getVector3(shader, locations.ambient),
+		getVector3(shader, locations.diffuse),
+		getVector3(shader, locations.specular)};
+}
+
+/// Returns the depth of a shadow map, 0 for a missing map as in OpenGL
+float getShadowMapDepth(const Texture2Software* shadowMap, float u, float v) noexcept
+{
+	float result[4];
+	sampleTexture(shadowMap, u, v, result);
+	return result[0];
+}
+
+/// Returns the depth of a perspective projection in the linear scale
+float linearizeDepth(float depth, float zNear, float zFar) noexcept
+{
+	return (zNear * (zFar / (zFar + depth * (zNear - zFar)) - 1.0f)) / (zFar - zNear);
+}
+
+/**
+	\brief Returns the fraction of the lit 3x3 shadow map samples.
+	\param perspective If the shadow map depth is a perspective one
+*/
+float getShadowFactor(
+	const float* shadowSpacePos,
+	const Texture2Software* shadowMap,
+	float normalLightDot,
+	float minShadowMapBias,
+	float maxShadowMapBias,
+	bool perspective,
+	float zNear,
+	float zFar) noexcept
+{
+	if (shadowSpacePos[3] <= 0.0f)
+	{
+		return 1.0f;
+	}
+
+	const float bias = mix(minShadowMapBias, maxShadowMapBias, 1.0f - std::abs(normalLightDot));
+	const float scale = 0.5f / shadowSpacePos[3];
+	const float projX = shadowSpacePos[0] * scale + 0.5f;
+	const float projY = shadowSpacePos[1] * scale + 0.5f;
+	float projZ = shadowSpacePos[2] * scale + 0.5f;
+	if (perspective)
+	{
+		projZ = linearizeDepth(projZ, zNear, zFar);
+	}
+
+	const float texelX = shadowMap != nullptr ? 1.0f / static_cast<float>(shadowMap->getSize().x) : 0.0f;
+	const float texelY = shadowMap != nullptr ? 1.0f / static_cast<float>(shadowMap->getSize().y) : 0.0f;
+	float shadow = 0.0f;
+	for (int32 x = -1; x <= 1; ++x)
+	{
+		for (int32 y = -1; y <= 1; ++y)
+		{
+			float closestDepth = getShadowMapDepth(
+				shadowMap,
+				projX + static_cast<float>(x) * texelX,
+				projY + static_cast<float>(y) * texelY);
+			if (perspective)
+			{
+				closestDepth = linearizeDepth(closestDepth, zNear, zFar);
+			}
+			shadow += projZ - bias < closestDepth ? 1.0f : 0.0f;
+		}
+	}
+	return shadow * (1.0f / 9.0f);
+}
+
+/// Phong shading of a draw call
+class PhongInvocationSoftware final : public ShaderInvocationSoftware
+{
+public:
+	/// Constructor
+	PhongInvocationSoftware(
+		u32 varyingCount,
+		bool tangentSpace,
+		const PhongUniformsSoftware& uniforms,
+		std::vector<DirectionalLightSoftware>&& directionalLights,
+		std::vector<PointLightSoftware>&& pointLights,
+		std::vector<SpotLightSoftware>&& spotLights,
+		std::unique_ptr<ClusteredLightsSoftware>&& clusteredLights) noexcept :
+
+		ShaderInvocationSoftware(varyingCount),
+		mTangentSpace(tangentSpace),
+		mShadowOffset(BASE_VARYINGS + (tangentSpace ? TANGENT_SPACE_VARYINGS : 0)),
+		mUniforms(uniforms),
+		mDirectionalLights(std::move(directionalLights)),
+		mPointLights(std::move(pointLights)),
+		mSpotLights(std::move(spotLights)),
+		mClusteredLights(std::move(clusteredLights))
+	{
+	}
+
+	/// Port of the vertex shader
+	void processVertex(
+		const VertexSoftware& vertex,
+		float* position,
+		float* varyings) const noexcept final
+	{
+		const float* inPos = vertex.attributes[0];
+		float modelPos[4];
+		transformPoint(mUniforms.model, inPos[0], inPos[1], inPos[2], modelPos);
+		transformPoint(mUniforms.modelViewProjection, inPos[0], inPos[1], inPos[2], position);
+
+		const Vector3 normal = transformVector(mUniforms.normalMat, vertex.attributes[1]);
+		varyings[0] = modelPos[0];
+		varyings[1] = modelPos[1];
+		varyings[2] = modelPos[2];
+		varyings[3] = normal.x;
+		varyings[4] = normal.y;
+		varyings[5] = normal.z;
+		varyings[6] = vertex.attributes[2][0];
+		varyings[7] = vertex.attributes[2][1];
+
+		if (mTangentSpace)
+		{
+			const Vector3 pos(modelPos[0], modelPos[1], modelPos[2]);
+			const Vector3 tbn[3] = {
+				transformVector(mUniforms.normalMat, vertex.attributes[3]),
+				transformVector(mUniforms.normalMat, vertex.attributes[4]),
+				normal};
+
+			float* tangentSpace = varyings + BASE_VARYINGS;
+			for (u32 i = 0; i < 3; ++i)
+			{
+				tangentSpace[i * 3] = tbn[i].x;
+				tangentSpace[i * 3 + 1] = tbn[i].y;
+				tangentSpace[i * 3 + 2] = tbn[i].z;
+				// The transposed TBN matrix transforms to the tangent space
+				tangentSpace[9 + i] = tbn[i].dot(mUniforms.viewPos);
+				tangentSpace[12 + i] = tbn[i].dot(pos);
+			}
+		}
+
+		float* shadowSpacePos = varyings + mShadowOffset;
+		for (const auto& light : mDirectionalLights)
+		{
+			transformPoint(light.shadowMatrix, modelPos[0], modelPos[1], modelPos[2], shadowSpacePos);
+			shadowSpacePos += SHADOW_VARYINGS;
+		}
+
+		for (const auto& light : mSpotLights)
+		{
+			transformPoint(light.shadowMatrix, modelPos[0], modelPos[1], modelPos[2], shadowSpacePos);
+			shadowSpacePos += SHADOW_VARYINGS;
+		}
+	}
+
+	/// Port of the fragment shader
+	bool processFragment(
+		const float* varyings,
+		float* color) const noexcept final
+	{
+		const Vector3 pos(varyings[0], varyings[1], varyings[2]);
+		const Vector3 normal(varyings[3], varyings[4], varyings[5]);
+		float u = varyings[6];
+		float v = varyings[7];
+		const float* tangentSpace = varyings + BASE_VARYINGS;
+
+		if (mUniforms.depthScale > 0.0f)
+		{
+			const Vector3 viewDir = (Vector3(tangentSpace[9], tangentSpace[10], tangentSpace[11]) -
+				Vector3(tangentSpace[12], tangentSpace[13], tangentSpace[14])).getNormalized();
+			parallaxMapping(viewDir, u, v);
+			if (u < 0.0f || u > 1.0f || v < 0.0f || v > 1.0f)
+			{
+				return false;
+			}
+		}
+
+		Vector3 norm;
+		if (mUniforms.normalMap)
+		{
+			const Vector3 mapNormal = sampleTextureRgb(mUniforms.normalTexture, u, v) * 2.0f -
+				Vector3(1.0f, 1.0f, 1.0f);
+			norm = (Vector3(tangentSpace[0], tangentSpace[1], tangentSpace[2]) * mapNormal.x +
+				Vector3(tangentSpace[3], tangentSpace[4], tangentSpace[5]) * mapNormal.y +
+				Vector3(tangentSpace[6], tangentSpace[7], tangentSpace[8]) * mapNormal.z).getNormalized();
+		}
+		else
+		{
+			norm = normal.getNormalized();
+		}
+
+		const Vector3 viewDir = (mUniforms.viewPos - pos).getNormalized();
+		const Vector3 geomDiffuse = sampleTextureRgb(mUniforms.diffuseTexture, u, v);
+		const Vector3 geomSpecular = sampleTextureRgb(mUniforms.specularTexture, u, v);
+		Vector3 result(0.0f, 0.0f, 0.0f);
+
+		const float* shadowSpacePos = varyings + mShadowOffset;
+		for (const auto& light : mDirectionalLights)
+		{
+			result += multiply(light.color.ambient, geomDiffuse);
+
+			const Vector3 lightDir = -light.dir;
+			const float normalLightDot = norm.dot(lightDir);
+			const Vector3 diffuse = multiply(light.color.diffuse, geomDiffuse) * std::max(0.0f, normalLightDot);
+			const Vector3 specular = multiply(light.color.specular, geomSpecular) *
+				getSpecular(lightDir, norm, viewDir);
+
+			result += (diffuse + specular) * getShadowFactor(
+				shadowSpacePos,
+				light.shadowMap,
+				normalLightDot,
+				mUniforms.minShadowMapBias,
+				mUniforms.maxShadowMapBias,
+				false,
+				0.0f,
+				0.0f);
+			shadowSpacePos += SHADOW_VARYINGS;
+		}
+
+		for (const auto& light : mPointLights)
+		{
+			const Vector3 ambient = multiply(light.color.ambient, geomDiffuse);
+
+			Vector3 lightDir = light.pos - pos;
+			const float distance = lightDir.length();
+			lightDir /= distance;
+			const Vector3 diffuse = multiply(light.color.diffuse, geomDiffuse) * std::max(0.0f, norm.dot(lightDir));
+			const Vector3 specular = multiply(light.color.specular, geomSpecular) *
+				getSpecular(lightDir, norm, viewDir);
+
+			const float attenuation = 1.0f / (
+				1.0f +
+				light.linAttenuation * distance +
+				light.quadAttenuation * distance * distance);
+
+			result += ambient + (diffuse + specular) * attenuation;
+		}
+
+		for (const auto& light : mSpotLights)
+		{
+			result += multiply(light.color.ambient, geomDiffuse);
+
+			Vector3 lightDir = light.pos - pos;
+			const float distance = lightDir.length();
+			lightDir /= distance;
+
+			const float theta = (-lightDir).dot(light.dir);
+			if (theta > light.outerAngleCos)
+			{
+				const float intensity = std::clamp(
+					(theta - light.outerAngleCos) / (light.innerAngleCos - light.outerAngleCos),
+					0.0f,
+					1.0f);
+
+				const float normalLightDot = norm.dot(lightDir);
+				const Vector3 diffuse = multiply(light.color.diffuse, geomDiffuse) * std::max(0.0f, normalLightDot);
+				const Vector3 specular = multiply(light.color.specular, geomSpecular) *
+					getSpecular(lightDir, norm, viewDir);
+
+				const float attenuation = 1.0f / (
+					1.0f +
+					light.linAttenuation * distance +
+					light.quadAttenuation * distance * distance);
+
+				const float shadowFactor = getShadowFactor(
+					shadowSpacePos,
+					light.shadowMap,
+					normalLightDot,
+					mUniforms.minShadowMapBias,
+					mUniforms.maxShadowMapBias,
+					true,
+					light.shadowNear,
+					light.shadowFar);
+				result += (diffuse + specular) * (intensity * attenuation * shadowFactor);
+			}
+			shadowSpacePos += SHADOW_VARYINGS;
+		}
+
+		if (mClusteredLights != nullptr)
+		{
+			result += getClusteredLighting(pos, norm, viewDir, geomDiffuse, geomSpecular);
+		}
+
+		color[0] = result.x;
+		color[1] = result.y;
+		color[2] = result.z;
+		color[3] = 1.0f;
+		return true;
+	}
+
+private:
+	/// Returns the component-wise product of two vectors
+	static Vector3 multiply(const Vector3& first, const Vector3& second) noexcept
+	{
+		return {first.x * second.x, first.y * second.y, first.z * second.z};
+	}
+
+	/// Returns the specular factor of a light
+	float getSpecular(
+		const Vector3& lightDir,
+		const Vector3& norm,
+		const Vector3& viewDir) const noexcept
+	{
+		const Vector3 reflectDir = reflect(-lightDir, norm);
+		return std::pow(std::max(viewDir.dot(reflectDir), 0.0f), mUniforms.shininess);
+	}
+
+	/// Returns the lighting of the lights of the cluster of a fragment
+	Vector3 getClusteredLighting(
+		const Vector3& pos,
+		const Vector3& norm,
+		const Vector3& viewDir,
+		const Vector3& geomDiffuse,
+		const Vector3& geomSpecular) const noexcept
+	{
+		const ClusteredLightsSoftware& clusters = *mClusteredLights;
+		Vector3 result = multiply(clusters.ambient, geomDiffuse);
+
+		float clusterPos[4];
+		transformPoint(clusters.viewProjection, pos.x, pos.y, pos.z, clusterPos);
+		const float depth =
+			clusters.viewDepth[0] * pos.x +
+			clusters.viewDepth[1] * pos.y +
+			clusters.viewDepth[2] * pos.z +
+			clusters.viewDepth[3];
+		if (clusterPos[3] <= 0.0f || depth <= 0.0f)
+		{
+			return result;
+		}
+
+		const auto getCell = [](float value, u32 count)
+		{
+			return static_cast<u32>(std::clamp(
+				std::floor(value),
+				0.0f,
+				static_cast<float>(count - 1)));
+		};
+		const u32 tileX = getCell(
+			(clusterPos[0] / clusterPos[3] * 0.5f + 0.5f) * static_cast<float>(clusters.countX),
+			clusters.countX);
+		const u32 tileY = getCell(
+			(clusterPos[1] / clusterPos[3] * 0.5f + 0.5f) * static_cast<float>(clusters.countY),
+			clusters.countY);
+		const u32 slice = getCell(
+			std::log(depth) * clusters.depthSlicing[0] + clusters.depthSlicing[1],
+			clusters.countZ);
+		const u32 range = clusters.ranges[tileX + clusters.countX * (tileY + clusters.countY * slice)];
+
+		const u32 end = (range & 0xFFFFu) + (range >> 16);
+		for (u32 i = range & 0xFFFFu; i < end; ++i)
+		{
+			const float* light = clusters.lights.data() + 16 * clusters.lightIndices[i];
+			Vector3 lightDir = Vector3(light[0], light[1], light[2]) - pos;
+			const float distance = lightDir.length();
+			lightDir /= distance;
+
+			// A point light has the zero direction and the outer cosine below -1
+			const float theta = (-lightDir).dot(Vector3(light[4], light[5], light[6]));
+			if (theta > light[11])
+			{
+				const float intensity = std::clamp((theta - light[11]) / (light[7] - light[11]), 0.0f, 1.0f);
+				const Vector3 diffuse = multiply(Vector3(light[8], light[9], light[10]), geomDiffuse) *
+					std::max(0.0f, norm.dot(lightDir));
+				const Vector3 specular = multiply(Vector3(light[12], light[13], light[14]), geomSpecular) *
+					getSpecular(lightDir, norm, viewDir);
+
+				const float attenuation = 1.0f / (1.0f + light[15] * distance + light[3] * distance * distance);
+				result += (diffuse + specular) * (intensity * attenuation);
+			}
+		}
+		return result;
+	}
+
+	/// Offsets the texture coordinates by the depth map
+	void parallaxMapping(const Vector3& viewDir, float& u, float& v) const noexcept
+	{
+		const float depthStep = 1.0f / mix(PARALLAX_MAX_LAYERS, PARALLAX_MIN_LAYERS, std::abs(viewDir.z));
+		const float deltaU = viewDir.x * mUniforms.depthScale * depthStep / viewDir.z;
+		const float deltaV = viewDir.y * mUniforms.depthScale * depthStep / viewDir.z;
+
+		float curDepth = 0.0f;
+		float curU = u;
+		float curV = v;
+		float curDepthMapValue = getDepth(curU, curV);
+		for (u32 i = 0; i < PARALLAX_MAX_STEPS && curDepth < curDepthMapValue; ++i)
+		{
+			curU -= deltaU;
+			curV -= deltaV;
+			curDepthMapValue = getDepth(curU, curV);
+			curDepth += depthStep;
+		}
+
+		const float prevU = curU + deltaU;
+		const float prevV = curV + deltaV;
+		const float depthAfter = curDepthMapValue - curDepth;
+		const float depthBefore = getDepth(prevU, prevV) - curDepth + depthStep;
+		const float weight = depthBefore / (depthBefore - depthAfter);
+		u = mix(prevU, curU, weight);
+		v = mix(prevV, curV, weight);
+	}
+
+	/// Returns the value of the depth map
+	float getDepth(float u, float v) const noexcept
+	{
+		float result[4];
+		sampleTexture(mUniforms.depthTexture, u, v, result);
+		return result[0];
+	}
+
+	/// If the tangent space varyings are passed
+	bool mTangentSpace;
+
+	/// The offset of the shadow space positions in the varyings
+	u32 mShadowOffset;
+
+	/// The material and transformation uniforms
+	PhongUniformsSoftware mUniforms;
+
+	/// The directional lights
+	std::vector<DirectionalLightSoftware> mDirectionalLights;
+
+	/// The point lights
+	std::vector<PointLightSoftware> mPointLights;
+
+	/// The spot lights
+	std::vector<SpotLightSoftware> mSpotLights;
+
+	/// The clustered lights, nullptr if the shader has no clustered lights
+	std::unique_ptr<ClusteredLightsSoftware> mClusteredLights;
+};
+
+/// Port of the Phong shader of PhongShaderModelC
+class PhongProgramSoftware final : public ShaderProgramSoftware
+{
+public:
+	/**
+		Constructor
+		\throw std::runtime_error If the light count definitions are not found
+		or the varyings exceed the limit
+	*/
+	PhongProgramSoftware(
+		ShaderSoftware& shader,
+		const char* fragmentShader) :
+
+		mMatrices(getMatrixSourceLocations(shader)),
+		mViewPos(shader.getParameterLocation("viewPos")),
+		mDiffuseSampler(shader.getParameterLocation("diffuseSampler")),
+		mSpecularSampler(shader.getParameterLocation("specularSampler")),
+		mNormalSampler(shader.getParameterLocation("normalSampler")),
+		mDepthSampler(shader.getParameterLocation("depthSampler")),
+		mMaterial(shader.getUniformBlockIndex("Material")),
+		mNormalMap(shader.getUniformBlockMemberOffset("Material", "normalMap")),
+		mDepthScale(shader.getUniformBlockMemberOffset("Material", "depthScale")),
+		mShininess(shader.getUniformBlockMemberOffset("Material", "shininess")),
+		mMinShadowMapBias(shader.getParameterLocation("minShadowMapBias")),
+		mMaxShadowMapBias(shader.getParameterLocation("maxShadowMapBias")),
+		mViewProjection(shader.getUniformBlockIndex("ViewProjection"))
+	{
+		const u32 directionalLights = getDefinition(fragmentShader, "MAX_DIRECTIONAL_LIGHTS");
+		const u32 pointLights = getDefinition(fragmentShader, "MAX_POINT_LIGHTS");
+		const u32 spotLights = getDefinition(fragmentShader, "MAX_SPOT_LIGHTS");
+		GLTUT_CHECK(
+			BASE_VARYINGS + TANGENT_SPACE_VARYINGS +
+					SHADOW_VARYINGS * (directionalLights + spotLights) <=
+				SOFTWARE_MAX_VARYINGS,
+			"Too many shadow casting lights for the software rasterizer");
+
+		for (u32 i = 0; i < directionalLights; ++i)
+		{
+			const std::string prefix = "directionalLights[" + std::to_string(i) + "]";
+			mDirectionalLights.push_back({
+				getColorLocations(shader, prefix),
+				shader.getParameterLocation((prefix + ".dir").c_str()),
+				shader.getParameterLocation((prefix + ".shadowMatrix").c_str())});
+		}
+
+		for (u32 i = 0; i < pointLights; ++i)
+		{
+			const std::string prefix = "pointLights[" + std::to_string(i) + "]";
+			mPointLights.push_back({
+				getColorLocations(shader, prefix),
+				shader.getParameterLocation((prefix + ".pos").c_str()),
+				shader.getParameterLocation((prefix + ".linAttenuation").c_str()),
+				shader.getParameterLocation((prefix + ".quadAttenuation").c_str())});
+		}
+
+		for (u32 i = 0; i < spotLights; ++i)
+		{
+			const std::string prefix = "spotLights[" + std::to_string(i) + "]";
+			mSpotLights.push_back({
+				getColorLocations(shader, prefix),
+				shader.getParameterLocation((prefix + ".pos").c_str()),
+				shader.getParameterLocation((prefix + ".dir").c_str()),
+				shader.getParameterLocation((prefix + ".innerAngleCos").c_str()),
+				shader.getParameterLocation((prefix + ".outerAngleCos").c_str()),
+				shader.getParameterLocation((prefix + ".linAttenuation").c_str()),
+				shader.getParameterLocation((prefix + ".quadAttenuation").c_str()),
+				shader.getParameterLocation((prefix + ".shadowMatrix").c_str()),
+				shader.getParameterLocation((prefix + ".shadowNear").c_str()),
+				shader.getParameterLocation((prefix + ".shadowFar").c_str())});
+		}
+
+		for (u32 i = 0; i < directionalLights + spotLights; ++i)
+		{
+			mShadowSamplers.push_back(shader.getParameterLocation(
+				("shadowSamplers[" + std::to_string(i) + "]").c_str()));
+		}
+
+		mClustered = std::strstr(fragmentShader, "#define CLUSTERED_LIGHTS") != nullptr;
+		if (mClustered)
+		{
+			mClusterCountX = getDefinition(fragmentShader, "CLUSTER_COUNT_X");
+			mClusterCountY = getDefinition(fragmentShader, "CLUSTER_COUNT_Y");
+			mClusterCountZ = getDefinition(fragmentShader, "CLUSTER_COUNT_Z");
+			GLTUT_CHECK(
+				mClusterCountX > 0 && mClusterCountY > 0 && mClusterCountZ > 0,
+				"Invalid cluster counts of the Phong shader");
+
+			mClusteredLights = {
+				shader.getUniformBlockIndex("ClusteredLights"),
+				shader.getUniformBlockIndex("LightClusters"),
+				shader.getUniformBlockMemberOffset("LightClusters", "clusterViewProjection"),
+				shader.getUniformBlockMemberOffset("LightClusters", "clusterViewDepth"),
+				shader.getUniformBlockMemberOffset("LightClusters", "clusterDepthSlicing"),
+				shader.getUniformBlockMemberOffset("LightClusters", "clusteredAmbient"),
+				shader.getUniformBlockMemberOffset("LightClusters", "clusterRanges"),
+				shader.getUniformBlockMemberOffset("LightClusters", "clusterLightIndices")};
+		}
+	}
+
+	/// Creates the invocation for a draw call
+	std::unique_ptr<ShaderInvocationSoftware> createInvocation(
+		const ShaderSoftware& shader,
+		const ShaderStateSoftware& state) const final
+	{
+		PhongUniformsSoftware uniforms;
+		getModelMatrices(shader, state, mMatrices, uniforms.model, uniforms.normalMat);
+		uniforms.modelViewProjection = multiply(
+			getViewProjection(shader, state, mViewProjection),
+			uniforms.model);
+		uniforms.viewPos = getVector3(shader, mViewPos);
+		uniforms.diffuseTexture = getSamplerTexture(shader, state, mDiffuseSampler);
+		uniforms.specularTexture = getSamplerTexture(shader, state, mSpecularSampler);
+		uniforms.normalTexture = getSamplerTexture(shader, state, mNormalSampler);
+		uniforms.depthTexture = getSamplerTexture(shader, state, mDepthSampler);
+		uniforms.normalMap = getUniformBlockValue<int32>(shader, state, mMaterial, mNormalMap) != 0;
+		uniforms.depthScale = getUniformBlockValue<float>(shader, state, mMaterial, mDepthScale);
+		uniforms.shininess = getUniformBlockValue<float>(shader, state, mMaterial, mShininess);
+		uniforms.minShadowMapBias = shader.getParameter(mMinShadowMapBias).values[0];
+		uniforms.maxShadowMapBias = shader.getParameter(mMaxShadowMapBias).values[0];
+
+		std::vector<DirectionalLightSoftware> directionalLights;
+		directionalLights.reserve(mDirectionalLights.size());
+		for (size_t i = 0; i < mDirectionalLights.size(); ++i)
+		{
+			const auto& locations = mDirectionalLights[i];
+			directionalLights.push_back({
+				getColor(shader, locations.color),
+				getVector3(shader, locations.dir),
+				getMatrix4(shader, locations.shadowMatrix),
+				getSamplerTexture(shader, state, mShadowSamplers[i])});
+		}
+
+		std::vector<PointLightSoftware> pointLights;
+		pointLights.reserve(mPointLights.size());
+		for (const auto& locations : mPointLights)
+		{
+			pointLights.push_back({
+				getColor(shader, locations.color),
+				getVector3(shader, locations.pos),
+				shader.getParameter(locations.linAttenuation).values[0],
+				shader.getParameter(locations.quadAttenuation).values[0]});
+		}
+
+		std::vector<SpotLightSoftware> spotLights;
+		spotLights.reserve(mSpotLights.size());
+		for (size_t i = 0; i < mSpotLights.size(); ++i)
+		{
+			const auto& locations = mSpotLights[i];
+			spotLights.push_back({
+				getColor(shader, locations.color),
+				getVector3(shader, locations.pos),
+				getVector3(shader, locations.dir),
+				shader.getParameter(locations.innerAngleCos).values[0],
+				shader.getParameter(locations.outerAngleCos).values[0],
+				shader.getParameter(locations.linAttenuation).values[0],
+				shader.getParameter(locations.quadAttenuation).values[0],
+				getMatrix4(shader, locations.shadowMatrix),
+				shader.getParameter(locations.shadowNear).values[0],
+				shader.getParameter(locations.shadowFar).values[0],
+				getSamplerTexture(shader, state, mShadowSamplers[mDirectionalLights.size() + i])});
+		}
+
+		// The tangent space is needed only for the normal and parallax mapping
+		const bool tangentSpace = uniforms.normalMap || uniforms.depthScale > 0.0f;
+		const u32 varyingCount =
+			BASE_VARYINGS +
+			(tangentSpace ? TANGENT_SPACE_VARYINGS : 0) +
+			SHADOW_VARYINGS * static_cast<u32>(directionalLights.size() + spotLights.size());
+
+		return std::make_unique<PhongInvocationSoftware>(
+			varyingCount,
+			tangentSpace,
+			uniforms,
+			std::move(directionalLights),
+			std::move(pointLights),
+			std::move(spotLights),
+			mClustered ?
+				getClusteredLights(
+					shader,
+					state,
+					mClusteredLights,
+					mClusterCountX,
+					mClusterCountY,
+					mClusterCountZ) :
+				nullptr);
+	}
+
+private:
+	/// The locations of the model and normal matrix parameters
+	MatrixSourceLocations mMatrices;
+
+	/// The location of the viewer position
+	int32 mViewPos;
+
+	/// The location of the diffuse sampler
+	int32 mDiffuseSampler;
+
+	/// The location of the specular sampler
+	int32 mSpecularSampler;
+
+	/// The location of the normal sampler
+	int32 mNormalSampler;
+
+	/// The location of the depth sampler
+	int32 mDepthSampler;
+
+	/// The index of the material uniform block
+	int32 mMaterial;
+
+	/// The offset of the normal mapping flag in the material block
+	int32 mNormalMap;
+
+	/// The offset of the parallax depth scale in the material block
+	int32 mDepthScale;
+
+	/// The offset of the shininess in the material block
+	int32 mShininess;
+
+	/// The location of the minimum shadow map bias
+	int32 mMinShadowMapBias;
+
+	/// The location of the maximum shadow map bias
+	int32 mMaxShadowMapBias;
+
+	/// The index of the view-projection uniform block
+	int32 mViewProjection;
+
+	/// The locations of the directional light uniforms
+	std::vector<DirectionalLightLocations> mDirectionalLights;
+
+	/// The locations of the point light uniforms
+	std::vector<PointLightLocations> mPointLights;
+
+	/// The locations of the spot light uniforms
+	std::vector<SpotLightLocations> mSpotLights;
+
+	/// The locations of the shadow samplers: directional lights, then spot lights
+	std::vector<int32> mShadowSamplers;
+
+	/// If the shader shades the clustered lights
+	bool mClustered = false;
+
+	/// The number of the clusters along the screen width
+	u32 mClusterCountX = 0;
+
+	/// The number of the clusters along the screen height
+	u32 mClusterCountY = 0;
+
+	/// The number of the clusters along the view depth
+	u32 mClusterCountZ = 0;
+
+	/// The locations of the clustered lights blocks
+	ClusteredLightsLocations mClusteredLights{};
+};
+
+// End of the anonymous namespace
+}
+
+// Global functions
+std::unique_ptr<ShaderProgramSoftware> createPhongProgramSoftware(
+	ShaderSoftware& shader,
+	const char*,
+	const char* fragmentShader)
+{
+	return std::make_unique<PhongProgramSoftware>(shader, fragmentShader);
+}
+
+// End of the namespace gltut
+}
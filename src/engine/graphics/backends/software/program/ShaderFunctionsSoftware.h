@@ -0,0 +1,306 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "engine/math/Vector3.h"
+
+#include "../ShaderSoftware.h"
+#include "../ShaderUniformBufferSoftware.h"
+#include "../TextureSoftware.h"
+
+namespace gltut
+{
+// Global types
+/// Column-major 4x4 matrix, as in GLSL
+using Matrix4Software = std::array<float, 16>;
+
+/// Column-major 3x3 matrix, as in GLSL
+using Matrix3Software = std::array<float, 9>;
+
+// Global functions
+/// Returns the product of two 4x4 matrices
+inline Matrix4Software multiply(
+	const Matrix4Software& first,
+	const Matrix4Software& second) noexcept
+{
+	Matrix4Software result;
+	for (u32 column = 0; column < 4; ++column)
+	{
+		for (u32 row = 0; row < 4; ++row)
+		{
+			float sum = 0.0f;
+			for (u32 i = 0; i < 4; ++i)
+			{
+				sum += first[i * 4 + row] * second[column * 4 + i];
+			}
+			result[column * 4 + row] = sum;
+		}
+	}
+	return result;
+}
+
+/// Transforms the point (x, y, z, 1) by a 4x4 matrix
+inline void transformPoint(
+	const Matrix4Software& matrix,
+	float x,
+	float y,
+	float z,
+	float* result) noexcept
+{
+	for (u32 row = 0; row < 4; ++row)
+	{
+		result[row] =
+			matrix[row] * x +
+			matrix[4 + row] * y +
+			matrix[8 + row] * z +
+			matrix[12 + row];
+	}
+}
+
+/// Transforms a vector by a 3x3 matrix
+inline Vector3 transformVector(
+	const Matrix3Software& matrix,
+	const float* vector) noexcept
+{
+	return {
+		matrix[0] * vector[0] + matrix[3] * vector[1] + matrix[6] * vector[2],
+		matrix[1] * vector[0] + matrix[4] * vector[1] + matrix[7] * vector[2],
+		matrix[2] * vector[0] + matrix[5] * vector[1] + matrix[8] * vector[2]};
+}
+
+/// Returns the reflection of an incident vector, as GLSL reflect
+inline Vector3 reflect(const Vector3& incident, const Vector3& normal) noexcept
+{
+	return incident - normal * (2.0f * normal.dot(incident));
+}
+
+/// Returns the linear interpolation of two values, as GLSL mix
+inline float mix(float first, float second, float t) noexcept
+{
+	return first + (second - first) * t;
+}
+
+/// Returns a parameter of a shader as a 4x4 matrix
+inline Matrix4Software getMatrix4(const ShaderSoftware& shader, int32 location) noexcept
+{
+	const auto& values = shader.getParameter(location).values;
+	Matrix4Software result;
+	std::copy(values.begin(), values.begin() + 16, result.begin());
+	return result;
+}
+
+/// Returns a parameter of a shader as a 3x3 matrix
+inline Matrix3Software getMatrix3(const ShaderSoftware& shader, int32 location) noexcept
+{
+	const auto& values = shader.getParameter(location).values;
+	Matrix3Software result;
+	std::copy(values.begin(), values.begin() + 9, result.begin());
+	return result;
+}
+
+/**
+	\brief Locations of the parameters selecting the model and normal matrices of a draw call,
+	see RendererBinding::MatrixSource
+*/
+struct MatrixSourceLocations
+{
+	/// The location of the model matrix
+	int32 model;
+
+	/// The location of the normal matrix
+	int32 normalMatrix;
+
+	/// The location of the matrix source
+	int32 matrixSource;
+
+	/// The index of the object uniform block
+	int32 objectBlock;
+};
+
+/// Returns the locations of the matrix source parameters with the standard names
+inline MatrixSourceLocations getMatrixSourceLocations(ShaderSoftware& shader) noexcept
+{
+	return {
+		shader.getParameterLocation("model"),
+		shader.getParameterLocation("normalMat"),
+		shader.getParameterLocation("matrixSource"),
+		shader.getUniformBlockIndex("Object")};
+}
+
+/**
+	\brief Returns the model and normal matrices of a draw call:
+	the instance attributes, the object buffer or the uniforms, by the matrix source parameter
+*/
+inline void getModelMatrices(
+	const ShaderSoftware& shader,
+	const ShaderStateSoftware& state,
+	const MatrixSourceLocations& locations,
+	Matrix4Software& model,
+	Matrix3Software& normalMatrix) noexcept
+{
+	const int source = shader.getParameter(locations.matrixSource).intValue;
+	if (source == 1 && state.instance != nullptr)
+	{
+		std::copy(state.instance->transform.data(), state.instance->transform.data() + 16, model.begin());
+		std::copy(state.instance->normalMatrix.data(), state.instance->normalMatrix.data() + 9, normalMatrix.begin());
+		return;
+	}
+
+	const u32 bindingPoint = shader.getUniformBlockBindingPoint(locations.objectBlock);
+	const ShaderUniformBufferSoftware* buffer = state.uniformBuffers[bindingPoint];
+	if (source == 2 && buffer != nullptr)
+	{
+		// std140: mat4, then mat3 with the columns padded to vec4
+		const u32 offset = state.uniformBufferOffsets[bindingPoint];
+		float data[28] = {};
+		buffer->getData(data, sizeof(data), offset);
+		std::copy(data, data + 16, model.begin());
+		for (u32 column = 0; column < 3; ++column)
+		{
+			std::copy(data + 16 + column * 4, data + 19 + column * 4, normalMatrix.begin() + column * 3);
+		}
+		return;
+	}
+
+	model = getMatrix4(shader, locations.model);
+	normalMatrix = getMatrix3(shader, locations.normalMatrix);
+}
+
+/// Returns the model matrix of a draw call, see getModelMatrices
+inline Matrix4Software getModelMatrix(
+	const ShaderSoftware& shader,
+	const ShaderStateSoftware& state,
+	const MatrixSourceLocations& locations) noexcept
+{
+	Matrix4Software model;
+	Matrix3Software normalMatrix;
+	getModelMatrices(shader, state, locations, model, normalMatrix);
+	return model;
+}
+
+/// Returns a parameter of a shader as a 3D vector
+inline Vector3 getVector3(const ShaderSoftware& shader, int32 location) noexcept
+{
+	const auto& values = shader.getParameter(location).values;
+	return {values[0], values[1], values[2]};
+}
+
+/// Returns the texture bound to the slot set to a sampler parameter
+inline const Texture2Software* getSamplerTexture(
+	const ShaderSoftware& shader,
+	const ShaderStateSoftware& state,
+	int32 location) noexcept
+{
+	const int slot = shader.getParameter(location).intValue;
+	return slot >= 0 && static_cast<u32>(slot) < Texture::TEXTURE_SLOTS ?
+		state.textures[slot] :
+		nullptr;
+}
+
+/**
+	\brief Reads a 4-byte member of a uniform block
+	\param offset The member offset in the block, see Shader::getUniformBlockMemberOffset
+	\return The member value or 0 if the block is not bound or has no such member
+*/
+template <typename T>
+inline T getUniformBlockValue(
+	const ShaderSoftware& shader,
+	const ShaderStateSoftware& state,
+	int32 blockIndex,
+	int32 offset) noexcept
+{
+	static_assert(sizeof(T) == 4, "The std140 scalars are 4-byte");
+	T value = 0;
+	const u32 bindingPoint = shader.getUniformBlockBindingPoint(blockIndex);
+	const ShaderUniformBufferSoftware* buffer = state.uniformBuffers[bindingPoint];
+	if (buffer != nullptr && blockIndex >= 0 && offset >= 0)
+	{
+		buffer->getData(&value, sizeof(value), state.uniformBufferOffsets[bindingPoint] + offset);
+	}
+	return value;
+}
+
+/**
+	\brief Reads a range of a uniform block, the bytes which are not read are zeroed
+	\param offset The range offset in the block, see Shader::getUniformBlockMemberOffset
+*/
+inline void getUniformBlockData(
+	const ShaderSoftware& shader,
+	const ShaderStateSoftware& state,
+	int32 blockIndex,
+	int32 offset,
+	void* data,
+	u32 size) noexcept
+{
+	std::memset(data, 0, size);
+	const u32 bindingPoint = shader.getUniformBlockBindingPoint(blockIndex);
+	const ShaderUniformBufferSoftware* buffer = state.uniformBuffers[bindingPoint];
+	if (buffer != nullptr && blockIndex >= 0 && offset >= 0)
+	{
+		buffer->getData(data, size, state.uniformBufferOffsets[bindingPoint] + offset);
+	}
+}
+
+/**
+	\brief Reads the ViewProjection uniform block: std140 view and projection matrices.
+	\return The product of the projection and view matrices
+*/
+inline Matrix4Software getViewProjection(
+	const ShaderSoftware& shader,
+	const ShaderStateSoftware& state,
+	int32 blockIndex) noexcept
+{
+	Matrix4Software view = {};
+	Matrix4Software projection = {};
+	const u32 bindingPoint = shader.getUniformBlockBindingPoint(blockIndex);
+	const ShaderUniformBufferSoftware* buffer = state.uniformBuffers[bindingPoint];
+	if (buffer != nullptr)
+	{
+		const u32 offset = state.uniformBufferOffsets[bindingPoint];
+		buffer->getData(view.data(), sizeof(view), offset);
+		buffer->getData(projection.data(), sizeof(projection), offset + sizeof(view));
+	}
+	return multiply(projection, view);
+}
+
+/**
+	\brief Samples a texture, as GLSL texture.
+	The missing textures return (0, 0, 0, 1) as the incomplete textures in OpenGL.
+*/
+inline void sampleTexture(
+	const Texture2Software* texture,
+	float u,
+	float v,
+	float* result) noexcept
+{
+	if (texture == nullptr)
+	{
+		result[0] = 0.0f;
+		result[1] = 0.0f;
+		result[2] = 0.0f;
+		result[3] = 1.0f;
+		return;
+	}
+	texture->sample(u, v, result);
+}
+
+/// Samples the RGB channels of a texture
+inline Vector3 sampleTextureRgb(
+	const Texture2Software* texture,
+	float u,
+	float v) noexcept
+{
+	float result[4];
+	sampleTexture(texture, u, v, result);
+	return {result[0], result[1], result[2]};
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,70 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "ShaderProgramSoftware.h"
+
+#include <cstring>
+#include <string>
+
+namespace gltut
+{
+
+namespace
+{
+// Local types
+/// The function creating a program
+using ProgramFactory = std::unique_ptr<ShaderProgramSoftware> (*)(
+	ShaderSoftware& shader,
+	const char* vertexShader,
+	const char* fragmentShader);
+
+/// The registered program
+struct ProgramEntry
+{
+	/// The name of the program in the marker
+	const char* name;
+
+	/// The function creating the program
+	ProgramFactory factory;
+};
+
+// Local constants
+/// The marker of the program name in the fragment shader source
+const char* PROGRAM_MARKER = "// Software rasterizer program: ";
+
+/// The registered programs
+const ProgramEntry PROGRAMS[] = {
+	{"flat_color", createFlatColorProgramSoftware},
+	{"depth", createDepthProgramSoftware},
+	{"phong", createPhongProgramSoftware}};
+
+// End of the anonymous namespace
+}
+
+// Global functions
+std::unique_ptr<ShaderProgramSoftware> createShaderProgramSoftware(
+	ShaderSoftware& shader,
+	const char* vertexShader,
+	const char* fragmentShader)
+{
+	const char* marker = std::strstr(fragmentShader, PROGRAM_MARKER);
+	GLTUT_CHECK(
+		marker != nullptr,
+		"The shader has no software rasterizer program marker");
+
+	const char* nameBegin = marker + std::strlen(PROGRAM_MARKER);
+	const std::string name(nameBegin, std::strcspn(nameBegin, " \t\r\n"));
+	for (const ProgramEntry& program : PROGRAMS)
+	{
+		if (name == program.name)
+		{
+			return program.factory(shader, vertexShader, fragmentShader);
+		}
+	}
+	throw std::runtime_error("Unknown software rasterizer program: " + name);
+}
+
+// End of the namespace gltut
+}
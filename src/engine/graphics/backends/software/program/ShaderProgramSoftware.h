@@ -0,0 +1,165 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <array>
+#include <memory>
+
+#include "engine/core/Check.h"
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/geometry/Geometry.h"
+#include "engine/graphics/texture/Texture.h"
+
+namespace gltut
+{
+// Forward declarations
+class ShaderSoftware;
+class ShaderUniformBufferSoftware;
+class Texture2Software;
+
+// Global constants
+/// The number of vertex attributes passed to the programs
+constexpr u32 SOFTWARE_VERTEX_ATTRIBUTES = 5;
+
+/// The maximum number of float varyings passed from a vertex to a fragment
+constexpr u32 SOFTWARE_MAX_VARYINGS = 64;
+
+/// The number of uniform buffer binding points
+constexpr u32 SOFTWARE_UNIFORM_BUFFER_BINDINGS = 16;
+
+// Global classes
+/**
+	\brief Vertex of the software device.
+	Attribute i corresponds to the vertex shader input at location i.
+	The missing attribute components are (0, 0, 0, 1) as in OpenGL.
+*/
+struct VertexSoftware
+{
+	/// The vertex attributes
+	float attributes[SOFTWARE_VERTEX_ATTRIBUTES][4];
+};
+
+/// The device state available to the programs
+struct ShaderStateSoftware
+{
+	/// The textures bound to the slots
+	std::array<const Texture2Software*, Texture::TEXTURE_SLOTS> textures = {};
+
+	/// The uniform buffers bound to the binding points
+	std::array<const ShaderUniformBufferSoftware*, SOFTWARE_UNIFORM_BUFFER_BINDINGS> uniformBuffers = {};
+
+	/// The offsets of the uniform buffer ranges bound to the binding points
+	std::array<u32, SOFTWARE_UNIFORM_BUFFER_BINDINGS> uniformBufferOffsets = {};
+
+	/// The instance of the current instanced draw call, nullptr for the non-instanced ones
+	const GeometryInstance* instance = nullptr;
+};
+
+/**
+	\brief Program of a single draw call.
+	Holds a snapshot of the shader uniforms taken when the draw call is issued,
+	so the rasterization can be deferred. The methods are called concurrently.
+*/
+class ShaderInvocationSoftware : public NonCopyable
+{
+public:
+	/// Constructor
+	explicit ShaderInvocationSoftware(u32 varyingCount) noexcept :
+		mVaryingCount(varyingCount)
+	{
+		GLTUT_ASSERT(varyingCount <= SOFTWARE_MAX_VARYINGS);
+	}
+
+	/// Virtual destructor
+	virtual ~ShaderInvocationSoftware() noexcept = default;
+
+	/// Returns the number of varyings written by the vertex stage
+	u32 getVaryingCount() const noexcept
+	{
+		return mVaryingCount;
+	}
+
+	/// Returns if the fragment stage writes the color
+	virtual bool hasColorOutput() const noexcept
+	{
+		return true;
+	}
+
+	/**
+		\brief Runs the vertex stage.
+		\param position The clip space position, 4 floats
+		\param varyings The varyings, getVaryingCount() floats
+	*/
+	virtual void processVertex(
+		const VertexSoftware& vertex,
+		float* position,
+		float* varyings) const noexcept = 0;
+
+	/**
+		\brief Runs the fragment stage.
+		\param color The RGBA color
+		\return false if the fragment is discarded
+	*/
+	virtual bool processFragment(
+		const float* varyings,
+		float* color) const noexcept = 0;
+
+private:
+	/// The number of varyings
+	u32 mVaryingCount;
+};
+
+/// C++ implementation of a shader program
+class ShaderProgramSoftware : public NonCopyable
+{
+public:
+	/// Virtual destructor
+	virtual ~ShaderProgramSoftware() noexcept = default;
+
+	/**
+		\brief Creates the invocation for a draw call
+		from the current shader uniforms and the device state
+	*/
+	virtual std::unique_ptr<ShaderInvocationSoftware> createInvocation(
+		const ShaderSoftware& shader,
+		const ShaderStateSoftware& state) const = 0;
+};
+
+// Global functions
+/**
+	\brief Creates the program of a shader.
+	The program is selected by the marker in the fragment shader source:
+	"// Software rasterizer program: <name>".
+	\throw std::runtime_error If there is no marker or no program with the name
+*/
+std::unique_ptr<ShaderProgramSoftware> createShaderProgramSoftware(
+	ShaderSoftware& shader,
+	const char* vertexShader,
+	const char* fragmentShader);
+
+/// Creates the flat color program, see FlatColorShader
+std::unique_ptr<ShaderProgramSoftware> createFlatColorProgramSoftware(
+	ShaderSoftware& shader,
+	const char* vertexShader,
+	const char* fragmentShader);
+
+/// Creates the depth program, see DepthShader
+std::unique_ptr<ShaderProgramSoftware> createDepthProgramSoftware(
+	ShaderSoftware& shader,
+	const char* vertexShader,
+	const char* fragmentShader);
+
+/**
+	\brief Creates the Phong program, see PhongShaderModelC
+	\throw std::runtime_error If the light count definitions are not found
+*/
+std::unique_ptr<ShaderProgramSoftware> createPhongProgramSoftware(
+	ShaderSoftware& shader,
+	const char* vertexShader,
+	const char* fragmentShader);
+
+// End of the namespace gltut
+}
@@ -0,0 +1,116 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <memory>
+#include <vector>
+
+#include "engine/graphics/geometry/Geometry.h"
+
+namespace gltut
+{
+// Global classes
+/// Geometry base class, computes the bounds of the vertex positions and owns the levels of detail
+class GeometryBase : public Geometry
+{
+public:
+	/**
+		\brief Constructor.
+		The 0th vertex component is treated as the position,
+		the missing position coordinates are 0
+	*/
+	GeometryBase(
+		VertexFormat vertexFormat,
+		u32 vertexCount,
+		const float* vertices) noexcept
+	{
+		const u32 vertexSize = vertexFormat.getTotalSize();
+		const u32 positionSize = std::min(vertexFormat.getComponentSize(0), 3u);
+		if (vertices == nullptr || vertexCount == 0 || positionSize == 0)
+		{
+			return;
+		}
+
+		for (u32 i = 0; i < vertexCount; ++i)
+		{
+			const float* source = vertices + static_cast<size_t>(i) * vertexSize;
+			Vector3 position;
+			for (u32 k = 0; k < positionSize; ++k)
+			{
+				position[k] = source[k];
+			}
+
+			if (i == 0)
+			{
+				mBounds = Box3(position);
+			}
+			else
+			{
+				mBounds.extend(position);
+			}
+		}
+	}
+
+	/// Returns the bounding box of the vertex positions in the local frame
+	const Box3& getBounds() const noexcept final
+	{
+		return mBounds;
+	}
+
+	/// Returns the number of the levels of detail
+	u32 getLodCount() const noexcept final
+	{
+		return static_cast<u32>(mLods.size()) + 1;
+	}
+
+	/// Returns a level of detail, nullptr if there is no such level
+	const Geometry* getLod(u32 level) const noexcept final
+	{
+		if (level == 0)
+		{
+			return this;
+		}
+		return level <= mLods.size() ? mLods[level - 1].geometry.get() : nullptr;
+	}
+
+	/// Returns the estimated maximum distance of a level of detail to the geometry surface
+	float getLodError(u32 level) const noexcept final
+	{
+		return level > 0 && level <= mLods.size() ? mLods[level - 1].error : 0.0f;
+	}
+
+	/**
+		\brief Adds the next level of detail
+		\param error The estimated maximum distance of the level to the geometry surface,
+		not less than the one of the previous level
+	*/
+	void addLod(std::unique_ptr<Geometry> lod, float error)
+	{
+		GLTUT_CHECK(lod != nullptr, "The level of detail is null");
+		GLTUT_CHECK(lod->getLodCount() == 1, "The level of detail has its own levels");
+		mLods.push_back({std::move(lod), std::max(error, getLodError(getLodCount() - 1))});
+	}
+
+private:
+	/// A level of detail
+	struct Lod
+	{
+		/// The geometry of the level
+		std::unique_ptr<Geometry> geometry;
+
+		/// The estimated maximum distance of the level to the geometry surface
+		float error;
+	};
+
+	/// The bounding box of the vertex positions
+	Box3 mBounds;
+
+	/// The levels of detail after the level 0
+	std::vector<Lod> mLods;
+};
+
+// End of the namespace gltut
+}
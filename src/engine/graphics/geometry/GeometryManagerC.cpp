@@ -6,10 +6,21 @@
 #include "GeometryManagerC.h"
 #include <string>
 #include "../GraphicsDeviceBase.h"
+#include "GeometryBase.h"
+#include "MeshSimplifierC.h"
 
 namespace gltut
 {
 
+namespace
+{
+// Local constants
+/// The maximum ratio of the triangles of a level of detail to the previous one, the levels above are not kept
+constexpr float MAX_LOD_REDUCTION = 0.9f;
+
+// End of the anonymous namespace
+}
+
 // Global classes
 Geometry* GeometryManagerC::create(
 	VertexFormat vertexFormat,
@@ -30,5 +41,57 @@ Geometry* GeometryManagerC::create(
 	return result;
 }
 
+Geometry* GeometryManagerC::createWithLods(
+	VertexFormat vertexFormat,
+	u32 vertexCount,
+	const float* vertices,
+	u32 indexCount,
+	const u32* indices,
+	u32 lodCount,
+	float lodReduction) noexcept
+{
+	Geometry* result = nullptr;
+	GLTUT_CATCH_ALL_BEGIN
+		GLTUT_CHECK(lodReduction > 0.0f && lodReduction < 1.0f, "Invalid level of detail reduction");
+		std::unique_ptr<Geometry> geometry = mDevice.createBackendGeometry(
+			vertexFormat,
+			vertexCount,
+			vertices,
+			indexCount,
+			indices);
+
+		// All backend geometries are derived from GeometryBase
+		GeometryBase& base = static_cast<GeometryBase&>(*geometry);
+		MeshSimplifierC simplifier(vertexFormat, vertexCount, vertices, indexCount, indices);
+		std::vector<float> lodVertices;
+		std::vector<u32> lodIndices;
+		u32 previousIndexCount = indexCount;
+		for (u32 level = 1; level <= lodCount; ++level)
+		{
+			const u32 targetIndexCount =
+				static_cast<u32>(static_cast<float>(previousIndexCount / 3) * lodReduction) * 3;
+			const u32 lodIndexCount = simplifier.simplify(targetIndexCount);
+			if (lodIndexCount == 0 ||
+				static_cast<float>(lodIndexCount) > static_cast<float>(previousIndexCount) * MAX_LOD_REDUCTION)
+			{
+				break;
+			}
+
+			simplifier.getMesh(lodVertices, lodIndices);
+			base.addLod(
+				mDevice.createBackendGeometry(
+					vertexFormat,
+					static_cast<u32>(lodVertices.size() / vertexFormat.getTotalSize()),
+					lodVertices.data(),
+					lodIndexCount,
+					lodIndices.data()),
+				simplifier.getError());
+			previousIndexCount = lodIndexCount;
+		}
+		result = add(std::move(geometry));
+	GLTUT_CATCH_ALL_END("Failed to create geometry with levels of detail")
+	return result;
+}
+
 // End of the namespace gltut
 }
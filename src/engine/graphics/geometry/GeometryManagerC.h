@@ -32,6 +32,16 @@ public:
 		u32 indexCount,
 		const u32* indices) noexcept final;
 
+	/// Creates a geometry with the levels of detail simplified from its mesh
+	Geometry* createWithLods(
+		VertexFormat vertexFormat,
+		u32 vertexCount,
+		const float* vertices,
+		u32 indexCount,
+		const u32* indices,
+		u32 lodCount,
+		float lodReduction) noexcept final;
+
 private:
 	/// Reference to the graphics device
 	GraphicsDeviceBase& mDevice;
@@ -0,0 +1,494 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "MeshSimplifierC.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/**
+	\brief The share of the cheapest collapses of a pass which bound its collapse error.
+	The collapses blocked by the other ones are retried in the next pass with the updated errors
+*/
+constexpr u32 PASS_COLLAPSE_QUANTILE = 4;
+
+/// The maximum number of the common neighbors of the vertices of a collapsed edge
+constexpr u32 MAX_COMMON_NEIGHBORS = 2;
+
+// Local functions
+/// Returns if the bytes of a range of floats are less than the bytes of another range
+bool isLess(const float* data0, const float* data1, u32 size) noexcept
+{
+	return std::memcmp(data0, data1, size * sizeof(float)) < 0;
+}
+
+/// Returns if the bytes of two ranges of floats are equal
+bool isEqual(const float* data0, const float* data1, u32 size) noexcept
+{
+	return std::memcmp(data0, data1, size * sizeof(float)) == 0;
+}
+
+/// Returns the doubled-area normal of a triangle
+Vector3 getNormal(const Vector3& p0, const Vector3& p1, const Vector3& p2) noexcept
+{
+	return (p1 - p0).cross(p2 - p0);
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+MeshSimplifierC::MeshSimplifierC(
+	VertexFormat vertexFormat,
+	u32 vertexCount,
+	const float* vertices,
+	u32 indexCount,
+	const u32* indices) :
+
+	mVertexFormat(vertexFormat)
+{
+	const u32 vertexSize = vertexFormat.getTotalSize();
+	const u32 positionSize = std::min(vertexFormat.getComponentSize(0), 3u);
+	GLTUT_CHECK(vertices != nullptr && vertexCount > 0, "The mesh has no vertices");
+	GLTUT_CHECK(positionSize > 0, "The mesh has no vertex positions");
+	GLTUT_CHECK(indices != nullptr && indexCount % 3 == 0, "The mesh has invalid indices");
+
+	// Merges the vertices with equal data
+	std::vector<u32> order(vertexCount);
+	std::iota(order.begin(), order.end(), 0);
+	const auto vertexData = [vertices, vertexSize](u32 vertex)
+	{
+		return vertices + static_cast<size_t>(vertex) * vertexSize;
+	};
+	std::sort(
+		order.begin(),
+		order.end(),
+		[&](u32 vertex0, u32 vertex1)
+		{
+			return isLess(vertexData(vertex0), vertexData(vertex1), vertexSize);
+		});
+
+	std::vector<u32> remap(vertexCount);
+	for (u32 i = 0; i < vertexCount; ++i)
+	{
+		const float* data = vertexData(order[i]);
+		if (i == 0 || !isEqual(data, vertexData(order[i - 1]), vertexSize))
+		{
+			mVertices.insert(mVertices.end(), data, data + vertexSize);
+			Vector3& position = mPositions.emplace_back(0.0f, 0.0f, 0.0f);
+			for (u32 k = 0; k < positionSize; ++k)
+			{
+				position[k] = data[k];
+			}
+		}
+		remap[order[i]] = static_cast<u32>(mPositions.size() - 1);
+	}
+
+	const u32 mergedCount = static_cast<u32>(mPositions.size());
+	mLocked.assign(mergedCount, false);
+	mQuadrics.resize(mergedCount);
+
+	// The vertices with equal positions form the seams
+	static_assert(sizeof(Vector3) == 3 * sizeof(float), "The positions must be tightly packed");
+	order.resize(mergedCount);
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(
+		order.begin(),
+		order.end(),
+		[this](u32 vertex0, u32 vertex1)
+		{
+			return isLess(&mPositions[vertex0].x, &mPositions[vertex1].x, 3);
+		});
+
+	std::vector<u32> positionIds(mergedCount);
+	u32 positionCount = 0;
+	for (u32 first = 0; first < mergedCount;)
+	{
+		u32 last = first + 1;
+		while (last < mergedCount &&
+			isEqual(&mPositions[order[first]].x, &mPositions[order[last]].x, 3))
+		{
+			++last;
+		}
+
+		for (u32 i = first; i < last; ++i)
+		{
+			positionIds[order[i]] = positionCount;
+			mLocked[order[i]] = last - first > 1;
+		}
+		++positionCount;
+		first = last;
+	}
+
+	mTriangles.reserve(indexCount / 3);
+	for (u32 i = 0; i < indexCount; i += 3)
+	{
+		GLTUT_CHECK(
+			indices[i] < vertexCount && indices[i + 1] < vertexCount && indices[i + 2] < vertexCount,
+			"The mesh index is out of range");
+
+		const std::array<u32, 3> triangle = {remap[indices[i]], remap[indices[i + 1]], remap[indices[i + 2]]};
+		if (triangle[0] != triangle[1] && triangle[1] != triangle[2] && triangle[2] != triangle[0])
+		{
+			mTriangles.push_back(triangle);
+		}
+	}
+
+	// The edges of a single triangle form the open borders, the edges of more triangles are non-manifold
+	std::vector<u64> edges;
+	edges.reserve(mTriangles.size() * 3);
+	for (const auto& triangle : mTriangles)
+	{
+		for (u32 k = 0; k < 3; ++k)
+		{
+			const u64 position0 = positionIds[triangle[k]];
+			const u64 position1 = positionIds[triangle[(k + 1) % 3]];
+			edges.push_back(std::min(position0, position1) << 32 | std::max(position0, position1));
+		}
+	}
+	std::sort(edges.begin(), edges.end());
+
+	std::vector<bool> lockedPositions(positionCount, false);
+	for (size_t first = 0; first < edges.size();)
+	{
+		size_t last = first + 1;
+		while (last < edges.size() && edges[last] == edges[first])
+		{
+			++last;
+		}
+
+		if (last - first != 2)
+		{
+			lockedPositions[edges[first] >> 32] = true;
+			lockedPositions[edges[first] & 0xFFFFFFFF] = true;
+		}
+		first = last;
+	}
+
+	for (u32 i = 0; i < mergedCount; ++i)
+	{
+		mLocked[i] = mLocked[i] || lockedPositions[positionIds[i]];
+	}
+
+	// The planes of the triangles weighted by their areas
+	for (const auto& triangle : mTriangles)
+	{
+		const Vector3 normal = getNormal(
+			mPositions[triangle[0]],
+			mPositions[triangle[1]],
+			mPositions[triangle[2]]);
+		// In double precision, so the tiny triangles have the planes too
+		const double length = std::sqrt(
+			static_cast<double>(normal.x) * normal.x +
+			static_cast<double>(normal.y) * normal.y +
+			static_cast<double>(normal.z) * normal.z);
+		if (!(length > 0.0))
+		{
+			continue;
+		}
+
+		const Vector3& point = mPositions[triangle[0]];
+		const double a = normal.x / length;
+		const double b = normal.y / length;
+		const double c = normal.z / length;
+		const double d = -(a * point.x + b * point.y + c * point.z);
+
+		Quadric plane;
+		plane.m = {a * a, a * b, a * c, a * d, b * b, b * c, b * d, c * c, c * d, d * d};
+		plane.weight = 0.5 * length;
+		for (double& element : plane.m)
+		{
+			element *= plane.weight;
+		}
+
+		for (u32 vertex : triangle)
+		{
+			add(mQuadrics[vertex], plane);
+		}
+	}
+}
+
+u32 MeshSimplifierC::simplify(u32 targetIndexCount)
+{
+	const u32 vertexCount = static_cast<u32>(mPositions.size());
+	std::vector<Collapse> collapses;
+	std::vector<bool> touched;
+	std::vector<u32> remap;
+
+	while (getIndexCount() > targetIndexCount)
+	{
+		updateAdjacency();
+
+		// Every interior edge is listed once, by the triangle where it goes from the smaller index
+		collapses.clear();
+		for (const auto& triangle : mTriangles)
+		{
+			for (u32 k = 0; k < 3; ++k)
+			{
+				if (triangle[k] < triangle[(k + 1) % 3])
+				{
+					const Collapse collapse = getCollapse(triangle[k], triangle[(k + 1) % 3]);
+					if (collapse.cost >= 0.0)
+					{
+						collapses.push_back(collapse);
+					}
+				}
+			}
+		}
+
+		if (collapses.empty())
+		{
+			break;
+		}
+
+		std::sort(
+			collapses.begin(),
+			collapses.end(),
+			[](const Collapse& collapse0, const Collapse& collapse1)
+			{
+				return collapse0.cost < collapse1.cost;
+			});
+
+		const double maxCost = collapses[collapses.size() / PASS_COLLAPSE_QUANTILE].cost;
+		const u32 triangleCount = static_cast<u32>(mTriangles.size());
+		const u32 removedLimit = triangleCount - targetIndexCount / 3;
+
+		touched.assign(vertexCount, false);
+		remap.resize(vertexCount);
+		std::iota(remap.begin(), remap.end(), 0);
+
+		u32 removedCount = 0;
+		for (const Collapse& collapse : collapses)
+		{
+			if (removedCount >= removedLimit || collapse.cost > maxCost)
+			{
+				break;
+			}
+
+			if (touched[collapse.from] || touched[collapse.to] || !isValid(collapse))
+			{
+				continue;
+			}
+
+			// The triangles around the collapsed edge change, so their vertices wait for the next pass
+			for (u32 vertex : {collapse.from, collapse.to})
+			{
+				for (u32 i = mTriangleOffsets[vertex]; i < mTriangleOffsets[vertex + 1]; ++i)
+				{
+					const auto& triangle = mTriangles[mVertexTriangles[i]];
+					touched[triangle[0]] = true;
+					touched[triangle[1]] = true;
+					touched[triangle[2]] = true;
+					if (vertex == collapse.from &&
+						std::find(triangle.begin(), triangle.end(), collapse.to) != triangle.end())
+					{
+						++removedCount;
+					}
+				}
+			}
+
+			remap[collapse.from] = collapse.to;
+			Quadric& quadric = mQuadrics[collapse.to];
+			add(quadric, mQuadrics[collapse.from]);
+			if (quadric.weight > 0.0)
+			{
+				mError = std::max(mError, static_cast<float>(std::sqrt(collapse.cost / quadric.weight)));
+			}
+		}
+
+		if (removedCount == 0)
+		{
+			break;
+		}
+
+		// The touched vertices do not collapse further in the pass, so a single remap is enough
+		size_t kept = 0;
+		for (const auto& source : mTriangles)
+		{
+			const std::array<u32, 3> triangle = {remap[source[0]], remap[source[1]], remap[source[2]]};
+			if (triangle[0] != triangle[1] && triangle[1] != triangle[2] && triangle[2] != triangle[0])
+			{
+				mTriangles[kept++] = triangle;
+			}
+		}
+		mTriangles.resize(kept);
+	}
+	return getIndexCount();
+}
+
+void MeshSimplifierC::getMesh(std::vector<float>& vertices, std::vector<u32>& indices) const
+{
+	const u32 vertexSize = mVertexFormat.getTotalSize();
+	std::vector<u32> newIndices(mPositions.size(), std::numeric_limits<u32>::max());
+
+	vertices.clear();
+	indices.clear();
+	indices.reserve(mTriangles.size() * 3);
+	u32 vertexCount = 0;
+	for (const auto& triangle : mTriangles)
+	{
+		for (u32 vertex : triangle)
+		{
+			if (newIndices[vertex] == std::numeric_limits<u32>::max())
+			{
+				newIndices[vertex] = vertexCount++;
+				const float* data = mVertices.data() + static_cast<size_t>(vertex) * vertexSize;
+				vertices.insert(vertices.end(), data, data + vertexSize);
+			}
+			indices.push_back(newIndices[vertex]);
+		}
+	}
+}
+
+double MeshSimplifierC::evaluate(const Quadric& quadric, const Vector3& point) noexcept
+{
+	const auto& m = quadric.m;
+	const double x = point.x;
+	const double y = point.y;
+	const double z = point.z;
+	const double result =
+		m[0] * x * x + 2.0 * m[1] * x * y + 2.0 * m[2] * x * z + 2.0 * m[3] * x +
+		m[4] * y * y + 2.0 * m[5] * y * z + 2.0 * m[6] * y +
+		m[7] * z * z + 2.0 * m[8] * z +
+		m[9];
+	// The rounding errors may make the sum of the squares negative
+	return std::max(result, 0.0);
+}
+
+void MeshSimplifierC::add(Quadric& target, const Quadric& source) noexcept
+{
+	for (u32 i = 0; i < target.m.size(); ++i)
+	{
+		target.m[i] += source.m[i];
+	}
+	target.weight += source.weight;
+}
+
+MeshSimplifierC::Collapse MeshSimplifierC::getCollapse(u32 vertex0, u32 vertex1) const noexcept
+{
+	Quadric quadric = mQuadrics[vertex0];
+	add(quadric, mQuadrics[vertex1]);
+
+	Collapse result = {-1.0, vertex0, vertex1};
+	if (!mLocked[vertex0])
+	{
+		result.cost = evaluate(quadric, mPositions[vertex1]);
+	}
+
+	if (!mLocked[vertex1])
+	{
+		const double cost = evaluate(quadric, mPositions[vertex0]);
+		if (result.cost < 0.0 || cost < result.cost)
+		{
+			result = {cost, vertex1, vertex0};
+		}
+	}
+	return result;
+}
+
+bool MeshSimplifierC::isValid(const Collapse& collapse) const
+{
+	const auto getNeighbors = [this](u32 vertex, std::vector<u32>& neighbors)
+	{
+		neighbors.clear();
+		for (u32 i = mTriangleOffsets[vertex]; i < mTriangleOffsets[vertex + 1]; ++i)
+		{
+			for (u32 neighbor : mTriangles[mVertexTriangles[i]])
+			{
+				if (neighbor != vertex)
+				{
+					neighbors.push_back(neighbor);
+				}
+			}
+		}
+		std::sort(neighbors.begin(), neighbors.end());
+		neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+	};
+
+	// The vertices of a manifold edge share only the opposite vertices of its two triangles
+	std::vector<u32> fromNeighbors;
+	std::vector<u32> toNeighbors;
+	getNeighbors(collapse.from, fromNeighbors);
+	getNeighbors(collapse.to, toNeighbors);
+	u32 commonCount = 0;
+	for (u32 neighbor : fromNeighbors)
+	{
+		if (std::binary_search(toNeighbors.begin(), toNeighbors.end(), neighbor))
+		{
+			++commonCount;
+		}
+	}
+
+	if (commonCount > MAX_COMMON_NEIGHBORS)
+	{
+		return false;
+	}
+
+	for (u32 i = mTriangleOffsets[collapse.from]; i < mTriangleOffsets[collapse.from + 1]; ++i)
+	{
+		const auto& triangle = mTriangles[mVertexTriangles[i]];
+		if (std::find(triangle.begin(), triangle.end(), collapse.to) != triangle.end())
+		{
+			continue;
+		}
+
+		std::array<Vector3, 3> points;
+		for (u32 k = 0; k < 3; ++k)
+		{
+			points[k] = mPositions[triangle[k]];
+		}
+		const Vector3 normal = getNormal(points[0], points[1], points[2]);
+
+		for (u32 k = 0; k < 3; ++k)
+		{
+			if (triangle[k] == collapse.from)
+			{
+				points[k] = mPositions[collapse.to];
+			}
+		}
+
+		if (!(normal.dot(getNormal(points[0], points[1], points[2])) > 0.0f))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void MeshSimplifierC::updateAdjacency()
+{
+	const u32 vertexCount = static_cast<u32>(mPositions.size());
+	mTriangleOffsets.assign(vertexCount + 1, 0);
+	for (const auto& triangle : mTriangles)
+	{
+		for (u32 vertex : triangle)
+		{
+			++mTriangleOffsets[vertex + 1];
+		}
+	}
+	std::partial_sum(mTriangleOffsets.begin(), mTriangleOffsets.end(), mTriangleOffsets.begin());
+
+	mVertexTriangles.resize(mTriangles.size() * 3);
+	std::vector<u32> positions(mTriangleOffsets.begin(), mTriangleOffsets.end() - 1);
+	for (u32 i = 0; i < mTriangles.size(); ++i)
+	{
+		for (u32 vertex : mTriangles[i])
+		{
+			mVertexTriangles[positions[vertex]++] = i;
+		}
+	}
+}
+
+// End of the namespace gltut
+}
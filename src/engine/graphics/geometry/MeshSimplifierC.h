@@ -0,0 +1,134 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <array>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/geometry/VertexFormat.h"
+#include "engine/math/Vector3.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Simplifies a triangle mesh by the edge collapses of the quadric error metric (Garland and Heckbert).
+	An edge collapses into one of its vertices, so the kept vertices keep their attributes.
+	The vertices with equal data are merged first. The vertices on the open borders
+	and on the attribute seams, where the vertices with equal positions differ, are not moved,
+	so the simplified mesh has no cracks.
+	The mesh is simplified progressively: every simplify() continues from the previous result
+*/
+class MeshSimplifierC : public NonCopyable
+{
+public:
+	/**
+		\brief Constructor.
+		The 0th vertex component is treated as the position
+		\throw std::runtime_error If the mesh is invalid
+	*/
+	MeshSimplifierC(
+		VertexFormat vertexFormat,
+		u32 vertexCount,
+		const float* vertices,
+		u32 indexCount,
+		const u32* indices);
+
+	/**
+		\brief Collapses the edges until the mesh has at most the target number of indices
+		or no edge can collapse
+		\return The number of the indices of the simplified mesh
+	*/
+	u32 simplify(u32 targetIndexCount);
+
+	/// Returns the number of the indices of the simplified mesh
+	u32 getIndexCount() const noexcept
+	{
+		return static_cast<u32>(mTriangles.size() * 3);
+	}
+
+	/**
+		\brief Returns the estimated maximum distance of the simplified surface to the source one.
+		The distance is in the units of the vertex positions
+	*/
+	float getError() const noexcept
+	{
+		return mError;
+	}
+
+	/// Writes the vertices used by the simplified mesh and its indices
+	void getMesh(std::vector<float>& vertices, std::vector<u32>& indices) const;
+
+private:
+	/// The symmetric 4x4 matrix of the squared distances to the planes, weighted by the areas
+	struct Quadric
+	{
+		/// The upper triangle of the matrix, row by row
+		std::array<double, 10> m{};
+
+		/// The sum of the weights of the planes
+		double weight = 0.0;
+	};
+
+	/// An edge collapse
+	struct Collapse
+	{
+		/// The error of the collapse
+		double cost;
+
+		/// The collapsed vertex
+		u32 from;
+
+		/// The vertex the collapsed one moves to
+		u32 to;
+	};
+
+	/// Returns the error of a quadric at a point
+	static double evaluate(const Quadric& quadric, const Vector3& point) noexcept;
+
+	/// Adds a quadric to another
+	static void add(Quadric& target, const Quadric& source) noexcept;
+
+	/// Returns the collapse of an edge with the smaller error, the cost is negative if none is allowed
+	Collapse getCollapse(u32 vertex0, u32 vertex1) const noexcept;
+
+	/// Returns if a collapse keeps the mesh manifold and does not flip the triangles around the collapsed vertex
+	bool isValid(const Collapse& collapse) const;
+
+	/// Updates the triangles around the vertices
+	void updateAdjacency();
+
+	/// The vertex format
+	VertexFormat mVertexFormat;
+
+	/// The data of the merged vertices
+	std::vector<float> mVertices;
+
+	/// The positions of the merged vertices
+	std::vector<Vector3> mPositions;
+
+	/// The quadrics of the merged vertices
+	std::vector<Quadric> mQuadrics;
+
+	/// The vertices which must not move
+	std::vector<bool> mLocked;
+
+	/// The triangles of the simplified mesh
+	std::vector<std::array<u32, 3>> mTriangles;
+
+	/// The offsets of the triangles of the vertices in mVertexTriangles, the vertex count + 1 entries
+	std::vector<u32> mTriangleOffsets;
+
+	/// The triangles around the vertices
+	std::vector<u32> mVertexTriangles;
+
+	/// The estimated maximum distance of the simplified surface to the source one
+	float mError = 0.0f;
+};
+
+// End of the namespace gltut
+}
@@ -5,6 +5,8 @@
 // Includes
 #include "ShaderArguments.h"
 
+#include <cstring>
+
 namespace gltut
 {
 
@@ -42,9 +44,14 @@ void addParameterValue(
 }
 
 // Global classes
-ShaderArguments::ShaderArguments(Shader* shader) noexcept :
+ShaderArguments::ShaderArguments(Shader* shader, const char* blockName) noexcept :
 	mShader(shader)
 {
+	GLTUT_CATCH_ALL_BEGIN
+	GLTUT_CHECK(blockName != nullptr, "The parameter block name is null");
+	mBlockName = blockName;
+	GLTUT_CATCH_ALL_END("Cannot set the parameter block name")
+	resetBlock();
 }
 
 Shader* ShaderArguments::getShader() const noexcept
@@ -58,6 +65,7 @@ void ShaderArguments::setShader(Shader* shader) noexcept
 	{
 		mParameterValues.clear();
 		mShader = shader;
+		resetBlock();
 	}
 }
 
@@ -65,6 +73,14 @@ int32 ShaderArguments::getParameterLocation(const char* name) const noexcept
 {
 	GLTUT_ASSERT_STRING(name);
 	GLTUT_ASSERT(mShader != nullptr);
+	if (!mBlock.empty())
+	{
+		const int32 offset = mShader->getUniformBlockMemberOffset(mBlockName.c_str(), name);
+		if (offset >= 0)
+		{
+			return BLOCK_LOCATION | offset;
+		}
+	}
 	return mShader->getParameterLocation(name);
 }
 
@@ -77,36 +93,98 @@ int32 ShaderArguments::getUniformBlockIndex(const char* name) const noexcept
 
 void ShaderArguments::setInt(int32 location, int value) noexcept
 {
+	if (isBlockLocation(location))
+	{
+		const int32 data = value;
+		writeBlock(location, &data, sizeof(data));
+		return;
+	}
 	addParameterValue(mParameterValues, location, value);
 }
 
 void ShaderArguments::setFloat(int32 location, float value) noexcept
 {
+	if (isBlockLocation(location))
+	{
+		writeBlock(location, &value, sizeof(value));
+		return;
+	}
 	addParameterValue(mParameterValues, location, value);
 }
 
 void ShaderArguments::setVec2(int32 location, float x, float y) noexcept
 {
+	if (isBlockLocation(location))
+	{
+		const float data[] = {x, y};
+		writeBlock(location, data, sizeof(data));
+		return;
+	}
 	addParameterValue(mParameterValues, location, std::array<float, 2> {x, y});
 }
 
+void ShaderArguments::setUvec2(int32 location, u32 x, u32 y) noexcept
+{
+	if (isBlockLocation(location))
+	{
+		const u32 data[] = {x, y};
+		writeBlock(location, data, sizeof(data));
+		return;
+	}
+	addParameterValue(mParameterValues, location, std::array<u32, 2> {x, y});
+}
+
 void ShaderArguments::setVec3(int32 location, float x, float y, float z) noexcept
 {
+	if (isBlockLocation(location))
+	{
+		const float data[] = {x, y, z};
+		writeBlock(location, data, sizeof(data));
+		return;
+	}
 	addParameterValue(mParameterValues, location, std::array<float, 3> {x, y, z});
 }
 
 void ShaderArguments::setVec4(int32 location, float x, float y, float z, float w) noexcept
 {
+	if (isBlockLocation(location))
+	{
+		const float data[] = {x, y, z, w};
+		writeBlock(location, data, sizeof(data));
+		return;
+	}
 	addParameterValue(mParameterValues, location, std::array<float, 4> {x, y, z, w});
 }
 
 void ShaderArguments::setMat3(int32 location, const float* value) noexcept
 {
+	if (isBlockLocation(location))
+	{
+		if (GLTUT_ASSERT(value != nullptr))
+		{
+			// std140: the columns are padded to vec4
+			float data[12] = {};
+			for (u32 column = 0; column < 3; ++column)
+			{
+				std::memcpy(data + column * 4, value + column * 3, 3 * sizeof(float));
+			}
+			writeBlock(location, data, sizeof(data));
+		}
+		return;
+	}
 	addParameterValue(mParameterValues, location, Matrix3(value));
 }
 
 void ShaderArguments::setMat4(int32 location, const float* value) noexcept
 {
+	if (isBlockLocation(location))
+	{
+		if (GLTUT_ASSERT(value != nullptr))
+		{
+			writeBlock(location, value, 16 * sizeof(float));
+		}
+		return;
+	}
 	addParameterValue(mParameterValues, location, Matrix4(value));
 }
 
@@ -122,7 +200,6 @@ void ShaderArguments::bind() const noexcept
 		return;
 	}
 
-	mShader->bind();
 	for (const auto& [location, value] : mParameterValues)
 	{
 		switch (value.index())
@@ -172,6 +249,13 @@ void ShaderArguments::bind() const noexcept
 		}
 		break;
 
+		case 7:
+		{
+			const auto& uvec2 = std::get<std::array<u32, 2>>(value);
+			mShader->setUvec2(location, uvec2[0], uvec2[1]);
+		}
+		break;
+
 		GLTUT_UNEXPECTED_SWITCH_DEFAULT_CASE(value.index());
 		}
 	}
@@ -182,5 +266,33 @@ void ShaderArguments::bind() const noexcept
 	}
 }
 
+void ShaderArguments::resetBlock() noexcept
+{
+	++mBlockVersion;
+	mBlock.clear();
+	const u32 size = mShader != nullptr && !mBlockName.empty() ?
+		mShader->getUniformBlockSize(mBlockName.c_str()) :
+		0;
+
+	GLTUT_CATCH_ALL_BEGIN
+	mBlock.resize(size, 0);
+	GLTUT_CATCH_ALL_END("Cannot allocate the shader parameter block")
+}
+
+void ShaderArguments::writeBlock(int32 location, const void* data, u32 size) noexcept
+{
+	const u32 offset = static_cast<u32>(location & ~BLOCK_LOCATION);
+	if (!GLTUT_ASSERT(offset + size <= mBlock.size()))
+	{
+		return;
+	}
+
+	if (std::memcmp(mBlock.data() + offset, data, size) != 0)
+	{
+		std::memcpy(mBlock.data() + offset, data, size);
+		++mBlockVersion;
+	}
+}
+
 // End of the namespace gltut
 }
@@ -20,7 +20,12 @@
 namespace gltut
 {
 // Global classes
-/// Represents a set of shader parameter values (like function arguments)
+/**
+	\brief Represents a set of shader parameter values (like function arguments).
+	The members of the parameter block, a std140 uniform block of the shader,
+	are written to a flat copy of the block at the offsets reflected from the shader,
+	the other parameters are kept as the values of the uniforms
+*/
 class ShaderArguments final : public ShaderParameters, public NonCopyable
 {
 public:
@@ -32,7 +37,8 @@ public:
 		std::array<float, 3>,
 		std::array<float, 4>,
 		Matrix3,
-		Matrix4>;
+		Matrix4,
+		std::array<u32, 2>>;
 
 	/// Vector of shader parameter locations and their values
 	using ParameterValues = std::vector<std::pair<int32, ParameterValue>>;
@@ -40,15 +46,30 @@ public:
 	/// Vector of uniform block binding points
 	using UniformBlockBindingPoints = std::vector<std::pair<int32, u32>>;
 
-	/// Constructor
-	explicit ShaderArguments(Shader* shader) noexcept;
+	/**
+		\brief Constructor
+		\param blockName The name of the parameter block, the shaders may have no such block
+	*/
+	ShaderArguments(Shader* shader, const char* blockName) noexcept;
 
 	/// Returns the associated shader
 	Shader* getShader() const noexcept;
 
-	/// Sets the shader. If the shader changes, resets all the parameter values
+	/// Sets the shader. If the shader changes, resets all the parameter values and the block
 	void setShader(Shader* shader) noexcept;
 
+	/// Returns the parameter block data, empty if the shader has no parameter block
+	const std::vector<u8>& getBlock() const noexcept
+	{
+		return mBlock;
+	}
+
+	/// Returns the version of the parameter block data, incremented on every change
+	u64 getBlockVersion() const noexcept
+	{
+		return mBlockVersion;
+	}
+
 	/// Returns the parameter location
 	int32 getParameterLocation(const char* name) const noexcept final;
 
@@ -64,6 +85,9 @@ public:
 	/// Sets a 2D vector to a shader parameter
 	void setVec2(int32 location, float x, float y) noexcept final;
 
+	/// Sets a 2D unsigned integer vector to a shader parameter
+	void setUvec2(int32 location, u32 x, u32 y) noexcept final;
+
 	/// Sets a 3D vector to a shader parameter
 	void setVec3(int32 location, float x, float y, float z) noexcept final;
 
@@ -79,10 +103,25 @@ public:
 	/// Sets a binding point to a shader uniform block
 	void setUniformBlockBindingPoint(int32 location, u32 bindingPoint) noexcept final;
 
-	/// Binds the controlled shader, then sets the shader parameters
+	/// Sets the parameters outside the block to the controlled shader, which must be bound
 	void bind() const noexcept;
 
 private:
+	/// The flag of the locations of the block members, the other bits are the member offsets
+	static constexpr int32 BLOCK_LOCATION = 1 << 30;
+
+	/// Checks if a location is a location of a block member
+	static bool isBlockLocation(int32 location) noexcept
+	{
+		return location >= 0 && (location & BLOCK_LOCATION) != 0;
+	}
+
+	/// Resets the block to the zeroed block of the shader
+	void resetBlock() noexcept;
+
+	/// Writes a value of a block member, changing the version only if the value changes
+	void writeBlock(int32 location, const void* data, u32 size) noexcept;
+
 	/// Associated shader
 	Shader* mShader;
 
@@ -91,6 +130,15 @@ private:
 
 	/// Shader uniform block binding points
 	UniformBlockBindingPoints mUniformBlockBindingPoints;
+
+	/// The name of the parameter block
+	std::string mBlockName;
+
+	/// The parameter block data in the std140 layout
+	std::vector<u8> mBlock;
+
+	/// The version of the parameter block data
+	u64 mBlockVersion = 0;
 };
 
 // End of the namespace gltut
@@ -10,6 +10,8 @@
 #include <array>
 #include <string>
 
+#include "../../core/Version.h"
+
 namespace gltut
 {
 // Global classes
@@ -43,6 +45,7 @@ public:
 		bool reset = false) noexcept final
 	{
 		mTarget = target;
+		mVersion = getNextVersion();
 		if (reset)
 		{
 			for (auto& name : mShaderParameters)
@@ -60,7 +63,7 @@ public:
 
 	/// Binds a scene object parameter to a shader parameter
 	virtual void bind(
-		typename ShaderBindingParameter parameter,
+		ShaderBindingParameter parameter,
 		const char* shaderParameter) noexcept final
 	{
 		const size_t index = static_cast<size_t>(parameter);
@@ -90,11 +93,12 @@ public:
 		{
 			GLTUT_ASSERT(!mShaderParameterParts[index].first.empty());
 		}
+		mVersion = getNextVersion();
 	}
 
 	/// Returns the name of a shader parameter bound to a scene parameter
 	const char* getBoundShaderParameter(
-		typename ShaderBindingParameter parameter) const noexcept final
+		ShaderBindingParameter parameter) const noexcept final
 	{
 		const auto& result = mShaderParameters[static_cast<size_t>(parameter)];
 		return result.empty() ? nullptr : result.c_str();
@@ -103,11 +107,17 @@ public:
 protected:
 	/// Return 2 parts of a shader parameter name
 	const ShaderParameterParts& getShaderParameterParts(
-		typename ShaderBindingParameter parameter) const noexcept
+		ShaderBindingParameter parameter) const noexcept
 	{
 		return mShaderParameterParts[static_cast<size_t>(parameter)];
 	}
 
+	/// Returns the version of the target and the bound parameters, changed on their every change
+	u64 getVersion() const noexcept
+	{
+		return mVersion;
+	}
+
 private:
 	/// The shader associated with this binding
 	Shader* mTarget;
@@ -117,6 +127,9 @@ private:
 
 	/// Names of scene parameters split into parts
 	std::array<ShaderParameterParts, static_cast<u32>(ShaderBindingParameter::TOTAL_COUNT)> mShaderParameterParts;
+
+	/// The version of the target and the bound parameters
+	u64 mVersion = getNextVersion();
 };
 
 // End of the namespace gltut
@@ -4,6 +4,7 @@
 
 // Includes
 #include "ShaderManagerC.h"
+#include "engine/core/CpuProfiler.h"
 #include "../../core/File.h"
 #include "../GraphicsDeviceBase.h"
 
@@ -15,6 +16,7 @@ Shader* ShaderManagerC::create(
 	const char* vertexShader,
 	const char* fragmentShader) noexcept
 {
+	GLTUT_PROFILE_ZONE("ShaderManagerC::create");
 	Shader* result = nullptr;
 	GLTUT_CATCH_ALL_BEGIN
 	result = add(mDevice.createBackendShader(
@@ -28,6 +30,7 @@ Shader* ShaderManagerC::load(
 	const char* vertexShaderPath,
 	const char* fragmentShaderPath) noexcept
 {
+	GLTUT_PROFILE_ZONE("ShaderManagerC::load");
 	Shader* result = nullptr;
 	GLTUT_CATCH_ALL_BEGIN
 	result = add(mDevice.createBackendShader(
@@ -6,7 +6,7 @@
 
 // Includes
 #include "../../core/ItemManagerT.h"
-#include "engine/graphics/Shader/ShaderManager.h"
+#include "engine/graphics/shader/ShaderManager.h"
 
 namespace gltut
 {
@@ -9,6 +9,7 @@
 #include "engine/core/NonCopyable.h"
 #include "engine/graphics/shader/ShaderUniformBuffer.h"
 #include <array>
+#include <limits>
 #include <string>
 
 namespace gltut
@@ -52,7 +53,7 @@ public:
 
 	/// Binds a parameter to a shader uniform buffer
 	virtual void bind(
-		typename ShaderUniformBufferBindingParameter parameter,
+		ShaderUniformBufferBindingParameter parameter,
 		u32 offset) noexcept final
 	{
 		const size_t index = static_cast<size_t>(parameter);
@@ -64,9 +65,9 @@ public:
 
 	/// Returns the name of a shader parameter bound to a scene parameter
 	const u32* getParameterOffset(
-		typename ShaderUniformBufferBindingParameter parameter) const noexcept final
+		ShaderUniformBufferBindingParameter parameter) const noexcept final
 	{
-		const u32 result = mParameterOffsets[static_cast<size_t>(parameter)];
+		const u32& result = mParameterOffsets[static_cast<size_t>(parameter)];
 		return result == std::numeric_limits<u32>::max() ? nullptr : &result;
 	}
 
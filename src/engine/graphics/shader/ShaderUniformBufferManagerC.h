@@ -6,7 +6,7 @@
 
 // Includes
 #include "../../core/ItemManagerT.h"
-#include "engine/graphics/Shader/ShaderUniformBufferManager.h"
+#include "engine/graphics/shader/ShaderUniformBufferManager.h"
 
 namespace gltut
 {
@@ -0,0 +1,292 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "UniformBlockLayout.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "engine/core/Check.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The base alignment of the arrays and the matrix columns in std140, in bytes
+constexpr u32 VEC4_ALIGNMENT = 16;
+
+// Local classes
+/// The std140 size and base alignment of a member type
+struct MemberType
+{
+	/// The size in bytes
+	u32 size;
+
+	/// The base alignment in bytes
+	u32 alignment;
+};
+
+// Local functions
+/// Rounds a value up to a multiple of an alignment
+u32 alignUp(u32 value, u32 alignment) noexcept
+{
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+/**
+	\brief Finds the std140 size and alignment of a scalar, vector or matrix type
+	\return The type, {0, 1} if the type is not supported
+*/
+MemberType getMemberType(const std::string& type, bool& found) noexcept
+{
+	found = true;
+	if (type == "float" || type == "int" || type == "uint" || type == "bool")
+	{
+		return {4, 4};
+	}
+
+	// vecN, ivecN, uvecN, bvecN
+	const size_t vector = type.find("vec");
+	if (vector != std::string::npos &&
+		vector + 4 == type.size() &&
+		(vector == 0 || (vector == 1 && std::strchr("iub", type[0]) != nullptr)))
+	{
+		switch (type.back())
+		{
+		case '2':
+			return {8, 8};
+		case '3':
+			return {12, 16};
+		case '4':
+			return {16, 16};
+		default:
+			break;
+		}
+	}
+
+	// The columns of a matN are aligned as vec4
+	if (type.size() == 4 && type.compare(0, 3, "mat") == 0 && type[3] >= '2' && type[3] <= '4')
+	{
+		return {static_cast<u32>(type[3] - '0') * VEC4_ALIGNMENT, VEC4_ALIGNMENT};
+	}
+
+	found = false;
+	return {0, 1};
+}
+
+/// Splits a source into identifiers, numbers and punctuation, skipping the comments and the preprocessor lines
+std::vector<std::string> tokenize(const char* source)
+{
+	std::vector<std::string> tokens;
+	const char* c = source;
+	while (*c != '\0')
+	{
+		if (c[0] == '/' && c[1] == '/')
+		{
+			while (*c != '\0' && *c != '\n')
+			{
+				++c;
+			}
+		}
+		else if (c[0] == '/' && c[1] == '*')
+		{
+			c += 2;
+			while (*c != '\0' && !(c[0] == '*' && c[1] == '/'))
+			{
+				++c;
+			}
+			c += *c != '\0' ? 2 : 0;
+		}
+		else if (*c == '#')
+		{
+			while (*c != '\0' && *c != '\n')
+			{
+				++c;
+			}
+		}
+		else if (std::isalnum(static_cast<unsigned char>(*c)) || *c == '_')
+		{
+			const char* begin = c;
+			while (std::isalnum(static_cast<unsigned char>(*c)) || *c == '_')
+			{
+				++c;
+			}
+			tokens.emplace_back(begin, c);
+		}
+		else
+		{
+			if (!std::isspace(static_cast<unsigned char>(*c)))
+			{
+				tokens.emplace_back(1, *c);
+			}
+			++c;
+		}
+	}
+	return tokens;
+}
+
+/**
+	\brief Parses the members of a block starting after its opening brace
+	\return The layout or std::nullopt if a member is not supported.
+	The index is moved after the closing brace
+*/
+std::optional<UniformBlockLayout> parseMembers(
+	const std::vector<std::string>& tokens,
+	size_t& index)
+{
+	UniformBlockLayout layout;
+	// The type of the current declaration
+	MemberType type{0, 1};
+	bool hasType = false;
+	bool supported = true;
+	while (index < tokens.size() && tokens[index] != "}")
+	{
+		const std::string& token = tokens[index++];
+		if (token == "highp" || token == "mediump" || token == "lowp")
+		{
+			continue;
+		}
+
+		if (token == "layout")
+		{
+			// Skips the member layout qualifiers like row_major
+			supported = false;
+			continue;
+		}
+
+		if (token == ";")
+		{
+			hasType = false;
+			continue;
+		}
+
+		if (!hasType)
+		{
+			// An unsupported type is kept as {0, 1} to scan to the end of the block
+			bool found = false;
+			type = getMemberType(token, found);
+			supported = supported && found;
+			hasType = true;
+			continue;
+		}
+
+		if (token == ",")
+		{
+			continue;
+		}
+
+		// A declarator: name or name[count]
+		u32 count = 0;
+		if (index + 2 < tokens.size() && tokens[index] == "[" && tokens[index + 2] == "]")
+		{
+			count = static_cast<u32>(std::strtoul(tokens[index + 1].c_str(), nullptr, 10));
+			supported = supported && count > 0;
+			index += 3;
+		}
+
+		if (count == 0)
+		{
+			layout.size = alignUp(layout.size, type.alignment);
+			layout.offsets[token] = layout.size;
+			layout.size += type.size;
+		}
+		else
+		{
+			// The array elements are aligned as vec4
+			const u32 stride = alignUp(type.size, VEC4_ALIGNMENT);
+			layout.size = alignUp(layout.size, VEC4_ALIGNMENT);
+			layout.offsets[token] = layout.size;
+			layout.offsets[token + "[0]"] = layout.size;
+			layout.size += stride * count;
+		}
+	}
+
+	++index;
+	if (!supported)
+	{
+		return std::nullopt;
+	}
+	layout.size = alignUp(layout.size, VEC4_ALIGNMENT);
+	return layout;
+}
+
+// End of the anonymous namespace
+}
+
+// Global functions
+void addUniformBlockLayouts(const char* source, UniformBlockLayouts& layouts)
+{
+	GLTUT_CHECK(source != nullptr, "The shader source is null");
+	const std::vector<std::string> tokens = tokenize(source);
+	for (size_t i = 0; i + 2 < tokens.size(); ++i)
+	{
+		if (tokens[i] != "uniform" || tokens[i + 2] != "{")
+		{
+			continue;
+		}
+
+		const std::string& name = tokens[i + 1];
+		size_t index = i + 3;
+		std::optional<UniformBlockLayout> layout = parseMembers(tokens, index);
+		if (layout.has_value() && index < tokens.size() && tokens[index] != ";")
+		{
+			// The members of a named instance are reflected as Block.member
+			UniformBlockLayout prefixed;
+			prefixed.size = layout->size;
+			for (const auto& [member, offset] : layout->offsets)
+			{
+				prefixed.offsets[name + "." + member] = offset;
+			}
+			layout = std::move(prefixed);
+		}
+
+		if (layout.has_value())
+		{
+			layouts[name] = std::move(*layout);
+		}
+		i = index - 1;
+	}
+}
+
+u32 getUniformBlockSize(
+	const UniformBlockLayouts& layouts,
+	const char* blockName) noexcept
+{
+	GLTUT_ASSERT_STRING(blockName);
+	GLTUT_CATCH_ALL_BEGIN
+	const auto block = layouts.find(blockName);
+	return block != layouts.end() ? block->second.size : 0;
+	GLTUT_CATCH_ALL_END("Cannot find a uniform block")
+	return 0;
+}
+
+int32 getUniformBlockMemberOffset(
+	const UniformBlockLayouts& layouts,
+	const char* blockName,
+	const char* memberName) noexcept
+{
+	GLTUT_ASSERT_STRING(blockName);
+	GLTUT_ASSERT_STRING(memberName);
+	GLTUT_CATCH_ALL_BEGIN
+	const auto block = layouts.find(blockName);
+	if (block == layouts.end())
+	{
+		return -1;
+	}
+
+	const auto member = block->second.offsets.find(memberName);
+	return member != block->second.offsets.end() ? static_cast<int32>(member->second) : -1;
+	GLTUT_CATCH_ALL_END("Cannot find a uniform block member")
+	return -1;
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,51 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <string>
+#include <unordered_map>
+
+#include "engine/core/Types.h"
+
+namespace gltut
+{
+// Global classes
+/// The std140 layout of a uniform block
+struct UniformBlockLayout
+{
+	/// The size of the block in bytes
+	u32 size = 0;
+
+	/// The offsets of the members in bytes, by name
+	std::unordered_map<std::string, u32> offsets;
+};
+
+/// The layouts of the uniform blocks, by block name
+using UniformBlockLayouts = std::unordered_map<std::string, UniformBlockLayout>;
+
+// Global functions
+/**
+	\brief Adds the std140 layouts of the uniform blocks declared in a GLSL source.
+	Used by the devices which do not compile the shaders.
+	The scalar, vector and matrix members and their arrays are supported,
+	the blocks with other members are skipped.
+	The members of the blocks with an instance name are prefixed by the block name, as in OpenGL
+*/
+void addUniformBlockLayouts(const char* source, UniformBlockLayouts& layouts);
+
+/// Returns the size of a uniform block in bytes, 0 if there is no such block
+u32 getUniformBlockSize(
+	const UniformBlockLayouts& layouts,
+	const char* blockName) noexcept;
+
+/// Returns the offset of a member of a uniform block in bytes, -1 if the block has no such member
+int32 getUniformBlockMemberOffset(
+	const UniformBlockLayouts& layouts,
+	const char* blockName,
+	const char* memberName) noexcept;
+
+// End of the namespace gltut
+}
@@ -4,6 +4,7 @@
 
 // Includes
 #include "TextureManagerC.h"
+#include "engine/core/CpuProfiler.h"
 #include "../GraphicsDeviceBase.h"
 #include "./stb_image.h"
 #include <array>
@@ -101,11 +102,27 @@ Texture2* TextureManagerC::create(
 	return result;
 }
 
+Texture2Array* TextureManagerC::createArray(
+	const Point2u& size,
+	TextureFormat format,
+	u32 layerCount,
+	const TextureParameters& parameters) noexcept
+{
+	Texture2Array* result = nullptr;
+	GLTUT_CATCH_ALL_BEGIN
+	GLTUT_CHECK(mDevice.isTextureArraySupported(), "The device does not support the texture arrays");
+	result = static_cast<Texture2Array*>(add(
+		mDevice.createBackendTexture2Array(size, format, layerCount, parameters)));
+	GLTUT_CATCH_ALL_END("Failed to create texture array")
+	return result;
+}
+
 Texture2* TextureManagerC::load(
 	const char* imagePath,
 	const TextureParameters& textureParameters,
 	const LoadParameters& loadParameters) noexcept
 {
+	GLTUT_PROFILE_ZONE("TextureManagerC::load");
 	Texture2* result = nullptr;
 	TextureData textureData;
 
@@ -131,6 +148,7 @@ TextureCubemap* TextureManagerC::load(
 	const TextureParameters& textureParameters,
 	const LoadParameters& loadParameters) noexcept
 {
+	GLTUT_PROFILE_ZONE("TextureManagerC::load");
 	TextureCubemap* result = nullptr;
 	std::array<TextureData, 6> textureData;
 
@@ -48,6 +48,13 @@ public:
 		const TextureParameters& textureParameters,
 		const LoadParameters& loadParameters) noexcept final;
 
+	/// Creates an array of 2D textures
+	Texture2Array* createArray(
+		const Point2u& size,
+		TextureFormat format,
+		u32 layerCount,
+		const TextureParameters& parameters) noexcept final;
+
 	/// Creates a solid color texture
 	const Texture2* createSolidColor(const Color& color) noexcept final;
 
@@ -8,7 +8,9 @@
 #include "RendererC.h"
 
 #include <algorithm>
+#include <thread>
 
+#include "engine/core/CpuProfiler.h"
 #include "./material/MaterialC.h"
 #include "./objects/RenderGeometryC.h"
 #include "./objects/RenderGeometryGroupC.h"
@@ -38,11 +40,24 @@ InterfaceType* createElement(
 	GLTUT_CATCH_ALL_END("Cannot create an " + elementName)
 	return result;
 }
+
+/// Returns the name of the profiling zone of a render pass execution
+[[maybe_unused]] const char* getZoneName(const RenderPass* pass) noexcept
+{
+	const char* name = pass->getName();
+	return name[0] != '\0' ? name : "RenderPass::execute";
+}
 }
 
 // Global classes
-RendererC::RendererC(GraphicsDevice& device) noexcept :
-	mDevice(device)
+RendererC::RendererC(GraphicsDevice& device) :
+	mDevice(device),
+	mMaterialBuffer(device),
+	mGraph(device),
+	mObjectBuffer(device),
+	mTaskPool(std::max(1u, std::thread::hardware_concurrency())),
+	mProfiler(device),
+	mStatistics(device)
 {
 }
 
@@ -101,7 +116,8 @@ Material* RendererC::createMaterial() noexcept
 	return createElement<Material, MaterialC>(
 		mMaterials,
 		"material",
-		mDevice);
+		mDevice,
+		mMaterialBuffer);
 }
 
 void RendererC::removeMaterial(Material* material) noexcept
@@ -160,7 +176,8 @@ RenderPass* RendererC::createPass(
 									  viewport,
 									  mDevice,
 									  mShaderBindings,
-									  mShaderUniformBufferBindings),
+									  mShaderUniformBufferBindings,
+									  mObjectBuffer),
 								  0)
 				 .first.get();
 	GLTUT_CATCH_ALL_END("Cannot create a scene render pass")
@@ -171,6 +188,8 @@ RenderPass* RendererC::createPass(
 
 void RendererC::removeAllPasses() noexcept
 {
+	mProfiler.removeAllPasses();
+	mStatistics.removeAllPasses();
 	mPasses.clear();
 }
 
@@ -195,7 +214,8 @@ RenderPass* RendererC::createDepthSortedPass(
 		viewport,
 		mDevice,
 		mShaderBindings,
-		mShaderUniformBufferBindings),
+		mShaderUniformBufferBindings,
+		mObjectBuffer),
 		0).first.get();
 	GLTUT_CATCH_ALL_END("Cannot create a depth-sorted scene render pass")
 
@@ -215,6 +235,8 @@ void RendererC::removePass(RenderPass* pass) noexcept
 
 	if (findResult != mPasses.end())
 	{
+		mProfiler.removePass(pass);
+		mStatistics.removePass(pass);
 		mPasses.erase(findResult);
 	}
 }
@@ -232,7 +254,7 @@ void RendererC::setPassPriority(RenderPass* pass, int32 priority) noexcept
 	if (findResult != mPasses.end())
 	{
 		findResult->second = priority;
-		std::sort(
+		std::stable_sort(
 			mPasses.begin(),
 			mPasses.end(),
 			[](const auto& pass1, const auto& pass2)
@@ -242,15 +264,116 @@ void RendererC::setPassPriority(RenderPass* pass, int32 priority) noexcept
 	}
 }
 
+TextureFramebuffer* RendererC::createTransientTarget(
+	const Point2u* size,
+	const TextureFormat* colorFormat,
+	bool depth) noexcept
+{
+	return mGraph.createTarget(size, colorFormat, depth);
+}
+
+void RendererC::removeTransientTarget(TextureFramebuffer* target) noexcept
+{
+	mGraph.removeTarget(target);
+}
+
 void RendererC::execute() noexcept
 {
-	for (const auto& pass : mPasses)
+	GLTUT_PROFILE_ZONE("RendererC::execute");
+	mObjectBuffer.beginFrame();
+	mProfiler.beginFrame();
+	mStatistics.beginSubmission();
+
+	// The passes are compiled every frame because their targets, inputs and activity may change
+	if (mGraph.compile(mPasses))
+	{
+		// Only the submission runs on the rendering thread
+		build(mGraph.getPasses());
+		for (RenderPass* pass : mGraph.getPasses())
+		{
+			execute(*pass);
+		}
+	}
+	else
 	{
-		if (pass.first->isActive())
+		for (const auto& pass : mPasses)
 		{
-			pass.first->execute();
+			if (pass.first->isActive())
+			{
+				execute(*pass.first);
+			}
 		}
 	}
+	mStatistics.endSubmission();
+}
+
+void RendererC::execute(RenderPass& pass) noexcept
+{
+	GLTUT_PROFILE_ZONE_DYNAMIC(getZoneName(&pass));
+	mProfiler.beginPass(&pass);
+	mStatistics.beginPass();
+	pass.execute();
+	mStatistics.endPass(pass);
+	mProfiler.endPass();
+}
+
+void RendererC::build(const std::vector<RenderPass*>& passes) noexcept
+{
+	GLTUT_PROFILE_ZONE("RendererC::build");
+	bool started = false;
+	mOcclusionTasks.clear();
+	mBuildTasks.clear();
+	GLTUT_CATCH_ALL_BEGIN
+	for (RenderPass* pass : passes)
+	{
+		// All render passes are created by the renderer
+		RenderPassC* passC = static_cast<RenderPassC*>(pass);
+		const u32 chunkCount = passC->beginBuild();
+		for (u32 i = 0; i < passC->getOcclusionBandCount(); ++i)
+		{
+			mOcclusionTasks.push_back({passC, i});
+		}
+
+		for (u32 i = 0; i < chunkCount; ++i)
+		{
+			mBuildTasks.push_back({passC, i});
+		}
+	}
+	started = true;
+	GLTUT_CATCH_ALL_END("Cannot start building the render passes")
+
+	// The passes without the completed build are built by their execution
+	if (!started)
+	{
+		return;
+	}
+
+	// The chunks test the geometries against the rasterized occlusion buffers
+	mTaskPool.run(
+		static_cast<u32>(mOcclusionTasks.size()),
+		[this](u32 index)
+		{
+			GLTUT_PROFILE_ZONE("RenderPassC::rasterizeOccluders");
+			const BuildTask& task = mOcclusionTasks[index];
+			task.pass->rasterizeOccluders(task.chunk);
+		});
+
+	mTaskPool.run(
+		static_cast<u32>(mBuildTasks.size()),
+		[this](u32 index)
+		{
+			GLTUT_PROFILE_ZONE("RenderPassC::buildChunk");
+			const BuildTask& task = mBuildTasks[index];
+			task.pass->buildChunk(task.chunk);
+		});
+
+	mTaskPool.run(
+		static_cast<u32>(passes.size()),
+		[&passes](u32 index)
+		{
+			GLTUT_PROFILE_ZONE("RenderPassC::endBuild");
+			static_cast<RenderPassC*>(passes[index])->endBuild();
+		});
 }
 
 // End of the namespace gltut
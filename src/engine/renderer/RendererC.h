@@ -13,6 +13,14 @@
 #include "engine/renderer/Renderer.h"
 #include "engine/scene/Scene.h"
 
+#include "../core/TaskPool.h"
+#include "./material/MaterialBufferC.h"
+#include "./render_graph/RenderGraphC.h"
+#include "./render_pass/ObjectBufferC.h"
+#include "./profiler/RenderProfilerC.h"
+#include "./render_pass/RenderPassC.h"
+#include "./statistics/RenderStatisticsC.h"
+
 namespace gltut
 {
 // Global classes
@@ -20,8 +28,11 @@ namespace gltut
 class RendererC final : public Renderer, public NonCopyable
 {
 public:
-	/// Constructor
-	explicit RendererC(GraphicsDevice& device) noexcept;
+	/**
+		\brief Constructor
+		\throw std::system_error If the worker threads cannot be started
+	*/
+	explicit RendererC(GraphicsDevice& device);
 
 	/// Returns the device
 	GraphicsDevice* getDevice() noexcept
@@ -29,6 +40,12 @@ public:
 		return &mDevice;
 	}
 
+	/// Returns the worker threads, shared with the engine parts running outside the passes
+	TaskPool& getTaskPool() noexcept
+	{
+		return mTaskPool;
+	}
+
 	/// Creates a shader material binding
 	ShaderRendererBinding* createShaderBinding(
 		Shader* shader) noexcept final;
@@ -88,13 +105,68 @@ public:
 	/// Sets the priority of the render pass
 	void setPassPriority(RenderPass* pass, int32 priority) noexcept final;
 
+	/// Creates a transient render target
+	TextureFramebuffer* createTransientTarget(
+		const Point2u* size,
+		const TextureFormat* colorFormat,
+		bool depth) noexcept final;
+
+	/// Removes a transient render target
+	void removeTransientTarget(TextureFramebuffer* target) noexcept final;
+
+	/// Returns the GPU profiler of the render passes
+	RenderProfiler* getProfiler() noexcept final
+	{
+		return &mProfiler;
+	}
+
+	/// Returns the counters of the render passes executed in the last frame
+	const RenderStatistics* getStatistics() const noexcept final
+	{
+		return &mStatistics;
+	}
+
+	/// Starts a frame, the statistics count the device calls of the whole frame
+	void beginFrame() noexcept
+	{
+		mStatistics.beginFrame();
+	}
+
+	/// Ends the frame started by beginFrame()
+	void endFrame() noexcept
+	{
+		mStatistics.endFrame();
+	}
+
 	/// Executes the render pipeline
 	void execute() noexcept;
 
 private:
+	/// A chunk of the draw data or a band of the occlusion buffer of a pass
+	struct BuildTask
+	{
+		/// The pass
+		RenderPassC* pass;
+
+		/// The chunk or the band
+		u32 chunk;
+	};
+
+	/**
+		\brief Builds the draw data of the passes on the worker threads.
+		The passes which fail to start the build are built by their execution
+	*/
+	void build(const std::vector<RenderPass*>& passes) noexcept;
+
+	/// Executes a pass, measuring it by the profilers and the statistics
+	void execute(RenderPass& pass) noexcept;
+
 	/// Graphics device
 	GraphicsDevice& mDevice;
 
+	/// The uniform buffers of the material parameter blocks, outlives the materials
+	MaterialBufferC mMaterialBuffer;
+
 	/// Shader renderer bindings
 	std::vector<std::unique_ptr<ShaderRendererBinding>> mShaderBindings;
 
@@ -111,7 +183,28 @@ private:
 	std::vector<std::unique_ptr<RenderGeometryGroup>> mGroups;
 
 	/// List of render passes
-	std::vector<std::pair<std::unique_ptr<RenderPass>, int32>> mPasses;
+	RenderGraphC::Passes mPasses;
+
+	/// The graph ordering the passes
+	RenderGraphC mGraph;
+
+	/// The per-draw data of the passes
+	ObjectBufferC mObjectBuffer;
+
+	/// The worker threads building the draw data of the passes
+	TaskPool mTaskPool;
+
+	/// The GPU profiler of the passes
+	RenderProfilerC mProfiler;
+
+	/// The counters of the passes
+	RenderStatisticsC mStatistics;
+
+	/// The bands of the occlusion buffers of the passes
+	std::vector<BuildTask> mOcclusionTasks;
+
+	/// The chunks of the draw data of the passes
+	std::vector<BuildTask> mBuildTasks;
 };
 
 // End of the namespace gltut
@@ -0,0 +1,84 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "MaterialBufferC.h"
+
+#include <algorithm>
+
+#include "engine/core/Check.h"
+
+namespace gltut
+{
+// Global classes
+MaterialBufferC::MaterialBufferC(GraphicsDevice& device) noexcept :
+
+	mDevice(device),
+	mAlignment(std::max(device.getShaderUniformBufferAlignment(), 1u))
+{
+}
+
+MaterialBufferC::~MaterialBufferC() noexcept
+{
+	for (ShaderUniformBuffer* page : mPages)
+	{
+		mDevice.getShaderUniformBuffers()->remove(page);
+	}
+}
+
+MaterialBufferC::Range MaterialBufferC::allocate(u32 size) noexcept
+{
+	if (size == 0)
+	{
+		return {};
+	}
+
+	const u32 alignedSize = (size + mAlignment - 1) / mAlignment * mAlignment;
+	GLTUT_CATCH_ALL_BEGIN
+	const auto found = mFreeRanges.find(alignedSize);
+	if (found != mFreeRanges.end() && !found->second.empty())
+	{
+		const Range range = found->second.back();
+		found->second.pop_back();
+		return range;
+	}
+
+	mPages.reserve(mPages.size() + 1);
+	if (alignedSize > PAGE_SIZE)
+	{
+		ShaderUniformBuffer* page = mDevice.getShaderUniformBuffers()->create(alignedSize);
+		GLTUT_CHECK(page != nullptr, "Cannot create a material buffer page");
+		mPages.push_back(page);
+		return {page, 0, alignedSize};
+	}
+
+	if (mPage == nullptr || mPageUsed + alignedSize > PAGE_SIZE)
+	{
+		mPage = mDevice.getShaderUniformBuffers()->create(PAGE_SIZE);
+		GLTUT_CHECK(mPage != nullptr, "Cannot create a material buffer page");
+		mPages.push_back(mPage);
+		mPageUsed = 0;
+	}
+
+	const Range range = {mPage, mPageUsed, alignedSize};
+	mPageUsed += alignedSize;
+	return range;
+	GLTUT_CATCH_ALL_END("Cannot allocate a material buffer range")
+	return {};
+}
+
+void MaterialBufferC::release(const Range& range) noexcept
+{
+	if (range.buffer == nullptr)
+	{
+		return;
+	}
+
+	GLTUT_CATCH_ALL_BEGIN
+	mFreeRanges[range.size].push_back(range);
+	GLTUT_CATCH_ALL_END("Cannot release a material buffer range")
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,77 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <unordered_map>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDevice.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief The uniform buffers of the parameter blocks of the material passes.
+	Every block gets a range of a shared buffer page, aligned for the range binding.
+	The released ranges are reused by the blocks of the same aligned size
+*/
+class MaterialBufferC : public NonCopyable
+{
+public:
+	/// A range of a buffer page
+	struct Range
+	{
+		/// The buffer, nullptr for an empty range
+		ShaderUniformBuffer* buffer = nullptr;
+
+		/// The offset in bytes
+		u32 offset = 0;
+
+		/// The aligned size in bytes
+		u32 size = 0;
+	};
+
+	/// Constructor
+	explicit MaterialBufferC(GraphicsDevice& device) noexcept;
+
+	/// Destructor
+	~MaterialBufferC() noexcept;
+
+	/**
+		\brief Allocates a range of a block size
+		\return The range or an empty range if it cannot be allocated
+	*/
+	Range allocate(u32 size) noexcept;
+
+	/// Releases a range returned by allocate(), the empty ranges are ignored
+	void release(const Range& range) noexcept;
+
+private:
+	/// The size of a buffer page in bytes, the larger blocks get their own pages
+	static constexpr u32 PAGE_SIZE = 64 * 1024;
+
+	/// The graphics device
+	GraphicsDevice& mDevice;
+
+	/// The alignment of the ranges
+	u32 mAlignment;
+
+	/// The buffer pages
+	std::vector<ShaderUniformBuffer*> mPages;
+
+	/// The number of the allocated bytes of the last shared page
+	u32 mPageUsed = PAGE_SIZE;
+
+	/// The last shared page, nullptr if there is no such page
+	ShaderUniformBuffer* mPage = nullptr;
+
+	/// The released ranges, by the aligned size
+	std::unordered_map<u32, std::vector<Range>> mFreeRanges;
+};
+
+// End of the namespace gltut
+}
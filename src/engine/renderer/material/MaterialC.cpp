@@ -26,6 +26,7 @@ MaterialPass* MaterialC::createPass(
 
 		auto pass = std::make_unique<MaterialPassC>(
 			mDevice,
+			mMaterialBuffer,
 			shader,
 			textureSlotsCount,
 			shaderBindingPointsCount);
@@ -8,6 +8,9 @@
 #include "engine/core/NonCopyable.h"
 #include "engine/graphics/GraphicsDevice.h"
 #include "engine/renderer/material/Material.h"
+
+#include "./MaterialBufferC.h"
+#include <memory>
 #include <vector>
 
 namespace gltut
@@ -17,8 +20,9 @@ class MaterialC final : public Material, public NonCopyable
 {
 public:
 	/// Constructor
-	MaterialC(GraphicsDevice& device) noexcept :
-		mDevice(device)
+	MaterialC(GraphicsDevice& device, MaterialBufferC& materialBuffer) noexcept :
+		mDevice(device),
+		mMaterialBuffer(materialBuffer)
 	{
 	}
 
@@ -39,6 +43,9 @@ private:
 	/// Graphics device reference
 	GraphicsDevice& mDevice;
 
+	/// The uniform buffers of the material parameter blocks
+	MaterialBufferC& mMaterialBuffer;
+
 	/// List of material passes
 	std::vector<std::unique_ptr<MaterialPass>> mPasses;
 };
@@ -14,16 +14,27 @@ namespace gltut
 // Global classes
 MaterialPassC::MaterialPassC(
 	GraphicsDevice& device,
+	MaterialBufferC& materialBuffer,
 	const ShaderRendererBinding* shader,
 	u32 textureSlotsCount,
 	u32 shaderBindingPointsCount) noexcept :
 
 	mDevice(device),
 	mShaderBinding(shader),
-	mShaderArguments(shader != nullptr ? shader->getTarget() : nullptr),
+	mShaderArguments(
+		shader != nullptr ? shader->getTarget() : nullptr,
+		RendererBinding::MATERIAL_BLOCK_NAME),
+	mMaterialBuffer(materialBuffer),
 	mTextures(device, textureSlotsCount),
 	mShaderUniformBuffers(device, shaderBindingPointsCount)
 {
+	updatePipelineState();
+	updateBlockRange();
+}
+
+MaterialPassC::~MaterialPassC() noexcept
+{
+	mMaterialBuffer.release(mBlockRange);
 }
 
 /// Returns the shader binding
@@ -36,28 +47,127 @@ void MaterialPassC::setShader(const ShaderRendererBinding* shader) noexcept
 {
 	mShaderBinding = shader;
 	mShaderArguments.setShader(shader != nullptr ? shader->getTarget() : nullptr);
+	updatePipelineState();
+	updateBlockRange();
+}
+
+const PipelineState* MaterialPassC::getPipelineState() const noexcept
+{
+	const Shader* shader = mShaderBinding != nullptr ? mShaderBinding->getTarget() : nullptr;
+	if (shader == nullptr)
+	{
+		return nullptr;
+	}
+
+	// The target of the shader binding may be replaced after the state is cached
+	if (mPipelineState != nullptr && mPipelineState->shader == shader)
+	{
+		return mPipelineState;
+	}
+
+	PipelineState state = mPipeline;
+	state.shader = shader;
+	return mDevice.getPipelineState(state);
 }
 
 void MaterialPassC::bind(const RenderGeometry* geometry) const noexcept
 {
-	if (geometry == nullptr ||
-		mShaderBinding == nullptr ||
+	if (geometry == nullptr)
+	{
+		return;
+	}
+
+	bindGeometry(geometry);
+	if (mShaderBinding == nullptr ||
+		mShaderBinding->getTarget() == nullptr)
+	{
+		return;
+	}
+
+	mShaderBinding->getTarget()->bind();
+	bindMaterial();
+
+	// The depth test and writes are left to the render pass
+	mDevice.setBlending(mPipeline.blending);
+	mDevice.setFaceCulling(mPipeline.faceCulling);
+	mDevice.setPolygonFill(
+		mPipeline.polygonFill,
+		mPipeline.polygonFillSize,
+		mPipeline.polygonFillSizeInShader);
+}
+
+void MaterialPassC::bindMaterial() const noexcept
+{
+	if (mShaderBinding == nullptr ||
 		mShaderBinding->getTarget() == nullptr)
 	{
 		return;
 	}
 
-	mShaderBinding->update(geometry);
 	mShaderArguments.bind();
+	bindBlock();
 	mTextures.bind();
 	mShaderUniformBuffers.bind();
+}
 
-	mDevice.setBlending(isTransparent());
-	mDevice.setFaceCulling(getFaceCulling());
-	mDevice.setPolygonFill(
-		mPolygonFill,
-		mPolygonFillSize,
-		mPolygonFillSizeInShader);
+void MaterialPassC::bindGeometry(const RenderGeometry* geometry) const noexcept
+{
+	if (geometry != nullptr && mShaderBinding != nullptr)
+	{
+		mShaderBinding->update(geometry);
+	}
+}
+
+void MaterialPassC::updatePipelineState() noexcept
+{
+	mPipeline.shader = mShaderBinding != nullptr ? mShaderBinding->getTarget() : nullptr;
+	mPipelineState = mPipeline.shader != nullptr ?
+		mDevice.getPipelineState(mPipeline) :
+		nullptr;
+}
+
+void MaterialPassC::updateBlockRange() noexcept
+{
+	const u32 size = static_cast<u32>(mShaderArguments.getBlock().size());
+	if (size <= mBlockRange.size && size > 0)
+	{
+		return;
+	}
+
+	mMaterialBuffer.release(mBlockRange);
+	mBlockRange = mMaterialBuffer.allocate(size);
+	// Forces the upload
+	mUploadedBlockVersion = mShaderArguments.getBlockVersion() - 1;
+}
+
+void MaterialPassC::bindBlock() const noexcept
+{
+	const std::vector<u8>& block = mShaderArguments.getBlock();
+	if (block.empty() || mBlockRange.buffer == nullptr)
+	{
+		return;
+	}
+
+	const u32 size = static_cast<u32>(block.size());
+	if (mUploadedBlockVersion != mShaderArguments.getBlockVersion())
+	{
+		mBlockRange.buffer->setData(block.data(), size, mBlockRange.offset);
+		mUploadedBlockVersion = mShaderArguments.getBlockVersion();
+	}
+
+	mDevice.bindShaderUniformBufferRange(
+		mBlockRange.buffer,
+		RendererBinding::MATERIAL_BUFFER_BINDING_POINT,
+		mBlockRange.offset,
+		size);
+}
+
+void MaterialPassC::bindMatrixSource(RendererBinding::MatrixSource source) const noexcept
+{
+	if (mShaderBinding != nullptr)
+	{
+		mShaderBinding->updateMatrixSource(source);
+	}
 }
 
 // End of the namespace gltut
@@ -5,27 +5,38 @@
 #pragma once
 
 // Includes
+#include "engine/core/Check.h"
 #include "engine/core/NonCopyable.h"
+#include "engine/graphics/PipelineState.h"
 #include "engine/renderer/material/MaterialPass.h"
 
 #include "../../graphics/shader/ShaderArguments.h"
+#include "./MaterialBufferC.h"
 #include "../shader/ShaderUniformBufferSetC.h"
 #include "../texture/TextureSetC.h"
 
 namespace gltut
 {
 // Global classes
-/// Implementation of the MaterialPass interface
+/**
+	\brief Implementation of the MaterialPass interface.
+	The shader parameters of the material parameter block are uploaded to a range of the material buffer
+	when they change, and the range is bound to RendererBinding::MATERIAL_BUFFER_BINDING_POINT
+*/
 class MaterialPassC final : public MaterialPass, public NonCopyable
 {
 public:
 	/// Constructor
-	explicit MaterialPassC(
+	MaterialPassC(
 		GraphicsDevice& device,
+		MaterialBufferC& materialBuffer,
 		const ShaderRendererBinding* shader,
 		u32 textureSlotsCount,
 		u32 shaderBindingPointsCount) noexcept;
 
+	/// Destructor
+	~MaterialPassC() noexcept final;
+
 	/// Returns the shader binding
 	const ShaderRendererBinding* getShader() const noexcept final;
 
@@ -44,6 +55,12 @@ public:
 		return &mTextures;
 	}
 
+	/// Returns the textures for reading
+	const TextureSetC& getTextureSet() const noexcept
+	{
+		return mTextures;
+	}
+
 	/// Returns the uniform buffers associated with this material pass
 	ShaderUniformBufferSet* getShaderUniformBuffers() noexcept final
 	{
@@ -53,25 +70,54 @@ public:
 	/// Returns the material face mode
 	FaceCullingMode getFaceCulling() const noexcept final
 	{
-		return mFaceCulling;
+		return mPipeline.faceCulling;
 	}
 
 	/// Sets the material face mode
 	void setFaceCulling(FaceCullingMode mode) noexcept final
 	{
-		mFaceCulling = mode;
+		mPipeline.faceCulling = mode;
+		updatePipelineState();
 	}
 
 	/// Returns the transparency flag
 	bool isTransparent() const noexcept final
 	{
-		return mTransparent;
+		return mPipeline.blending;
 	}
 
-	/// Sets the transparency flag
+	/// Sets the transparency flag, the transparent passes are blended
 	void setTransparent(bool transparent) noexcept final
 	{
-		mTransparent = transparent;
+		mPipeline.blending = transparent;
+		updatePipelineState();
+	}
+
+	/// Returns the estimated cost of shading a fragment, in texture samples
+	float getCost() const noexcept final
+	{
+		return mCost;
+	}
+
+	/// Sets the estimated cost of shading a fragment, in texture samples
+	void setCost(float cost) noexcept final
+	{
+		if (GLTUT_ASSERT(cost >= 0.0f))
+		{
+			mCost = cost;
+		}
+	}
+
+	/// Returns if the shader may discard the fragments
+	bool isDiscarding() const noexcept final
+	{
+		return mDiscarding;
+	}
+
+	/// Sets if the shader may discard the fragments
+	void setDiscarding(bool discarding) noexcept final
+	{
+		mDiscarding = discarding;
 	}
 
 	/// Sets the polygon fill mode
@@ -80,15 +126,51 @@ public:
 		float size = 1.0f,
 		bool enableSizeInShader = false) noexcept
 	{
-		mPolygonFill = mode;
-		mPolygonFillSize = size;
-		mPolygonFillSizeInShader = enableSizeInShader;
+		mPipeline.polygonFill = mode;
+		mPipeline.polygonFillSize = size;
+		mPipeline.polygonFillSizeInShader = enableSizeInShader;
+		updatePipelineState();
 	}
 
+	/**
+		\brief Returns the pipeline state of the pass with the default depth test and writes.
+		The render passes derive their pipeline states from it
+		\return The state or nullptr if the pass has no shader or the state cannot be created
+	*/
+	const PipelineState* getPipelineState() const noexcept;
+
 	/// Binds the material pass for a render geometry
 	void bind(const RenderGeometry* geometry) const noexcept final;
 
+	/**
+		\brief Binds the shader arguments, the parameter block, the textures and the uniform buffers of the material pass.
+		The shader must be bound by the pipeline state before, the matrices of the draws are then bound by bindGeometry() or bindMatrixSource()
+	*/
+	void bindMaterial() const noexcept;
+
+	/**
+		\brief Binds only the geometry-dependent shader parameters.
+		Used for consecutive geometries of the same material pass,
+		when the rest of the state is already bound by bind()
+	*/
+	void bindGeometry(const RenderGeometry* geometry) const noexcept;
+
+	/**
+		\brief Switches the shader to the matrices of a source other than the uniforms.
+		Used for the instanced and the object buffer draws after bindMaterial()
+	*/
+	void bindMatrixSource(RendererBinding::MatrixSource source) const noexcept;
+
 private:
+	/// Updates the pipeline state after a change of its parts
+	void updatePipelineState() noexcept;
+
+	/// Allocates the range of the parameter block of the shader, releasing the previous one
+	void updateBlockRange() noexcept;
+
+	/// Uploads the parameter block if it changes and binds its range
+	void bindBlock() const noexcept;
+
 	/// The graphics device
 	GraphicsDevice& mDevice;
 
@@ -98,26 +180,32 @@ private:
 	/// The shader arguments
 	ShaderArguments mShaderArguments;
 
+	/// The uniform buffers of the material parameter blocks
+	MaterialBufferC& mMaterialBuffer;
+
+	/// The range of the parameter block, empty if the shader has no parameter block
+	MaterialBufferC::Range mBlockRange;
+
+	/// The version of the parameter block uploaded to the range
+	mutable u64 mUploadedBlockVersion = 0;
+
 	/// The textures
 	TextureSetC mTextures;
 
 	/// The shader uniform buffers
 	ShaderUniformBufferSetC mShaderUniformBuffers;
 
-	/// The face mode
-	FaceCullingMode mFaceCulling = FaceCullingMode::BACK;
-
-	/// The transparency flag
-	bool mTransparent = false;
+	/// The pipeline state with the default depth test and writes
+	PipelineState mPipeline;
 
-	/// The polygon fill mode
-	PolygonFillMode mPolygonFill = PolygonFillMode::SOLID;
+	/// The cached pipeline state, nullptr if it cannot be created
+	const PipelineState* mPipelineState = nullptr;
 
-	/// The polygon fill size
-	float mPolygonFillSize = 1.0f;
+	/// The estimated cost of shading a fragment, in texture samples
+	float mCost = 0.0f;
 
-	/// If true, the polygon fill size is passed to the shader
-	bool mPolygonFillSizeInShader = false;
+	/// If the shader may discard the fragments
+	bool mDiscarding = false;
 };
 
 // End of the namespace gltut
@@ -23,8 +23,10 @@ public:
 
 		mGeometry(geometry),
 		mMaterial(material),
-		mTransform(transform)
+		mTransform(transform),
+		mNormalMatrix(gltut::getNormalMatrix(transform.getMatrix3()))
 	{
+		updateGlobalBounds();
 	}
 
 	/// Returns the geometry geometry
@@ -37,6 +39,7 @@ public:
 	void setGeometry(const Geometry* geometry) noexcept final
 	{
 		mGeometry = geometry;
+		updateGlobalBounds();
 	}
 
 	/// Returns the material
@@ -61,12 +64,47 @@ public:
 	void setTransform(const Matrix4& transform) noexcept final
 	{
 		mTransform = transform;
+		mNormalMatrix = gltut::getNormalMatrix(transform.getMatrix3());
+		updateGlobalBounds();
+	}
+
+	/// Returns the normal matrix of the transform
+	const Matrix3& getNormalMatrix() const noexcept final
+	{
+		return mNormalMatrix;
+	}
+
+	/// Returns the bounds of the transformed geometry, nullptr if there is no geometry
+	const Box3* getGlobalBounds() const noexcept final
+	{
+		return mGeometry != nullptr ? &mGlobalBounds : nullptr;
+	}
+
+	/// Returns the enclosing volume
+	const BoundingVolume* getParentVolume() const noexcept final
+	{
+		return mParentVolume;
+	}
+
+	/// Sets the enclosing volume
+	void setParentVolume(const BoundingVolume* volume) noexcept final
+	{
+		mParentVolume = volume;
 	}
 
 	/// Renders the object
 	void render(u32 materialPass) const noexcept final;
 
 private:
+	/// Updates the global bounds from the geometry bounds and the transform
+	void updateGlobalBounds() noexcept
+	{
+		if (mGeometry != nullptr)
+		{
+			mGlobalBounds = transformBox(mGeometry->getBounds(), mTransform);
+		}
+	}
+
 	/// The geometry
 	const Geometry* mGeometry = nullptr;
 
@@ -75,6 +113,15 @@ private:
 
 	/// The transformation matrix
 	Matrix4 mTransform = Matrix4::identity();
+
+	/// The normal matrix of the transform
+	Matrix3 mNormalMatrix = Matrix3::identity();
+
+	/// The bounds of the transformed geometry
+	Box3 mGlobalBounds;
+
+	/// The enclosing volume
+	const BoundingVolume* mParentVolume = nullptr;
 };
 
 // End of the namespace gltut
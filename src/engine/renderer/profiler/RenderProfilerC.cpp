@@ -0,0 +1,279 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "RenderProfilerC.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "../../core/File.h"
+#include "../../core/Json.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The nanoseconds in a millisecond
+constexpr float NANOSECONDS_PER_MILLISECOND = 1.0e6f;
+
+// Local functions
+/// Writes a string as a quoted CSV field
+void writeCsvString(std::ostringstream& stream, const char* string)
+{
+	stream << '"';
+	for (const char* c = string; *c != '\0'; ++c)
+	{
+		// The quotes are doubled
+		if (*c == '"')
+		{
+			stream << '"';
+		}
+		stream << *c;
+	}
+	stream << '"';
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+RenderProfilerC::RenderProfilerC(GraphicsDevice& device) noexcept :
+
+	mPool(device.getProfilerQueries())
+{
+}
+
+RenderProfilerC::~RenderProfilerC() noexcept
+{
+	removeAllPasses();
+}
+
+void RenderProfilerC::setEnabled(bool enabled) noexcept
+{
+	if (enabled == mEnabled)
+	{
+		return;
+	}
+
+	removeAllPasses();
+	mEnabled = enabled && mPool != nullptr;
+}
+
+float RenderProfilerC::getFrameTime() const noexcept
+{
+	float result = 0.0f;
+	for (const PassState* state : mExecuted)
+	{
+		result += state->profile.time;
+	}
+	return result;
+}
+
+bool RenderProfilerC::saveCsv(const char* path) const noexcept
+{
+	GLTUT_CATCH_ALL_BEGIN
+	GLTUT_CHECK(path != nullptr, "The path is null");
+	writeStringToFile(path, getCsv());
+	return true;
+	GLTUT_CATCH_ALL_END("Cannot save the render pass profiles to a CSV file")
+	return false;
+}
+
+bool RenderProfilerC::saveJson(const char* path) const noexcept
+{
+	GLTUT_CATCH_ALL_BEGIN
+	GLTUT_CHECK(path != nullptr, "The path is null");
+	writeStringToFile(path, getJson());
+	return true;
+	GLTUT_CATCH_ALL_END("Cannot save the render pass profiles to a JSON file")
+	return false;
+}
+
+void RenderProfilerC::beginFrame() noexcept
+{
+	mExecuted.clear();
+	if (!mEnabled)
+	{
+		return;
+	}
+
+	++mFrame;
+	for (auto& [pass, state] : mStates)
+	{
+		for (u32 i = 0; i < FRAME_QUERY_COUNT; ++i)
+		{
+			readResult(state, i);
+		}
+	}
+}
+
+void RenderProfilerC::beginPass(const RenderPass* pass) noexcept
+{
+	if (!mEnabled || !GLTUT_ASSERT(mActiveQuery == 0))
+	{
+		return;
+	}
+
+	GLTUT_CATCH_ALL_BEGIN
+	PassState& state = mStates[pass];
+	state.profile.pass = pass;
+	mExecuted.push_back(&state);
+
+	// The query of two frames ago is reused only after its result is read
+	const u32 frameQuery = mFrame % FRAME_QUERY_COUNT;
+	readResult(state, frameQuery);
+	if (state.pending[frameQuery])
+	{
+		return;
+	}
+
+	u32& query = state.queries[frameQuery];
+	if (query == 0)
+	{
+		query = mPool->acquire();
+		if (query == 0)
+		{
+			return;
+		}
+	}
+
+	mPool->begin(query);
+	state.pending[frameQuery] = true;
+	mActiveQuery = query;
+	GLTUT_CATCH_ALL_END("Cannot start profiling a render pass")
+}
+
+void RenderProfilerC::endPass() noexcept
+{
+	if (mActiveQuery != 0)
+	{
+		mPool->end(mActiveQuery);
+		mActiveQuery = 0;
+	}
+}
+
+void RenderProfilerC::removePass(const RenderPass* pass) noexcept
+{
+	const auto found = mStates.find(pass);
+	if (found == mStates.end())
+	{
+		return;
+	}
+
+	releaseQueries(found->second);
+	mExecuted.erase(
+		std::remove(mExecuted.begin(), mExecuted.end(), &found->second),
+		mExecuted.end());
+	mStates.erase(found);
+}
+
+void RenderProfilerC::removeAllPasses() noexcept
+{
+	for (auto& [pass, state] : mStates)
+	{
+		releaseQueries(state);
+	}
+	mStates.clear();
+	mExecuted.clear();
+}
+
+void RenderProfilerC::readResult(PassState& state, u32 frameQuery) noexcept
+{
+	if (!state.pending[frameQuery])
+	{
+		return;
+	}
+
+	const std::optional<ProfilerQueryPool::Result> result = mPool->getResult(state.queries[frameQuery]);
+	if (!result.has_value())
+	{
+		return;
+	}
+
+	state.pending[frameQuery] = false;
+	// The first execution includes the lazy driver work, e.g. the shader compilation
+	if (!state.warmedUp)
+	{
+		state.warmedUp = true;
+		return;
+	}
+
+	RenderPassProfile& profile = state.profile;
+	profile.time = static_cast<float>(result->time) / NANOSECONDS_PER_MILLISECOND;
+	profile.vertices = result->vertices;
+	profile.primitives = result->primitives;
+	profile.fragments = result->fragments;
+
+	state.history[state.historyNext] = profile.time;
+	state.historyNext = (state.historyNext + 1) % HISTORY_SIZE;
+	state.historySize = std::min(state.historySize + 1, HISTORY_SIZE);
+
+	float sum = 0.0f;
+	profile.maxTime = 0.0f;
+	for (u32 i = 0; i < state.historySize; ++i)
+	{
+		sum += state.history[i];
+		profile.maxTime = std::max(profile.maxTime, state.history[i]);
+	}
+	profile.averageTime = sum / static_cast<float>(state.historySize);
+}
+
+void RenderProfilerC::releaseQueries(PassState& state) noexcept
+{
+	for (u32& query : state.queries)
+	{
+		if (query != 0)
+		{
+			mPool->release(query);
+			query = 0;
+		}
+	}
+}
+
+std::string RenderProfilerC::getCsv() const
+{
+	std::ostringstream stream;
+	stream << "index,name,time_ms,average_time_ms,max_time_ms,vertices,primitives,fragments\n";
+	for (size_t i = 0; i < mExecuted.size(); ++i)
+	{
+		const RenderPassProfile& profile = mExecuted[i]->profile;
+		stream << i << ',';
+		writeCsvString(stream, profile.pass->getName());
+		stream << ',' << profile.time <<
+			',' << profile.averageTime <<
+			',' << profile.maxTime <<
+			',' << profile.vertices <<
+			',' << profile.primitives <<
+			',' << profile.fragments << '\n';
+	}
+	return stream.str();
+}
+
+std::string RenderProfilerC::getJson() const
+{
+	std::ostringstream stream;
+	stream << "{\n\t\"frameTimeMs\": " << getFrameTime() <<
+		",\n\t\"pipelineStatistics\": " << (hasPipelineStatistics() ? "true" : "false") <<
+		",\n\t\"passes\": [";
+	for (size_t i = 0; i < mExecuted.size(); ++i)
+	{
+		const RenderPassProfile& profile = mExecuted[i]->profile;
+		stream << (i == 0 ? "\n" : ",\n") << "\t\t{\"index\": " << i << ", \"name\": ";
+		writeJsonString(stream, profile.pass->getName());
+		stream << ", \"timeMs\": " << profile.time <<
+			", \"averageTimeMs\": " << profile.averageTime <<
+			", \"maxTimeMs\": " << profile.maxTime <<
+			", \"vertices\": " << profile.vertices <<
+			", \"primitives\": " << profile.primitives <<
+			", \"fragments\": " << profile.fragments << '}';
+	}
+	stream << "\n\t]\n}\n";
+	return stream.str();
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,154 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDevice.h"
+#include "engine/renderer/RenderProfiler.h"
+
+namespace gltut
+{
+// Global classes
+/// Implementation of the RenderProfiler interface
+class RenderProfilerC final : public RenderProfiler, public NonCopyable
+{
+public:
+	/// Constructor
+	explicit RenderProfilerC(GraphicsDevice& device) noexcept;
+
+	/// Destructor, returns the queries to the pool
+	~RenderProfilerC() noexcept final;
+
+	/// Returns if the device supports the profiling
+	bool isSupported() const noexcept final
+	{
+		return mPool != nullptr;
+	}
+
+	/// Returns if the device counts the vertices, the primitives and the fragments
+	bool hasPipelineStatistics() const noexcept final
+	{
+		return mPool != nullptr && mPool->hasPipelineStatistics();
+	}
+
+	/// Enables or disables the profiling
+	void setEnabled(bool enabled) noexcept final;
+
+	/// Returns if the profiling is enabled
+	bool isEnabled() const noexcept final
+	{
+		return mEnabled;
+	}
+
+	/// Returns the number of the profiled passes executed in the last frame
+	u32 getPassCount() const noexcept final
+	{
+		return static_cast<u32>(mExecuted.size());
+	}
+
+	/// Returns the profile of the i-th pass executed in the last frame
+	const RenderPassProfile* getPass(u32 index) const noexcept final
+	{
+		return index < mExecuted.size() ? &mExecuted[index]->profile : nullptr;
+	}
+
+	/// Returns the sum of the latest GPU times of the passes executed in the last frame
+	float getFrameTime() const noexcept final;
+
+	/// Saves the profiles of the passes executed in the last frame to a CSV file
+	bool saveCsv(const char* path) const noexcept final;
+
+	/// Saves the profiles of the passes executed in the last frame to a JSON file
+	bool saveJson(const char* path) const noexcept final;
+
+	/// Starts a frame: reads the available results of the previous frames without waiting
+	void beginFrame() noexcept;
+
+	/**
+		\brief Starts measuring the execution of a pass.
+		The pass is not measured in this frame if the result of its query of two frames ago is not available yet
+	*/
+	void beginPass(const RenderPass* pass) noexcept;
+
+	/// Ends measuring the pass started by beginPass()
+	void endPass() noexcept;
+
+	/// Removes the profile of a pass
+	void removePass(const RenderPass* pass) noexcept;
+
+	/// Removes the profiles of all passes
+	void removeAllPasses() noexcept;
+
+private:
+	/// The number of the queries of a pass, used in turns by the consecutive frames
+	static constexpr u32 FRAME_QUERY_COUNT = 2;
+
+	/// The number of the recent executions of the rolling average and maximum
+	static constexpr u32 HISTORY_SIZE = 64;
+
+	/// The profiling state of a pass
+	struct PassState
+	{
+		/// The queries of the frames, 0 if not acquired
+		std::array<u32, FRAME_QUERY_COUNT> queries{};
+
+		/// If the queries are issued and their results are not read yet
+		std::array<bool, FRAME_QUERY_COUNT> pending{};
+
+		/// The GPU times of the recent executions, in milliseconds
+		std::array<float, HISTORY_SIZE> history{};
+
+		/// The number of the recent executions in the history
+		u32 historySize = 0;
+
+		/// The index of the next execution in the history
+		u32 historyNext = 0;
+
+		/// If the first measured execution is read and discarded
+		bool warmedUp = false;
+
+		/// The profile
+		RenderPassProfile profile;
+	};
+
+	/// Reads the result of a pending query of a pass if it is available
+	void readResult(PassState& state, u32 frameQuery) noexcept;
+
+	/// Returns the queries of a pass to the pool
+	void releaseQueries(PassState& state) noexcept;
+
+	/// Returns the profiles of the passes executed in the last frame as CSV
+	std::string getCsv() const;
+
+	/// Returns the profiles of the passes executed in the last frame as JSON
+	std::string getJson() const;
+
+	/// The profiler query pool of the device, nullptr if the device does not support the profiling
+	ProfilerQueryPool* mPool;
+
+	/// If the profiling is enabled
+	bool mEnabled = false;
+
+	/// The current frame
+	u32 mFrame = 0;
+
+	/// The states of the passes
+	std::unordered_map<const RenderPass*, PassState> mStates;
+
+	/// The states of the passes executed in the current frame, in the execution order
+	std::vector<PassState*> mExecuted;
+
+	/// The query being measured, 0 if none
+	u32 mActiveQuery = 0;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,383 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "RenderGraphC.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace gltut
+{
+// Global classes
+RenderGraphC::RenderGraphC(GraphicsDevice& device) noexcept :
+
+	mDevice(device)
+{
+}
+
+RenderGraphC::~RenderGraphC() noexcept
+{
+	for (const SharedTarget& shared : mSharedTargets)
+	{
+		removeFramebuffer(shared.framebuffer);
+	}
+}
+
+TextureFramebuffer* RenderGraphC::createTarget(
+	const Point2u* size,
+	const TextureFormat* colorFormat,
+	bool depth) noexcept
+{
+	TextureFramebuffer* result = nullptr;
+	GLTUT_CATCH_ALL_BEGIN
+	result = mTargets.emplace_back(std::make_unique<TransientTargetC>(
+		mDevice,
+		size,
+		colorFormat,
+		depth)).get();
+	GLTUT_CATCH_ALL_END("Cannot create a transient render target")
+	return result;
+}
+
+void RenderGraphC::removeTarget(TextureFramebuffer* target) noexcept
+{
+	auto it = std::find_if(
+		mTargets.begin(),
+		mTargets.end(),
+		[&target](const auto& currentTarget)
+		{
+			return currentTarget.get() == target;
+		});
+
+	// The shared framebuffer of the target is removed by the next compilation
+	if (it != mTargets.end())
+	{
+		mTargets.erase(it);
+	}
+}
+
+bool RenderGraphC::compile(const Passes& passes) noexcept
+{
+	GLTUT_CATCH_ALL_BEGIN
+	build(passes);
+	sort();
+	cull();
+	assignTargets();
+	return true;
+	GLTUT_CATCH_ALL_END("Cannot compile the render graph")
+
+	mOrder.clear();
+	return false;
+}
+
+void RenderGraphC::build(const Passes& passes)
+{
+	const u32 count = static_cast<u32>(std::count_if(
+		passes.begin(),
+		passes.end(),
+		[](const auto& pass)
+		{
+			return pass.first->isActive();
+		}));
+
+	// The nodes are reused to keep the capacities of the successor lists
+	mNodes.resize(count);
+	u32 index = 0;
+	for (const auto& item : passes)
+	{
+		RenderPass* pass = item.first.get();
+		if (!pass->isActive())
+		{
+			continue;
+		}
+
+		Node& node = mNodes[index++];
+		node.pass = pass;
+		node.successors.clear();
+		node.predecessors = 0;
+		node.placed = false;
+		node.live = false;
+
+		const Framebuffer* target = pass->getTarget();
+		node.target = findTarget(target);
+		if (const auto* textureTarget = dynamic_cast<const TextureFramebuffer*>(target);
+			textureTarget != nullptr)
+		{
+			node.outputs = {textureTarget->getColor(), textureTarget->getDepth()};
+		}
+		else
+		{
+			node.outputs = {target, nullptr};
+		}
+	}
+
+	for (u32 i = 0; i < count; ++i)
+	{
+		const Node& writer = mNodes[i];
+		for (u32 j = 0; j < count; ++j)
+		{
+			// The readers go after the writers, the writers of a texture keep the priority order
+			const Node& node = mNodes[j];
+			if (i != j &&
+				(readsOutput(node, writer) ||
+				 (i < j && (writes(node, writer.outputs[0]) || writes(node, writer.outputs[1])))))
+			{
+				mNodes[i].successors.push_back(j);
+				++mNodes[j].predecessors;
+			}
+		}
+	}
+}
+
+void RenderGraphC::sort()
+{
+	const u32 count = static_cast<u32>(mNodes.size());
+	mNodeOrder.clear();
+	while (mNodeOrder.size() < count)
+	{
+		// The first ready node in the priority order.
+		// The nodes of a dependency cycle keep the priority order
+		u32 next = count;
+		u32 firstRemaining = count;
+		for (u32 i = 0; i < count && next == count; ++i)
+		{
+			if (!mNodes[i].placed)
+			{
+				firstRemaining = std::min(firstRemaining, i);
+				if (mNodes[i].predecessors == 0)
+				{
+					next = i;
+				}
+			}
+		}
+
+		if (next == count)
+		{
+			next = firstRemaining;
+		}
+
+		Node& node = mNodes[next];
+		node.placed = true;
+		mNodeOrder.push_back(next);
+		for (const u32 successor : node.successors)
+		{
+			if (mNodes[successor].predecessors > 0)
+			{
+				--mNodes[successor].predecessors;
+			}
+		}
+	}
+}
+
+void RenderGraphC::cull()
+{
+	// The readers follow the writers, so the liveness of the readers is known
+	for (auto it = mNodeOrder.rbegin(); it != mNodeOrder.rend(); ++it)
+	{
+		Node& node = mNodes[*it];
+		node.live = node.target == nullptr;
+		for (u32 i = 0; i < mNodes.size() && !node.live; ++i)
+		{
+			node.live = mNodes[i].live && readsOutput(mNodes[i], node);
+		}
+	}
+
+	mOrder.clear();
+	for (const u32 index : mNodeOrder)
+	{
+		if (mNodes[index].live)
+		{
+			mOrder.push_back(mNodes[index].pass);
+		}
+	}
+}
+
+void RenderGraphC::assignTargets()
+{
+	constexpr u32 NO_POSITION = std::numeric_limits<u32>::max();
+
+	mLifetimes.clear();
+	for (const auto& target : mTargets)
+	{
+		u32 first = NO_POSITION;
+		u32 last = 0;
+		u32 position = 0;
+		for (const u32 index : mNodeOrder)
+		{
+			const Node& node = mNodes[index];
+			if (!node.live)
+			{
+				continue;
+			}
+
+			if (node.target == target.get())
+			{
+				first = std::min(first, position);
+				last = std::max(last, position);
+			}
+			else if (reads(*node.pass, target->getColor()) || reads(*node.pass, target->getDepth()))
+			{
+				last = std::max(last, position);
+			}
+			++position;
+		}
+
+		if (first == NO_POSITION)
+		{
+			target->setFramebuffer(nullptr);
+		}
+		else
+		{
+			mLifetimes.push_back({first, last, target.get()});
+		}
+	}
+
+	std::sort(
+		mLifetimes.begin(),
+		mLifetimes.end(),
+		[](const Lifetime& lifetime1, const Lifetime& lifetime2)
+		{
+			return lifetime1.first < lifetime2.first;
+		});
+
+	for (SharedTarget& shared : mSharedTargets)
+	{
+		shared.used = false;
+	}
+
+	for (const Lifetime& lifetime : mLifetimes)
+	{
+		TransientTargetC* target = lifetime.target;
+		target->updateSize();
+		auto shared = std::find_if(
+			mSharedTargets.begin(),
+			mSharedTargets.end(),
+			[&lifetime](const SharedTarget& current)
+			{
+				return (!current.used || current.last < lifetime.first) &&
+					lifetime.target->isCompatible(*current.framebuffer);
+			});
+
+		if (shared == mSharedTargets.end())
+		{
+			TextureFramebuffer* framebuffer = createFramebuffer(*target);
+			if (framebuffer == nullptr)
+			{
+				target->setFramebuffer(nullptr);
+				continue;
+			}
+			shared = mSharedTargets.insert(mSharedTargets.end(), {framebuffer, 0, false});
+		}
+
+		shared->used = true;
+		shared->last = lifetime.last;
+		target->setFramebuffer(shared->framebuffer);
+	}
+
+	// Removes the framebuffers of the removed, culled or resized targets
+	auto unused = std::partition(
+		mSharedTargets.begin(),
+		mSharedTargets.end(),
+		[](const SharedTarget& shared)
+		{
+			return shared.used;
+		});
+
+	for (auto it = unused; it != mSharedTargets.end(); ++it)
+	{
+		removeFramebuffer(it->framebuffer);
+	}
+	mSharedTargets.erase(unused, mSharedTargets.end());
+}
+
+TransientTargetC* RenderGraphC::findTarget(const Framebuffer* framebuffer) const noexcept
+{
+	auto it = std::find_if(
+		mTargets.begin(),
+		mTargets.end(),
+		[&framebuffer](const auto& target)
+		{
+			return target.get() == framebuffer;
+		});
+	return it != mTargets.end() ? it->get() : nullptr;
+}
+
+bool RenderGraphC::reads(const RenderPass& pass, const void* resource) noexcept
+{
+	if (resource == nullptr)
+	{
+		return false;
+	}
+
+	for (u32 i = 0; i < pass.getInputCount(); ++i)
+	{
+		if (pass.getInput(i) == resource)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+TextureFramebuffer* RenderGraphC::createFramebuffer(const TransientTargetC& target) noexcept
+{
+	TextureManager* textures = mDevice.getTextures();
+	const Texture2* colorDescription = target.getColor();
+	const Texture2* depthDescription = target.getDepth();
+
+	Texture2* color = colorDescription != nullptr ?
+		textures->create(
+			{nullptr, target.getTextureSize(), colorDescription->getFormat()},
+			colorDescription->getParameters()) :
+		nullptr;
+
+	Texture2* depth = depthDescription != nullptr ?
+		textures->create(
+			{nullptr, target.getTextureSize(), depthDescription->getFormat()},
+			depthDescription->getParameters()) :
+		nullptr;
+
+	TextureFramebuffer* result = nullptr;
+	if ((color != nullptr || colorDescription == nullptr) &&
+		(depth != nullptr || depthDescription == nullptr))
+	{
+		result = mDevice.getFramebuffers()->create(color, depth);
+	}
+
+	if (result == nullptr)
+	{
+		if (color != nullptr)
+		{
+			textures->remove(color);
+		}
+
+		if (depth != nullptr)
+		{
+			textures->remove(depth);
+		}
+	}
+	return result;
+}
+
+void RenderGraphC::removeFramebuffer(TextureFramebuffer* framebuffer) noexcept
+{
+	Texture2* color = framebuffer->getColor();
+	Texture2* depth = framebuffer->getDepth();
+
+	// The framebuffer goes first because it references the textures
+	mDevice.getFramebuffers()->remove(framebuffer);
+	if (color != nullptr)
+	{
+		mDevice.getTextures()->remove(color);
+	}
+
+	if (depth != nullptr)
+	{
+		mDevice.getTextures()->remove(depth);
+	}
+}
+
+// End of the namespace gltut
+}
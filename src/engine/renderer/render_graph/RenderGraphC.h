@@ -0,0 +1,175 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDevice.h"
+#include "engine/renderer/RenderPass.h"
+
+#include "TransientTargetC.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Orders the render passes by the textures they write and read.
+	A pass writes the textures of its target, or the target itself if it is not a texture framebuffer,
+	and reads the textures declared with RenderPass::addInput().
+	The writers of a texture are executed before its readers,
+	the writers of the same texture keep the order of the priorities.
+	The passes writing only transient targets which no executed pass reads are culled,
+	the transient targets with non-overlapping lifetimes share the textures.
+*/
+class RenderGraphC : public NonCopyable
+{
+public:
+	/// The render passes with their priorities, sorted by the priorities
+	using Passes = std::vector<std::pair<std::unique_ptr<RenderPass>, int32>>;
+
+	/// Constructor
+	explicit RenderGraphC(GraphicsDevice& device) noexcept;
+
+	/// Destructor
+	~RenderGraphC() noexcept;
+
+	/// Creates a transient target
+	TextureFramebuffer* createTarget(
+		const Point2u* size,
+		const TextureFormat* colorFormat,
+		bool depth) noexcept;
+
+	/// Removes a transient target
+	void removeTarget(TextureFramebuffer* target) noexcept;
+
+	/**
+		\brief Orders and culls the active passes, assigns the textures of the transient targets
+		\return false if the graph cannot be compiled
+	*/
+	bool compile(const Passes& passes) noexcept;
+
+	/// Returns the passes to execute, in the execution order
+	const std::vector<RenderPass*>& getPasses() const noexcept
+	{
+		return mOrder;
+	}
+
+private:
+	/// A pass of the graph
+	struct Node
+	{
+		/// The pass
+		RenderPass* pass = nullptr;
+
+		/// The written resources: the target textures or the target itself
+		std::array<const void*, 2> outputs = {};
+
+		/// The written transient target, nullptr if the target is not transient
+		TransientTargetC* target = nullptr;
+
+		/// The nodes executed after this node
+		std::vector<u32> successors;
+
+		/// The number of the nodes executed before this node
+		u32 predecessors = 0;
+
+		/// If the node is placed to the order
+		bool placed = false;
+
+		/// If the output of the node is used
+		bool live = false;
+	};
+
+	/// The lifetime of a transient target, in the positions of the executed passes
+	struct Lifetime
+	{
+		/// The first position
+		u32 first;
+
+		/// The last position
+		u32 last;
+
+		/// The target
+		TransientTargetC* target;
+	};
+
+	/// A framebuffer shared by the transient targets
+	struct SharedTarget
+	{
+		/// The framebuffer
+		TextureFramebuffer* framebuffer;
+
+		/// The last position the framebuffer is used at
+		u32 last;
+
+		/// If the framebuffer is used in the current frame
+		bool used;
+	};
+
+	/// Collects the active passes and their dependencies
+	void build(const Passes& passes);
+
+	/// Orders the nodes topologically, keeping the priority order of the independent nodes
+	void sort();
+
+	/// Keeps the nodes whose outputs are used
+	void cull();
+
+	/// Assigns the shared framebuffers to the transient targets
+	void assignTargets();
+
+	/// Returns the transient target, nullptr if the framebuffer is not a transient target
+	TransientTargetC* findTarget(const Framebuffer* framebuffer) const noexcept;
+
+	/// Returns if a pass reads a resource
+	static bool reads(const RenderPass& pass, const void* resource) noexcept;
+
+	/// Returns if a node writes a resource
+	static bool writes(const Node& node, const void* resource) noexcept
+	{
+		return resource != nullptr &&
+			(node.outputs[0] == resource || node.outputs[1] == resource);
+	}
+
+	/// Returns if a node reads an output of another node
+	static bool readsOutput(const Node& reader, const Node& writer) noexcept
+	{
+		return reads(*reader.pass, writer.outputs[0]) || reads(*reader.pass, writer.outputs[1]);
+	}
+
+	/// Creates a shared framebuffer for a transient target
+	TextureFramebuffer* createFramebuffer(const TransientTargetC& target) noexcept;
+
+	/// Removes a shared framebuffer with its textures
+	void removeFramebuffer(TextureFramebuffer* framebuffer) noexcept;
+
+	/// The device
+	GraphicsDevice& mDevice;
+
+	/// The transient targets
+	std::vector<std::unique_ptr<TransientTargetC>> mTargets;
+
+	/// The nodes of the active passes, in the priority order
+	std::vector<Node> mNodes;
+
+	/// The indices of the nodes in the execution order
+	std::vector<u32> mNodeOrder;
+
+	/// The passes to execute
+	std::vector<RenderPass*> mOrder;
+
+	/// The lifetimes of the used transient targets
+	std::vector<Lifetime> mLifetimes;
+
+	/// The framebuffers shared by the transient targets
+	std::vector<SharedTarget> mSharedTargets;
+};
+
+// End of the namespace gltut
+}
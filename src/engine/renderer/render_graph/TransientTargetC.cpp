@@ -0,0 +1,162 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "TransientTargetC.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The format of the depth textures, as created by the texture factory
+constexpr TextureFormat DEPTH_FORMAT = TextureFormat::FLOAT;
+
+// Local functions
+/// Returns if the texture parameters are equal
+bool isEqual(const TextureParameters& first, const TextureParameters& second) noexcept
+{
+	return first.minFilter == second.minFilter &&
+		first.magFilter == second.magFilter &&
+		first.wrapMode == second.wrapMode;
+}
+
+/// Returns if a framebuffer texture matches a transient texture: both missing or the same format and parameters
+bool isCompatibleTexture(const Texture2* texture, const TransientTextureC* transient) noexcept
+{
+	if ((texture != nullptr) != (transient != nullptr))
+	{
+		return false;
+	}
+
+	return texture == nullptr ||
+		(texture->getFormat() == transient->getFormat() &&
+			isEqual(texture->getParameters(), transient->getParameters()));
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+TransientTextureC::TransientTextureC(
+	GraphicsDevice& device,
+	TransientTargetC& target,
+	TextureFormat format) noexcept :
+
+	mDevice(device),
+	mTarget(target),
+	mFormat(format),
+	mParameters(
+		TextureFilterMode::NEAREST,
+		TextureFilterMode::NEAREST,
+		TextureWrapMode::CLAMP_TO_EDGE)
+{
+}
+
+void TransientTextureC::setParameters(const TextureParameters& parameters) noexcept
+{
+	mParameters = parameters;
+	if (mTexture != nullptr)
+	{
+		mTexture->setParameters(parameters);
+	}
+}
+
+void TransientTextureC::bind(u32 slot) const noexcept
+{
+	if (mTexture != nullptr)
+	{
+		mTexture->bind(slot);
+	}
+	else
+	{
+		mDevice.bindTexture(nullptr, slot);
+	}
+}
+
+const Point2u& TransientTextureC::getSize() const noexcept
+{
+	return mTarget.getTextureSize();
+}
+
+void TransientTextureC::setSize(const Point2u& size) noexcept
+{
+	mTarget.setSize(size);
+}
+
+void TransientTextureC::setTexture(Texture2* texture) noexcept
+{
+	if (texture != nullptr && !isEqual(texture->getParameters(), mParameters))
+	{
+		texture->setParameters(mParameters);
+	}
+	mTexture = texture;
+}
+
+TransientTargetC::TransientTargetC(
+	GraphicsDevice& device,
+	const Point2u* size,
+	const TextureFormat* colorFormat,
+	bool depth) :
+
+	mDevice(device),
+	mFixedSize(size != nullptr ? std::make_optional(*size) : std::nullopt)
+{
+	GLTUT_CHECK(colorFormat != nullptr || depth, "A transient target must have a texture");
+	if (colorFormat != nullptr)
+	{
+		mColor = std::make_unique<TransientTextureC>(device, *this, *colorFormat);
+	}
+
+	if (depth)
+	{
+		mDepth = std::make_unique<TransientTextureC>(device, *this, DEPTH_FORMAT);
+	}
+	updateSize();
+}
+
+void TransientTargetC::updateSize() noexcept
+{
+	mSize = mFixedSize.has_value() ?
+		*mFixedSize :
+		mDevice.getFramebuffers()->getDefault()->getSize();
+}
+
+void TransientTargetC::bind() const noexcept
+{
+	// The passes writing the target are executed only when the target is assigned
+	if (GLTUT_ASSERT(mFramebuffer != nullptr))
+	{
+		mFramebuffer->bind();
+	}
+}
+
+bool TransientTargetC::isCompatible(const TextureFramebuffer& framebuffer) const noexcept
+{
+	// The aliases share the sampling state of the textures, so only identically sampled targets alias
+	const Point2u size = framebuffer.getSize();
+	return size.x == mSize.x &&
+		size.y == mSize.y &&
+		isCompatibleTexture(framebuffer.getColor(), mColor.get()) &&
+		(framebuffer.getDepth() != nullptr) == (mDepth != nullptr) &&
+		(mDepth == nullptr || isEqual(framebuffer.getDepth()->getParameters(), mDepth->getParameters()));
+}
+
+void TransientTargetC::setFramebuffer(TextureFramebuffer* framebuffer) noexcept
+{
+	mFramebuffer = framebuffer;
+	if (mColor != nullptr)
+	{
+		mColor->setTexture(framebuffer != nullptr ? framebuffer->getColor() : nullptr);
+	}
+
+	if (mDepth != nullptr)
+	{
+		mDepth->setTexture(framebuffer != nullptr ? framebuffer->getDepth() : nullptr);
+	}
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,198 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <memory>
+#include <optional>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDevice.h"
+
+namespace gltut
+{
+// Forward declarations
+class TransientTargetC;
+
+// Global classes
+/**
+	\brief Texture of a transient target.
+	Forwards to the texture the render graph assigns to the target,
+	so the materials keep sampling the same object when the assignment changes
+*/
+class TransientTextureC final : public Texture2, public NonCopyable
+{
+public:
+	/// Constructor
+	TransientTextureC(
+		GraphicsDevice& device,
+		TransientTargetC& target,
+		TextureFormat format) noexcept;
+
+	/// Returns the id of the assigned texture, 0 if there is no texture
+	u32 getId() const noexcept final
+	{
+		return mTexture != nullptr ? mTexture->getId() : 0;
+	}
+
+	/// Returns the texture parameters
+	const TextureParameters& getParameters() const noexcept final
+	{
+		return mParameters;
+	}
+
+	/// Sets the texture parameters
+	void setParameters(const TextureParameters& parameters) noexcept final;
+
+	/// Binds the assigned texture, unbinds the slot if there is no texture
+	void bind(u32 slot) const noexcept final;
+
+	/// Returns the bindless handle of the assigned texture, 0 if there is no texture
+	u64 getBindlessHandle() const noexcept final
+	{
+		return mTexture != nullptr ? mTexture->getBindlessHandle() : 0;
+	}
+
+	/// Returns the texture format
+	TextureFormat getFormat() const noexcept final
+	{
+		return mFormat;
+	}
+
+	/// Returns the size of the target
+	const Point2u& getSize() const noexcept final;
+
+	/// Sets the size of the target
+	void setSize(const Point2u& size) noexcept final;
+
+	/// Sets the assigned texture
+	void setTexture(Texture2* texture) noexcept;
+
+private:
+	/// The device
+	GraphicsDevice& mDevice;
+
+	/// The target
+	TransientTargetC& mTarget;
+
+	/// The format
+	TextureFormat mFormat;
+
+	/// The parameters
+	TextureParameters mParameters;
+
+	/// The assigned texture
+	Texture2* mTexture = nullptr;
+};
+
+/**
+	\brief Render target whose textures are allocated by the render graph.
+	The graph assigns the textures for the frames the target is written and read,
+	the targets of the same description with non-overlapping lifetimes share the textures.
+	The content of the target is not preserved between the frames
+*/
+class TransientTargetC final : public TextureFramebuffer, public NonCopyable
+{
+public:
+	/**
+		\brief Constructor
+		\param size The size of the target, nullptr for the window size
+		\param colorFormat The format of the color texture, nullptr for no color
+		\param depth If the target has a depth texture
+		\throw std::runtime_error If the target has no textures
+	*/
+	TransientTargetC(
+		GraphicsDevice& device,
+		const Point2u* size,
+		const TextureFormat* colorFormat,
+		bool depth);
+
+	/// Returns the size of the target
+	Point2u getSize() const noexcept final
+	{
+		return mSize;
+	}
+
+	/// Returns the size of the textures of the target
+	const Point2u& getTextureSize() const noexcept
+	{
+		return mSize;
+	}
+
+	/// Sets a fixed size of the target
+	void setSize(const Point2u& size) noexcept
+	{
+		mFixedSize = size;
+		mSize = size;
+	}
+
+	/// Updates the size of a window-size target
+	void updateSize() noexcept;
+
+	/// Binds the assigned framebuffer
+	void bind() const noexcept final;
+
+	/// Reads the color content of the assigned framebuffer
+	bool readColor(u8* data) const noexcept final
+	{
+		return mFramebuffer != nullptr && mFramebuffer->readColor(data);
+	}
+
+	/// Returns the color texture
+	Texture2* getColor() const noexcept final
+	{
+		return mColor.get();
+	}
+
+	/// The textures of the target are managed by the render graph, does nothing
+	void setColor(Texture2*) noexcept final
+	{
+	}
+
+	/// Returns the depth texture
+	Texture2* getDepth() const noexcept final
+	{
+		return mDepth.get();
+	}
+
+	/// The textures of the target are managed by the render graph, does nothing
+	void setDepth(Texture2*) noexcept final
+	{
+	}
+
+	/// Returns if a framebuffer matches the description of the target, including the texture parameters
+	bool isCompatible(const TextureFramebuffer& framebuffer) const noexcept;
+
+	/// Returns the assigned framebuffer
+	TextureFramebuffer* getFramebuffer() const noexcept
+	{
+		return mFramebuffer;
+	}
+
+	/// Assigns a framebuffer of the same description, nullptr to release the framebuffer
+	void setFramebuffer(TextureFramebuffer* framebuffer) noexcept;
+
+private:
+	/// The device
+	GraphicsDevice& mDevice;
+
+	/// The fixed size, std::nullopt for the window size
+	std::optional<Point2u> mFixedSize;
+
+	/// The current size
+	Point2u mSize;
+
+	/// The color texture
+	std::unique_ptr<TransientTextureC> mColor;
+
+	/// The depth texture
+	std::unique_ptr<TransientTextureC> mDepth;
+
+	/// The assigned framebuffer
+	TextureFramebuffer* mFramebuffer = nullptr;
+};
+
+// End of the namespace gltut
+}
@@ -5,9 +5,46 @@
 // Includes
 #include "DepthSortedRenderPassC.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "../../core/Float4.h"
+#include "../../core/RadixSort.h"
+
 namespace gltut
 {
 
+namespace
+{
+// Local constants
+/**
+	\brief The number of the entry moves per entry after which the insertion sort gives up.
+	Bounds the insertion sort to linear time when the order changes a lot
+*/
+constexpr size_t INSERTION_SORT_MOVES_PER_ENTRY = 4;
+
+// Local functions
+/// Maps 4 floats to the unsigned keys with the same order
+void storeSortKeys(Float4 values, u32* keys) noexcept
+{
+	// Flips all bits of the negative values and the sign bit of the non-negative ones
+#ifdef GLTUT_FLOAT4_SSE2
+	const __m128i bits = _mm_castps_si128(values);
+	const __m128i flip = _mm_or_si128(_mm_srai_epi32(bits, 31), _mm_set1_epi32(static_cast<int>(0x80000000u)));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(keys), _mm_xor_si128(bits, flip));
+#else
+	std::memcpy(keys, values.lanes, sizeof(values.lanes));
+	for (u32 i = 0; i < 4; ++i)
+	{
+		keys[i] = (keys[i] & 0x80000000u) != 0 ? ~keys[i] : (keys[i] | 0x80000000u);
+	}
+#endif
+}
+
+// End of the anonymous namespace
+}
+
 // Global classes
 DepthSortedRenderPassC::DepthSortedRenderPassC(
 	const Viewpoint* viewpoint,
@@ -19,7 +56,8 @@ DepthSortedRenderPassC::DepthSortedRenderPassC(
 	const Rectangle2u* viewport,
 	GraphicsDevice& device,
 	const ShaderBindings& shaderBindings,
-	const ShaderUniformBufferBindings& shaderUniformBufferBindings) noexcept :
+	const ShaderUniformBufferBindings& shaderUniformBufferBindings,
+	ObjectBufferC& objectBuffer) noexcept :
 
 	RenderPassC(
 		viewpoint,
@@ -31,7 +69,8 @@ DepthSortedRenderPassC::DepthSortedRenderPassC(
 		viewport,
 		device,
 		shaderBindings,
-		shaderUniformBufferBindings),
+		shaderUniformBufferBindings,
+		objectBuffer),
 
 	mGroup(group)
 {
@@ -39,28 +78,116 @@ DepthSortedRenderPassC::DepthSortedRenderPassC(
 
 void DepthSortedRenderPassC::execute() noexcept
 {
-	const Matrix4 viewMatrix = getViewpoint()->getViewMatrix();
-	if (!(mViewMatrix - viewMatrix).isNearZero())
+	if (!mSorted)
+	{
+		build();
+	}
+	mSorted = false;
+	RenderPassC::execute(&mSortedGroup);
+}
+
+u32 DepthSortedRenderPassC::beginBuild() noexcept
+{
+	mSorted = false;
+	mBuildViewMatrix = getViewpoint()->getViewMatrix();
+	return 0;
+}
+
+void DepthSortedRenderPassC::endBuild() noexcept
+{
+	GLTUT_CATCH_ALL_BEGIN
+	updateKeys();
+	// The order of the previous build is usually nearly sorted
+	if (!insertionSort())
 	{
-		mViewMatrix = viewMatrix;
-		mSortedGroup.clear();
-		for (u32 i = 0; i < mGroup->getSize(); ++i)
+		radixSort(
+			mEntries,
+			mSortBuffer,
+			[](const Entry& entry)
+			{
+				return entry.key;
+			});
+	}
+
+	mSortedGroup.clear();
+	for (const Entry& entry : mEntries)
+	{
+		mSortedGroup.add(mGroup->get(entry.index));
+	}
+	GLTUT_CATCH_ALL_END("Cannot sort a depth-sorted render pass")
+	mSorted = true;
+}
+
+void DepthSortedRenderPassC::updateKeys()
+{
+	const u32 size = mGroup->getSize();
+	if (mEntries.size() != size)
+	{
+		mEntries.resize(size);
+		for (u32 i = 0; i < size; ++i)
 		{
-			mSortedGroup.add(mGroup->get(i));
+			mEntries[i].index = i;
 		}
+	}
+
+	// The positions are gathered in the entry order, the padding lanes are zero
+	const size_t paddedSize = (size + 3) / 4 * 4;
+	mPositionX.assign(paddedSize, 0.0f);
+	mPositionY.assign(paddedSize, 0.0f);
+	mPositionZ.assign(paddedSize, 0.0f);
+	for (u32 i = 0; i < size; ++i)
+	{
+		const Vector3 position = mGroup->get(mEntries[i].index)->getTransform().getTranslation();
+		mPositionX[i] = position.x;
+		mPositionY[i] = position.y;
+		mPositionZ[i] = position.z;
+	}
+
+	// Only the z row of the view matrix is needed, the view matrix is affine
+	const Matrix4& view = mBuildViewMatrix;
+	const Float4 zx = splat(view(2, 0));
+	const Float4 zy = splat(view(2, 1));
+	const Float4 zz = splat(view(2, 2));
+	const Float4 zw = splat(view(2, 3));
+	std::array<u32, 4> keys;
+	for (size_t i = 0; i < paddedSize; i += 4)
+	{
+		const Float4 depth = add(
+			add(
+				add(multiply(zx, load(mPositionX.data() + i)), multiply(zy, load(mPositionY.data() + i))),
+				multiply(zz, load(mPositionZ.data() + i))),
+			zw);
+		storeSortKeys(depth, keys.data());
 
-		std::sort(
-			mSortedGroup.begin(),
-			mSortedGroup.end(),
-			[&viewMatrix](const RenderGeometry* a, const RenderGeometry* b)
+		const size_t laneCount = std::min<size_t>(4, size - i);
+		for (size_t lane = 0; lane < laneCount; ++lane)
+		{
+			mEntries[i + lane].key = keys[lane];
+		}
+	}
+}
+
+bool DepthSortedRenderPassC::insertionSort() noexcept
+{
+	const size_t size = mEntries.size();
+	size_t movesLeft = size * INSERTION_SORT_MOVES_PER_ENTRY;
+	for (size_t i = 1; i < size; ++i)
+	{
+		const Entry entry = mEntries[i];
+		size_t j = i;
+		for (; j > 0 && mEntries[j - 1].key > entry.key; --j)
+		{
+			if (movesLeft-- == 0)
 			{
-				const Vector3 aPos = a->getTransform().getTranslation();
-				const Vector3 bPos = b->getTransform().getTranslation();
-				// The further the object, the smaller the z value in view space
-				return (viewMatrix * aPos).z < (viewMatrix * bPos).z;
-			});
+				// The remaining entries are sorted by the radix sort
+				mEntries[j] = entry;
+				return false;
+			}
+			mEntries[j] = mEntries[j - 1];
+		}
+		mEntries[j] = entry;
 	}
-	RenderPassC::execute(&mSortedGroup);
+	return true;
 }
 
 // End of the namespace gltut
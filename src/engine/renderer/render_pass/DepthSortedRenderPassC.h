@@ -5,6 +5,8 @@
 #pragma once
 
 // Includes
+#include <vector>
+
 #include "../objects/RenderGeometryGroupC.h"
 #include "RenderPassC.h"
 
@@ -26,20 +28,74 @@ public:
 		const Rectangle2u* viewport,
 		GraphicsDevice& device,
 		const ShaderBindings& shaderBindings,
-		const ShaderUniformBufferBindings& shaderUniformBufferBindings) noexcept;
+		const ShaderUniformBufferBindings& shaderUniformBufferBindings,
+		ObjectBufferC& objectBuffer) noexcept;
 
 	/// Executes the render pass
 	void execute() noexcept final;
 
+	/// Returns the number of the sorted geometries, they are not culled
+	u32 getSubmittedCount() const noexcept final
+	{
+		return mSortedGroup.getSize();
+	}
+
+	/// Captures the view matrix on the rendering thread
+	u32 beginBuild() noexcept final;
+
+	/// The sorting is not split into chunks, does nothing
+	void buildChunk(u32) noexcept final
+	{
+	}
+
+	/**
+		\brief Sorts the group by the view depths, may be called by any thread.
+		The depths are updated every build, so both the camera and the object motion are tracked
+	*/
+	void endBuild() noexcept final;
+
 private:
+	/// A geometry of the group with its sort key
+	struct Entry
+	{
+		/// The order-preserving bits of the view-space z, the further the object, the smaller the key
+		u64 key;
+
+		/// The index of the geometry in the group
+		u32 index;
+	};
+
+	/// Updates the sort keys of the entries, resets the entries if the group size changes
+	void updateKeys();
+
+	/**
+		\brief Sorts the entries of the previous order by insertion.
+		\return false if the order changed too much and the sorting is stopped
+	*/
+	bool insertionSort() noexcept;
+
 	/// The group to render
 	const RenderGeometryGroup* mGroup;
 
 	/// The depth-sorted group
 	RenderGeometryGroupC mSortedGroup;
 
-	/// The view matrix
-	Matrix4 mViewMatrix;
+	/// The entries in the order of the sorted group, kept between the builds
+	std::vector<Entry> mEntries;
+
+	/// The temporary buffer of the radix sort
+	std::vector<Entry> mSortBuffer;
+
+	/// The positions of the entries, padded to a multiple of 4 for the 4-wide key computation
+	std::vector<float> mPositionX;
+	std::vector<float> mPositionY;
+	std::vector<float> mPositionZ;
+
+	/// The view matrix captured by beginBuild()
+	Matrix4 mBuildViewMatrix;
+
+	/// If the group is sorted for the next execution
+	bool mSorted = false;
 };
 
 // End of the namespace gltut
@@ -0,0 +1,632 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "DrawListC.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "../../core/RadixSort.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The number of bits of the phase, the highest bits of the keys
+constexpr u32 PHASE_BITS = 2;
+
+/// The shift of the phase in the keys
+constexpr u32 PHASE_SHIFT = 64 - PHASE_BITS;
+
+/// The phase of the depth pre-pass packets, drawn first without the color writes
+constexpr u64 DEPTH_PRE_PASS_PHASE = 0;
+
+/// The phase of the opaque packets without the depth pre-pass
+constexpr u64 OPAQUE_PHASE = 1;
+
+/// The phase of the opaque packets after the depth pre-pass, drawn with the equal depth test and no depth writes
+constexpr u64 DEPTH_EQUAL_PHASE = 2;
+
+/// The phase of the transparent packets, which go after the opaque ones
+constexpr u64 TRANSPARENT_PHASE = 3;
+
+/// The number of bits of the pipeline state index
+constexpr u32 PIPELINE_STATE_BITS = 9;
+
+/// The number of bits of the texture index
+constexpr u32 TEXTURE_BITS = 12;
+
+/// The number of bits of the material pass index
+constexpr u32 MATERIAL_PASS_BITS = 13;
+
+/// The number of bits of the geometry index
+constexpr u32 GEOMETRY_BITS = 12;
+
+/// The number of bits of the quantized depth
+constexpr u32 DEPTH_BITS = 16;
+
+/**
+	\brief The share of the threshold a coarser level of detail must be within to replace the previous level.
+	The gap between the thresholds of refining and coarsening keeps the levels from flickering
+*/
+constexpr float LOD_COARSENING_RATIO = 0.75f;
+
+/// The minimum clip w of the bounds of a geometry with a level of detail, the closer ones use the level 0
+constexpr float MIN_LOD_CLIP_W = 1.0e-5f;
+
+static_assert(
+	PHASE_BITS + PIPELINE_STATE_BITS + TEXTURE_BITS + MATERIAL_PASS_BITS + GEOMETRY_BITS + DEPTH_BITS == 64,
+	"The sort key fields must fill 64 bits");
+
+// Local functions
+/**
+	\brief Returns the view distance quantized to DEPTH_BITS, preserving the order.
+	The high bits of a non-negative float are monotonic with its value
+*/
+u64 quantizeDepth(float distance) noexcept
+{
+	if (!(distance > 0.0f))
+	{
+		return 0;
+	}
+
+	u32 bits;
+	std::memcpy(&bits, &distance, sizeof(bits));
+	return bits >> (32 - DEPTH_BITS);
+}
+
+/// Returns the phase of a key
+u64 getPhase(u64 key) noexcept
+{
+	return key >> PHASE_SHIFT;
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+void DrawListC::build(
+	const RenderGeometryGroup& group,
+	u32 materialPass,
+	DepthTestMode depthTest,
+	const Matrix4& viewMatrix,
+	const Frustum* frustum,
+	const OcclusionBufferC* occlusionBuffer,
+	const OcclusionQueriesC* occlusionQueries,
+	const LodSelection* lodSelection,
+	const DepthPrePass* depthPrePass)
+{
+	const u32 chunkCount = beginBuild(
+		group,
+		materialPass,
+		depthTest,
+		viewMatrix,
+		frustum,
+		occlusionBuffer,
+		occlusionQueries,
+		lodSelection,
+		depthPrePass);
+	for (u32 i = 0; i < chunkCount; ++i)
+	{
+		buildChunk(i);
+	}
+	endBuild();
+}
+
+u32 DrawListC::beginBuild(
+	const RenderGeometryGroup& group,
+	u32 materialPass,
+	DepthTestMode depthTest,
+	const Matrix4& viewMatrix,
+	const Frustum* frustum,
+	const OcclusionBufferC* occlusionBuffer,
+	const OcclusionQueriesC* occlusionQueries,
+	const LodSelection* lodSelection,
+	const DepthPrePass* depthPrePass)
+{
+	// The candidates of the previous build are not used if the allocation fails
+	mCandidateCount = 0;
+	mGroup = &group;
+	mMaterialPass = materialPass;
+	if (depthTest != mDepthTest)
+	{
+		mPhasePipelineStates.clear();
+		mDepthTest = depthTest;
+	}
+	mViewMatrix = viewMatrix;
+	mFrustum = frustum != nullptr ? std::make_optional(*frustum) : std::nullopt;
+	mOcclusionBuffer = occlusionBuffer;
+	mOcclusionQueries = occlusionQueries;
+	mLodSelection = lodSelection != nullptr ? std::make_optional(*lodSelection) : std::nullopt;
+	mDepthPrePass = depthPrePass != nullptr ? std::make_optional(*depthPrePass) : std::nullopt;
+
+	const u32 size = group.getSize();
+	const u32 chunkCount = (size + CHUNK_SIZE - 1) / CHUNK_SIZE;
+	mCandidates.resize(size);
+	mChunks.resize(chunkCount);
+	mCandidateCount = size;
+	return chunkCount;
+}
+
+void DrawListC::buildChunk(u32 chunk) noexcept
+{
+	if (!GLTUT_ASSERT(chunk < mChunks.size()))
+	{
+		return;
+	}
+
+	Chunk& state = mChunks[chunk];
+	state.containments.clear();
+	state.culledCount = 0;
+	state.occludedCount = 0;
+	state.hiddenGeometries.clear();
+
+	const u32 first = chunk * CHUNK_SIZE;
+	const u32 last = std::min(first + CHUNK_SIZE, mCandidateCount);
+	for (u32 i = first; i < last; ++i)
+	{
+		Candidate& candidate = mCandidates[i];
+		candidate.materialPass = nullptr;
+
+		const RenderGeometry* renderGeometry = mGroup->get(i);
+		const Material* material = renderGeometry->getMaterial();
+		const Geometry* geometry = renderGeometry->getGeometry();
+		if (material == nullptr || geometry == nullptr)
+		{
+			continue;
+		}
+
+		// All material passes are created by MaterialC
+		const MaterialPassC* pass = static_cast<const MaterialPassC*>(material->getPass(mMaterialPass));
+		if (pass == nullptr ||
+			pass->getShader() == nullptr ||
+			pass->getShader()->getTarget() == nullptr)
+		{
+			continue;
+		}
+
+		GLTUT_CATCH_ALL_BEGIN
+		if (mFrustum.has_value() && !isVisible(*renderGeometry, *mFrustum, state.containments))
+		{
+			++state.culledCount;
+			continue;
+		}
+		GLTUT_CATCH_ALL_END("Cannot cull a geometry of a draw list")
+
+		const Box3* bounds = renderGeometry->getGlobalBounds();
+		if (mOcclusionBuffer != nullptr && bounds != nullptr && mOcclusionBuffer->isOccluded(*bounds))
+		{
+			++state.occludedCount;
+			continue;
+		}
+
+		candidate.conditionalQuery = 0;
+		if (mOcclusionQueries != nullptr &&
+			mOcclusionQueries->getVisibility(renderGeometry, candidate.conditionalQuery) ==
+				OcclusionQueriesC::Visibility::HIDDEN)
+		{
+			++state.occludedCount;
+			GLTUT_CATCH_ALL_BEGIN
+			state.hiddenGeometries.push_back(renderGeometry);
+			GLTUT_CATCH_ALL_END("Cannot add a hidden geometry of a draw list")
+			continue;
+		}
+
+		// The further the object, the smaller the z value in view space
+		candidate.depth = quantizeDepth(
+			-(mViewMatrix * renderGeometry->getTransform().getTranslation()).z);
+		candidate.lodLevel = mLodSelection.has_value() && geometry->getLodCount() > 1 ?
+			selectLod(*renderGeometry, *geometry) :
+			0;
+		candidate.prePass = candidate.conditionalQuery == 0 ?
+			getPrePass(*material, *pass) :
+			nullptr;
+		candidate.materialPass = pass;
+	}
+}
+
+void DrawListC::endBuild()
+{
+	mPackets.clear();
+	mPrePassCount = 0;
+	mPipelineStateRanks.clear();
+	mTextureRanks.clear();
+	mMaterialPassRanks.clear();
+	mGeometryRanks.clear();
+
+	mCulledCount = 0;
+	mOccludedCount = 0;
+	mHiddenGeometries.clear();
+	for (const Chunk& chunk : mChunks)
+	{
+		mCulledCount += chunk.culledCount;
+		mOccludedCount += chunk.occludedCount;
+		mHiddenGeometries.insert(
+			mHiddenGeometries.end(),
+			chunk.hiddenGeometries.begin(),
+			chunk.hiddenGeometries.end());
+	}
+
+	// Forgets the levels of the removed geometries
+	if (mLodLevels.size() > 2 * static_cast<size_t>(mCandidateCount))
+	{
+		mLodLevels.clear();
+	}
+
+	// The ranks are assigned in the group order, so the keys do not depend on the chunks
+	mPackets.reserve(static_cast<size_t>(mCandidateCount) * (mDepthPrePass.has_value() ? 2 : 1));
+	for (u32 i = 0; i < mCandidateCount; ++i)
+	{
+		const Candidate& candidate = mCandidates[i];
+		const MaterialPassC* pass = candidate.materialPass;
+		if (pass == nullptr)
+		{
+			continue;
+		}
+
+		const RenderGeometry* renderGeometry = mGroup->get(i);
+		const Geometry* geometry = renderGeometry->getGeometry();
+		const Geometry* lod = geometry;
+		if (geometry->getLodCount() > 1)
+		{
+			mLodLevels[renderGeometry] = candidate.lodLevel;
+			const u32 bias = mLodSelection.has_value() ? mLodSelection->bias : 0;
+			lod = geometry->getLod(std::min(candidate.lodLevel + bias, geometry->getLodCount() - 1));
+		}
+
+		// The geometry is drawn without the pre-pass if the pre-pass has no pipeline state
+		const PipelineState* prePassState = candidate.prePass != nullptr ?
+			getPipelineState(*candidate.prePass, DEPTH_PRE_PASS_PHASE) :
+			nullptr;
+		const u64 phase = pass->isTransparent() ?
+			TRANSPARENT_PHASE :
+			(prePassState != nullptr ? DEPTH_EQUAL_PHASE : OPAQUE_PHASE);
+		const PipelineState* pipelineState = getPipelineState(*pass, phase);
+		if (pipelineState == nullptr)
+		{
+			continue;
+		}
+
+		const u64 state = getState(*pipelineState, *pass, lod);
+		u64 key = 0;
+		if (phase == TRANSPARENT_PHASE)
+		{
+			// Back-to-front, then by the state
+			key = (TRANSPARENT_PHASE << PHASE_SHIFT) |
+				(((u64(1) << DEPTH_BITS) - 1 - candidate.depth) << (PHASE_SHIFT - DEPTH_BITS)) |
+				state;
+		}
+		else
+		{
+			// By the state, then front-to-back
+			key = (phase << PHASE_SHIFT) | (state << DEPTH_BITS) | candidate.depth;
+		}
+		mPackets.push_back({key, renderGeometry, lod, pass, pipelineState, candidate.conditionalQuery});
+
+		if (prePassState != nullptr)
+		{
+			const u64 prePassKey = (DEPTH_PRE_PASS_PHASE << PHASE_SHIFT) |
+				(getState(*prePassState, *candidate.prePass, lod) << DEPTH_BITS) |
+				candidate.depth;
+			mPackets.push_back({prePassKey, renderGeometry, lod, candidate.prePass, prePassState, 0});
+			++mPrePassCount;
+		}
+	}
+
+	radixSort(
+		mPackets,
+		mSortBuffer,
+		[](const Packet& packet)
+		{
+			return packet.key;
+		});
+
+	buildDraws();
+}
+
+void DrawListC::render(
+	ObjectBufferC& objectBuffer,
+	OcclusionQueryPool* queryPool) const noexcept
+{
+	const std::optional<u32> firstObject = objectBuffer.write(
+		mObjects.data(),
+		static_cast<u32>(mObjects.size()));
+
+	// The state bound before the list is unknown
+	const PipelineState* boundState = nullptr;
+	const MaterialPassC* boundPass = nullptr;
+	for (const Draw& draw : mDraws)
+	{
+		const Packet& packet = mPackets[draw.packet];
+		if (packet.pipelineState != boundState)
+		{
+			mDevice.bindPipelineState(*packet.pipelineState, boundState);
+			boundState = packet.pipelineState;
+		}
+
+		if (packet.materialPass != boundPass)
+		{
+			packet.materialPass->bindMaterial();
+			boundPass = packet.materialPass;
+		}
+
+		const bool conditional = packet.conditionalQuery != 0 && queryPool != nullptr;
+		if (conditional)
+		{
+			queryPool->beginConditionalRender(packet.conditionalQuery);
+		}
+
+		const Geometry* geometry = packet.lod;
+		if (draw.matrixSource == RendererBinding::MatrixSource::INSTANCE_ATTRIBUTES)
+		{
+			packet.materialPass->bindMatrixSource(draw.matrixSource);
+			geometry->renderInstanced(
+				mInstances.data() + draw.first,
+				draw.instanceCount);
+		}
+		else if (draw.matrixSource == RendererBinding::MatrixSource::OBJECT_BUFFER && firstObject)
+		{
+			packet.materialPass->bindMatrixSource(draw.matrixSource);
+			objectBuffer.bind(*firstObject + draw.first);
+			geometry->render();
+		}
+		else
+		{
+			packet.materialPass->bindGeometry(packet.geometry);
+			geometry->render();
+		}
+
+		if (conditional)
+		{
+			queryPool->endConditionalRender();
+		}
+	}
+
+	if (boundState == nullptr)
+	{
+		return;
+	}
+
+	if (!boundState->colorWrite)
+	{
+		mDevice.setColorWrite(true);
+	}
+
+	if (!boundState->depthWrite)
+	{
+		mDevice.setDepthWrite(true);
+	}
+
+	if (boundState->depthTest != mDepthTest)
+	{
+		mDevice.setDepthTest(mDepthTest);
+	}
+}
+
+u64 DrawListC::getRank(Ranks& ranks, const void* object, u32 bits)
+{
+	const u64 rank = ranks.try_emplace(object, ranks.size()).first->second;
+	return std::min(rank, (u64(1) << bits) - 1);
+}
+
+u64 DrawListC::getState(const PipelineState& pipelineState, const MaterialPassC& pass, const Geometry* lod)
+{
+	const TextureSetC& textures = pass.getTextureSet();
+	const Texture* texture = textures.getTextureSlotsCount() > 0 ?
+		textures.getTexture(0) :
+		nullptr;
+
+	u64 state = getRank(mPipelineStateRanks, &pipelineState, PIPELINE_STATE_BITS);
+	state = (state << TEXTURE_BITS) | getRank(mTextureRanks, texture, TEXTURE_BITS);
+	state = (state << MATERIAL_PASS_BITS) | getRank(mMaterialPassRanks, &pass, MATERIAL_PASS_BITS);
+	return (state << GEOMETRY_BITS) | getRank(mGeometryRanks, lod, GEOMETRY_BITS);
+}
+
+const PipelineState* DrawListC::getPipelineState(const MaterialPassC& pass, u64 phase)
+{
+	const PipelineState* passState = pass.getPipelineState();
+	if (passState == nullptr)
+	{
+		return nullptr;
+	}
+
+	static_assert(PHASE_COUNT == u64(1) << PHASE_BITS, "The phases must fill the phase bits");
+	const PipelineState*& state = mPhasePipelineStates.try_emplace(passState).first->second[phase];
+	if (state == nullptr)
+	{
+		// The transparent phase shares the depth state of the opaque one
+		PipelineState phaseState = *passState;
+		phaseState.depthTest = phase == DEPTH_EQUAL_PHASE ? DepthTestMode::EQUAL : mDepthTest;
+		phaseState.depthWrite = phase != DEPTH_EQUAL_PHASE;
+		phaseState.colorWrite = phase != DEPTH_PRE_PASS_PHASE;
+		state = mDevice.getPipelineState(phaseState);
+	}
+	return state;
+}
+
+const MaterialPassC* DrawListC::getPrePass(const Material& material, const MaterialPassC& pass) const noexcept
+{
+	if (!mDepthPrePass.has_value() ||
+		pass.isTransparent() ||
+		pass.isDiscarding() ||
+		pass.getCost() < mDepthPrePass->minCost)
+	{
+		return nullptr;
+	}
+
+	// The pre-pass must cover the same faces as the pass
+	const MaterialPassC* prePass = static_cast<const MaterialPassC*>(
+		material.getPass(mDepthPrePass->materialPass));
+	return prePass != nullptr &&
+			prePass != &pass &&
+			prePass->getShader() != nullptr &&
+			prePass->getShader()->getTarget() != nullptr &&
+			prePass->getFaceCulling() == pass.getFaceCulling() ?
+		prePass :
+		nullptr;
+}
+
+bool DrawListC::isVisible(
+	const RenderGeometry& geometry,
+	const Frustum& frustum,
+	Containments& containments)
+{
+	const Frustum::Containment parentContainment = classify(
+		geometry.getParentVolume(),
+		frustum,
+		containments);
+	if (parentContainment != Frustum::Containment::INTERSECTING)
+	{
+		return parentContainment == Frustum::Containment::INSIDE;
+	}
+
+	const Box3* bounds = geometry.getGlobalBounds();
+	return bounds == nullptr || frustum.classify(*bounds) != Frustum::Containment::OUTSIDE;
+}
+
+Frustum::Containment DrawListC::classify(
+	const BoundingVolume* volume,
+	const Frustum& frustum,
+	Containments& containments)
+{
+	// The hierarchy root is not bounded
+	if (volume == nullptr)
+	{
+		return Frustum::Containment::INTERSECTING;
+	}
+
+	const auto found = containments.find(volume);
+	if (found != containments.end())
+	{
+		return found->second;
+	}
+
+	Frustum::Containment result = classify(volume->getParentVolume(), frustum, containments);
+	if (result == Frustum::Containment::INTERSECTING)
+	{
+		// A volume without bounds does not restrict its children
+		if (const Box3* bounds = volume->getGlobalBounds())
+		{
+			result = frustum.classify(*bounds);
+		}
+	}
+	containments.emplace(volume, result);
+	return result;
+}
+
+u32 DrawListC::selectLod(const RenderGeometry& renderGeometry, const Geometry& geometry) const noexcept
+{
+	const Box3* bounds = renderGeometry.getGlobalBounds();
+	if (bounds == nullptr)
+	{
+		return 0;
+	}
+
+	// The minimum clip w over the bounds, the w of a perspective projection is the view distance
+	const Matrix4& projectionView = mLodSelection->projectionView;
+	float nearestW = projectionView(3, 3);
+	for (u32 k = 0; k < 3; ++k)
+	{
+		nearestW += std::min(
+			projectionView(3, k) * bounds->getMin()[k],
+			projectionView(3, k) * bounds->getMax()[k]);
+	}
+
+	if (!(nearestW > MIN_LOD_CLIP_W))
+	{
+		return 0;
+	}
+
+	const Matrix4& transform = renderGeometry.getTransform();
+	float scale = 0.0f;
+	for (u32 column = 0; column < 3; ++column)
+	{
+		scale = std::max(
+			scale,
+			Vector3(transform(0, column), transform(1, column), transform(2, column)).length());
+	}
+
+	const float pixelsPerUnit = scale * mLodSelection->pixelScale / nearestW;
+	const float threshold = mLodSelection->threshold;
+	u32 level = 0;
+	while (level + 1 < geometry.getLodCount() &&
+		geometry.getLodError(level + 1) * pixelsPerUnit <= threshold)
+	{
+		++level;
+	}
+
+	// The new geometries take the selected level at once
+	const auto found = mLodLevels.find(&renderGeometry);
+	const u32 previous = found != mLodLevels.end() ? found->second : level;
+	while (level > previous &&
+		geometry.getLodError(level) * pixelsPerUnit > threshold * LOD_COARSENING_RATIO)
+	{
+		--level;
+	}
+	return level;
+}
+
+void DrawListC::buildDraws()
+{
+	mDraws.clear();
+	mInstances.clear();
+	mObjects.clear();
+
+	const u32 size = static_cast<u32>(mPackets.size());
+	for (u32 first = 0; first < size;)
+	{
+		const Packet& packet = mPackets[first];
+		const u64 phase = getPhase(packet.key);
+		const bool matrixSourceSupported = packet.materialPass->getShader()->isMatrixSourceSupported();
+		u32 last = first + 1;
+		// The conditional packets are drawn one by one
+		if (phase != TRANSPARENT_PHASE && matrixSourceSupported && packet.conditionalQuery == 0)
+		{
+			while (last < size &&
+				getPhase(mPackets[last].key) == phase &&
+				mPackets[last].materialPass == packet.materialPass &&
+				mPackets[last].lod == packet.lod &&
+				mPackets[last].conditionalQuery == 0)
+			{
+				++last;
+			}
+		}
+
+		if (last - first > 1)
+		{
+			mDraws.push_back({
+				first,
+				last - first,
+				static_cast<u32>(mInstances.size()),
+				RendererBinding::MatrixSource::INSTANCE_ATTRIBUTES});
+
+			for (u32 i = first; i < last; ++i)
+			{
+				const RenderGeometry* geometry = mPackets[i].geometry;
+				mInstances.push_back({geometry->getTransform(), geometry->getNormalMatrix()});
+			}
+		}
+		else if (matrixSourceSupported)
+		{
+			mDraws.push_back({
+				first,
+				0,
+				static_cast<u32>(mObjects.size()),
+				RendererBinding::MatrixSource::OBJECT_BUFFER});
+
+			mObjects.emplace_back().set(packet.geometry->getTransform(), packet.geometry->getNormalMatrix());
+		}
+		else
+		{
+			mDraws.push_back({first, 0, 0, RendererBinding::MatrixSource::UNIFORMS});
+		}
+		first = last;
+	}
+}
+
+// End of the namespace gltut
+}
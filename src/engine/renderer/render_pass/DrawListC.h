@@ -0,0 +1,409 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <array>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDevice.h"
+#include "engine/math/Frustum.h"
+#include "engine/renderer/objects/RenderGeometryGroup.h"
+
+#include "../material/MaterialPassC.h"
+#include "ObjectBufferC.h"
+#include "OcclusionBufferC.h"
+#include "OcclusionQueriesC.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief The list of draw packets of a render geometry group.
+	The packets are sorted by 64-bit keys, so the draws sharing the pipeline state,
+	the textures, the material pass and the geometry are adjacent,
+	and the opaque draws with the same state go front-to-back.
+	The transparent draws go after the opaque ones, back-to-front.
+	The geometries outside the view frustum are rejected,
+	together with the subtrees of the rejected bounding volumes.
+	The geometries hidden by the occluders of an occlusion buffer or by the occlusion queries are rejected too,
+	the uncertain ones are drawn one by one with the conditional rendering.
+	Every geometry is drawn with its coarsest level of detail whose projected error is within a threshold.
+	A geometry switches to a coarser level only when its error is well below the threshold, so the levels do not flicker.
+	The opaque geometries with costly material passes may be drawn by a depth material pass first,
+	then by their material passes with the equal depth test and no depth writes, after the other opaque ones.
+	The pipeline states of the packets are derived from the states of their material passes
+	and the depth test and writes of their phases, and are bound only when they change.
+	The culling runs in chunks of the group, which may be built in parallel.
+	The adjacent opaque packets sharing the geometry and the material pass
+	are rendered by a single instanced draw if the shader supports the matrix sources.
+	The matrices of the other draws of such shaders are uploaded to the object buffer at once.
+*/
+class DrawListC : public NonCopyable
+{
+public:
+	/// Draw packet
+	struct Packet
+	{
+		/// The sort key
+		u64 key;
+
+		/// The geometry to render
+		const RenderGeometry* geometry;
+
+		/// The level of detail of the geometry to render
+		const Geometry* lod;
+
+		/// The material pass of the geometry
+		const MaterialPassC* materialPass;
+
+		/// The pipeline state of the material pass in the phase of the packet
+		const PipelineState* pipelineState;
+
+		/// The occlusion query of the conditional rendering, 0 to render unconditionally
+		u32 conditionalQuery;
+	};
+
+	/// Draw call of one or more packets
+	struct Draw
+	{
+		/// The index of the first packet
+		u32 packet;
+
+		/// The number of the instances, 0 for a non-instanced draw of a single packet
+		u32 instanceCount;
+
+		/// The first instance of an instanced draw or the object of an object buffer draw
+		u32 first;
+
+		/// The source of the model and normal matrices
+		RendererBinding::MatrixSource matrixSource;
+	};
+
+	/// The level of detail selection of a build
+	struct LodSelection
+	{
+		/// The projection * view matrix
+		Matrix4 projectionView;
+
+		/// The half viewport height in pixels times the vertical scale of the projection
+		float pixelScale;
+
+		/// The maximum projected error of the selected levels, in pixels
+		float threshold;
+
+		/// The number of the coarser levels added to the selected ones
+		u32 bias;
+	};
+
+	/// The depth pre-pass of a build
+	struct DepthPrePass
+	{
+		/// The material pass drawing only the depth, with the same positions as the built material pass
+		u32 materialPass;
+
+		/// The minimum cost of the built material passes drawn after the pre-pass
+		float minCost;
+	};
+
+	/// The number of the geometries of a build chunk
+	static constexpr u32 CHUNK_SIZE = 1024;
+
+	/// Constructor
+	explicit DrawListC(GraphicsDevice& device) noexcept :
+		mDevice(device)
+	{
+	}
+
+	/**
+		\brief Builds and sorts the packets of a group for a material pass and view matrix
+		\param depthTest The depth test of the render pass
+		\param frustum The view frustum, nullptr to disable the culling
+		\param occlusionBuffer The rasterized occlusion buffer, nullptr to disable the occlusion culling
+		\param occlusionQueries The occlusion queries, nullptr to disable them
+		\param lodSelection The level of detail selection, nullptr to render the levels 0
+		\param depthPrePass The depth pre-pass, nullptr to disable it
+	*/
+	void build(
+		const RenderGeometryGroup& group,
+		u32 materialPass,
+		DepthTestMode depthTest,
+		const Matrix4& viewMatrix,
+		const Frustum* frustum,
+		const OcclusionBufferC* occlusionBuffer,
+		const OcclusionQueriesC* occlusionQueries,
+		const LodSelection* lodSelection,
+		const DepthPrePass* depthPrePass);
+
+	/**
+		\brief Starts building the packets of a group for a material pass and view matrix.
+		The list is built by buildChunk() for every chunk and completed by endBuild().
+		The group and its geometries must not change until the build is completed
+		\param depthTest The depth test of the render pass
+		\param frustum The view frustum, nullptr to disable the culling
+		\param occlusionBuffer The occlusion buffer, nullptr to disable the occlusion culling.
+		The buffer must be rasterized before the chunks are built
+		\param occlusionQueries The occlusion queries, nullptr to disable them
+		\param lodSelection The level of detail selection, nullptr to render the levels 0
+		\param depthPrePass The depth pre-pass, nullptr to disable it
+		\return The number of the chunks
+	*/
+	u32 beginBuild(
+		const RenderGeometryGroup& group,
+		u32 materialPass,
+		DepthTestMode depthTest,
+		const Matrix4& viewMatrix,
+		const Frustum* frustum,
+		const OcclusionBufferC* occlusionBuffer,
+		const OcclusionQueriesC* occlusionQueries,
+		const LodSelection* lodSelection,
+		const DepthPrePass* depthPrePass);
+
+	/**
+		\brief Culls the geometries of a chunk and computes their view depths.
+		The different chunks may be built by different threads at the same time
+	*/
+	void buildChunk(u32 chunk) noexcept;
+
+	/**
+		\brief Assigns the sort keys of the visible geometries, sorts the packets and groups them into the draws.
+		Keeps the selected levels of detail for the next build
+	*/
+	void endBuild();
+
+	/**
+		\brief Renders the draws, binding the pipeline states and the material passes only when they change.
+		Restores the depth test and the depth and color writes of the render pass after
+		\param queryPool The pool of the conditional queries, nullptr if the occlusion queries are disabled
+	*/
+	void render(
+		ObjectBufferC& objectBuffer,
+		OcclusionQueryPool* queryPool) const noexcept;
+
+	/// Returns the packets
+	const std::vector<Packet>& getPackets() const noexcept
+	{
+		return mPackets;
+	}
+
+	/// Returns the draw calls
+	const std::vector<Draw>& getDraws() const noexcept
+	{
+		return mDraws;
+	}
+
+	/// Returns the number of the geometries of the group in the last build
+	u32 getCandidateCount() const noexcept
+	{
+		return mCandidateCount;
+	}
+
+	/// Returns the number of the geometries drawn by the depth pre-pass
+	u32 getPrePassCount() const noexcept
+	{
+		return mPrePassCount;
+	}
+
+	/// Returns the number of the geometries rejected by the frustum culling
+	u32 getCulledCount() const noexcept
+	{
+		return mCulledCount;
+	}
+
+	/// Returns the number of the geometries rejected by the occlusion culling and the occlusion queries
+	u32 getOccludedCount() const noexcept
+	{
+		return mOccludedCount;
+	}
+
+	/// Returns the geometries rejected by the occlusion queries, they are queried again
+	const std::vector<const RenderGeometry*>& getHiddenGeometries() const noexcept
+	{
+		return mHiddenGeometries;
+	}
+
+private:
+	/// The number of the phases of the packets
+	static constexpr u32 PHASE_COUNT = 4;
+
+	/// Dense indices of objects, in the order of the first appearance
+	using Ranks = std::unordered_map<const void*, u64>;
+
+	/// The pipeline states of the phases, by the pipeline states of the material passes
+	using PhasePipelineStates = std::unordered_map<const PipelineState*, std::array<const PipelineState*, PHASE_COUNT>>;
+
+	/// The positions of the bounding volumes relative to the frustum
+	using Containments = std::unordered_map<const BoundingVolume*, Frustum::Containment>;
+
+	/// A geometry of the group, filled by the chunks
+	struct Candidate
+	{
+		/// The material pass, nullptr if the geometry is not rendered
+		const MaterialPassC* materialPass;
+
+		/// The depth material pass of the pre-pass, nullptr if the geometry has no pre-pass
+		const MaterialPassC* prePass;
+
+		/// The quantized view depth
+		u64 depth;
+
+		/// The occlusion query of the conditional rendering, 0 to render unconditionally
+		u32 conditionalQuery;
+
+		/// The selected level of detail
+		u32 lodLevel;
+	};
+
+	/// The state of a build chunk
+	struct Chunk
+	{
+		/// The positions of the bounding volumes relative to the frustum
+		Containments containments;
+
+		/// The number of the culled geometries
+		u32 culledCount = 0;
+
+		/// The number of the occluded geometries
+		u32 occludedCount = 0;
+
+		/// The geometries rejected by the occlusion queries
+		std::vector<const RenderGeometry*> hiddenGeometries;
+	};
+
+	/// Returns the dense index of an object, saturated to a bit count
+	static u64 getRank(Ranks& ranks, const void* object, u32 bits);
+
+	/// Returns the state part of the key of a pipeline state, a material pass and a level of detail
+	u64 getState(const PipelineState& pipelineState, const MaterialPassC& pass, const Geometry* lod);
+
+	/**
+		\brief Returns the pipeline state of a material pass in a phase, derives it on the first request
+		\return The state or nullptr if it cannot be created
+	*/
+	const PipelineState* getPipelineState(const MaterialPassC& pass, u64 phase);
+
+	/**
+		\brief Returns the depth material pass drawn before a material pass of an opaque geometry.
+		Returns nullptr if the pre-pass is disabled, the pass is cheap, transparent or discards the fragments,
+		or the material has no suitable depth pass
+	*/
+	const MaterialPassC* getPrePass(const Material& material, const MaterialPassC& pass) const noexcept;
+
+	/// Checks if a geometry is inside or intersects the frustum
+	static bool isVisible(
+		const RenderGeometry& geometry,
+		const Frustum& frustum,
+		Containments& containments);
+
+	/**
+		\brief Returns the position of a bounding volume relative to the frustum.
+		A volume is outside if any of its ancestors is outside,
+		and inside if any of its ancestors is inside.
+		The results are cached in the containments of a chunk
+	*/
+	static Frustum::Containment classify(
+		const BoundingVolume* volume,
+		const Frustum& frustum,
+		Containments& containments);
+
+	/**
+		\brief Returns the level of detail of a geometry by its projected errors.
+		Keeps the previous level unless it is too coarse or a coarser level is well within the threshold
+	*/
+	u32 selectLod(const RenderGeometry& renderGeometry, const Geometry& geometry) const noexcept;
+
+	/// Groups the sorted packets into the draws and fills their instances and objects
+	void buildDraws();
+
+	/// The graphics device
+	GraphicsDevice& mDevice;
+
+	/// The group being built
+	const RenderGeometryGroup* mGroup = nullptr;
+
+	/// The material pass being built
+	u32 mMaterialPass = 0;
+
+	/// The depth test of the build
+	DepthTestMode mDepthTest = DepthTestMode::LESS;
+
+	/// The pipeline states of the phases derived for the depth test of the build
+	PhasePipelineStates mPhasePipelineStates;
+
+	/// The view matrix of the build
+	Matrix4 mViewMatrix;
+
+	/// The view frustum of the build, std::nullopt if the culling is disabled
+	std::optional<Frustum> mFrustum;
+
+	/// The occlusion buffer of the build, nullptr if the occlusion culling is disabled
+	const OcclusionBufferC* mOcclusionBuffer = nullptr;
+
+	/// The occlusion queries of the build, nullptr if they are disabled
+	const OcclusionQueriesC* mOcclusionQueries = nullptr;
+
+	/// The level of detail selection of the build, std::nullopt to render the levels 0
+	std::optional<LodSelection> mLodSelection;
+
+	/// The depth pre-pass of the build, std::nullopt if it is disabled
+	std::optional<DepthPrePass> mDepthPrePass;
+
+	/// The levels of detail selected by the previous builds, for the geometries with several levels
+	std::unordered_map<const RenderGeometry*, u32> mLodLevels;
+
+	/// The geometries of the group being built
+	std::vector<Candidate> mCandidates;
+
+	/// The number of the geometries being built
+	u32 mCandidateCount = 0;
+
+	/// The chunks being built
+	std::vector<Chunk> mChunks;
+
+	/// The packets
+	std::vector<Packet> mPackets;
+
+	/// The temporary buffer of the radix sort
+	std::vector<Packet> mSortBuffer;
+
+	/// The number of the depth pre-pass packets
+	u32 mPrePassCount = 0;
+
+	/// The draw calls
+	std::vector<Draw> mDraws;
+
+	/// The instances of the instanced draws
+	std::vector<GeometryInstance> mInstances;
+
+	/// The objects of the object buffer draws
+	std::vector<ObjectData> mObjects;
+
+	/// The dense indices of the pipeline states
+	Ranks mPipelineStateRanks;
+
+	/// The dense indices of the textures
+	Ranks mTextureRanks;
+
+	/// The dense indices of the material passes
+	Ranks mMaterialPassRanks;
+
+	/// The dense indices of the geometries
+	Ranks mGeometryRanks;
+
+	/// The number of the culled geometries
+	u32 mCulledCount = 0;
+
+	/// The number of the occluded geometries
+	u32 mOccludedCount = 0;
+
+	/// The geometries rejected by the occlusion queries
+	std::vector<const RenderGeometry*> mHiddenGeometries;
+};
+
+// End of the namespace gltut
+}
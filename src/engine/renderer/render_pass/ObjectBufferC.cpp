@@ -0,0 +1,106 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "ObjectBufferC.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "engine/renderer/shader/RendererBinding.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The minimum capacity of a segment, in objects
+constexpr u32 MIN_SEGMENT_CAPACITY = 1024;
+
+// End of the anonymous namespace
+}
+
+// Global classes
+ObjectBufferC::ObjectBufferC(GraphicsDevice& device) noexcept :
+
+	mDevice(device)
+{
+	const u32 alignment = std::max(device.getShaderUniformBufferAlignment(), 1u);
+	mStride = (static_cast<u32>(sizeof(ObjectData)) + alignment - 1) / alignment * alignment;
+}
+
+ObjectBufferC::~ObjectBufferC() noexcept
+{
+	if (mBuffer != nullptr)
+	{
+		mDevice.getShaderUniformBuffers()->remove(mBuffer);
+	}
+}
+
+void ObjectBufferC::beginFrame() noexcept
+{
+	mSegment = (mSegment + 1) % SEGMENTS;
+	mSegmentSize = 0;
+}
+
+std::optional<u32> ObjectBufferC::write(const ObjectData* objects, u32 count) noexcept
+{
+	if (objects == nullptr || count == 0)
+	{
+		return std::nullopt;
+	}
+
+	if (mSegmentSize + count > mSegmentCapacity &&
+		!reserve(std::max({mSegmentCapacity * 2, mSegmentSize + count, MIN_SEGMENT_CAPACITY})))
+	{
+		return std::nullopt;
+	}
+
+	GLTUT_CATCH_ALL_BEGIN
+	mStaging.resize(static_cast<size_t>(count) * mStride);
+	GLTUT_CATCH_ALL_END("Cannot allocate the object buffer staging data")
+	if (mStaging.size() < static_cast<size_t>(count) * mStride)
+	{
+		return std::nullopt;
+	}
+
+	for (u32 i = 0; i < count; ++i)
+	{
+		std::memcpy(mStaging.data() + static_cast<size_t>(i) * mStride, objects + i, sizeof(ObjectData));
+	}
+
+	const u32 first = mSegment * mSegmentCapacity + mSegmentSize;
+	mBuffer->setData(mStaging.data(), count * mStride, first * mStride);
+	mSegmentSize += count;
+	return first;
+}
+
+void ObjectBufferC::bind(u32 object) const noexcept
+{
+	mDevice.bindShaderUniformBufferRange(
+		mBuffer,
+		RendererBinding::OBJECT_BUFFER_BINDING_POINT,
+		object * mStride,
+		sizeof(ObjectData));
+}
+
+bool ObjectBufferC::reserve(u32 segmentCapacity) noexcept
+{
+	if (mBuffer != nullptr)
+	{
+		mDevice.getShaderUniformBuffers()->remove(mBuffer);
+		mBuffer = nullptr;
+	}
+
+	// The data written to the previous buffer stays valid for the draws already issued
+	mBuffer = mDevice.getShaderUniformBuffers()->create(segmentCapacity * SEGMENTS * mStride);
+	mSegmentCapacity = mBuffer != nullptr ? segmentCapacity : 0;
+	mSegment = 0;
+	mSegmentSize = 0;
+	return mBuffer != nullptr;
+}
+
+// End of the namespace gltut
+}
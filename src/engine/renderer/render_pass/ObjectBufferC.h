@@ -0,0 +1,105 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <optional>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDevice.h"
+#include "engine/math/Matrix3.h"
+#include "engine/math/Matrix4.h"
+
+namespace gltut
+{
+// Global classes
+/// Per-draw data of the object buffer, std140 layout
+struct ObjectData
+{
+	/// The model matrix
+	Matrix4 model;
+
+	/// The normal matrix, the columns padded to vec4
+	float normalMatrix[12];
+
+	/// Sets the matrices
+	void set(const Matrix4& transform, const Matrix3& normal) noexcept
+	{
+		model = transform;
+		for (u32 column = 0; column < 3; ++column)
+		{
+			for (u32 row = 0; row < 3; ++row)
+			{
+				normalMatrix[column * 4 + row] = normal.data()[column * 3 + row];
+			}
+			normalMatrix[column * 4 + 3] = 0.0f;
+		}
+	}
+};
+
+static_assert(
+	sizeof(ObjectData) == 28 * sizeof(float),
+	"The object data must match the std140 layout");
+
+/**
+	\brief Ring of the per-draw data shared by the render passes.
+	The buffer is split into 3 segments used by the consecutive frames,
+	so the data of a frame does not overwrite the data the previous frames may still read.
+	The draws reference the data by binding its range to
+	RendererBinding::OBJECT_BUFFER_BINDING_POINT.
+*/
+class ObjectBufferC : public NonCopyable
+{
+public:
+	/// Constructor
+	explicit ObjectBufferC(GraphicsDevice& device) noexcept;
+
+	/// Destructor
+	~ObjectBufferC() noexcept;
+
+	/// Switches to the next segment, called once per frame
+	void beginFrame() noexcept;
+
+	/**
+		\brief Writes the data of the objects to the current segment with a single upload
+		\return The index of the first written object, std::nullopt if the buffer cannot be created
+	*/
+	std::optional<u32> write(const ObjectData* objects, u32 count) noexcept;
+
+	/// Binds the data of an object returned by write()
+	void bind(u32 object) const noexcept;
+
+private:
+	/// The number of the segments
+	static constexpr u32 SEGMENTS = 3;
+
+	/// Recreates the buffer with a segment capacity, dropping the data
+	bool reserve(u32 segmentCapacity) noexcept;
+
+	/// The graphics device
+	GraphicsDevice& mDevice;
+
+	/// The buffer
+	ShaderUniformBuffer* mBuffer = nullptr;
+
+	/// The distance between the objects in the buffer, in bytes
+	u32 mStride = 0;
+
+	/// The capacity of a segment, in objects
+	u32 mSegmentCapacity = 0;
+
+	/// The current segment
+	u32 mSegment = 0;
+
+	/// The number of the objects written to the current segment
+	u32 mSegmentSize = 0;
+
+	/// The data of the written objects with the buffer stride
+	std::vector<u8> mStaging;
+};
+
+// End of the namespace gltut
+}
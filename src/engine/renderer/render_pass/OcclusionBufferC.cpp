@@ -0,0 +1,335 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "OcclusionBufferC.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "../../core/Float4.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The depth of the pixels without occluders
+constexpr float NO_OCCLUDER_DEPTH = std::numeric_limits<float>::max();
+
+/// The minimum clip w of a projected point, the points closer to the eye plane are not projected
+constexpr float MIN_CLIP_W = 1.0e-5f;
+
+/// The minimum doubled area of a rasterized triangle, in pixels
+constexpr float MIN_TRIANGLE_AREA = 1.0e-6f;
+
+/// The corners of the faces of a box, the bits 0, 1, 2 of a corner select the max x, y, z
+constexpr std::array<std::array<u32, 4>, 6> BOX_FACES = {{
+	{0, 2, 6, 4},
+	{1, 5, 7, 3},
+	{0, 4, 5, 1},
+	{2, 3, 7, 6},
+	{0, 1, 3, 2},
+	{4, 6, 7, 5}}};
+
+// Local functions
+/// Returns the pixel containing a coordinate, clamped to [0, size - 1]
+u32 toPixel(float coordinate, u32 size) noexcept
+{
+	// The comparison is false for NaN
+	if (!(coordinate > 0.0f))
+	{
+		return 0;
+	}
+	return std::min(static_cast<u32>(std::min(coordinate, static_cast<float>(size))), size - 1);
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+u32 OcclusionBufferC::begin(
+	const Matrix4& projectionView,
+	const std::vector<const RenderGeometry*>& occluders)
+{
+	mProjectionView = projectionView;
+	mTriangles.clear();
+	mDepths.resize(WIDTH * HEIGHT);
+	mTileDepths.resize((WIDTH / TILE_SIZE) * (HEIGHT / TILE_SIZE));
+
+	std::array<ScreenPoint, 8> corners;
+	for (const RenderGeometry* occluder : occluders)
+	{
+		const Geometry* geometry = occluder->getGeometry();
+		if (geometry == nullptr ||
+			!project(geometry->getBounds(), projectionView * occluder->getTransform(), corners))
+		{
+			continue;
+		}
+
+		for (const auto& face : BOX_FACES)
+		{
+			addTriangle(corners[face[0]], corners[face[1]], corners[face[2]]);
+			addTriangle(corners[face[0]], corners[face[2]], corners[face[3]]);
+		}
+	}
+	return mTriangles.empty() ? 0 : BAND_COUNT;
+}
+
+void OcclusionBufferC::rasterize(u32 band) noexcept
+{
+	if (!GLTUT_ASSERT(band < BAND_COUNT))
+	{
+		return;
+	}
+
+	const u32 firstRow = band * BAND_HEIGHT;
+	const u32 lastRow = firstRow + BAND_HEIGHT - 1;
+	std::fill(
+		mDepths.begin() + firstRow * WIDTH,
+		mDepths.begin() + (lastRow + 1) * WIDTH,
+		NO_OCCLUDER_DEPTH);
+
+	for (const Triangle& triangle : mTriangles)
+	{
+		const u32 minY = std::max(triangle.minY, firstRow);
+		const u32 maxY = std::min(triangle.maxY, lastRow);
+		const Float4 zero = splat(0.0f);
+		const Float4 edgeX0 = splat(triangle.edgeX[0]);
+		const Float4 edgeX1 = splat(triangle.edgeX[1]);
+		const Float4 edgeX2 = splat(triangle.edgeX[2]);
+		const Float4 depthX = splat(triangle.depthX);
+		for (u32 y = minY; y <= maxY; ++y)
+		{
+			const float centerY = static_cast<float>(y) + 0.5f;
+			const float edge0 = triangle.edgeY[0] * centerY + triangle.edgeOffset[0];
+			const float edge1 = triangle.edgeY[1] * centerY + triangle.edgeOffset[1];
+			const float edge2 = triangle.edgeY[2] * centerY + triangle.edgeOffset[2];
+			const float rowDepth = triangle.depthY * centerY + triangle.depthOffset;
+
+			float* row = mDepths.data() + y * WIDTH;
+			u32 x = triangle.minX;
+
+			// 4 pixels at once, the covered and closer ones keep the triangle depth
+			for (; x + 3 <= triangle.maxX; x += 4)
+			{
+				const Float4 centerX = sequence(static_cast<float>(x) + 0.5f);
+				const u32 inside =
+					lessEqual(zero, add(multiply(edgeX0, centerX), splat(edge0))) &
+					lessEqual(zero, add(multiply(edgeX1, centerX), splat(edge1))) &
+					lessEqual(zero, add(multiply(edgeX2, centerX), splat(edge2)));
+				if (inside == 0)
+				{
+					continue;
+				}
+
+				const Float4 depth = add(multiply(depthX, centerX), splat(rowDepth));
+				const Float4 stored = load(row + x);
+				const u32 closer = inside & less(depth, stored);
+				if (closer != 0)
+				{
+					store(row + x, select(closer, minimum(depth, stored), stored));
+				}
+			}
+
+			// The remainder of the row
+			for (; x <= triangle.maxX; ++x)
+			{
+				const float centerX = static_cast<float>(x) + 0.5f;
+				const bool inside =
+					(triangle.edgeX[0] * centerX + edge0 >= 0.0f) &
+					(triangle.edgeX[1] * centerX + edge1 >= 0.0f) &
+					(triangle.edgeX[2] * centerX + edge2 >= 0.0f);
+				const float depth = triangle.depthX * centerX + rowDepth;
+				row[x] = inside & (depth < row[x]) ? depth : row[x];
+			}
+		}
+	}
+
+	constexpr u32 TILE_COLUMNS = WIDTH / TILE_SIZE;
+	for (u32 tileY = firstRow / TILE_SIZE; tileY <= lastRow / TILE_SIZE; ++tileY)
+	{
+		for (u32 tileX = 0; tileX < TILE_COLUMNS; ++tileX)
+		{
+			float farthest = 0.0f;
+			for (u32 y = tileY * TILE_SIZE; y < (tileY + 1) * TILE_SIZE; ++y)
+			{
+				const float* row = mDepths.data() + y * WIDTH + tileX * TILE_SIZE;
+				for (u32 x = 0; x < TILE_SIZE; ++x)
+				{
+					farthest = std::max(farthest, row[x]);
+				}
+			}
+			mTileDepths[tileY * TILE_COLUMNS + tileX] = farthest;
+		}
+	}
+}
+
+bool OcclusionBufferC::isOccluded(const Box3& box) const noexcept
+{
+	std::array<ScreenPoint, 8> corners;
+	if (!project(box, mProjectionView, corners))
+	{
+		return false;
+	}
+
+	float minX = corners[0].x;
+	float maxX = corners[0].x;
+	float minY = corners[0].y;
+	float maxY = corners[0].y;
+	float nearest = corners[0].depth;
+	for (const ScreenPoint& corner : corners)
+	{
+		minX = std::min(minX, corner.x);
+		maxX = std::max(maxX, corner.x);
+		minY = std::min(minY, corner.y);
+		maxY = std::max(maxY, corner.y);
+		nearest = std::min(nearest, corner.depth);
+	}
+
+	// The boxes outside the buffer are left to the frustum culling
+	if (!(maxX >= 0.0f && minX <= WIDTH && maxY >= 0.0f && minY <= HEIGHT))
+	{
+		return false;
+	}
+
+	const u32 firstX = toPixel(minX, WIDTH);
+	const u32 lastX = toPixel(maxX, WIDTH);
+	const u32 firstY = toPixel(minY, HEIGHT);
+	const u32 lastY = toPixel(maxY, HEIGHT);
+
+	constexpr u32 TILE_COLUMNS = WIDTH / TILE_SIZE;
+	for (u32 tileY = firstY / TILE_SIZE; tileY <= lastY / TILE_SIZE; ++tileY)
+	{
+		const u32 tileFirstY = std::max(tileY * TILE_SIZE, firstY);
+		const u32 tileLastY = std::min((tileY + 1) * TILE_SIZE - 1, lastY);
+		for (u32 tileX = firstX / TILE_SIZE; tileX <= lastX / TILE_SIZE; ++tileX)
+		{
+			if (mTileDepths[tileY * TILE_COLUMNS + tileX] < nearest)
+			{
+				continue;
+			}
+
+			// The tile is not hidden entirely, the pixels under the box decide
+			const u32 tileFirstX = std::max(tileX * TILE_SIZE, firstX);
+			const u32 tileLastX = std::min((tileX + 1) * TILE_SIZE - 1, lastX);
+			if (tileFirstX == tileX * TILE_SIZE &&
+				tileLastX == (tileX + 1) * TILE_SIZE - 1 &&
+				tileFirstY == tileY * TILE_SIZE &&
+				tileLastY == (tileY + 1) * TILE_SIZE - 1)
+			{
+				return false;
+			}
+
+			for (u32 y = tileFirstY; y <= tileLastY; ++y)
+			{
+				const float* row = mDepths.data() + y * WIDTH;
+				for (u32 x = tileFirstX; x <= tileLastX; ++x)
+				{
+					if (!(row[x] < nearest))
+					{
+						return false;
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
+
+bool OcclusionBufferC::project(
+	const Box3& box,
+	const Matrix4& transform,
+	std::array<ScreenPoint, 8>& corners) noexcept
+{
+	const Vector3& min = box.getMin();
+	const Vector3& max = box.getMax();
+	for (u32 i = 0; i < 8; ++i)
+	{
+		const Vector3 corner(
+			(i & 1) != 0 ? max.x : min.x,
+			(i & 2) != 0 ? max.y : min.y,
+			(i & 4) != 0 ? max.z : min.z);
+
+		float clip[4];
+		for (u32 row = 0; row < 4; ++row)
+		{
+			clip[row] =
+				transform(row, 0) * corner.x +
+				transform(row, 1) * corner.y +
+				transform(row, 2) * corner.z +
+				transform(row, 3);
+		}
+
+		if (!(clip[3] > MIN_CLIP_W))
+		{
+			return false;
+		}
+
+		const float inverseW = 1.0f / clip[3];
+		corners[i] = {
+			(clip[0] * inverseW * 0.5f + 0.5f) * WIDTH,
+			(clip[1] * inverseW * 0.5f + 0.5f) * HEIGHT,
+			clip[2] * inverseW * 0.5f + 0.5f};
+	}
+	return true;
+}
+
+void OcclusionBufferC::addTriangle(ScreenPoint p0, ScreenPoint p1, ScreenPoint p2)
+{
+	float area = (p1.x - p0.x) * (p2.y - p0.y) - (p1.y - p0.y) * (p2.x - p0.x);
+	if (!(std::abs(area) > MIN_TRIANGLE_AREA))
+	{
+		return;
+	}
+
+	// Counter-clockwise, so the edge functions are positive inside
+	if (area < 0.0f)
+	{
+		std::swap(p1, p2);
+		area = -area;
+	}
+
+	const float minX = std::min({p0.x, p1.x, p2.x});
+	const float maxX = std::max({p0.x, p1.x, p2.x});
+	const float minY = std::min({p0.y, p1.y, p2.y});
+	const float maxY = std::max({p0.y, p1.y, p2.y});
+	if (maxX < 0.0f || minX > WIDTH || maxY < 0.0f || minY > HEIGHT)
+	{
+		return;
+	}
+
+	Triangle& triangle = mTriangles.emplace_back();
+	const std::array<const ScreenPoint*, 3> points = {&p0, &p1, &p2};
+	for (u32 i = 0; i < 3; ++i)
+	{
+		const ScreenPoint& start = *points[i];
+		const ScreenPoint& end = *points[(i + 1) % 3];
+		triangle.edgeX[i] = start.y - end.y;
+		triangle.edgeY[i] = end.x - start.x;
+		// The minimum of the edge function over a pixel is at the pixel center minus this half-extent
+		triangle.edgeOffset[i] =
+			-(triangle.edgeX[i] * start.x + triangle.edgeY[i] * start.y) -
+			0.5f * (std::abs(triangle.edgeX[i]) + std::abs(triangle.edgeY[i]));
+	}
+
+	triangle.depthX =
+		((p1.depth - p0.depth) * (p2.y - p0.y) - (p2.depth - p0.depth) * (p1.y - p0.y)) / area;
+	triangle.depthY =
+		((p1.x - p0.x) * (p2.depth - p0.depth) - (p2.x - p0.x) * (p1.depth - p0.depth)) / area;
+	// The maximum of the depth over a pixel is at the pixel center plus this half-extent
+	triangle.depthOffset =
+		p0.depth - triangle.depthX * p0.x - triangle.depthY * p0.y +
+		0.5f * (std::abs(triangle.depthX) + std::abs(triangle.depthY));
+
+	triangle.minX = toPixel(minX, WIDTH);
+	triangle.maxX = toPixel(maxX, WIDTH);
+	triangle.minY = toPixel(minY, HEIGHT);
+	triangle.maxY = toPixel(maxY, HEIGHT);
+}
+
+// End of the namespace gltut
+}
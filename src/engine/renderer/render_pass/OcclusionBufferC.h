@@ -0,0 +1,137 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <array>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/math/Box3.h"
+#include "engine/renderer/objects/RenderGeometry.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Low-resolution depth buffer of the occluders, rasterized on the CPU.
+	The local bounds of the occluder geometries are rasterized conservatively:
+	a pixel gets the farthest depth of an occluder only if the occluder covers the whole pixel.
+	The farthest depths of the pixel tiles form the hierarchical level,
+	so a box is tested against the tiles it covers entirely and against the pixels of the other tiles.
+	The buffer is rasterized in horizontal bands, which may be rasterized in parallel
+*/
+class OcclusionBufferC : public NonCopyable
+{
+public:
+	/// The width of the buffer
+	static constexpr u32 WIDTH = 256;
+
+	/// The height of the buffer
+	static constexpr u32 HEIGHT = 128;
+
+	/// The size of the tiles of the hierarchical level
+	static constexpr u32 TILE_SIZE = 8;
+
+	/// The height of a rasterization band, a multiple of the tile size
+	static constexpr u32 BAND_HEIGHT = 2 * TILE_SIZE;
+
+	/// The number of the rasterization bands
+	static constexpr u32 BAND_COUNT = HEIGHT / BAND_HEIGHT;
+
+	static_assert(
+		WIDTH % TILE_SIZE == 0 && HEIGHT % BAND_HEIGHT == 0,
+		"The buffer must consist of whole tiles and bands");
+
+	/**
+		\brief Sets up the triangles of the occluders for a projection * view matrix.
+		The occluders crossing the plane of the eye are skipped
+		\return The number of the bands to rasterize, 0 if no occluder is rasterized
+	*/
+	u32 begin(
+		const Matrix4& projectionView,
+		const std::vector<const RenderGeometry*>& occluders);
+
+	/// Rasterizes the occluders into a band, may be called by any thread
+	void rasterize(u32 band) noexcept;
+
+	/// Returns if a global box is hidden by the occluders
+	bool isOccluded(const Box3& box) const noexcept;
+
+private:
+	/// A triangle set up for the rasterization in the pixel coordinates
+	struct Triangle
+	{
+		/// The x coefficients of the edge functions, positive inside
+		std::array<float, 3> edgeX;
+
+		/// The y coefficients of the edge functions
+		std::array<float, 3> edgeY;
+
+		/// The constants of the edge functions, shifted to cover the whole pixels
+		std::array<float, 3> edgeOffset;
+
+		/// The x coefficient of the depth plane
+		float depthX;
+
+		/// The y coefficient of the depth plane
+		float depthY;
+
+		/// The constant of the depth plane, shifted to the farthest depth of a pixel
+		float depthOffset;
+
+		/// The first column of the bounding pixels
+		u32 minX;
+
+		/// The last column of the bounding pixels
+		u32 maxX;
+
+		/// The first row of the bounding pixels
+		u32 minY;
+
+		/// The last row of the bounding pixels
+		u32 maxY;
+	};
+
+	/// A point in the pixel coordinates with the depth in [0, 1] between the clipping planes
+	struct ScreenPoint
+	{
+		/// The x coordinate
+		float x;
+
+		/// The y coordinate
+		float y;
+
+		/// The depth
+		float depth;
+	};
+
+	/**
+		\brief Projects the corners of a box with a transform to the pixel coordinates
+		\return false if a corner is not in front of the eye
+	*/
+	static bool project(
+		const Box3& box,
+		const Matrix4& transform,
+		std::array<ScreenPoint, 8>& corners) noexcept;
+
+	/// Sets up a triangle, skips the degenerate and off-screen ones
+	void addTriangle(ScreenPoint p0, ScreenPoint p1, ScreenPoint p2);
+
+	/// The projection * view matrix
+	Matrix4 mProjectionView;
+
+	/// The triangles of the occluders
+	std::vector<Triangle> mTriangles;
+
+	/// The depths of the pixels, row by row
+	std::vector<float> mDepths;
+
+	/// The farthest depths of the tiles, row by row
+	std::vector<float> mTileDepths;
+};
+
+// End of the namespace gltut
+}
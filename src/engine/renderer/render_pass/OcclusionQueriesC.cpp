@@ -0,0 +1,186 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "OcclusionQueriesC.h"
+
+#include "engine/core/Check.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local constants
+/// The frames between the queries of a visible geometry
+constexpr u32 VISIBLE_QUERY_INTERVAL = 8;
+
+/// The frames after which the query of a geometry which is not rendered is released
+constexpr u32 RELEASE_FRAMES = 64;
+
+// Local functions
+/// Returns if a box crosses the near plane or the plane of the eye
+bool crossesNearPlane(const Box3& box, const Matrix4& projectionView) noexcept
+{
+	const Vector3& min = box.getMin();
+	const Vector3& max = box.getMax();
+	for (u32 i = 0; i < 8; ++i)
+	{
+		const Vector3 corner(
+			(i & 1) != 0 ? max.x : min.x,
+			(i & 2) != 0 ? max.y : min.y,
+			(i & 4) != 0 ? max.z : min.z);
+
+		const float z =
+			projectionView(2, 0) * corner.x +
+			projectionView(2, 1) * corner.y +
+			projectionView(2, 2) * corner.z +
+			projectionView(2, 3);
+
+		const float w =
+			projectionView(3, 0) * corner.x +
+			projectionView(3, 1) * corner.y +
+			projectionView(3, 2) * corner.z +
+			projectionView(3, 3);
+
+		if (!(w > 0.0f && z >= -w))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+OcclusionQueriesC::OcclusionQueriesC(OcclusionQueryPool& pool) noexcept :
+
+	mPool(pool)
+{
+}
+
+OcclusionQueriesC::~OcclusionQueriesC() noexcept
+{
+	for (const auto& item : mStates)
+	{
+		if (item.second.query != 0)
+		{
+			mPool.release(item.second.query);
+		}
+	}
+}
+
+void OcclusionQueriesC::update() noexcept
+{
+	++mFrame;
+	mQueryCount = 0;
+	mPendingCount = 0;
+	for (auto it = mStates.begin(); it != mStates.end();)
+	{
+		State& state = it->second;
+		if (mFrame - state.frame > RELEASE_FRAMES)
+		{
+			if (state.query != 0)
+			{
+				mPool.release(state.query);
+			}
+			it = mStates.erase(it);
+			continue;
+		}
+
+		if (state.pending)
+		{
+			const std::optional<bool> result = mPool.getResult(state.query);
+			if (result.has_value())
+			{
+				state.pending = false;
+				state.tested = true;
+				state.visible = *result;
+			}
+			else
+			{
+				++mPendingCount;
+			}
+		}
+		++it;
+	}
+}
+
+OcclusionQueriesC::Visibility OcclusionQueriesC::getVisibility(
+	const RenderGeometry* geometry,
+	u32& query) const noexcept
+{
+	const auto found = mStates.find(geometry);
+	if (found == mStates.end() || !found->second.tested || found->second.visible)
+	{
+		return Visibility::VISIBLE;
+	}
+
+	if (found->second.pending)
+	{
+		query = found->second.query;
+		return Visibility::UNCERTAIN;
+	}
+	return Visibility::HIDDEN;
+}
+
+void OcclusionQueriesC::beginIssue() noexcept
+{
+	mPool.beginBoxes();
+}
+
+void OcclusionQueriesC::issue(const RenderGeometry* geometry, const Matrix4& projectionView) noexcept
+{
+	GLTUT_CATCH_ALL_BEGIN
+	const auto inserted = mStates.try_emplace(geometry);
+	State& state = inserted.first->second;
+	if (inserted.second)
+	{
+		state.phase = static_cast<u32>(mStates.size()) % VISIBLE_QUERY_INTERVAL;
+	}
+
+	state.frame = mFrame;
+	if (state.pending ||
+		(state.tested && state.visible && (mFrame + state.phase) % VISIBLE_QUERY_INTERVAL != 0))
+	{
+		return;
+	}
+
+	// The geometries without bounds and the ones around the eye are always visible
+	const Box3* bounds = geometry->getGlobalBounds();
+	if (bounds == nullptr || crossesNearPlane(*bounds, projectionView))
+	{
+		state.tested = true;
+		state.visible = true;
+		return;
+	}
+
+	if (state.query == 0)
+	{
+		state.query = mPool.acquire();
+		if (state.query == 0)
+		{
+			return;
+		}
+	}
+
+	mPool.queryBox(
+		state.query,
+		projectionView *
+			Matrix4::translationMatrix(bounds->getMin()) *
+			Matrix4::scaleMatrix(bounds->getSize()));
+	state.pending = true;
+	++mQueryCount;
+	GLTUT_CATCH_ALL_END("Cannot issue an occlusion query")
+}
+
+void OcclusionQueriesC::endIssue() noexcept
+{
+	mPool.endBoxes();
+}
+
+// End of the namespace gltut
+}
@@ -0,0 +1,124 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <unordered_map>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/query/OcclusionQueryPool.h"
+#include "engine/renderer/objects/RenderGeometry.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief The occlusion queries of the geometries of a render pass.
+	After the pass is rendered, the bounding boxes of the hidden geometries
+	and, periodically, of the visible ones are tested against its depth.
+	The results are read in the next frames without waiting.
+	The geometries are drawn by their latest results: the visible ones are drawn,
+	the hidden ones are skipped, and the hidden ones with a pending query
+	are drawn with the conditional rendering on that query
+*/
+class OcclusionQueriesC : public NonCopyable
+{
+public:
+	/// The visibility of a geometry
+	enum class Visibility
+	{
+		/// The geometry is visible or not tested yet
+		VISIBLE,
+		/// The geometry was hidden, is drawn only if its pending query passes
+		UNCERTAIN,
+		/// The geometry is hidden
+		HIDDEN
+	};
+
+	/// Constructor
+	explicit OcclusionQueriesC(OcclusionQueryPool& pool) noexcept;
+
+	/// Destructor, returns the queries to the pool
+	~OcclusionQueriesC() noexcept;
+
+	/**
+		\brief Starts a frame: reads the available results of the pending queries
+		and releases the queries of the geometries which are not rendered for a while.
+		Never waits for the results
+	*/
+	void update() noexcept;
+
+	/**
+		\brief Returns the visibility of a geometry by the latest available result.
+		May be called by any thread between update() and issue()
+		\param query Receives the pending query of an uncertain geometry
+	*/
+	Visibility getVisibility(const RenderGeometry* geometry, u32& query) const noexcept;
+
+	/// Starts issuing the queries, after the geometries of the pass are rendered
+	void beginIssue() noexcept;
+
+	/**
+		\brief Issues the query of a rendered or skipped geometry if it needs one.
+		The geometries whose boxes cross the near plane are visible without a query
+	*/
+	void issue(const RenderGeometry* geometry, const Matrix4& projectionView) noexcept;
+
+	/// Ends issuing the queries
+	void endIssue() noexcept;
+
+	/// Returns the number of the queries issued in the frame
+	u32 getQueryCount() const noexcept
+	{
+		return mQueryCount;
+	}
+
+	/// Returns the number of the queries whose results were not available at the frame start
+	u32 getPendingCount() const noexcept
+	{
+		return mPendingCount;
+	}
+
+private:
+	/// The query state of a geometry
+	struct State
+	{
+		/// The query, 0 if no query is acquired
+		u32 query = 0;
+
+		/// The last frame the geometry is rendered or skipped
+		u32 frame = 0;
+
+		/// The frame offset of the periodic queries of the visible geometry
+		u32 phase = 0;
+
+		/// If the query is issued and its result is not read yet
+		bool pending = false;
+
+		/// If the geometry is tested
+		bool tested = false;
+
+		/// If the geometry was visible in the latest result
+		bool visible = true;
+	};
+
+	/// The occlusion query pool
+	OcclusionQueryPool& mPool;
+
+	/// The states of the geometries
+	std::unordered_map<const RenderGeometry*, State> mStates;
+
+	/// The current frame
+	u32 mFrame = 0;
+
+	/// The number of the queries issued in the frame
+	u32 mQueryCount = 0;
+
+	/// The number of the pending queries at the frame start
+	u32 mPendingCount = 0;
+};
+
+// End of the namespace gltut
+}
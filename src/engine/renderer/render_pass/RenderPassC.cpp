@@ -5,6 +5,8 @@
 // Includes
 #include "RenderPassC.h"
 
+#include <algorithm>
+
 namespace gltut
 {
 // Global classes
@@ -18,10 +20,13 @@ RenderPassC::RenderPassC(
 	const Rectangle2u* viewport,
 	GraphicsDevice& device,
 	const ShaderBindings& shaderBindings,
-	const ShaderUniformBufferBindings& shaderUniformBufferBindings) :
+	const ShaderUniformBufferBindings& shaderUniformBufferBindings,
+	ObjectBufferC& objectBuffer) :
 
 	mViewpoint(viewpoint),
 	mObject(object),
+	mGroup(dynamic_cast<const RenderGeometryGroup*>(object)),
+	mDrawList(device),
 	mTarget(target),
 	mMaterialPass(materialPass),
 	mClearColor(clearColor ? std::make_optional(*clearColor) : std::nullopt),
@@ -29,18 +34,241 @@ RenderPassC::RenderPassC(
 	mViewport(viewport ? std::make_optional(*viewport) : std::nullopt),
 	mDevice(device),
 	mShaderBindings(shaderBindings),
-	mShaderUniformBufferBindings(shaderUniformBufferBindings)
+	mShaderUniformBufferBindings(shaderUniformBufferBindings),
+	mObjectBuffer(objectBuffer)
 {
 	GLTUT_CHECK(object != nullptr, "Object cannot be null");
 	GLTUT_CHECK(target != nullptr, "Target framebuffer cannot be null");
 }
 
+void RenderPassC::setName(const char* name) noexcept
+{
+	GLTUT_CATCH_ALL_BEGIN
+	mName = name != nullptr ? name : "";
+	GLTUT_CATCH_ALL_END("Cannot set the name of a render pass")
+}
+
+void RenderPassC::addInput(const Texture* texture) noexcept
+{
+	if (texture == nullptr ||
+		std::find(mInputs.begin(), mInputs.end(), texture) != mInputs.end())
+	{
+		return;
+	}
+
+	GLTUT_CATCH_ALL_BEGIN
+	mInputs.push_back(texture);
+	GLTUT_CATCH_ALL_END("Cannot add an input of a render pass")
+}
+
+void RenderPassC::removeInput(const Texture* texture) noexcept
+{
+	auto it = std::find(mInputs.begin(), mInputs.end(), texture);
+	if (it != mInputs.end())
+	{
+		mInputs.erase(it);
+	}
+}
+
+void RenderPassC::addOccluder(const RenderGeometry* occluder) noexcept
+{
+	if (occluder == nullptr ||
+		std::find(mOccluders.begin(), mOccluders.end(), occluder) != mOccluders.end())
+	{
+		return;
+	}
+
+	GLTUT_CATCH_ALL_BEGIN
+	mOccluders.push_back(occluder);
+	GLTUT_CATCH_ALL_END("Cannot add an occluder of a render pass")
+}
+
+void RenderPassC::removeOccluder(const RenderGeometry* occluder) noexcept
+{
+	auto it = std::find(mOccluders.begin(), mOccluders.end(), occluder);
+	if (it != mOccluders.end())
+	{
+		mOccluders.erase(it);
+	}
+}
+
+void RenderPassC::enableOcclusionQueries(bool enabled) noexcept
+{
+	if (!enabled)
+	{
+		mOcclusionQueries.reset();
+		return;
+	}
+
+	OcclusionQueryPool* pool = mDevice.getOcclusionQueries();
+	if (mOcclusionQueries == nullptr && pool != nullptr)
+	{
+		GLTUT_CATCH_ALL_BEGIN
+		mOcclusionQueries = std::make_unique<OcclusionQueriesC>(*pool);
+		GLTUT_CATCH_ALL_END("Cannot enable the occlusion queries of a render pass")
+	}
+}
+
 void RenderPassC::execute() noexcept
 {
-	execute(mObject);
+	if (mGroup == nullptr)
+	{
+		execute(mObject);
+		return;
+	}
+
+	if (!mBuilt)
+	{
+		build();
+	}
+	mBuilt = false;
+
+	prepare();
+	mDrawList.render(
+		mObjectBuffer,
+		mOcclusionQueries != nullptr ? mDevice.getOcclusionQueries() : nullptr);
+	issueOcclusionQueries();
+}
+
+u32 RenderPassC::beginBuild() noexcept
+{
+	mBuilt = false;
+	mOcclusionBandCount = 0;
+	if (mGroup == nullptr)
+	{
+		return 0;
+	}
+
+	GLTUT_CATCH_ALL_BEGIN
+	if (mViewpoint != nullptr)
+	{
+		const Matrix4 viewMatrix = mViewpoint->getViewMatrix();
+		const Matrix4 projectionMatrix = mViewpoint->getProjectionMatrix(getAspectRatio());
+		mProjectionView = projectionMatrix * viewMatrix;
+		const Frustum frustum(mProjectionView);
+		const DrawListC::LodSelection lodSelection = {
+			mProjectionView,
+			0.5f * static_cast<float>(getViewportSize().y) * projectionMatrix(1, 1),
+			mLodThreshold,
+			mLodBias};
+		mOcclusionBandCount = mOccluders.empty() ?
+			0 :
+			mOcclusionBuffer.begin(mProjectionView, mOccluders);
+
+		if (mOcclusionQueries != nullptr)
+		{
+			mOcclusionQueries->update();
+		}
+
+		return mDrawList.beginBuild(
+			*mGroup,
+			mMaterialPass,
+			mDepthTest,
+			viewMatrix,
+			&frustum,
+			mOcclusionBandCount > 0 ? &mOcclusionBuffer : nullptr,
+			mOcclusionQueries.get(),
+			&lodSelection,
+			mDepthPrePass.has_value() ? &mDepthPrePass.value() : nullptr);
+	}
+	return mDrawList.beginBuild(
+		*mGroup,
+		mMaterialPass,
+		mDepthTest,
+		Matrix4::identity(),
+		nullptr,
+		nullptr,
+		nullptr,
+		nullptr,
+		mDepthPrePass.has_value() ? &mDepthPrePass.value() : nullptr);
+	GLTUT_CATCH_ALL_END("Cannot build the draw list of a render pass")
+	return 0;
+}
+
+void RenderPassC::rasterizeOccluders(u32 band) noexcept
+{
+	mOcclusionBuffer.rasterize(band);
+}
+
+void RenderPassC::buildChunk(u32 chunk) noexcept
+{
+	mDrawList.buildChunk(chunk);
+}
+
+void RenderPassC::endBuild() noexcept
+{
+	if (mGroup == nullptr)
+	{
+		return;
+	}
+
+	GLTUT_CATCH_ALL_BEGIN
+	mDrawList.endBuild();
+	mBuilt = true;
+	GLTUT_CATCH_ALL_END("Cannot build the draw list of a render pass")
 }
 
 void RenderPassC::execute(const RenderObject* target) noexcept
+{
+	prepare();
+	if (target != nullptr)
+	{
+		target->render(mMaterialPass);
+	}
+}
+
+void RenderPassC::build() noexcept
+{
+	const u32 chunkCount = beginBuild();
+	for (u32 i = 0; i < mOcclusionBandCount; ++i)
+	{
+		rasterizeOccluders(i);
+	}
+
+	for (u32 i = 0; i < chunkCount; ++i)
+	{
+		buildChunk(i);
+	}
+	endBuild();
+}
+
+void RenderPassC::issueOcclusionQueries() noexcept
+{
+	// The queries need the projection of the viewpoint
+	if (mOcclusionQueries == nullptr || mViewpoint == nullptr)
+	{
+		return;
+	}
+
+	mOcclusionQueries->beginIssue();
+	for (const DrawListC::Packet& packet : mDrawList.getPackets())
+	{
+		mOcclusionQueries->issue(packet.geometry, mProjectionView);
+	}
+
+	for (const RenderGeometry* geometry : mDrawList.getHiddenGeometries())
+	{
+		mOcclusionQueries->issue(geometry, mProjectionView);
+	}
+	mOcclusionQueries->endIssue();
+}
+
+Point2u RenderPassC::getViewportSize() const noexcept
+{
+	return mViewport.has_value() ?
+		mViewport->getSize() :
+		mTarget->getSize();
+}
+
+float RenderPassC::getAspectRatio() const noexcept
+{
+	const Point2u viewportSize = getViewportSize();
+	return viewportSize.x > 0 && viewportSize.y > 0 ?
+		static_cast<float>(viewportSize.x) / static_cast<float>(viewportSize.y) :
+		1.0f;
+}
+
+void RenderPassC::prepare() noexcept
 {
 	mDevice.setDepthTest(mDepthTest);
 
@@ -52,15 +280,7 @@ void RenderPassC::execute(const RenderObject* target) noexcept
 		mClearColor.has_value() ? &mClearColor.value() : nullptr,
 		mClearDepth);
 
-	const Point2u viewportSize = mViewport.has_value() ?
-		mViewport->getSize() :
-		mTarget->getSize();
-
-	const float aspectRatio =
-		viewportSize.x > 0 && viewportSize.y > 0 ?
-		static_cast<float>(viewportSize.x) / static_cast<float>(viewportSize.y) :
-		1.0f;
-
+	const float aspectRatio = getAspectRatio();
 	for (const auto& binding : mShaderBindings)
 	{
 		binding->update(mViewpoint, aspectRatio);
@@ -70,11 +290,6 @@ void RenderPassC::execute(const RenderObject* target) noexcept
 	{
 		binding->update(mViewpoint, aspectRatio);
 	}
-
-	if (target != nullptr)
-	{
-		target->render(mMaterialPass);
-	}
 }
 
 // End of the namespace gltut
@@ -5,7 +5,9 @@
 #pragma once
 
 // Includes
+#include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "engine/core/NonCopyable.h"
@@ -14,6 +16,8 @@
 #include "engine/renderer/shader/ShaderRendererBinding.h"
 #include "engine/renderer/shader/ShaderUniformBufferRendererBinding.h"
 
+#include "DrawListC.h"
+
 namespace gltut
 {
 // Global classes
@@ -40,7 +44,17 @@ public:
 		const Rectangle2u* viewport,
 		GraphicsDevice& device,
 		const ShaderBindings& shaderBindings,
-		const ShaderUniformBufferBindings& shaderUniformBufferBindings);
+		const ShaderUniformBufferBindings& shaderUniformBufferBindings,
+		ObjectBufferC& objectBuffer);
+
+	/// Returns the name of the pass
+	const char* getName() const noexcept final
+	{
+		return mName.c_str();
+	}
+
+	/// Sets the name of the pass
+	void setName(const char* name) noexcept final;
 
 	/// Returns the scene viewpoint
 	const Viewpoint* getViewpoint() const noexcept final
@@ -141,20 +155,228 @@ public:
 		mActive = active;
 	}
 
-	/// Executes the render pass
+	/// Declares a texture read by the pass
+	void addInput(const Texture* texture) noexcept final;
+
+	/// Removes a texture read by the pass
+	void removeInput(const Texture* texture) noexcept final;
+
+	/// Returns the number of the textures read by the pass
+	u32 getInputCount() const noexcept final
+	{
+		return static_cast<u32>(mInputs.size());
+	}
+
+	/// Returns the i-th texture read by the pass
+	const Texture* getInput(u32 index) const noexcept final
+	{
+		return index < mInputs.size() ? mInputs[index] : nullptr;
+	}
+
+	/// Adds an occluder of the pass
+	void addOccluder(const RenderGeometry* occluder) noexcept final;
+
+	/// Removes an occluder of the pass
+	void removeOccluder(const RenderGeometry* occluder) noexcept final;
+
+	/// Returns the number of the occluders of the pass
+	u32 getOccluderCount() const noexcept final
+	{
+		return static_cast<u32>(mOccluders.size());
+	}
+
+	/// Returns the i-th occluder of the pass
+	const RenderGeometry* getOccluder(u32 index) const noexcept final
+	{
+		return index < mOccluders.size() ? mOccluders[index] : nullptr;
+	}
+
+	/// Returns the number of the geometries submitted to the culling in the last execution
+	u32 getSubmittedCount() const noexcept override
+	{
+		return mDrawList.getCandidateCount();
+	}
+
+	/// Returns the number of the geometries outside the view frustum in the last execution
+	u32 getFrustumCulledCount() const noexcept final
+	{
+		return mDrawList.getCulledCount();
+	}
+
+	/// Enables or disables the GPU occlusion queries of the pass
+	void enableOcclusionQueries(bool enabled) noexcept final;
+
+	/// Returns if the occlusion queries are enabled
+	bool areOcclusionQueriesEnabled() const noexcept final
+	{
+		return mOcclusionQueries != nullptr;
+	}
+
+	/// Returns the number of the geometries hidden by the occluders or by the occlusion queries in the last execution
+	u32 getOcclusionCulledCount() const noexcept final
+	{
+		return mDrawList.getOccludedCount();
+	}
+
+	/// Returns the number of the occlusion queries issued in the last execution
+	u32 getOcclusionQueryCount() const noexcept final
+	{
+		return mOcclusionQueries != nullptr ? mOcclusionQueries->getQueryCount() : 0;
+	}
+
+	/// Returns the number of the occlusion queries whose results were not available in the last execution
+	u32 getOcclusionQueryPendingCount() const noexcept final
+	{
+		return mOcclusionQueries != nullptr ? mOcclusionQueries->getPendingCount() : 0;
+	}
+
+	/// Sets the maximum projected error of the levels of detail, in pixels
+	void setLodThreshold(float pixels) noexcept final
+	{
+		if (GLTUT_ASSERT(pixels >= 0.0f))
+		{
+			mLodThreshold = pixels;
+		}
+	}
+
+	/// Returns the maximum projected error of the levels of detail, in pixels
+	float getLodThreshold() const noexcept final
+	{
+		return mLodThreshold;
+	}
+
+	/// Sets the number of the coarser levels of detail added to the selected ones
+	void setLodBias(u32 levels) noexcept final
+	{
+		mLodBias = levels;
+	}
+
+	/// Returns the number of the coarser levels of detail added to the selected ones
+	u32 getLodBias() const noexcept final
+	{
+		return mLodBias;
+	}
+
+	/// Enables the depth-only pre-pass of the opaque geometries with costly materials
+	void enableDepthPrePass(u32 depthMaterialPass, float minCost) noexcept final
+	{
+		mDepthPrePass = DrawListC::DepthPrePass{depthMaterialPass, minCost};
+	}
+
+	/// Disables the depth pre-pass
+	void disableDepthPrePass() noexcept final
+	{
+		mDepthPrePass.reset();
+	}
+
+	/// Returns if the depth pre-pass is enabled
+	bool isDepthPrePassEnabled() const noexcept final
+	{
+		return mDepthPrePass.has_value();
+	}
+
+	/// Returns the number of the geometries drawn by the depth pre-pass in the last execution
+	u32 getDepthPrePassCount() const noexcept final
+	{
+		return mDrawList.getPrePassCount();
+	}
+
+	/**
+		\brief Executes the render pass.
+		If the object is a render geometry group, renders it via a sorted draw list,
+		skipping the geometries outside the viewpoint frustum and the ones hidden by the occluders,
+		with the levels of detail selected by their projected errors.
+		Builds the draw list if it is not built by the build methods for this execution
+	*/
 	void execute() noexcept;
 
+	/**
+		\brief Starts building the draw data of the pass on the rendering thread.
+		The occlusion buffer is rasterized by rasterizeOccluders() for every band,
+		then the data is built by buildChunk() for every chunk and completed by endBuild().
+		The chunks and the passes may be built by different threads at the same time
+		\return The number of the chunks
+	*/
+	virtual u32 beginBuild() noexcept;
+
+	/// Returns the number of the bands of the occlusion buffer to rasterize before the chunks are built
+	u32 getOcclusionBandCount() const noexcept
+	{
+		return mOcclusionBandCount;
+	}
+
+	/// Rasterizes the occluders into a band of the occlusion buffer, may be called by any thread
+	void rasterizeOccluders(u32 band) noexcept;
+
+	/// Builds a chunk of the draw data, may be called by any thread
+	virtual void buildChunk(u32 chunk) noexcept;
+
+	/// Completes the draw data, may be called by any thread
+	virtual void endBuild() noexcept;
+
 protected:
-	/// Executes the render pass
+	/// Executes the render pass for an object, rendering it as is
 	void execute(const RenderObject* target) noexcept;
 
+	/// Builds the draw data on the calling thread
+	void build() noexcept;
+
+	/// Returns the size of the viewport
+	Point2u getViewportSize() const noexcept;
+
+	/// Returns the aspect ratio of the viewport
+	float getAspectRatio() const noexcept;
+
 private:
+	/// Sets the pass state, clears the target and updates the viewpoint bindings
+	void prepare() noexcept;
+
+	/// Issues the occlusion queries of the rendered and hidden geometries against the depth of the pass
+	void issueOcclusionQueries() noexcept;
+
+private:
+	/// The name of the pass
+	std::string mName;
+
 	/// The viewpoint for this render pass
 	const Viewpoint* mViewpoint;
 
 	/// The object to render
 	const RenderObject* mObject;
 
+	/// The object as a render geometry group, nullptr if it is not a group
+	const RenderGeometryGroup* mGroup;
+
+	/// The draw list of the group
+	DrawListC mDrawList;
+
+	/// If the draw list is built for the next execution
+	bool mBuilt = false;
+
+	/// The occluders
+	std::vector<const RenderGeometry*> mOccluders;
+
+	/// The occlusion buffer of the draw list
+	OcclusionBufferC mOcclusionBuffer;
+
+	/// The number of the occlusion buffer bands of the build, 0 if the occlusion culling is not used
+	u32 mOcclusionBandCount = 0;
+
+	/// The occlusion queries, nullptr if they are disabled
+	std::unique_ptr<OcclusionQueriesC> mOcclusionQueries;
+
+	/// The projection * view matrix of the build
+	Matrix4 mProjectionView;
+
+	/// The maximum projected error of the levels of detail, in pixels
+	float mLodThreshold = 1.0f;
+
+	/// The number of the coarser levels of detail added to the selected ones
+	u32 mLodBias = 0;
+
+	/// The depth pre-pass, std::nullopt if it is disabled
+	std::optional<DrawListC::DepthPrePass> mDepthPrePass;
+
 	/// The target frame buffer for this render pass
 	Framebuffer* mTarget;
 
@@ -176,6 +398,9 @@ private:
 	/// Active flag
 	bool mActive = true;
 
+	/// The textures read by the pass
+	std::vector<const Texture*> mInputs;
+
 	/// GraphicsDevice
 	GraphicsDevice& mDevice;
 
@@ -184,6 +409,9 @@ private:
 
 	/// Shader uniform buffer bindings
 	const ShaderUniformBufferBindings& mShaderUniformBufferBindings;
+
+	/// The object buffer of the renderer
+	ObjectBufferC& mObjectBuffer;
 };
 
 // End of the namespace gltut
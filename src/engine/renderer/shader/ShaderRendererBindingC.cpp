@@ -46,6 +46,8 @@ void ShaderRendererBindingC::update(const RenderGeometry* geometry) const noexce
 		return;
 	}
 
+	updateMatrixSource(RendererBinding::MatrixSource::UNIFORMS);
+
 	if (const char* objectMatrix = getBoundShaderParameter(RendererBinding::Parameter::GEOMETRY_MATRIX);
 		objectMatrix != nullptr)
 	{
@@ -55,8 +57,23 @@ void ShaderRendererBindingC::update(const RenderGeometry* geometry) const noexce
 	if (const char* objectNormalMatrix = getBoundShaderParameter(RendererBinding::Parameter::GEOMETRY_NORMAL_MATRIX);
 		objectNormalMatrix != nullptr)
 	{
-		const Matrix3 normalMatrix = getNormalMatrix(geometry->getTransform().getMatrix3());
-		shader->setMat3(objectNormalMatrix, normalMatrix.data());
+		shader->setMat3(objectNormalMatrix, geometry->getNormalMatrix().data());
+	}
+}
+
+void ShaderRendererBindingC::updateMatrixSource(RendererBinding::MatrixSource source) const noexcept
+{
+	Shader* shader = getTarget();
+	if (shader == nullptr || source == mMatrixSource)
+	{
+		return;
+	}
+
+	if (const char* matrixSource = getBoundShaderParameter(RendererBinding::Parameter::GEOMETRY_MATRIX_SOURCE);
+		matrixSource != nullptr)
+	{
+		shader->setInt(matrixSource, static_cast<int>(source));
+		mMatrixSource = source;
 	}
 }
 
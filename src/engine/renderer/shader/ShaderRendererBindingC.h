@@ -25,6 +25,19 @@ public:
 
 	/// Updates the shader for a render geometry
 	void update(const RenderGeometry* geometry) const noexcept final;
+
+	/// Returns true if the matrix source parameter is bound
+	bool isMatrixSourceSupported() const noexcept final
+	{
+		return getBoundShaderParameter(RendererBinding::Parameter::GEOMETRY_MATRIX_SOURCE) != nullptr;
+	}
+
+	/// Sets the matrix source parameter of the shader if it changes
+	void updateMatrixSource(RendererBinding::MatrixSource source) const noexcept final;
+
+private:
+	/// The last value of the matrix source parameter
+	mutable RendererBinding::MatrixSource mMatrixSource = RendererBinding::MatrixSource::UNIFORMS;
 };
 
 // End of the namespace gltut
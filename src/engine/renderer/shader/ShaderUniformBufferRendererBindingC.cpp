@@ -57,8 +57,7 @@ void ShaderUniformBufferRendererBindingC::update(const RenderGeometry* geometry)
 	if (const u32* offset = getParameterOffset(RendererBinding::Parameter::GEOMETRY_NORMAL_MATRIX);
 		offset != nullptr)
 	{
-		const Matrix3 normalMatrix = getNormalMatrix(geometry->getTransform().getMatrix3());
-		target->setData(normalMatrix.data(), sizeof(Matrix3), *offset);
+		target->setData(geometry->getNormalMatrix().data(), sizeof(Matrix3), *offset);
 	}
 }
 
@@ -50,7 +50,11 @@ void ShaderUniformBufferSetC::bind() const noexcept
 {
 	for (u32 i = 0; i < mBindingPoints.size(); ++i)
 	{
-		mDevice.bindShaderUniformBuffer(mBindingPoints[i], i);
+		// The binding points without buffers, e.g. the object and material ones, are left to the renderer
+		if (mBindingPoints[i] != nullptr)
+		{
+			mDevice.bindShaderUniformBuffer(mBindingPoints[i], i);
+		}
 	}
 }
 
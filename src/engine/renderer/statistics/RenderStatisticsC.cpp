@@ -0,0 +1,134 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "RenderStatisticsC.h"
+
+#include <algorithm>
+
+#include "engine/core/Check.h"
+
+namespace gltut
+{
+
+namespace
+{
+// Local functions
+/// Returns the time between two points in milliseconds
+template <typename TimePoint>
+float getMilliseconds(TimePoint start, TimePoint end) noexcept
+{
+	return std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+/// Sets the device counters of statistics to the calls between two counter snapshots
+void setDeviceCounters(
+	RenderPassStatistics& statistics,
+	const GraphicsDeviceCallCounters& start,
+	const GraphicsDeviceCallCounters& end) noexcept
+{
+	statistics.drawCalls = end.drawCalls - start.drawCalls;
+	// The devices draw the indexed triangle lists only
+	statistics.triangles = (end.drawnIndices - start.drawnIndices) / 3;
+	statistics.shaderSwitches = end.shaderBinds - start.shaderBinds;
+	statistics.textureBinds = end.textureBinds - start.textureBinds;
+	statistics.uniformUploads =
+		end.uniformSets - start.uniformSets +
+		end.uniformBufferUpdates - start.uniformBufferUpdates;
+	statistics.uniformBufferBytes = end.uniformBufferBytes - start.uniformBufferBytes;
+	statistics.framebufferSwitches = end.framebufferBinds - start.framebufferBinds;
+}
+
+// End of the anonymous namespace
+}
+
+// Global classes
+RenderStatisticsC::RenderStatisticsC(GraphicsDevice& device) noexcept :
+	mCounters(device.getCallCounters())
+{
+}
+
+void RenderStatisticsC::beginFrame() noexcept
+{
+	if (mCounters != nullptr)
+	{
+		mFrameStartCounters = *mCounters;
+	}
+	mSubmissionTime = 0.0f;
+}
+
+void RenderStatisticsC::endFrame() noexcept
+{
+	mFrame = RenderPassStatistics();
+	// The uploads outside the passes, e.g. of the scene lights, are counted too
+	if (mCounters != nullptr)
+	{
+		setDeviceCounters(mFrame, mFrameStartCounters, *mCounters);
+	}
+
+	for (const RenderPassStatistics& pass : mPasses)
+	{
+		mFrame.submittedObjects += pass.submittedObjects;
+		mFrame.culledObjects += pass.culledObjects;
+	}
+	mFrame.submissionTime = mSubmissionTime;
+}
+
+void RenderStatisticsC::beginSubmission() noexcept
+{
+	mPasses.clear();
+	mSubmissionStart = Clock::now();
+}
+
+void RenderStatisticsC::endSubmission() noexcept
+{
+	mSubmissionTime += getMilliseconds(mSubmissionStart, Clock::now());
+}
+
+void RenderStatisticsC::beginPass() noexcept
+{
+	if (mCounters != nullptr)
+	{
+		mPassStartCounters = *mCounters;
+	}
+	mPassStart = Clock::now();
+}
+
+void RenderStatisticsC::endPass(const RenderPass& pass) noexcept
+{
+	RenderPassStatistics statistics;
+	statistics.pass = &pass;
+	statistics.submissionTime = getMilliseconds(mPassStart, Clock::now());
+	statistics.submittedObjects = pass.getSubmittedCount();
+	statistics.culledObjects = pass.getFrustumCulledCount() + pass.getOcclusionCulledCount();
+	if (mCounters != nullptr)
+	{
+		setDeviceCounters(statistics, mPassStartCounters, *mCounters);
+	}
+
+	GLTUT_CATCH_ALL_BEGIN
+	mPasses.push_back(statistics);
+	GLTUT_CATCH_ALL_END("Cannot count the render pass statistics")
+}
+
+void RenderStatisticsC::removePass(const RenderPass* pass) noexcept
+{
+	mPasses.erase(
+		std::remove_if(
+			mPasses.begin(),
+			mPasses.end(),
+			[pass](const RenderPassStatistics& statistics)
+			{
+				return statistics.pass == pass;
+			}),
+		mPasses.end());
+}
+
+void RenderStatisticsC::removeAllPasses() noexcept
+{
+	mPasses.clear();
+}
+
+// End of the namespace gltut
+}
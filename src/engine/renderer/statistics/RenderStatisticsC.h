@@ -0,0 +1,106 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <chrono>
+#include <vector>
+
+#include "engine/core/NonCopyable.h"
+#include "engine/graphics/GraphicsDevice.h"
+#include "engine/renderer/RenderStatistics.h"
+
+namespace gltut
+{
+// Global classes
+/// Implementation of the RenderStatistics interface
+class RenderStatisticsC final : public RenderStatistics, public NonCopyable
+{
+public:
+	/// Constructor
+	explicit RenderStatisticsC(GraphicsDevice& device) noexcept;
+
+	/// Returns if the device counts the calls
+	bool hasDeviceCounters() const noexcept final
+	{
+		return mCounters != nullptr;
+	}
+
+	/// Returns the number of the passes executed in the last frame
+	u32 getPassCount() const noexcept final
+	{
+		return static_cast<u32>(mPasses.size());
+	}
+
+	/// Returns the counters of the i-th pass executed in the last frame
+	const RenderPassStatistics* getPass(u32 index) const noexcept final
+	{
+		return index < mPasses.size() ? &mPasses[index] : nullptr;
+	}
+
+	/// Returns the counters of the last frame
+	const RenderPassStatistics& getFrame() const noexcept final
+	{
+		return mFrame;
+	}
+
+	/// Starts a frame, the device calls from here to endFrame() are counted in the frame
+	void beginFrame() noexcept;
+
+	/**
+		\brief Ends the frame.
+		The device counters include the calls outside the passes, the objects are summed over the passes
+	*/
+	void endFrame() noexcept;
+
+	/// Starts counting the execution of the passes
+	void beginSubmission() noexcept;
+
+	/// Ends counting the execution of the passes started by beginSubmission()
+	void endSubmission() noexcept;
+
+	/// Starts counting the execution of a pass
+	void beginPass() noexcept;
+
+	/// Ends counting the execution of a pass started by beginPass()
+	void endPass(const RenderPass& pass) noexcept;
+
+	/// Removes the counters of a pass
+	void removePass(const RenderPass* pass) noexcept;
+
+	/// Removes the counters of all passes
+	void removeAllPasses() noexcept;
+
+private:
+	/// The clock of the submission times
+	using Clock = std::chrono::steady_clock;
+
+	/// The call counters of the device, nullptr if the device does not count the calls
+	const GraphicsDeviceCallCounters* mCounters;
+
+	/// The counters of the passes executed in the current or the last frame
+	std::vector<RenderPassStatistics> mPasses;
+
+	/// The counters of the last frame
+	RenderPassStatistics mFrame;
+
+	/// The device counters at the start of the current frame
+	GraphicsDeviceCallCounters mFrameStartCounters;
+
+	/// The device counters at the start of the current pass
+	GraphicsDeviceCallCounters mPassStartCounters;
+
+	/// The start of the current pass
+	Clock::time_point mPassStart;
+
+	/// The start of the current submission
+	Clock::time_point mSubmissionStart;
+
+	/// The time of the submissions of the current frame, in milliseconds
+	float mSubmissionTime = 0.0f;
+};
+
+// End of the namespace gltut
+}
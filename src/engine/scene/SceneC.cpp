@@ -5,6 +5,7 @@
 // Includes
 #include "SceneC.h"
 #include "engine/core/Check.h"
+#include "engine/core/CpuProfiler.h"
 
 namespace gltut
 {
@@ -201,6 +202,9 @@ void SceneC::removeCameraController(CameraController* controller) noexcept
 
 void SceneC::update() noexcept
 {
+	GLTUT_PROFILE_ZONE("SceneC::update");
+	updateBounds();
+
 	const auto currentTime = std::chrono::high_resolution_clock::now();
 	const auto timeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
 							currentTime - mCreationTime)
@@ -233,5 +237,23 @@ void SceneC::update() noexcept
 	}
 }
 
+void SceneC::updateBounds() noexcept
+{
+	const auto updateRoots = [](auto& nodes)
+	{
+		for (auto& node : nodes)
+		{
+			if (node.getParent() == nullptr)
+			{
+				node.updateGlobalBounds();
+			}
+		}
+	};
+
+	updateRoots(mGroups);
+	updateRoots(mGeometries);
+	updateRoots(mLights);
+}
+
 // End of the namespace gltut
 }
@@ -7,6 +7,7 @@
 // Includes
 #include <chrono>
 #include <deque>
+#include <memory>
 
 #include "engine/core/NonCopyable.h"
 #include "engine/renderer/Renderer.h"
@@ -158,6 +159,9 @@ public:
 	void update() noexcept;
 
 private:
+	/// Updates the bounds of the scene nodes, so the passes can reject whole subtrees
+	void updateBounds() noexcept;
+
 	/// The window
 	Window& mWindow;
 
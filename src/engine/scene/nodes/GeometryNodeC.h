@@ -39,6 +39,13 @@ private:
 	{
 		SceneNodeT<GeometryNode>::updateGlobalTransform();
 		mGeometry.setTransform(getGlobalTransform());
+		mGeometry.setParentVolume(getParent());
+	}
+
+	/// Returns the global bounds of the geometry
+	const Box3* getOwnGlobalBounds() const noexcept final
+	{
+		return mGeometry.getGlobalBounds();
 	}
 
 	/// The geometry
@@ -7,6 +7,7 @@
 // Includes
 #include "engine/scene/nodes/LightNode.h"
 
+#include "../../core/Version.h"
 #include "./SceneNodeT.h"
 
 namespace gltut
@@ -35,6 +36,7 @@ public:
 	void setType(Type type) noexcept final
 	{
 		mType = type;
+		mVersion = getNextVersion();
 	}
 
 	/// Returns the light direction in the local frame
@@ -53,6 +55,7 @@ public:
 	void setDirection(const Vector3& direction) noexcept final
 	{
 		mDirection = direction.isNearZero() ? DEFAULT_DIRECTION : direction.getNormalized();
+		mVersion = getNextVersion();
 	}
 
 	/**
@@ -80,6 +83,7 @@ public:
 	{
 		mOuterAngle = clamp(angleRadians, 0.0f, PI);
 		mInnerAngle = clamp(mInnerAngle, 0.0f, mOuterAngle);
+		mVersion = getNextVersion();
 	}
 
 	/// Returns the inner angle for spot lights, in radians
@@ -92,6 +96,7 @@ public:
 	void setInnerAngle(float angleRadians) noexcept final
 	{
 		mInnerAngle = clamp(angleRadians, 0.0f, mOuterAngle);
+		mVersion = getNextVersion();
 	}
 
 	/// Returns the linear attenuation for point and spot lights
@@ -104,6 +109,7 @@ public:
 	void setLinearAttenuation(float linearAttenuation) noexcept final
 	{
 		mLinearAttenuation = linearAttenuation;
+		mVersion = getNextVersion();
 	}
 
 	/// Returns the quadratic attenuation for point and spot lights
@@ -116,6 +122,7 @@ public:
 	void setQuadraticAttenuation(float quadraticAttenuation) noexcept final
 	{
 		mQuadraticAttenuation = quadraticAttenuation;
+		mVersion = getNextVersion();
 	}
 
 	/// Returns the ambient color
@@ -128,6 +135,7 @@ public:
 	void setAmbient(const Color& ambient) noexcept final
 	{
 		mAmbient = ambient;
+		mVersion = getNextVersion();
 	}
 
 	/// Returns the diffuse color
@@ -140,6 +148,7 @@ public:
 	void setDiffuse(const Color& diffuse) noexcept final
 	{
 		mDiffuse = diffuse;
+		mVersion = getNextVersion();
 	}
 
 	/// Returns the specular color
@@ -152,6 +161,7 @@ public:
 	void setSpecular(const Color& specular) noexcept final
 	{
 		mSpecular = specular;
+		mVersion = getNextVersion();
 	}
 
 	/// Returns the shadow map
@@ -160,10 +170,25 @@ public:
 		return mShadowMap;
 	}
 
-	/// Sets the shadow map`
+	/// Sets the shadow map
 	void setShadowMap(ShadowMap* shadowMap) noexcept final
 	{
 		mShadowMap = shadowMap;
+		mVersion = getNextVersion();
+	}
+
+	/// Returns the version of the light
+	u64 getVersion() const noexcept final
+	{
+		return mVersion;
+	}
+
+protected:
+	/// Updates the global transform and the version
+	void updateGlobalTransform() noexcept final
+	{
+		SceneNodeT<LightNode>::updateGlobalTransform();
+		mVersion = getNextVersion();
 	}
 
 private:
@@ -196,6 +221,9 @@ private:
 
 	/// The shadow map
 	ShadowMap* mShadowMap = nullptr;
+
+	/// The version
+	u64 mVersion = getNextVersion();
 };
 
 // End of the namespace gltut
@@ -5,6 +5,7 @@
 #pragma once
 
 // Includes
+#include <optional>
 #include <vector>
 #include "engine/core/NonCopyable.h"
 #include "engine/math/Matrix4.h"
@@ -132,7 +133,51 @@ public:
 		return index < mChildren.size() ? mChildren[index] : nullptr;
 	}
 
+	/// Returns the global bounds of the node geometry and of all its descendants
+	const Box3* getGlobalBounds() const noexcept final
+	{
+		return mGlobalBounds.has_value() ? &mGlobalBounds.value() : nullptr;
+	}
+
+	/// Returns the parent node as the enclosing volume
+	const BoundingVolume* getParentVolume() const noexcept final
+	{
+		return mParent;
+	}
+
+	/// Updates the global bounds of this node and its descendants, children first
+	void updateGlobalBounds() noexcept final
+	{
+		mGlobalBounds.reset();
+		if (const Box3* ownBounds = getOwnGlobalBounds())
+		{
+			mGlobalBounds = *ownBounds;
+		}
+
+		for (SceneNode* child : mChildren)
+		{
+			child->updateGlobalBounds();
+			if (const Box3* childBounds = child->getGlobalBounds())
+			{
+				if (mGlobalBounds.has_value())
+				{
+					mGlobalBounds->extend(*childBounds);
+				}
+				else
+				{
+					mGlobalBounds = *childBounds;
+				}
+			}
+		}
+	}
+
 protected:
+	/// Returns the global bounds of the node geometry, excluding the children
+	virtual const Box3* getOwnGlobalBounds() const noexcept
+	{
+		return nullptr;
+	}
+
 	/// Updates the global transform
 	virtual void updateGlobalTransform() noexcept
 	{
@@ -165,6 +210,9 @@ private:
 
 	/// The child nodes
 	std::vector<SceneNode*> mChildren;
+
+	/// The global bounds of the node geometry and of all its descendants
+	std::optional<Box3> mGlobalBounds;
 };
 
 // End of the namespace gltut
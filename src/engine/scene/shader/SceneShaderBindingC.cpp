@@ -7,14 +7,20 @@
 #include "engine/graphics/shader/Shader.h"
 #include "engine/scene/Scene.h"
 
+#include <cmath>
+
 namespace gltut
 {
 
 namespace
 {
+// Local constants
+/// The marker of the light parameters missing for a light type
+constexpr SceneBinding::Parameter NO_PARAMETER = SceneBinding::Parameter::TOTAL_COUNT;
+
 // Local functions
 
-/// Returns the full parameter name with index and attribute	
+/// Returns the full parameter name with index and attribute
 std::string getFullParameter(
 	const std::pair<std::string, std::string>& parameterAttribute,
 	u32 index)
@@ -31,42 +37,36 @@ std::string getFullParameter(
 /// Sets a 3D vector shader parameter
 void setVector3(
 	Shader& shader,
-	const std::pair<std::string, std::string>& parameterAttribute,
-	u32 index,
+	int32 location,
 	const Vector3& value) noexcept
 {
-	if (const auto fullName = getFullParameter(parameterAttribute, index);
-		!fullName.empty())
+	if (location >= 0)
 	{
-		shader.setVec3(fullName.c_str(), value.x, value.y, value.z);
+		shader.setVec3(location, value.x, value.y, value.z);
 	}
 }
 
 /// Sets a 4x4 matrix shader parameter
 void setMatrix4(
 	Shader& shader,
-	const std::pair<std::string, std::string>& parameterAttribute,
-	u32 index,
+	int32 location,
 	const Matrix4& value) noexcept
 {
-	if (const auto fullName = getFullParameter(parameterAttribute, index);
-		!fullName.empty())
+	if (location >= 0)
 	{
-		shader.setMat4(fullName.c_str(), value.data());
+		shader.setMat4(location, value.data());
 	}
 }
 
 /// Sets a float shader parameter
 void setFloat(
 	Shader& shader,
-	const std::pair<std::string, std::string>& parameterAttribute,
-	u32 index,
+	int32 location,
 	float value) noexcept
 {
-	if (const auto fullName = getFullParameter(parameterAttribute, index);
-		!fullName.empty())
+	if (location >= 0)
 	{
-		shader.setFloat(fullName.c_str(), value);
+		shader.setFloat(location, value);
 	}
 }
 
@@ -74,50 +74,132 @@ void setFloat(
 }
 
 // Global classes
+const std::array<
+	std::array<SceneBinding::Parameter, SceneShaderBindingC::LIGHT_PARAMETER_COUNT>,
+	SceneShaderBindingC::LIGHT_TYPE_COUNT> SceneShaderBindingC::SCENE_PARAMETERS = {{
+	// Directional lights
+	{
+		SceneBinding::Parameter::DIRECTIONAL_LIGHT_POSITION,
+		SceneBinding::Parameter::DIRECTIONAL_LIGHT_DIRECTION,
+		SceneBinding::Parameter::DIRECTIONAL_LIGHT_AMBIENT_COLOR,
+		SceneBinding::Parameter::DIRECTIONAL_LIGHT_DIFFUSE_COLOR,
+		SceneBinding::Parameter::DIRECTIONAL_LIGHT_SPECULAR_COLOR,
+		SceneBinding::Parameter::DIRECTIONAL_LIGHT_LINEAR_ATTENUATION,
+		SceneBinding::Parameter::DIRECTIONAL_LIGHT_QUADRATIC_ATTENUATION,
+		NO_PARAMETER,
+		NO_PARAMETER,
+		SceneBinding::Parameter::DIRECTIONAL_LIGHT_SHADOW_MATRIX,
+		NO_PARAMETER,
+		NO_PARAMETER
+	},
+	// Point lights
+	{
+		SceneBinding::Parameter::POINT_LIGHT_POSITION,
+		NO_PARAMETER,
+		SceneBinding::Parameter::POINT_LIGHT_AMBIENT_COLOR,
+		SceneBinding::Parameter::POINT_LIGHT_DIFFUSE_COLOR,
+		SceneBinding::Parameter::POINT_LIGHT_SPECULAR_COLOR,
+		SceneBinding::Parameter::POINT_LIGHT_LINEAR_ATTENUATION,
+		SceneBinding::Parameter::POINT_LIGHT_QUADRATIC_ATTENUATION,
+		NO_PARAMETER,
+		NO_PARAMETER,
+		NO_PARAMETER,
+		NO_PARAMETER,
+		NO_PARAMETER
+	},
+	// Spot lights
+	{
+		SceneBinding::Parameter::SPOT_LIGHT_POSITION,
+		SceneBinding::Parameter::SPOT_LIGHT_DIRECTION,
+		SceneBinding::Parameter::SPOT_LIGHT_AMBIENT_COLOR,
+		SceneBinding::Parameter::SPOT_LIGHT_DIFFUSE_COLOR,
+		SceneBinding::Parameter::SPOT_LIGHT_SPECULAR_COLOR,
+		SceneBinding::Parameter::SPOT_LIGHT_LINEAR_ATTENUATION,
+		SceneBinding::Parameter::SPOT_LIGHT_QUADRATIC_ATTENUATION,
+		SceneBinding::Parameter::SPOT_LIGHT_INNER_ANGLE_COS,
+		SceneBinding::Parameter::SPOT_LIGHT_OUTER_ANGLE_COS,
+		SceneBinding::Parameter::SPOT_LIGHT_SHADOW_MATRIX,
+		SceneBinding::Parameter::SPOT_LIGHT_SHADOW_NEAR,
+		SceneBinding::Parameter::SPOT_LIGHT_SHADOW_FAR
+	}
+}};
+
 void SceneShaderBindingC::update(const Scene* scene) const noexcept
 {
 	if (getTarget() == nullptr || scene == nullptr)
 	{
 		return;
 	}
-	getTarget()->bind();
-	updateLights(*scene);
+
+	GLTUT_CATCH_ALL_BEGIN
+		updateLights(*scene);
+	GLTUT_CATCH_ALL_END("Failed to update the scene shader binding")
 }
 
-void SceneShaderBindingC::updateLight(
-	const LightNode& light,
-	u32 lightInd,
-	SceneBinding::Parameter position,
-	SceneBinding::Parameter ambientColor,
-	SceneBinding::Parameter diffuseColor,
-	SceneBinding::Parameter specularColor) const noexcept
+SceneShaderBindingC::LightSlot& SceneShaderBindingC::getLightSlot(
+	LightNode::Type type,
+	u32 index) const
+{
+	const u32 typeIndex = static_cast<u32>(type);
+	GLTUT_ASSERT(typeIndex < LIGHT_TYPE_COUNT);
+
+	auto& slots = mLightSlots[typeIndex];
+	while (slots.size() <= index)
+	{
+		const u32 slotIndex = static_cast<u32>(slots.size());
+		LightSlot slot;
+		for (u32 i = 0; i < LIGHT_PARAMETER_COUNT; ++i)
+		{
+			const SceneBinding::Parameter parameter = SCENE_PARAMETERS[typeIndex][i];
+			const std::string name = parameter != NO_PARAMETER ?
+				getFullParameter(getShaderParameterParts(parameter), slotIndex) :
+				std::string();
+
+			slot.locations[i] = name.empty() ? -1 : getTarget()->getParameterLocation(name.c_str());
+		}
+		slots.push_back(slot);
+	}
+	return slots[index];
+}
+
+void SceneShaderBindingC::setLight(
+	const LightSlot& slot,
+	const LightNode& light) const noexcept
 {
 	Shader* shader = getTarget();
 	GLTUT_ASSERT(shader != nullptr);
 
-	setVector3(
-		*shader,
-		getShaderParameterParts(position),
-		lightInd,
-		light.getGlobalTransform().getTranslation());
-
-	setVector3(
+	const auto location = [&slot](LightParameter parameter)
+	{
+		return slot.locations[static_cast<u32>(parameter)];
+	};
+
+	setVector3(*shader, location(LightParameter::POSITION), light.getGlobalTransform().getTranslation());
+	setVector3(*shader, location(LightParameter::DIRECTION), light.getGlobalDirection());
+	setVector3(*shader, location(LightParameter::AMBIENT_COLOR), toVector3(light.getAmbient()));
+	setVector3(*shader, location(LightParameter::DIFFUSE_COLOR), toVector3(light.getDiffuse()));
+	setVector3(*shader, location(LightParameter::SPECULAR_COLOR), toVector3(light.getSpecular()));
+	setFloat(*shader, location(LightParameter::LINEAR_ATTENUATION), light.getLinearAttenuation());
+	setFloat(*shader, location(LightParameter::QUADRATIC_ATTENUATION), light.getQuadraticAttenuation());
+	setFloat(*shader, location(LightParameter::INNER_ANGLE_COS), std::cos(light.getInnerAngle()));
+	setFloat(*shader, location(LightParameter::OUTER_ANGLE_COS), std::cos(light.getOuterAngle()));
+
+	const ShadowMap* shadowMap = light.getShadowMap();
+	setMatrix4(
 		*shader,
-		getShaderParameterParts(ambientColor),
-		lightInd,
-		toVector3(light.getAmbient()));
+		location(LightParameter::SHADOW_MATRIX),
+		// The zero matrix without a shadow map
+		shadowMap != nullptr ? shadowMap->getShadowMatrix() : Matrix4());
 
-	setVector3(
+	setFloat(
 		*shader,
-		getShaderParameterParts(diffuseColor),
-		lightInd,
-		toVector3(light.getDiffuse()));
+		location(LightParameter::SHADOW_NEAR),
+		shadowMap != nullptr ? shadowMap->getFrustumNear() : 0.0f);
 
-	setVector3(
+	setFloat(
 		*shader,
-		getShaderParameterParts(specularColor),
-		lightInd,
-		toVector3(light.getSpecular()));
+		location(LightParameter::SHADOW_FAR),
+		shadowMap != nullptr ? shadowMap->getFrustumFar() : 0.0f);
 }
 
 void SceneShaderBindingC::updateLights(const Scene& scene) const
@@ -125,10 +207,18 @@ void SceneShaderBindingC::updateLights(const Scene& scene) const
 	Shader* shader = getTarget();
 	GLTUT_ASSERT(shader != nullptr);
 
-	u32 directionalInd = 0;
-	u32 pointInd = 0;
-	u32 spotInd = 0;
+	// The new target or parameter names invalidate the locations
+	if (mLightSlotsVersion != getVersion())
+	{
+		for (auto& slots : mLightSlots)
+		{
+			slots.clear();
+		}
+		mLightSlotsVersion = getVersion();
+	}
 
+	std::array<u32, LIGHT_TYPE_COUNT> typeIndices{};
+	bool shaderBound = false;
 	for (u32 lightInd = 0; lightInd < scene.getLightCount(); ++lightInd)
 	{
 		const LightNode* light = scene.getLight(lightInd);
@@ -137,127 +227,30 @@ void SceneShaderBindingC::updateLights(const Scene& scene) const
 			continue;
 		}
 
-		switch (light->getType())
-		{
-		case LightNode::Type::DIRECTIONAL:
-		{
-			updateLight(
-				*light,
-				directionalInd,
-				SceneBinding::Parameter::DIRECTIONAL_LIGHT_POSITION,
-				SceneBinding::Parameter::DIRECTIONAL_LIGHT_AMBIENT_COLOR,
-				SceneBinding::Parameter::DIRECTIONAL_LIGHT_DIFFUSE_COLOR,
-				SceneBinding::Parameter::DIRECTIONAL_LIGHT_SPECULAR_COLOR);
+		const LightNode::Type type = light->getType();
+		LightSlot& slot = getLightSlot(type, typeIndices[static_cast<u32>(type)]++);
 
-			setVector3(
-				*shader,
-				getShaderParameterParts(SceneBinding::Parameter::DIRECTIONAL_LIGHT_DIRECTION),
-				lightInd,
-				light->getGlobalDirection());
+		const u64 shadowVersion = light->getShadowMap() != nullptr ?
+			light->getShadowMap()->getVersion() :
+			0;
 
-			setMatrix4(
-				*shader,
-				getShaderParameterParts(SceneBinding::Parameter::DIRECTIONAL_LIGHT_SHADOW_MATRIX),
-				directionalInd,
-				light->getShadowMap() != nullptr ? light->getShadowMap()->getShadowMatrix() :
-												 // Set zero matrix
-					Matrix4());
-			++directionalInd;
-		}
-		break;
-
-		case LightNode::Type::POINT:
+		if (slot.light == light &&
+			slot.version == light->getVersion() &&
+			slot.shadowVersion == shadowVersion)
 		{
-			updateLight(
-				*light,
-				pointInd,
-				SceneBinding::Parameter::POINT_LIGHT_POSITION,
-				SceneBinding::Parameter::POINT_LIGHT_AMBIENT_COLOR,
-				SceneBinding::Parameter::POINT_LIGHT_DIFFUSE_COLOR,
-				SceneBinding::Parameter::POINT_LIGHT_SPECULAR_COLOR);
-
-			setFloat(
-				*shader,
-				getShaderParameterParts(SceneBinding::Parameter::POINT_LIGHT_LINEAR_ATTENUATION),
-				spotInd,
-				light->getLinearAttenuation());
-
-			setFloat(
-				*shader,
-				getShaderParameterParts(SceneBinding::Parameter::POINT_LIGHT_QUADRATIC_ATTENUATION),
-				spotInd,
-				light->getQuadraticAttenuation());
-
-			++pointInd;
+			continue;
 		}
-		break;
 
-		case LightNode::Type::SPOT:
+		if (!shaderBound)
 		{
-			updateLight(
-				*light,
-				spotInd,
-				SceneBinding::Parameter::SPOT_LIGHT_POSITION,
-				SceneBinding::Parameter::SPOT_LIGHT_AMBIENT_COLOR,
-				SceneBinding::Parameter::SPOT_LIGHT_DIFFUSE_COLOR,
-				SceneBinding::Parameter::SPOT_LIGHT_SPECULAR_COLOR);
-
-			setVector3(
-				*shader,
-				getShaderParameterParts(SceneBinding::Parameter::SPOT_LIGHT_DIRECTION),
-				spotInd,
-				light->getGlobalDirection());
-
-			setFloat(
-				*shader,
-				getShaderParameterParts(SceneBinding::Parameter::SPOT_LIGHT_INNER_ANGLE_COS),
-				spotInd,
-				std::cos(light->getInnerAngle()));
-
-			setFloat(
-				*shader,
-				getShaderParameterParts(SceneBinding::Parameter::SPOT_LIGHT_OUTER_ANGLE_COS),
-				spotInd,
-				std::cos(light->getOuterAngle()));
-
-			setFloat(
-				*shader,
-				getShaderParameterParts(SceneBinding::Parameter::SPOT_LIGHT_LINEAR_ATTENUATION),
-				spotInd,
-				light->getLinearAttenuation());
-
-			setFloat(
-				*shader,
-				getShaderParameterParts(SceneBinding::Parameter::SPOT_LIGHT_QUADRATIC_ATTENUATION),
-				spotInd,
-				light->getQuadraticAttenuation());
-
-			setMatrix4(
-				*shader,
-				getShaderParameterParts(SceneBinding::Parameter::SPOT_LIGHT_SHADOW_MATRIX),
-				spotInd,
-				light->getShadowMap() != nullptr ? light->getShadowMap()->getShadowMatrix() :
-												 // Set zero matrix
-					Matrix4());
-
-			setFloat(
-				*shader,
-				getShaderParameterParts(SceneBinding::Parameter::SPOT_LIGHT_SHADOW_NEAR),
-				spotInd,
-				light->getShadowMap() != nullptr ? light->getShadowMap()->getFrustumNear() : 0.0f);
-
-			setFloat(
-				*shader,
-				getShaderParameterParts(SceneBinding::Parameter::SPOT_LIGHT_SHADOW_FAR),
-				spotInd,
-				light->getShadowMap() != nullptr ? light->getShadowMap()->getFrustumFar() : 0.0f);
-
-			++spotInd;
+			shader->bind();
+			shaderBound = true;
 		}
-		break;
 
-			GLTUT_UNEXPECTED_SWITCH_DEFAULT_CASE(light->getType())
-		}
+		setLight(slot, *light);
+		slot.light = light;
+		slot.version = light->getVersion();
+		slot.shadowVersion = shadowVersion;
 	}
 }
 
@@ -5,6 +5,9 @@
 #pragma once
 
 // Includes
+#include <array>
+#include <vector>
+
 #include "engine/scene/Scene.h"
 
 #include "../../graphics/shader/ShaderBindingT.h"
@@ -12,7 +15,11 @@
 namespace gltut
 {
 // Global classes
-/// Implementation of the SceneShaderBinding interface
+/**
+	\brief Implementation of the SceneShaderBinding interface.
+	The uniform locations of a light are resolved once, when the light index first appears,
+	and a light is set to the shader only when its version or the version of its shadow map changes
+*/
 class SceneShaderBindingC final : public ShaderBindingT<SceneShaderBinding, SceneBinding::Parameter>
 {
 public:
@@ -23,17 +30,65 @@ public:
 	void update(const Scene* scene) const noexcept final;
 
 private:
-	/// Update the shader for a light
-	void updateLight(
-		const LightNode& light,
-		u32 lightInd,
-		SceneBinding::Parameter position,
-		SceneBinding::Parameter ambientColor,
-		SceneBinding::Parameter diffuseColor,
-		SceneBinding::Parameter specularColor) const noexcept;
+	/// The light parameters set to the shader
+	enum class LightParameter
+	{
+		POSITION,
+		DIRECTION,
+		AMBIENT_COLOR,
+		DIFFUSE_COLOR,
+		SPECULAR_COLOR,
+		LINEAR_ATTENUATION,
+		QUADRATIC_ATTENUATION,
+		INNER_ANGLE_COS,
+		OUTER_ANGLE_COS,
+		SHADOW_MATRIX,
+		SHADOW_NEAR,
+		SHADOW_FAR,
+		TOTAL_COUNT
+	};
+
+	/// The number of the light parameters
+	static constexpr u32 LIGHT_PARAMETER_COUNT = static_cast<u32>(LightParameter::TOTAL_COUNT);
+
+	/// The number of the light types
+	static constexpr u32 LIGHT_TYPE_COUNT = 3;
+
+	/// A light of the shader
+	struct LightSlot
+	{
+		/// The uniform locations of the light parameters, -1 for the unbound ones
+		std::array<int32, LIGHT_PARAMETER_COUNT> locations;
+
+		/// The light set to the slot
+		const LightNode* light = nullptr;
+
+		/// The version of the light set to the slot
+		u64 version = 0;
+
+		/// The version of the shadow map set to the slot, 0 for no shadow map
+		u64 shadowVersion = 0;
+	};
+
+	/// Returns the slot of the index-th light of a type, resolves the slot locations on the first call
+	LightSlot& getLightSlot(LightNode::Type type, u32 index) const;
+
+	/// Sets a light to the shader
+	void setLight(const LightSlot& slot, const LightNode& light) const noexcept;
 
 	/// Updates light binding
 	void updateLights(const Scene& scene) const;
+
+	/// The lights of the shader by the light types
+	mutable std::array<std::vector<LightSlot>, LIGHT_TYPE_COUNT> mLightSlots;
+
+	/// The scene parameters of the light parameters by the light types, TOTAL_COUNT for the missing ones
+	static const std::array<
+		std::array<SceneBinding::Parameter, LIGHT_PARAMETER_COUNT>,
+		LIGHT_TYPE_COUNT> SCENE_PARAMETERS;
+
+	/// The version of the binding the light slots are resolved for
+	mutable u64 mLightSlotsVersion = 0;
 };
 
 // End of the namespace gltut
@@ -0,0 +1,84 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+// Includes
+#include "HeadlessWindowC.h"
+
+#include <algorithm>
+
+#include "engine/core/Check.h"
+
+namespace gltut
+{
+// Global classes
+HeadlessWindowC::HeadlessWindowC(
+	u32 width,
+	u32 height) :
+
+	mSize(width, height)
+{
+	GLTUT_CHECK(width > 0, "Window width must be greater than 0");
+	GLTUT_CHECK(height > 0, "Window height must be greater than 0");
+}
+
+void HeadlessWindowC::setTitle(const char* title) noexcept
+{
+	GLTUT_CATCH_ALL_BEGIN
+	mTitle = title != nullptr ? title : "";
+	GLTUT_CATCH_ALL_END("Failed to set the window title")
+}
+
+void HeadlessWindowC::addEventHandler(EventHandler* handler, bool inFront) noexcept
+{
+	if (!GLTUT_ASSERT(handler != nullptr) ||
+		!GLTUT_ASSERT(std::find(
+						  mEventHandlers.begin(),
+						  mEventHandlers.end(),
+						  handler) == mEventHandlers.end()))
+	{
+		return;
+	}
+
+	try
+	{
+		if (inFront)
+		{
+			mEventHandlers.push_front(handler);
+		}
+		else
+		{
+			mEventHandlers.push_back(handler);
+		}
+	}
+	GLTUT_CATCH_ALL("Failed to add an event handler")
+}
+
+void HeadlessWindowC::removeEventHandler(EventHandler* handler) noexcept
+{
+	auto findResult = std::find(
+		mEventHandlers.begin(),
+		mEventHandlers.end(),
+		handler);
+
+	if (findResult != mEventHandlers.end())
+	{
+		mEventHandlers.erase(findResult);
+	}
+}
+
+bool HeadlessWindowC::update() noexcept
+{
+	if (u32 fps = static_cast<u32>(mFPSCounter.tick()))
+	{
+		mFPS = fps;
+		if (mShowFPS)
+		{
+			std::cout << mTitle << " [FPS: " << mFPS << "]" << std::endl;
+		}
+	}
+	return true;
+}
+
+// End of the namespace gltut
+}
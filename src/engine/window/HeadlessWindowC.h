@@ -0,0 +1,109 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include <deque>
+#include <string>
+
+#include "../core/FPSCounter.h"
+#include "./WindowBase.h"
+
+namespace gltut
+{
+// Global classes
+/**
+	\brief Window implementation without a native window.
+	Used for offscreen rendering: it has a fixed size, no device context
+	and never receives input events.
+*/
+class HeadlessWindowC final : public WindowBase
+{
+public:
+	/// Constructor
+	HeadlessWindowC(u32 width, u32 height);
+
+	/// Sets the window title
+	void setTitle(const char* title) noexcept final;
+
+	/// Shows frames per second (FPS) in the window title
+	void showFPS(bool show) noexcept final
+	{
+		mShowFPS = show;
+	}
+
+	/// Returns the size of the window in pixels
+	const Point2u& getSize() const noexcept final
+	{
+		return mSize;
+	}
+
+	/// Returns the current frames per second (FPS)
+	u32 getFPS() noexcept final
+	{
+		return mFPS;
+	}
+
+	/// Adds an event handler
+	void addEventHandler(EventHandler* handler, bool inFront = false) noexcept final;
+
+	/// Removes an event handler. Does nothing if the handler is not found.
+	void removeEventHandler(EventHandler* handler) noexcept final;
+
+	/// Returns the virtual cursor position
+	Point2i getCursorPosition() const noexcept final
+	{
+		return mCursorPosition;
+	}
+
+	/// Sets the virtual cursor position
+	void setCursorPosition(const Point2i& position) noexcept final
+	{
+		mCursorPosition = position;
+	}
+
+	/// Returns nullptr, there is no native window
+	void* getHandle() const noexcept final
+	{
+		return nullptr;
+	}
+
+	/// Returns nullptr, there is no device context
+	void* getDeviceContext() const noexcept final
+	{
+		return nullptr;
+	}
+
+	/**
+		\brief Updates the FPS counter
+		\return Always true, a headless window cannot be closed
+	*/
+	bool update() noexcept final;
+
+private:
+	/// Event handlers
+	std::deque<EventHandler*> mEventHandlers;
+
+	/// FPS counter
+	FPSCounter mFPSCounter;
+
+	/// The size of the window
+	Point2u mSize;
+
+	/// The window title
+	std::string mTitle;
+
+	/// The virtual cursor position
+	Point2i mCursorPosition;
+
+	/// Show FPS flag
+	bool mShowFPS = false;
+
+	/// FPS
+	u32 mFPS = 0;
+};
+
+// End of the namespace gltut
+}
@@ -0,0 +1,26 @@
+// OpenGL tutorials and engine (https://github.com/dmitry-sapelnikov/opengl-tutorials)
+// SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+// Includes
+#include "engine/core/NonCopyable.h"
+#include "engine/window/Window.h"
+
+namespace gltut
+{
+// Global classes
+/// Base class for the window implementations
+class WindowBase : public Window, public NonCopyable
+{
+public:
+	/**
+		\brief Updates the window
+		\return True if the window is still open, false if the window is closed
+	*/
+	virtual bool update() noexcept = 0;
+};
+
+// End of the namespace gltut
+}
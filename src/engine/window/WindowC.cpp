@@ -2,6 +2,9 @@
 // SPDX-FileCopyrightText: 2024-2025 Dmitry Sapelnikov
 // SPDX-License-Identifier: MIT
 
+// Native windows are implemented only for Windows
+#ifdef _WIN32
+
 // Includes
 #include "WindowC.h"
 
@@ -401,3 +404,5 @@ void WindowC::updateSize() noexcept
 
 // End of the namespace gltut
 }
+
+#endif
@@ -10,10 +10,8 @@
 #include <memory>
 #include <string>
 
-#include "engine/core/NonCopyable.h"
-#include "engine/window/Window.h"
-
 #include "../core/FPSCounter.h"
+#include "./WindowBase.h"
 
 namespace gltut
 {
@@ -22,7 +20,7 @@ namespace gltut
 class WindowCallback;
 
 /// Implementation of the Window class
-class WindowC final : public Window, public NonCopyable
+class WindowC final : public WindowBase
 {
 public:
 	WindowC(u32 width, u32 height);
@@ -58,7 +56,7 @@ public:
 		\brief Updates the window
 		\return True if the window is still open, false if the window is closed
 	*/
-	bool update() noexcept;
+	bool update() noexcept final;
 
 	/// Returns the window handle
 	void* getHandle() const noexcept final
@@ -12,6 +12,7 @@
 #include <windows.h>
 
 #include "engine/Engine.h"
+#include "engine/core/CpuProfiler.h"
 #include "./imgui/imgui_impl_win32.h"
 #include "./imgui/imgui_impl_opengl3.h"
 
@@ -119,6 +120,8 @@ EngineImguiC::EngineImguiC(Engine& engine) :
 		false,
 		nullptr);
 
+	GLTUT_CHECK(mRenderPass != nullptr, "Failed to create the ImGui render pass");
+	mRenderPass->setName("ImGui");
 	engine.getRenderer()->setPassPriority(mRenderPass, std::numeric_limits<int>::max());
 
 	mEventHandler = std::make_unique<ImguiEventHandler>(
@@ -159,6 +162,150 @@ void EngineImguiC::newFrame() noexcept
 	GLTUT_CATCH_ALL_END("Failed to create new ImGui frame")
 }
 
+void EngineImguiC::showRenderProfile(bool* open) noexcept
+{
+	GLTUT_CATCH_ALL_BEGIN
+		RenderProfiler* profiler = mEngine.getRenderer()->getProfiler();
+		if (!ImGui::Begin("Render profile", open))
+		{
+			ImGui::End();
+			return;
+		}
+
+		if (!profiler->isSupported())
+		{
+			ImGui::TextUnformatted("The graphics device does not support the profiling");
+			ImGui::End();
+			return;
+		}
+
+		bool enabled = profiler->isEnabled();
+		if (ImGui::Checkbox("Enabled", &enabled))
+		{
+			profiler->setEnabled(enabled);
+		}
+
+		ImGui::SameLine();
+		if (ImGui::Button("Save CSV"))
+		{
+			profiler->saveCsv("render_profile.csv");
+		}
+
+		ImGui::SameLine();
+		if (ImGui::Button("Save JSON"))
+		{
+			profiler->saveJson("render_profile.json");
+		}
+
+		ImGui::Text("GPU frame time: %.3f ms", profiler->getFrameTime());
+
+		const bool statistics = profiler->hasPipelineStatistics();
+		const int columnCount = statistics ? 7 : 4;
+		if (ImGui::BeginTable(
+			"Passes",
+			columnCount,
+			ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+		{
+			ImGui::TableSetupColumn("Pass");
+			ImGui::TableSetupColumn("Time, ms");
+			ImGui::TableSetupColumn("Average, ms");
+			ImGui::TableSetupColumn("Max, ms");
+			if (statistics)
+			{
+				ImGui::TableSetupColumn("Vertices");
+				ImGui::TableSetupColumn("Primitives");
+				ImGui::TableSetupColumn("Fragments");
+			}
+			ImGui::TableHeadersRow();
+
+			for (u32 i = 0; i < profiler->getPassCount(); ++i)
+			{
+				const RenderPassProfile* pass = profiler->getPass(i);
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(pass->pass->getName());
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", pass->time);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", pass->averageTime);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", pass->maxTime);
+				if (statistics)
+				{
+					ImGui::TableNextColumn();
+					ImGui::Text("%llu", static_cast<unsigned long long>(pass->vertices));
+					ImGui::TableNextColumn();
+					ImGui::Text("%llu", static_cast<unsigned long long>(pass->primitives));
+					ImGui::TableNextColumn();
+					ImGui::Text("%llu", static_cast<unsigned long long>(pass->fragments));
+				}
+			}
+			ImGui::EndTable();
+		}
+
+		const RenderPassStatistics& frame = mEngine.getRenderer()->getStatistics()->getFrame();
+		ImGui::Text(
+			"Draw calls: %llu, triangles: %llu, objects: %llu, culled: %llu",
+			static_cast<unsigned long long>(frame.drawCalls),
+			static_cast<unsigned long long>(frame.triangles),
+			static_cast<unsigned long long>(frame.submittedObjects),
+			static_cast<unsigned long long>(frame.culledObjects));
+		ImGui::Text(
+			"Shaders: %llu, textures: %llu, uniforms: %llu, framebuffers: %llu",
+			static_cast<unsigned long long>(frame.shaderSwitches),
+			static_cast<unsigned long long>(frame.textureBinds),
+			static_cast<unsigned long long>(frame.uniformUploads),
+			static_cast<unsigned long long>(frame.framebufferSwitches));
+		ImGui::Text("CPU submission time: %.3f ms", frame.submissionTime);
+
+		CpuProfiler* cpuProfiler = getCpuProfiler();
+		bool cpuEnabled = cpuProfiler->isEnabled();
+		if (ImGui::Checkbox("CPU zones", &cpuEnabled))
+		{
+			cpuProfiler->setEnabled(cpuEnabled);
+		}
+
+		ImGui::SameLine();
+		if (ImGui::Button("Save trace"))
+		{
+			cpuProfiler->saveChromeTrace("cpu_trace.json");
+		}
+
+		ImGui::Text(
+			"CPU frame time: %.3f ms, dropped zones: %llu",
+			cpuProfiler->getFrameTime(),
+			static_cast<unsigned long long>(cpuProfiler->getDroppedZoneCount()));
+
+		if (ImGui::BeginTable(
+			"Zones",
+			4,
+			ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+		{
+			ImGui::TableSetupColumn("Zone");
+			ImGui::TableSetupColumn("Calls");
+			ImGui::TableSetupColumn("Time, ms");
+			ImGui::TableSetupColumn("Max, ms");
+			ImGui::TableHeadersRow();
+
+			for (u32 i = 0; i < cpuProfiler->getZoneCount(); ++i)
+			{
+				const CpuProfileZone* zone = cpuProfiler->getZone(i);
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(zone->name);
+				ImGui::TableNextColumn();
+				ImGui::Text("%u", zone->count);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", zone->time);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", zone->maxTime);
+			}
+			ImGui::EndTable();
+		}
+		ImGui::End();
+	GLTUT_CATCH_ALL_END("Failed to show the render profile")
+}
+
 // Global functions
 EngineImgui* createEngineImgui(Engine* engine) noexcept
 {
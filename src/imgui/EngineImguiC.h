@@ -21,6 +21,9 @@ public:
 	/// Creates a new Imgui frame
 	void newFrame() noexcept final;
 
+	/// Shows the window with the GPU profiles of the render passes and the CPU profiling zones
+	void showRenderProfile(bool* open) noexcept final;
+
 private:
 	Engine& mEngine;
 
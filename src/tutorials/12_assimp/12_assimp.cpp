@@ -11,6 +11,8 @@
 #include "asset_loader/AssetLoader.h"
 #include "engine/Engine.h"
 #include "engine/core/Check.h"
+#include "engine/core/CpuProfiler.h"
+#include "engine/factory/material/MaterialPassIndex.h"
 #include "engine/math/Rng.h"
 
 #include "imgui/EngineImgui.h"
@@ -18,6 +20,13 @@
 namespace
 {
 // Local constants
+/// The number of the simplified levels of detail of the backpack meshes
+constexpr gltut::u32 BACKPACK_LOD_COUNT = 3;
+
+/// The minimum shading cost of the materials drawn after the depth pre-pass,
+/// the shadowed normal-mapped backpack costs 12 texture samples per fragment
+constexpr float DEPTH_PRE_PASS_MIN_COST = 10.0f;
+
 /// The number of directional lights in the scene
 constexpr size_t DIRECTIONAL_LIGHT_COUNT = 2;
 
@@ -146,10 +155,18 @@ int main()
 	auto* backpack = assetLoader->loadAsset(
 		"assets/backpack/backpack.obj",
 		assetMaterialFactory,
-		true);
+		true,
+		BACKPACK_LOD_COUNT);
 	GLTUT_CHECK(backpack, "Failed to load backpack asset");
 	backpack->setTransform(gltut::Matrix4::scaleMatrix({2.0f, 2.0f, 2.0f}));
 
+	gltut::RenderPass* scenePass = engine->getSceneRenderPass();
+	scenePass->enableDepthPrePass(
+		static_cast<gltut::u32>(gltut::MaterialPassIndex::DEPTH),
+		DEPTH_PRE_PASS_MIN_COST);
+	bool depthPrePass = true;
+	bool showRenderProfile = false;
+
 	std::vector<gltut::GeometryNode*> lights;
 	std::vector<gltut::LightNode*> lightSources;
 	std::vector<gltut::ShadowMap*> shadows;
@@ -187,6 +204,27 @@ int main()
 		ImGui::Text("FPS: %u", engine->getWindow()->getFPS());
 		ImGui::Text("Time: %.2f seconds", time);
 
+		if (ImGui::Checkbox("Depth Pre-Pass", &depthPrePass))
+		{
+			if (depthPrePass)
+			{
+				scenePass->enableDepthPrePass(
+					static_cast<gltut::u32>(gltut::MaterialPassIndex::DEPTH),
+					DEPTH_PRE_PASS_MIN_COST);
+			}
+			else
+			{
+				scenePass->disableDepthPrePass();
+			}
+		}
+		ImGui::Text("Pre-passed: %u", scenePass->getDepthPrePassCount());
+
+		if (ImGui::Checkbox("Render Profile", &showRenderProfile))
+		{
+			engine->getRenderer()->getProfiler()->setEnabled(showRenderProfile);
+			gltut::getCpuProfiler()->setEnabled(showRenderProfile);
+		}
+
 		// Right azimuth numeric control with range 0 to 360 degrees
 		bool azimuthChanged = ImGui::SliderFloat(
 			"Light Azimuth",
@@ -228,6 +266,16 @@ int main()
 
 		ImGui::End();
 
+		if (showRenderProfile)
+		{
+			imgui->showRenderProfile(&showRenderProfile);
+			if (!showRenderProfile)
+			{
+				engine->getRenderer()->getProfiler()->setEnabled(false);
+				gltut::getCpuProfiler()->setEnabled(false);
+			}
+		}
+
 		if (!engine->update())
 		{
 			break;
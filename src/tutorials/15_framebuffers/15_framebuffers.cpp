@@ -145,18 +145,15 @@ int main()
 		gltut::Color clearColor(0.1f, 0.1f, 0.1f);
 
 		engine->getRenderer()->removeAllPasses();
-		auto* colorTexture = engine->getFactory()->getTexture()->createWindowSizeTexture(
-			gltut::TextureFormat::RGBA);
-		GLTUT_CHECK(colorTexture != nullptr, "Failed to create color texture");
 
-		auto* depthTexture = engine->getFactory()->getTexture()->createWindowSizeTexture(
-			gltut::TextureFormat::FLOAT);
-		GLTUT_CHECK(depthTexture != nullptr, "Failed to create depth texture");
-
-		auto* framebuffer = renderer->getDevice()->getFramebuffers()->create(
-			colorTexture,
-			depthTexture);
+		// The renderer allocates the textures of the window size while an effect pass reads them
+		const gltut::TextureFormat colorFormat = gltut::TextureFormat::RGBA;
+		auto* framebuffer = renderer->createTransientTarget(
+			nullptr,
+			&colorFormat,
+			true);
 		GLTUT_CHECK(framebuffer, "Failed to create framebuffer");
+		const gltut::Texture* colorTexture = framebuffer->getColor();
 
 		auto* renderToTexturePass = renderer->createPass(
 			scene->getActiveCameraViewpoint(),
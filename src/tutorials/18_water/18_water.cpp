@@ -477,31 +477,17 @@ std::unique_ptr<gltut::CameraController> createCameraAndController(gltut::Engine
 	return controller;
 }
 
-/// Creates a texture framebuffer. \todo (Dmitry): move it to the engine factory
+/**
+	\brief Creates a window-size framebuffer.
+	The renderer allocates its textures and executes the passes writing it before the water pass reading them
+*/
 gltut::TextureFramebuffer* createTextureFramebuffer(gltut::Engine& engine, bool useColor, bool useDepth)
 {
-	gltut::Factory* factory = engine.getFactory();
-
-	gltut::Texture2* colorTexture = nullptr;
-	if (useColor)
-	{
-		colorTexture = factory->getTexture()->createWindowSizeTexture(
-			gltut::TextureFormat::RGBA);
-		GLTUT_CHECK(colorTexture != nullptr, "Failed to create color texture");
-	}
-
-	gltut::Texture2* depthTexture = nullptr;
-
-	if (useDepth)
-	{
-		depthTexture = factory->getTexture()->createWindowSizeTexture(
-			gltut::TextureFormat::FLOAT);
-		GLTUT_CHECK(depthTexture != nullptr, "Failed to create depth texture");
-	}
-
-	gltut::TextureFramebuffer* framebuffer = engine.getRenderer()->getDevice()->getFramebuffers()->create(
-		colorTexture,
-		depthTexture);
+	const gltut::TextureFormat colorFormat = gltut::TextureFormat::RGBA;
+	gltut::TextureFramebuffer* framebuffer = engine.getRenderer()->createTransientTarget(
+		nullptr,
+		useColor ? &colorFormat : nullptr,
+		useDepth);
 	GLTUT_CHECK(framebuffer, "Failed to create framebuffer");
 
 	return framebuffer;